@@ -0,0 +1,60 @@
+#
+# Convert binary log file (BinaryLogSink) to CSV log file
+#
+# arg[1] : binary_file : path to the binary log file. ex. ../../data/sample/logs/logs_220627_142946/220627_142946_default.bin
+# arg[2] : --output : path to the output CSV file. The extension of the input file is replaced with .csv by default.
+#
+
+#
+# Import
+#
+import os
+import sys
+import struct
+import argparse
+from array import array
+
+MAGIC = b'S2EBLOG\0'
+FORMAT_VERSION = 1
+
+def read_binary_log(read_file_name):
+  with open(read_file_name, 'rb') as f:
+    magic = f.read(len(MAGIC))
+    if magic != MAGIC:
+      raise ValueError(read_file_name + ' is not a S2E binary log file')
+    version, number_of_columns = struct.unpack('<II', f.read(8))
+    if version != FORMAT_VERSION:
+      raise ValueError('Unsupported binary log format version: ' + str(version))
+    column_names = []
+    for _ in range(number_of_columns):
+      length, = struct.unpack('<I', f.read(4))
+      column_names.append(f.read(length).decode('utf-8'))
+    data = f.read()
+    values = array('d')
+    values.frombytes(data[:len(data) - len(data) % values.itemsize])
+  if sys.byteorder != 'little':
+    values.byteswap()
+  # Drop the last incomplete record if the simulation was aborted while writing
+  number_of_records = len(values) // number_of_columns if number_of_columns > 0 else 0
+  records = [values[i * number_of_columns:(i + 1) * number_of_columns] for i in range(number_of_records)]
+  return column_names, records
+
+def write_csv(write_file_name, column_names, records):
+  with open(write_file_name, 'w') as f:
+    f.write(''.join(name + ',' for name in column_names) + '\n')
+    for record in records:
+      f.write(''.join(repr(value) + ',' for value in record) + '\n')
+
+# Arguments
+aparser = argparse.ArgumentParser()
+aparser.add_argument('binary_file', type=str, help='path to the binary log file')
+aparser.add_argument('--output', type=str, help='path to the output CSV file', default=None)
+args = aparser.parse_args()
+
+output_file = args.output
+if output_file is None:
+  output_file = os.path.splitext(args.binary_file)[0] + '.csv'
+
+column_names, records = read_binary_log(args.binary_file)
+write_csv(output_file, column_names, records)
+print('Converted ' + str(len(records)) + ' records to ' + output_file)
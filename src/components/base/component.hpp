@@ -61,9 +61,6 @@ class Component : public ITickable {
   virtual void FastTick(const unsigned int fast_count);
 
  protected:
-  unsigned int prescaler_;           //!< Frequency scale factor for normal update
-  unsigned int fast_prescaler_ = 1;  //!< Frequency scale factor for fast update
-
   /**
    * @fn MainRoutine
    * @brief Pure virtual function periodically executed when the power switch is on.
@@ -6,6 +6,8 @@
 #ifndef S2E_COMPONENTS_BASE_CLASSES_INTERFACE_TICKABLE_HPP_
 #define S2E_COMPONENTS_BASE_CLASSES_INTERFACE_TICKABLE_HPP_
 
+#include <atomic>
+
 /**
  * @class ITickable
  * @brief Interface class for time update of components
@@ -34,10 +36,37 @@ class ITickable {
    * @fn SetNeedsFastUpdate
    * @brief Set fast update flag
    */
-  inline void SetNeedsFastUpdate(const bool need_fast_update) { needs_fast_update_ = need_fast_update; }
+  inline void SetNeedsFastUpdate(const bool need_fast_update) {
+    needs_fast_update_ = need_fast_update;
+    fast_update_setting_version_++;
+  }
+  /**
+   * @fn GetFastUpdateSettingVersion
+   * @brief Return the number of the calls of SetNeedsFastUpdate of all instances
+   * @note The clock generator uses this to detect the change of the fast update flags
+   */
+  static inline unsigned int GetFastUpdateSettingVersion() { return fast_update_setting_version_.load(std::memory_order_relaxed); }
+
+  /**
+   * @fn GetPrescaler
+   * @brief Return frequency scale factor for normal update
+   * @note The clock generator calls Tick only when the count is a multiple of the prescaler
+   */
+  inline unsigned int GetPrescaler() const { return prescaler_; }
+  /**
+   * @fn GetFastPrescaler
+   * @brief Return frequency scale factor for fast update
+   * @note The clock generator calls FastTick only when the count is a multiple of the fast prescaler
+   */
+  inline unsigned int GetFastPrescaler() const { return fast_prescaler_; }
 
  protected:
-  bool needs_fast_update_ = false;  //!< Whether or not high-frequency disturbances need to be calculated
+  bool needs_fast_update_ = false;   //!< Whether or not high-frequency disturbances need to be calculated
+  unsigned int prescaler_ = 1;       //!< Frequency scale factor for normal update
+  unsigned int fast_prescaler_ = 1;  //!< Frequency scale factor for fast update
+
+ private:
+  static inline std::atomic<unsigned int> fast_update_setting_version_{0};  //!< Number of the calls of SetNeedsFastUpdate
 };
 
 #endif  // S2E_COMPONENTS_BASE_CLASSES_INTERFACE_TICKABLE_HPP_
@@ -32,6 +32,10 @@ std::string AngularVelocityObserver::GetLogValue() const {
   return str_tmp;
 }
 
+void AngularVelocityObserver::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, angular_velocity_b_rad_s_);
+}
+
 AngularVelocityObserver InitializeAngularVelocityObserver(ClockGenerator* clock_generator, const std::string file_name, double component_step_time_s,
                                                           const Attitude& attitude) {
   IniAccess ini_file(file_name);
@@ -51,6 +51,11 @@ class AngularVelocityObserver : public Component, public Sensor<3>, public ILogg
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const override;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const override;
 
   // Getter
   /**
@@ -47,6 +47,10 @@ std::string AttitudeObserver::GetLogValue() const {
   return str_tmp;
 }
 
+void AttitudeObserver::AppendLogValue(std::vector<double>& values) const {
+  AppendQuaternion(values, observed_quaternion_i2b_);
+}
+
 AttitudeObserver InitializeAttitudeObserver(ClockGenerator* clock_generator, const std::string file_name, const Attitude& attitude) {
   // General
   IniAccess ini_file(file_name);
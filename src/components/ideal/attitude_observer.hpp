@@ -52,6 +52,11 @@ class AttitudeObserver : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const override;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const override;
 
   /**
    * @fn GetQuaternion_i2c
@@ -58,6 +58,11 @@ class ForceGenerator : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
   // Getter
   /**
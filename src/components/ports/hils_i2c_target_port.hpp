@@ -7,6 +7,7 @@
 #define S2E_COMPONENTS_PORTS_HILS_I2C_TARGET_PORT_HPP_
 
 #include <map>
+#include <string>
 
 #include "hils_uart_port.hpp"
 
@@ -31,6 +32,12 @@ class HilsI2cTargetPort : public HilsUartPort {
    * @param [in] max_register_number: Maximum register number
    */
   HilsI2cTargetPort(const unsigned int port_id, const unsigned char max_register_number);
+  /**
+   * @fn HilsI2cTargetPort
+   * @brief Constructor
+   * @param [in] port_name: Port name like "COM4" on Windows or device path like "/dev/ttyUSB0" on Linux
+   */
+  HilsI2cTargetPort(const std::string port_name);
   /**
    * @fn ~HilsI2cTargetPort
    * @brief Destructor
@@ -93,11 +100,11 @@ class HilsI2cTargetPort : public HilsUartPort {
   int GetStoredFrameCounter();
 
  private:
-  const unsigned int kDefaultCommandSize = 0xff;  //!< Default command size
-  const unsigned int kDefaultTxSize = 0xff;       //!< Default TX size
-  unsigned char max_register_number_ = 0xff;      //!< Maximum register number
-  unsigned char saved_register_address_ = 0x00;   //!< Saved register address
-  unsigned int stored_frame_counter_ = 0;         //!< Send a few frames of telemetry to the converter in advance.
+  static const unsigned int kDefaultCommandSize = 0xff;  //!< Default command size
+  static const unsigned int kDefaultTxSize = 0xff;       //!< Default TX size
+  unsigned char max_register_number_ = 0xff;             //!< Maximum register number
+  unsigned char saved_register_address_ = 0x00;          //!< Saved register address
+  unsigned int stored_frame_counter_ = 0;                //!< Send a few frames of telemetry to the converter in advance.
 
   /** @brief Device register: < register address, value>  **/
   std::map<unsigned char, unsigned char> device_registers_;
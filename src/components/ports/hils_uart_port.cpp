@@ -1,7 +1,7 @@
 ﻿/**
  * @file hils_uart_port.cpp
  * @brief Class to manage PC's COM port
- * @details Currently, this feature supports Windows Visual Studio only.(FIXME)
+ * @details This implementation supports Windows Visual Studio only with C++/CLI. See hils_uart_port_posix.cpp for Linux.
  * Reference: https://docs.microsoft.com/en-us/dotnet/api/system.io.ports.serialport?view=netframework-4.7.2
  * @note TODO :We need to clarify the difference with ComPortInterface
  */
@@ -20,6 +20,16 @@ HilsUartPort::HilsUartPort(const unsigned int port_id, const unsigned int baud_r
   Initialize();
 }
 
+HilsUartPort::HilsUartPort(const std::string port_name, const unsigned int baud_rate, const unsigned int tx_buffer_size,
+                           const unsigned int rx_buffer_size)
+    : kPortName(port_name), baud_rate_(baud_rate), kTxBufferSize(tx_buffer_size), kRxBufferSize(rx_buffer_size) {
+  // Allocate managed arrays.
+  tx_buffer_ = gcnew bytearray(kTxBufferSize);
+  rx_buffer_ = gcnew bytearray(kRxBufferSize);
+
+  Initialize();
+}
+
 HilsUartPort::~HilsUartPort() {
   // Memory allocated by gcnew does not have to be explicitly deleted.
 }
@@ -1,20 +1,27 @@
 /**
  * @file hils_uart_port.hpp
  * @brief Class to manage PC's COM port
- * @details Currently, this feature supports Windows Visual Studio only.(FIXME)
+ * @details On Windows, this feature supports Visual Studio only with C++/CLI (hils_uart_port.cpp).
  * Reference: https://docs.microsoft.com/en-us/dotnet/api/system.io.ports.serialport?view=netframework-4.7.2
+ * On Linux, the port is a serial device or a pseudo terminal managed by PosixSerialPort (hils_uart_port_posix.cpp).
  * @note TODO :We need to clarify the difference with ComPortInterface
  */
 
 #ifndef S2E_COMPONENTS_PORTS_HILS_UART_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_HILS_UART_PORT_HPP_
 
+#ifdef WIN32
 #include <msclr/gcroot.h>
 #include <msclr/marshal_cppstd.h>
+#else
+#include <library/communication/posix_serial_port.hpp>
+#endif
 
 #include <string>
 
+#ifdef WIN32
 typedef cli::array<System::Byte> bytearray;  //!< System::Byte: an 8-bit unsigned integer
+#endif
 
 /**
  * @class HilsUartPort
@@ -33,6 +40,15 @@ class HilsUartPort {
    * @param [in] rx_buffer_size: RX buffer size
    */
   HilsUartPort(const unsigned int port_id, const unsigned int baud_rate, const unsigned int tx_buffer_size, const unsigned int rx_buffer_size);
+  /**
+   * @fn HilsUartPort
+   * @brief Constructor.
+   * @param [in] port_name: Port name like "COM4" on Windows or device path like "/dev/ttyUSB0" on Linux
+   * @param [in] baud_rate: Baudrate of the COM port
+   * @param [in] tx_buffer_size: TX buffer size
+   * @param [in] rx_buffer_size: RX buffer size
+   */
+  HilsUartPort(const std::string port_name, const unsigned int baud_rate, const unsigned int tx_buffer_size, const unsigned int rx_buffer_size);
   /**
    * @fn ~HilsUartPort
    * @brief Destructor.
@@ -81,17 +97,21 @@ class HilsUartPort {
   const std::string kPortName;       //!< Port name like "COM4"
   unsigned int baud_rate_;           //!< Baud rate ex. 9600, 115200
 
+#ifdef WIN32
   // gcroot is the type-safe wrapper template to refer to a CLR object from the c++ heap reference:
   // https://docs.microsoft.com/en-us/cpp/dotnet/how-to-declare-handles-in-native-types?view=msvc-160
   msclr::gcroot<System::IO::Ports::SerialPort ^> port_;  //!< Port
   msclr::gcroot<bytearray ^> tx_buffer_;                 //!< TX Buffer
   msclr::gcroot<bytearray ^> rx_buffer_;                 //!< RX Buffer
+#else
+  PosixSerialPort port_;  //!< Port with the RX ring buffer
+#endif
 
   /**
    * @fn GetPortName
    * @brief Convert port id to port name
    * @param [in] port_id: Port ID like 4
-   * @return Port name like "COM4"
+   * @return Port name like "COM4" on Windows or "/dev/ttyS4" on Linux
    */
   static std::string GetPortName(const unsigned int port_id);
   /**
@@ -0,0 +1,69 @@
+/**
+ * @file hils_uart_port_posix.cpp
+ * @brief Class to manage PC's COM port
+ * @details This implementation supports Linux with POSIX termios. See hils_uart_port.cpp for Windows.
+ * The port can be a serial device like /dev/ttyUSB0 or a pseudo terminal like /dev/pts/3 made by socat.
+ */
+
+#include "hils_uart_port.hpp"
+
+#include <cstdio>
+
+// # define HILS_UART_PORT_SHOW_DEBUG_DATA
+
+HilsUartPort::HilsUartPort(const unsigned int port_id, const unsigned int baud_rate, const unsigned int tx_buffer_size,
+                           const unsigned int rx_buffer_size)
+    : HilsUartPort(GetPortName(port_id), baud_rate, tx_buffer_size, rx_buffer_size) {}
+
+HilsUartPort::HilsUartPort(const std::string port_name, const unsigned int baud_rate, const unsigned int tx_buffer_size,
+                           const unsigned int rx_buffer_size)
+    : kTxBufferSize(tx_buffer_size),
+      kRxBufferSize(rx_buffer_size),
+      kPortName(port_name),
+      baud_rate_(baud_rate),
+      port_(port_name, baud_rate, rx_buffer_size) {
+  Initialize();
+}
+
+HilsUartPort::~HilsUartPort() { ClosePort(); }
+
+// Static method to convert from com port number to device path.
+std::string HilsUartPort::GetPortName(const unsigned int port_id) { return "/dev/ttyS" + std::to_string(port_id); }
+
+int HilsUartPort::Initialize() { return OpenPort(); }
+
+int HilsUartPort::ClosePort() { return port_.Close(); }
+
+int HilsUartPort::OpenPort() {
+  // -1: The device cannot be opened, -2: The baud rate is not supported, -3: The termios setting failed, -4: The epoll setting failed
+  int ret = port_.Open();
+  if (ret != 0) {
+    printf("Error: HILS UART port %s cannot be opened (code %d)\n", kPortName.c_str(), ret);
+    return ret;
+  }
+  return 0;  // Success !!
+}
+
+int HilsUartPort::WriteTx(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  if (data_length > kTxBufferSize) return -1;
+  int ret = port_.Write(buffer, offset, data_length);
+#ifdef HILS_UART_PORT_SHOW_DEBUG_DATA
+  if (ret != 0) printf("HILS UART port %s: write error\n", kPortName.c_str());
+#endif
+  return ret;
+}
+
+int HilsUartPort::ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  // The received data has already been moved from the kernel into the RX ring buffer of the port
+  int ret = port_.Read(buffer, offset, data_length);
+#ifdef HILS_UART_PORT_SHOW_DEBUG_DATA
+  if (ret < 0) printf("HILS UART port %s: read error\n", kPortName.c_str());
+#endif
+  return ret;
+}
+
+int HilsUartPort::GetBytesToRead() { return port_.GetBytesToRead(); }
+
+int HilsUartPort::DiscardInBuffer() { return port_.DiscardInBuffer(); }
+
+int HilsUartPort::DiscardOutBuffer() { return port_.DiscardOutBuffer(); }
@@ -237,6 +237,22 @@ std::string GnssReceiver::GetLogValue() const  // For logs
   return str_tmp;
 }
 
+void GnssReceiver::AppendLogValue(std::vector<double>& values) const {
+  AppendScalar(values, utc_.year);
+  AppendScalar(values, utc_.month);
+  AppendScalar(values, utc_.day);
+  AppendScalar(values, utc_.hour);
+  AppendScalar(values, utc_.minute);
+  AppendScalar(values, utc_.second);
+  AppendVector(values, position_eci_m_);
+  AppendVector(values, velocity_ecef_m_s_);
+  AppendScalar(values, position_llh_[0]);
+  AppendScalar(values, position_llh_[1]);
+  AppendScalar(values, position_llh_[2]);
+  AppendScalar(values, is_gnss_visible_);
+  AppendScalar(values, visible_satellite_number_);
+}
+
 typedef struct _gnssrecever_param {
   int prescaler;
   AntennaModel antenna_model;
@@ -139,6 +139,11 @@ class GnssReceiver : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
  protected:
   // Parameters for receiver
@@ -45,6 +45,10 @@ std::string GyroSensor::GetLogValue() const {
   return str_tmp;
 }
 
+void GyroSensor::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, angular_velocity_c_rad_s_);
+}
+
 GyroSensor InitGyroSensor(ClockGenerator* clock_generator, int sensor_id, const std::string file_name, double component_step_time_s,
                           const Dynamics* dynamics) {
   IniAccess gyro_conf(file_name);
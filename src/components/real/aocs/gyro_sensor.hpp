@@ -70,6 +70,11 @@ class GyroSensor : public Component, public Sensor<kGyroDimension>, public ILogg
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const override;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const override;
 
   /**
    * @fn GetMeasuredAngularVelocity_c_rad_s
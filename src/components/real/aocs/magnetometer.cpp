@@ -47,6 +47,10 @@ std::string Magnetometer::GetLogValue() const {
   return str_tmp;
 }
 
+void Magnetometer::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, magnetic_field_c_nT_);
+}
+
 Magnetometer InitMagnetometer(ClockGenerator* clock_generator, int sensor_id, const std::string file_name, double component_step_time_s,
                               const GeomagneticField* geomagnetic_field) {
   IniAccess magsensor_conf(file_name);
@@ -70,6 +70,11 @@ class Magnetometer : public Component, public Sensor<kMagnetometerDimension>, pu
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const override;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const override;
 
   /**
    * @fn GetMeasuredMagneticField_c_nT
@@ -111,6 +111,11 @@ std::string Magnetorquer::GetLogValue() const {
   return str_tmp;
 }
 
+void Magnetorquer::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, output_magnetic_moment_b_Am2_);
+  AppendVector(values, torque_b_Nm_);
+}
+
 Magnetorquer InitMagnetorquer(ClockGenerator* clock_generator, int actuator_id, const std::string file_name, double component_step_time_s,
                               const GeomagneticField* geomagnetic_field) {
   IniAccess magtorquer_conf(file_name);
@@ -95,6 +95,11 @@ class Magnetorquer : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const override;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const override;
 
   /**
    * @fn GetOutputTorque_b_Nm
@@ -227,6 +227,19 @@ std::string ReactionWheel::GetLogValue() const {
   return str_tmp;
 }
 
+void ReactionWheel::AppendLogValue(std::vector<double>& values) const {
+  AppendScalar(values, angular_velocity_rad_s_);
+  AppendScalar(values, angular_velocity_rpm_);
+  AppendScalar(values, velocity_limit_rpm_);
+  AppendScalar(values, target_acceleration_rad_s2_);
+  AppendScalar(values, generated_angular_acceleration_rad_s2_);
+
+  if (is_logged_jitter_ && is_calculated_jitter_) {
+    AppendVector(values, rw_jitter_.GetJitterForce_c_N());
+    AppendVector(values, rw_jitter_.GetJitterTorque_c_Nm());
+  }
+}
+
 // In order to share processing among initialization functions, variables should also be shared.
 // These variables have internal linkages and cannot be referenced from the outside.
 namespace {
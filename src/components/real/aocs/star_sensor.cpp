@@ -69,6 +69,12 @@ StarSensor::StarSensor(const int prescaler, ClockGenerator* clock_generator, Pow
 void StarSensor::Initialize() {
   measured_quaternion_i2c_ = libra::Quaternion(0.0, 0.0, 0.0, 1.0);
 
+  // Resolve celestial bodies
+  const CelestialInformation& celestial_information = local_environment_->GetCelestialInformation().GetGlobalInformation();
+  sun_ = celestial_information.GetBodyHandle("SUN");
+  earth_ = celestial_information.GetBodyHandle("EARTH");
+  moon_ = celestial_information.GetBodyHandle("MOON");
+
   // Decide delay buffer size
   max_delay_ = int(output_delay_ * 2 / step_time_s_);
   if (max_delay_ <= 0) max_delay_ = 1;
@@ -127,9 +133,9 @@ void StarSensor::update(const LocalCelestialInformation* local_celestial_informa
 
 void StarSensor::AllJudgement(const LocalCelestialInformation* local_celestial_information, const Attitude* attitude) {
   int judgement = 0;
-  judgement = SunJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("SUN"));
-  judgement += EarthJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("EARTH"));
-  judgement += MoonJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("MOON"));
+  judgement = SunJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(sun_));
+  judgement += EarthJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(earth_));
+  judgement += MoonJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(moon_));
   judgement += CaptureRateJudgement(attitude->GetAngularVelocity_b_rad_s());
   if (judgement > 0)
     error_flag_ = true;
@@ -198,6 +204,11 @@ std::string StarSensor::GetLogValue() const {
   return str_tmp;
 }
 
+void StarSensor::AppendLogValue(std::vector<double>& values) const {
+  AppendQuaternion(values, measured_quaternion_i2c_);
+  AppendScalar(values, double(error_flag_));
+}
+
 double StarSensor::CalAngleVector_rad(const Vector<3>& vector1, const Vector<3>& vector2) {
   libra::Vector<3> vect1_normal = vector1.CalcNormalizedVector();
   libra::Vector<3> vect2_normal = vector2.CalcNormalizedVector();
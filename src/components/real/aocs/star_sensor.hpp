@@ -93,6 +93,11 @@ class StarSensor : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const override;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const override;
 
   /**
    * @fn GetMeasuredQuaternion_i2c
@@ -138,6 +143,9 @@ class StarSensor : public Component, public ILoggable {
   // Observed variables
   const Dynamics* dynamics_;                   //!< Dynamics information
   const LocalEnvironment* local_environment_;  //!< Local environment information
+  CelestialBodyHandle sun_;                    //!< Handle of the sun
+  CelestialBodyHandle earth_;                  //!< Handle of the earth
+  CelestialBodyHandle moon_;                   //!< Handle of the moon
 
   // Internal functions
   /**
@@ -43,6 +43,8 @@ SunSensor::SunSensor(const int prescaler, ClockGenerator* clock_generator, Power
 }
 
 void SunSensor::Initialize(const double random_noise_standard_deviation_rad, const double bias_noise_standard_deviation_rad) {
+  sun_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("SUN");
+
   // Bias
   NormalRand nr(0.0, bias_noise_standard_deviation_rad, global_randomization.MakeSeed());
   bias_noise_alpha_rad_ += nr;
@@ -59,7 +61,7 @@ void SunSensor::MainRoutine(const int time_count) {
 }
 
 void SunSensor::Measure() {
-  libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN");
+  libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_);
   libra::Vector<3> sun_dir_b = sun_pos_b.CalcNormalizedVector();
 
   sun_direction_true_c_ = quaternion_b2c_.FrameConversion(sun_dir_b);  // Frame conversion from body to component
@@ -151,6 +153,11 @@ string SunSensor::GetLogValue() const {
   return str_tmp;
 }
 
+void SunSensor::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, measured_sun_direction_c_);
+  AppendScalar(values, double(sun_detected_flag_));
+}
+
 SunSensor InitSunSensor(ClockGenerator* clock_generator, int ss_id, std::string file_name, const SolarRadiationPressureEnvironment* srp_environment,
                         const LocalCelestialInformation* local_celestial_information) {
   IniAccess ss_conf(file_name);
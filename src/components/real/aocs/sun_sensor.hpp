@@ -77,6 +77,11 @@ class SunSensor : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const override;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const override;
 
   // Getter
   inline bool GetSunDetectedFlag() const { return sun_detected_flag_; };
@@ -108,6 +113,7 @@ class SunSensor : public Component, public ILoggable {
   // Measured variables
   const SolarRadiationPressureEnvironment* srp_environment_;      //!< Solar Radiation Pressure environment
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
+  CelestialBodyHandle sun_;                                       //!< Handle of the sun
 
   // functions
   /**
@@ -117,6 +117,11 @@ std::string GroundStationCalculator::GetLogValue() const {
   return str_tmp;
 }
 
+void GroundStationCalculator::AppendLogValue(std::vector<double>& values) const {
+  AppendScalar(values, max_bitrate_Mbps_);
+  AppendScalar(values, receive_margin_dB_);
+}
+
 GroundStationCalculator InitGsCalculator(const std::string file_name) {
   IniAccess gs_conf(file_name);
 
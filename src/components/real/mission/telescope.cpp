@@ -32,6 +32,11 @@ Telescope::Telescope(ClockGenerator* clock_generator, const libra::Quaternion& q
       hipparcos_(hipparcos),
       local_celestial_information_(local_celestial_information),
       orbit_(orbit) {
+  // Resolve celestial bodies
+  sun_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("SUN");
+  earth_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("EARTH");
+  moon_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("MOON");
+
   is_sun_in_forbidden_angle = true;
   is_earth_in_forbidden_angle = true;
   is_moon_in_forbidden_angle = true;
@@ -69,13 +74,13 @@ Telescope::~Telescope() {}
 void Telescope::MainRoutine(const int time_count) {
   UNUSED(time_count);
   // Check forbidden angle
-  is_sun_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN"), sun_forbidden_angle_rad_);
-  is_earth_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("EARTH"), earth_forbidden_angle_rad_);
-  is_moon_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("MOON"), moon_forbidden_angle_rad_);
+  is_sun_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_), sun_forbidden_angle_rad_);
+  is_earth_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m(earth_), earth_forbidden_angle_rad_);
+  is_moon_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m(moon_), moon_forbidden_angle_rad_);
   // Position calculation of celestial bodies from CelesInfo
-  Observe(sun_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN"));
-  Observe(earth_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("EARTH"));
-  Observe(moon_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("MOON"));
+  Observe(sun_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_));
+  Observe(earth_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m(earth_));
+  Observe(moon_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m(moon_));
   // Position calculation of stars from Hipparcos Catalogue
   // No update when Hipparcos Catalogue was not read
   if (hipparcos_->IsCalcEnabled) ObserveStars();
@@ -245,6 +250,25 @@ string Telescope::GetLogValue() const {
   return str_tmp;
 }
 
+void Telescope::AppendLogValue(std::vector<double>& values) const {
+  AppendScalar(values, is_sun_in_forbidden_angle);
+  AppendScalar(values, is_earth_in_forbidden_angle);
+  AppendScalar(values, is_moon_in_forbidden_angle);
+  AppendVector(values, sun_position_image_sensor);
+  AppendVector(values, earth_position_image_sensor);
+  AppendVector(values, moon_position_image_sensor);
+  AppendScalar(values, ground_position_x_image_sensor_);
+  AppendScalar(values, ground_position_y_image_sensor_);
+  // When Hipparcos Catalogue was not read, no output of ObserveStars
+  if (hipparcos_->IsCalcEnabled) {
+    for (size_t i = 0; i < number_of_logged_stars_; i++) {
+      AppendScalar(values, star_list_in_sight[i].hipparcos_data.hipparcos_id);
+      AppendScalar(values, star_list_in_sight[i].hipparcos_data.visible_magnitude);
+      AppendVector(values, star_list_in_sight[i].position_image_sensor);
+    }
+  }
+}
+
 Telescope InitTelescope(ClockGenerator* clock_generator, int sensor_id, const string file_name, const Attitude* attitude,
                         const HipparcosCatalogue* hipparcos, const LocalCelestialInformation* local_celestial_information, const Orbit* orbit) {
   using libra::pi;
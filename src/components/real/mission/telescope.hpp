@@ -127,6 +127,9 @@ class Telescope : public Component, public ILoggable {
   const Attitude* attitude_;                                      //!< Attitude information
   const HipparcosCatalogue* hipparcos_;                           //!< Star information
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
+  CelestialBodyHandle sun_;                                       //!< Handle of the sun
+  CelestialBodyHandle earth_;                                     //!< Handle of the earth
+  CelestialBodyHandle moon_;                                      //!< Handle of the moon
   /**
    * @fn ObserveGroundPositionDeviation
    * @brief Calculate the deviation of the ground position from its initial value in the image sensor
@@ -145,6 +148,11 @@ class Telescope : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
   // For debug **********************************************
   //  libra::Vector<3> sun_pos_c;
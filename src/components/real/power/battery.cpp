@@ -68,6 +68,11 @@ std::string Battery::GetLogValue() const {
   return str_tmp;
 }
 
+void Battery::AppendLogValue(std::vector<double>& values) const {
+  AppendScalar(values, battery_voltage_V_);
+  AppendScalar(values, depth_of_discharge_percent_);
+}
+
 void Battery::MainRoutine(const int time_count) {
   UNUSED(time_count);
 
@@ -5,90 +5,241 @@
 
 #include "csv_scenario_interface.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
 #include <library/initialize/initialize_file_access.hpp>
+#include <library/utilities/file_utility.hpp>
+#include <numeric>
+#include <stdexcept>
+
+static const char kBinaryMagic[8] = {'S', '2', 'E', 'S', 'C', 'N', 'R', '\0'};  //!< Magic number of the binary scenario file
+static const uint32_t kBinaryFormatVersion = 1;                                 //!< Format version of the binary scenario file
+static const size_t kMaxLinearSearchRows = 8;                                   //!< Number of rows searched from the cursor before binary search
+
+/**
+ * @fn ParseCsvLine
+ * @brief Parse comma separated numbers in a line on memory
+ * @note The fields are copied to a null-terminated buffer since the mapped file is not null-terminated
+ * @param [in] line_begin: Top of the line
+ * @param [in] line_end: End of the line without newline characters
+ * @param [out] values: Parsed values
+ * @param [in] max_number: Maximum number of values
+ * @return Number of values parsed before the first field which is not a number
+ */
+static size_t ParseCsvLine(const char* line_begin, const char* line_end, double* values, const size_t max_number) {
+  size_t number = 0;
+  const char* field_begin = line_begin;
+  while (number < max_number && field_begin < line_end) {
+    const char* comma = static_cast<const char*>(memchr(field_begin, ',', line_end - field_begin));
+    const char* field_end = comma == nullptr ? line_end : comma;
+
+    char buffer[64];
+    const size_t length = std::min((size_t)(field_end - field_begin), sizeof(buffer) - 1);
+    memcpy(buffer, field_begin, length);
+    buffer[length] = '\0';
+    char* parse_end = nullptr;
+    values[number] = strtod(buffer, &parse_end);
+    if (parse_end == buffer) break;
+    ++number;
+
+    if (comma == nullptr) break;
+    field_begin = comma + 1;
+  }
+  return number;
+}
 
 bool CsvScenarioInterface::is_csv_scenario_enabled_;
-std::map<std::string, unsigned int> CsvScenarioInterface::buffer_line_id_;
-std::map<std::string, DoubleBuffer> CsvScenarioInterface::buffers_;
+std::vector<double> CsvScenarioInterface::time_buffer_s_;
+std::vector<double> CsvScenarioInterface::value_buffer_;
+std::unique_ptr<MemoryMappedFile> CsvScenarioInterface::binary_file_;
+const double* CsvScenarioInterface::times_s_ = nullptr;
+const double* CsvScenarioInterface::values_ = nullptr;
+size_t CsvScenarioInterface::number_of_rows_ = 0;
+thread_local size_t CsvScenarioInterface::cursor_ = 0;
 
 void CsvScenarioInterface::Initialize(const std::string file_name) {
   IniAccess scenario_conf(file_name);
   char Section[30] = "SCENARIO";
 
   CsvScenarioInterface::is_csv_scenario_enabled_ = scenario_conf.ReadBoolean(Section, "is_csv_scenario_enabled");
+  ClearData();
+  if (!is_csv_scenario_enabled_) return;
 
   std::string csv_path;
   csv_path = scenario_conf.ReadString(Section, "csv_path");
+  std::string binary_path;
+  binary_path = scenario_conf.ReadString(Section, "binary_path");
+  if (binary_path == "NULL") binary_path.clear();
 
-  buffer_line_id_["sun_dir_b_x"] = 1;
-  buffer_line_id_["sun_dir_b_y"] = 2;
-  buffer_line_id_["sun_dir_b_z"] = 3;
-  buffer_line_id_["sun_flag"] = 4;
-  buffer_line_id_["power_consumption"] = 5;
+  uint64_t csv_size_B = 0;
+  int64_t csv_modified_time = 0;
+  const bool is_csv_available = GetFileStatus(csv_path, csv_size_B, csv_modified_time);
 
-  std::vector<std::vector<double>> data;
-  data = ReadCsvData(csv_path, 1);
+  if (!binary_path.empty() && ReadBinaryData(binary_path, csv_size_B, csv_modified_time, is_csv_available)) return;
 
-  for (auto itr = buffer_line_id_.begin(); itr != buffer_line_id_.end(); itr++) {
-    StoreBuffer(itr->first, data);
-  }
+  ReadCsvData(csv_path, 1);
+  if (!binary_path.empty()) WriteBinaryData(binary_path, csv_size_B, csv_modified_time);
 }
 
 bool CsvScenarioInterface::IsCsvScenarioEnabled() { return CsvScenarioInterface::is_csv_scenario_enabled_; }
 
 libra::Vector<3> CsvScenarioInterface::GetSunDirectionBody(const double time_query) {
+  const size_t row = FindRow(time_query);
   libra::Vector<3> sun_dir_b;
-  sun_dir_b[0] = GetValueFromBuffer("sun_dir_b_x", time_query);
-  sun_dir_b[1] = GetValueFromBuffer("sun_dir_b_y", time_query);
-  sun_dir_b[2] = GetValueFromBuffer("sun_dir_b_z", time_query);
+  sun_dir_b[0] = GetValue(row, kSunDirectionBodyX);
+  sun_dir_b[1] = GetValue(row, kSunDirectionBodyY);
+  sun_dir_b[2] = GetValue(row, kSunDirectionBodyZ);
   return sun_dir_b;
 }
 
-bool CsvScenarioInterface::GetSunFlag(const double time_query) { return (bool)GetValueFromBuffer("sun_flag", time_query); }
-
-double CsvScenarioInterface::GetPowerConsumption(const double time_query) { return GetValueFromBuffer("power_consumption", time_query); }
-
-std::vector<std::vector<double>> CsvScenarioInterface::ReadCsvData(const std::string filename, const std::size_t ignore_line_num) {
-  std::ifstream file;
-  file.open(filename, std::ios::in);
-  if (!file) throw std::invalid_argument(filename + std::string(" cannot be opened."));
-
-  std::string reading_line_buffer;
-  for (std::size_t line = 0; line < ignore_line_num; line++) {
-    getline(file, reading_line_buffer);
-    if (file.eof()) break;
+bool CsvScenarioInterface::GetSunFlag(const double time_query) { return (bool)GetValue(FindRow(time_query), kSunFlag); }
+
+double CsvScenarioInterface::GetPowerConsumption(const double time_query) { return GetValue(FindRow(time_query), kPowerConsumption); }
+
+void CsvScenarioInterface::ReadCsvData(const std::string& file_path, const std::size_t ignore_line_num) {
+  MemoryMappedFile file(file_path);
+  if (!file.IsOpened()) throw std::invalid_argument(file_path + std::string(" cannot be opened."));
+  const char* cursor = file.GetData();
+  const char* end = cursor + file.GetSize_B();
+
+  std::vector<double> times_s;
+  std::vector<double> values;
+  size_t line_number = 0;
+  size_t number_of_short_lines = 0;
+  while (cursor < end) {
+    const char* line_begin = cursor;
+    const char* newline = static_cast<const char*>(memchr(cursor, '\n', end - cursor));
+    const char* line_end = newline == nullptr ? end : newline;
+    cursor = newline == nullptr ? end : newline + 1;
+    if (line_end > line_begin && *(line_end - 1) == '\r') --line_end;
+    if (line_number++ < ignore_line_num) continue;
+    if (line_end == line_begin) break;
+
+    double line_values[1 + kNumberOfColumns];
+    if (ParseCsvLine(line_begin, line_end, line_values, 1 + kNumberOfColumns) < 1 + kNumberOfColumns) {
+      number_of_short_lines++;
+      continue;
+    }
+    times_s.push_back(line_values[0]);
+    values.insert(values.end(), line_values + 1, line_values + 1 + kNumberOfColumns);
+  }
+  if (number_of_short_lines > 0) {
+    std::cout << "[WARNINGS] " << number_of_short_lines << " lines in " << file_path << " are ignored since they have less than "
+              << 1 + kNumberOfColumns << " values." << std::endl;
   }
 
-  double num;
-  char comma;
-  std::vector<std::vector<double>> data;
-
-  while (std::getline(file, reading_line_buffer)) {
-    if (reading_line_buffer.size() == 0) break;
-    std::vector<double> temp_data;
-    std::istringstream is(reading_line_buffer);
-    while (is >> num) {
-      temp_data.push_back(num);
-      is >> comma;
+  // Sort the rows by time. The stable sort keeps the order of the rows with the same time, and the last one is used.
+  std::vector<size_t> order(times_s.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&times_s](const size_t a, const size_t b) { return times_s[a] < times_s[b]; });
+
+  time_buffer_s_.clear();
+  time_buffer_s_.reserve(order.size());
+  value_buffer_.clear();
+  value_buffer_.reserve(order.size() * kNumberOfColumns);
+  for (const size_t row : order) {
+    if (!time_buffer_s_.empty() && time_buffer_s_.back() == times_s[row]) {
+      std::copy(values.begin() + row * kNumberOfColumns, values.begin() + (row + 1) * kNumberOfColumns, value_buffer_.end() - kNumberOfColumns);
+      continue;
     }
-    data.push_back(temp_data);
+    time_buffer_s_.push_back(times_s[row]);
+    value_buffer_.insert(value_buffer_.end(), values.begin() + row * kNumberOfColumns, values.begin() + (row + 1) * kNumberOfColumns);
   }
 
-  return data;
+  times_s_ = time_buffer_s_.data();
+  values_ = value_buffer_.data();
+  number_of_rows_ = time_buffer_s_.size();
+}
+
+bool CsvScenarioInterface::ReadBinaryData(const std::string& file_path, const uint64_t csv_size_B, const int64_t csv_modified_time,
+                                          const bool is_csv_available) {
+  // The rows are looked up forward from the cursor with occasional jumps, so the default read-ahead is kept
+  std::unique_ptr<MemoryMappedFile> file(new MemoryMappedFile(file_path, MemoryAccessPattern::kNormal));
+  if (!file->IsOpened()) return false;
+  const char* cursor = file->GetData();
+  const char* end = cursor + file->GetSize_B();
+
+  // Copy a value from the mapped file with the range check
+  auto read = [&cursor, end](void* value, const size_t size_B) {
+    if ((size_t)(end - cursor) < size_B) return false;
+    memcpy(value, cursor, size_B);
+    cursor += size_B;
+    return true;
+  };
+
+  char magic[8];
+  uint32_t format_version = 0, number_of_columns = 0;
+  uint64_t number_of_rows = 0, source_size_B = 0;
+  int64_t source_modified_time = 0;
+  if (!read(magic, sizeof(magic)) || memcmp(magic, kBinaryMagic, sizeof(magic)) != 0) return false;
+  if (!read(&format_version, sizeof(format_version)) || format_version != kBinaryFormatVersion) return false;
+  if (!read(&number_of_columns, sizeof(number_of_columns)) || number_of_columns != kNumberOfColumns) return false;
+  if (!read(&number_of_rows, sizeof(number_of_rows))) return false;
+  if (!read(&source_size_B, sizeof(source_size_B)) || !read(&source_modified_time, sizeof(source_modified_time))) return false;
+  if (is_csv_available && (source_size_B != csv_size_B || source_modified_time != csv_modified_time)) return false;
+  if (number_of_rows > (uint64_t)(end - cursor) / (sizeof(double) * (1 + kNumberOfColumns))) return false;
+
+  // The arrays are used in place. The header size is a multiple of 8 bytes, so the arrays are aligned in the mapped file.
+  time_buffer_s_.clear();
+  value_buffer_.clear();
+  times_s_ = reinterpret_cast<const double*>(cursor);
+  values_ = times_s_ + number_of_rows;
+  number_of_rows_ = (size_t)number_of_rows;
+  binary_file_ = std::move(file);
+  return true;
 }
 
-void CsvScenarioInterface::StoreBuffer(const std::string buffer_name, const std::vector<std::vector<double>>& data) {
-  auto line_num = buffer_line_id_.at(buffer_name);
-  for (const auto& line : data) {
-    buffers_[buffer_name][line[0]] = line[line_num];
+void CsvScenarioInterface::WriteBinaryData(const std::string& file_path, const uint64_t csv_size_B, const int64_t csv_modified_time) {
+  // The file is replaced atomically, so that the other runs never map the partially written file
+  const bool is_written = ReplaceFileAtomically(file_path, [&](std::ofstream& file) {
+    // File layout (host byte order)
+    //   magic "S2ESCNR" + '\0' (8 bytes), format version (uint32), number of columns (uint32), number of rows (uint64)
+    //   size of the source CSV file (uint64), modified time of the source CSV file (int64)
+    //   times (double x rows), row-major values (double x rows x columns)
+    const uint32_t number_of_columns = kNumberOfColumns;
+    const uint64_t number_of_rows = number_of_rows_;
+    file.write(kBinaryMagic, sizeof(kBinaryMagic));
+    file.write(reinterpret_cast<const char*>(&kBinaryFormatVersion), sizeof(kBinaryFormatVersion));
+    file.write(reinterpret_cast<const char*>(&number_of_columns), sizeof(number_of_columns));
+    file.write(reinterpret_cast<const char*>(&number_of_rows), sizeof(number_of_rows));
+    file.write(reinterpret_cast<const char*>(&csv_size_B), sizeof(csv_size_B));
+    file.write(reinterpret_cast<const char*>(&csv_modified_time), sizeof(csv_modified_time));
+    file.write(reinterpret_cast<const char*>(times_s_), sizeof(double) * number_of_rows_);
+    file.write(reinterpret_cast<const char*>(values_), sizeof(double) * number_of_rows_ * kNumberOfColumns);
+  });
+  if (!is_written) {
+    std::cout << "[WARNINGS] Binary scenario file cannot be written: " << file_path << std::endl;
   }
 }
 
-double CsvScenarioInterface::GetValueFromBuffer(const std::string buffer_name, const double time_query) {
-  double output;
-  auto itr = buffers_.at(buffer_name).upper_bound(time_query);
-  itr--;
-  if (itr == buffers_.at(buffer_name).end()) return 0;
-  output = itr->second;
-  return output;
+void CsvScenarioInterface::ClearData() {
+  time_buffer_s_.clear();
+  value_buffer_.clear();
+  binary_file_.reset();
+  times_s_ = nullptr;
+  values_ = nullptr;
+  number_of_rows_ = 0;
+}
+
+size_t CsvScenarioInterface::FindRow(const double time_query) {
+  if (number_of_rows_ == 0 || time_query < times_s_[0]) return number_of_rows_;
+
+  // Search forward from the previous row since the time usually increases
+  size_t row = cursor_ < number_of_rows_ ? cursor_ : 0;
+  if (times_s_[row] <= time_query) {
+    for (size_t i = 0; i < kMaxLinearSearchRows; i++) {
+      if (row + 1 == number_of_rows_ || time_query < times_s_[row + 1]) {
+        cursor_ = row;
+        return row;
+      }
+      row++;
+    }
+  }
+
+  row = (size_t)(std::upper_bound(times_s_, times_s_ + number_of_rows_, time_query) - times_s_) - 1;
+  cursor_ = row;
+  return row;
 }
@@ -6,16 +6,21 @@
 #ifndef S2E_COMPONENTS_REAL_POWER_CSV_SCENARIO_INTERFACE_HPP_
 #define S2E_COMPONENTS_REAL_POWER_CSV_SCENARIO_INTERFACE_HPP_
 
+#include <cstdint>
 #include <library/math/vector.hpp>
-#include <map>
+#include <library/utilities/memory_mapped_file.hpp>
+#include <memory>
 #include <string>
 #include <vector>
 
-typedef std::map<double, double> DoubleBuffer;
-
 /*
  * @class CsvScenarioInterface
  * @brief Interface to read power related scenario in CSV file
+ * @details The scenario is stored in flat arrays sorted by time: the time array and the row-major value array whose columns are the
+ *          scenario items. The value at a time query is the value of the latest row at or before the query. The lookup starts from the row
+ *          found in the previous lookup of the same thread, so the lookups with monotonically increasing time are O(1) in average.
+ *          When binary_path is set in the initialize file, the arrays are saved in the binary file and the file is memory-mapped in the
+ *          following runs as long as the size and the modified time of the CSV file are unchanged.
  */
 class CsvScenarioInterface {
  public:
@@ -51,31 +56,76 @@ class CsvScenarioInterface {
   static double GetPowerConsumption(const double time_query);
 
  private:
+  /**
+   * @enum ColumnId
+   * @brief Column of the scenario items in the value array. The CSV file has the time column before them.
+   */
+  enum ColumnId : size_t {
+    kSunDirectionBodyX = 0,  //!< X component of the sun direction in the body fixed frame
+    kSunDirectionBodyY,      //!< Y component of the sun direction in the body fixed frame
+    kSunDirectionBodyZ,      //!< Z component of the sun direction in the body fixed frame
+    kSunFlag,                //!< Sun flag
+    kPowerConsumption,       //!< Power consumption [W]
+    kNumberOfColumns,        //!< Number of the scenario items
+  };
+
   /**
    * @fn ReadCsvData
-   * @brief Read CSV data
-   * @param [in] filename: Path to CSV file
+   * @brief Read CSV data and store them in the sorted arrays
+   * @note When the same time appears in several rows, the last row is used
+   * @param [in] file_path: Path to CSV file
    * @param [in] ignore_line_num: Number of ignore line
    */
-  static std::vector<std::vector<double>> ReadCsvData(const std::string filename, const std::size_t ignore_line_num = 0);
+  static void ReadCsvData(const std::string& file_path, const std::size_t ignore_line_num = 0);
+  /**
+   * @fn ReadBinaryData
+   * @brief Map the binary scenario file and use the arrays in it
+   * @param [in] file_path: Path to binary file
+   * @param [in] csv_size_B: Size of the source CSV file [Byte]
+   * @param [in] csv_modified_time: Modified time of the source CSV file [ns]
+   * @param [in] is_csv_available: The source CSV file exists. When false, the binary file is used without the check of the source.
+   * @return True when the binary file is valid and mapped
+   */
+  static bool ReadBinaryData(const std::string& file_path, const uint64_t csv_size_B, const int64_t csv_modified_time, const bool is_csv_available);
+  /**
+   * @fn WriteBinaryData
+   * @brief Write the arrays into the binary scenario file
+   * @note The arrays are written into the temporary file "<file_path>.tmp" first, and the file is renamed to the binary scenario file
+   * @param [in] file_path: Path to binary file
+   * @param [in] csv_size_B: Size of the source CSV file [Byte]
+   * @param [in] csv_modified_time: Modified time of the source CSV file [ns]
+   */
+  static void WriteBinaryData(const std::string& file_path, const uint64_t csv_size_B, const int64_t csv_modified_time);
   /**
-   * @fn StoreBuffer
-   * @brief Store buffer
-   * @param [in] buffer_name: Buffer name
-   * @param [in] data: Data
+   * @fn ClearData
+   * @brief Release the arrays and the mapped file
    */
-  static void StoreBuffer(const std::string buffer_name, const std::vector<std::vector<double>>& data);
+  static void ClearData();
   /**
-   * @fn GetValueFromBuffer
-   * @brief Return value from buffer
-   * @param [in] buffer_name: Buffer name
+   * @fn FindRow
+   * @brief Return the latest row at or before the time query
    * @param [in] time_query: Time query
+   * @return Row index, or number of rows when the time query is before the first row
+   */
+  static size_t FindRow(const double time_query);
+  /**
+   * @fn GetValue
+   * @brief Return value in the row and the column. The value is zero for the invalid row.
+   * @param [in] row: Row index
+   * @param [in] column: Column of the scenario item
    */
-  static double GetValueFromBuffer(const std::string buffer_name, const double time_query);
+  static inline double GetValue(const size_t row, const ColumnId column) {
+    return row < number_of_rows_ ? values_[row * kNumberOfColumns + column] : 0.0;
+  }
 
-  static bool is_csv_scenario_enabled_;                        //!< Enable flag to use CSV scenario
-  static std::map<std::string, unsigned int> buffer_line_id_;  //!< Buffer line ID
-  static std::map<std::string, DoubleBuffer> buffers_;         //!< Buffer
+  static bool is_csv_scenario_enabled_;                   //!< Enable flag to use CSV scenario
+  static std::vector<double> time_buffer_s_;              //!< Times of the rows read from CSV file
+  static std::vector<double> value_buffer_;               //!< Row-major values read from CSV file
+  static std::unique_ptr<MemoryMappedFile> binary_file_;  //!< Mapped binary scenario file
+  static const double* times_s_;                          //!< Times of the rows in the buffer or the mapped file
+  static const double* values_;                           //!< Row-major values in the buffer or the mapped file
+  static size_t number_of_rows_;                          //!< Number of rows
+  static thread_local size_t cursor_;                     //!< Row found in the previous lookup of the thread
 };
 
 #endif  // S2E_COMPONENTS_REAL_POWER_CSV_SCENARIO_INTERFACE_HPP_
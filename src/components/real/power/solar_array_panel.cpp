@@ -24,6 +24,7 @@ SolarArrayPanel::SolarArrayPanel(const int prescaler, ClockGenerator* clock_gene
       srp_environment_(srp_environment),
       local_celestial_information_(local_celestial_information),
       compo_step_time_s_(component_step_time_s) {
+  sun_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("SUN");
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
 }
@@ -60,6 +61,7 @@ SolarArrayPanel::SolarArrayPanel(ClockGenerator* clock_generator, int component_
       srp_environment_(srp_environment),
       local_celestial_information_(local_celestial_information),
       compo_step_time_s_(0.1) {
+  sun_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("SUN");
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
 }
@@ -75,6 +77,7 @@ SolarArrayPanel::SolarArrayPanel(const SolarArrayPanel& obj)
       transmission_efficiency_(obj.transmission_efficiency_),
       srp_environment_(obj.srp_environment_),
       local_celestial_information_(obj.local_celestial_information_),
+      sun_(obj.sun_),
       compo_step_time_s_(obj.compo_step_time_s_) {
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
@@ -95,6 +98,10 @@ std::string SolarArrayPanel::GetLogValue() const {
   return str_tmp;
 }
 
+void SolarArrayPanel::AppendLogValue(std::vector<double>& values) const {
+  AppendScalar(values, power_generation_W_);
+}
+
 void SolarArrayPanel::MainRoutine(const int time_count) {
   if (CsvScenarioInterface::IsCsvScenarioEnabled()) {
     double time_query = compo_step_time_s_ * time_count;
@@ -105,7 +112,7 @@ void SolarArrayPanel::MainRoutine(const int time_count) {
                           cell_area_m2_ * number_of_parallel_ * number_of_series_ * InnerProduct(normal_vector_, normalized_sun_direction_body);
   } else {
     const auto power_density = srp_environment_->GetPowerDensity_W_m2();
-    libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN");
+    libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_);
     libra::Vector<3> sun_dir_b = sun_pos_b.CalcNormalizedVector();
     power_generation_W_ = cell_efficiency_ * transmission_efficiency_ * power_density * cell_area_m2_ * number_of_parallel_ * number_of_series_ *
                           InnerProduct(normal_vector_, sun_dir_b);
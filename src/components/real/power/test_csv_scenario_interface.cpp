@@ -0,0 +1,205 @@
+/**
+ * @file test_csv_scenario_interface.cpp
+ * @brief Test codes for CsvScenarioInterface class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <library/utilities/thread_pool.hpp>
+#include <string>
+#include <vector>
+
+#include "csv_scenario_interface.hpp"
+
+namespace {
+const size_t kNumberOfRows = 100;  //!< Number of the rows in the scenario
+
+/**
+ * @brief Return the time of the row. The intervals are not uniform.
+ */
+double GetRowTime_s(const size_t row) { return 10.0 * row + (row % 3); }
+
+/**
+ * @brief Return the power consumption of the row
+ * @param [in] row: Row index
+ * @param [in] offset_W: Offset to make a different scenario with the same file size
+ */
+double GetRowPower_W(const size_t row, const double offset_W) { return offset_W + row; }
+}  // namespace
+
+class CsvScenarioInterfaceTest : public ::testing::Test {
+ protected:
+  const std::string ini_file_path_ = "test_csv_scenario_interface.ini";
+  const std::string csv_file_path_ = "test_csv_scenario_interface.csv";
+  const std::string binary_file_path_ = "test_csv_scenario_interface.bin";
+
+  void SetUp() override {
+    std::ofstream file(ini_file_path_);
+    file << "[SCENARIO]" << std::endl;
+    file << "is_csv_scenario_enabled = true" << std::endl;
+    file << "csv_path = " << csv_file_path_ << std::endl;
+    file << "binary_path = " << binary_file_path_ << std::endl;
+  }
+  void TearDown() override {
+    // Disable the scenario to release the data for the other tests
+    {
+      std::ofstream file(ini_file_path_);
+      file << "[SCENARIO]" << std::endl;
+      file << "is_csv_scenario_enabled = false" << std::endl;
+    }
+    CsvScenarioInterface::Initialize(ini_file_path_);
+    std::remove(ini_file_path_.c_str());
+    std::remove(csv_file_path_.c_str());
+    std::remove(binary_file_path_.c_str());
+  }
+
+  /**
+   * @brief Write the scenario CSV file
+   * @param [in] number_of_rows: Number of the rows
+   * @param [in] offset_W: Offset of the power consumption
+   */
+  void WriteCsvFile(const size_t number_of_rows, const double offset_W) const {
+    std::ofstream file(csv_file_path_);
+    file << "time,sun_x,sun_y,sun_z,sun_flag,power" << std::endl;
+    // The rows are written in the reverse order since the interface sorts them by time
+    for (size_t i = 0; i < number_of_rows; i++) {
+      const size_t row = number_of_rows - 1 - i;
+      char line[128];
+      snprintf(line, sizeof(line), "%.1f,%.1f,0.0,1.0,%d,%.3f", GetRowTime_s(row), GetRowTime_s(row), (int)(row % 2), GetRowPower_W(row, offset_W));
+      file << line << std::endl;
+    }
+  }
+
+  /**
+   * @brief Compare the lookup at the time with the latest row at or before the time
+   * @param [in] time_s: Time query
+   * @param [in] number_of_rows: Number of the rows
+   * @param [in] offset_W: Offset of the power consumption
+   */
+  static void ExpectLookup(const double time_s, const size_t number_of_rows, const double offset_W) {
+    std::vector<double> times_s(number_of_rows);
+    for (size_t row = 0; row < number_of_rows; row++) times_s[row] = GetRowTime_s(row);
+    const size_t upper_row = std::upper_bound(times_s.begin(), times_s.end(), time_s) - times_s.begin();
+    if (upper_row == 0) {
+      // Before the first row
+      EXPECT_DOUBLE_EQ(0.0, CsvScenarioInterface::GetPowerConsumption(time_s)) << "time_s: " << time_s;
+      EXPECT_FALSE(CsvScenarioInterface::GetSunFlag(time_s)) << "time_s: " << time_s;
+      return;
+    }
+    const size_t row = upper_row - 1;
+    EXPECT_DOUBLE_EQ(GetRowPower_W(row, offset_W), CsvScenarioInterface::GetPowerConsumption(time_s)) << "time_s: " << time_s;
+    EXPECT_EQ(row % 2 == 1, CsvScenarioInterface::GetSunFlag(time_s)) << "time_s: " << time_s;
+    EXPECT_DOUBLE_EQ(GetRowTime_s(row), CsvScenarioInterface::GetSunDirectionBody(time_s)[0]) << "time_s: " << time_s;
+  }
+
+  /**
+   * @brief Compare the lookups in forward, backward, and jumping order
+   * @param [in] number_of_rows: Number of the rows
+   * @param [in] offset_W: Offset of the power consumption
+   */
+  static void ExpectLookups(const size_t number_of_rows, const double offset_W) {
+    const double end_time_s = GetRowTime_s(number_of_rows - 1) + 20.0;
+    // Forward with the steps shorter than the rows, including the times on the rows
+    for (double time_s = -5.0; time_s <= end_time_s; time_s += 0.5) ExpectLookup(time_s, number_of_rows, offset_W);
+    // Backward
+    for (double time_s = end_time_s; time_s >= -5.0; time_s -= 0.5) ExpectLookup(time_s, number_of_rows, offset_W);
+    // Jumps longer than the linear search from the cursor in both directions
+    const std::vector<double> jump_times_s = {0.0, 500.0, 12.0, 13.0, 990.5, -1.0, 300.0, 211.0, 950.0, 949.0, 2000.0, 101.0, 0.0};
+    for (const double time_s : jump_times_s) ExpectLookup(time_s, number_of_rows, offset_W);
+  }
+};
+
+/**
+ * @brief Test the lookups of the scenario read from the CSV file
+ */
+TEST_F(CsvScenarioInterfaceTest, CursorLookup) {
+  WriteCsvFile(kNumberOfRows, 100.0);
+  CsvScenarioInterface::Initialize(ini_file_path_);
+  ASSERT_TRUE(CsvScenarioInterface::IsCsvScenarioEnabled());
+  ExpectLookups(kNumberOfRows, 100.0);
+}
+
+/**
+ * @brief Test the lookups in the threads. Each thread has its own cursor.
+ */
+TEST_F(CsvScenarioInterfaceTest, CursorLookupInThreads) {
+  WriteCsvFile(kNumberOfRows, 100.0);
+  CsvScenarioInterface::Initialize(ini_file_path_);
+
+  ThreadPool thread_pool(4);
+  thread_pool.ParallelFor(8, [](size_t index) {
+    // The threads scan the scenario from different times in different directions
+    const double step_s = index % 2 == 0 ? 3.0 : -3.0;
+    double time_s = 100.0 * index;
+    for (size_t i = 0; i < 200; i++) {
+      ExpectLookup(time_s, kNumberOfRows, 100.0);
+      time_s += step_s;
+    }
+  });
+}
+
+/**
+ * @brief Test that the binary scenario file gives the same scenario as the CSV file
+ */
+TEST_F(CsvScenarioInterfaceTest, BinaryRoundTrip) {
+  WriteCsvFile(kNumberOfRows, 100.0);
+  CsvScenarioInterface::Initialize(ini_file_path_);
+  ASSERT_TRUE(std::ifstream(binary_file_path_).is_open());
+  EXPECT_FALSE(std::ifstream(binary_file_path_ + ".tmp").is_open());
+
+  // Rewrite the CSV file with the same size and the same modified time, so that the binary file is used
+  const std::filesystem::file_time_type modified_time = std::filesystem::last_write_time(csv_file_path_);
+  const uintmax_t file_size_B = std::filesystem::file_size(csv_file_path_);
+  WriteCsvFile(kNumberOfRows, 200.0);
+  ASSERT_EQ(file_size_B, std::filesystem::file_size(csv_file_path_));
+  std::filesystem::last_write_time(csv_file_path_, modified_time);
+
+  CsvScenarioInterface::Initialize(ini_file_path_);
+  ExpectLookups(kNumberOfRows, 100.0);
+
+  // The binary file is used without the check when the CSV file does not exist
+  std::remove(csv_file_path_.c_str());
+  CsvScenarioInterface::Initialize(ini_file_path_);
+  ExpectLookups(kNumberOfRows, 100.0);
+}
+
+/**
+ * @brief Test that the binary scenario file is rebuilt when the CSV file is changed
+ */
+TEST_F(CsvScenarioInterfaceTest, BinaryInvalidation) {
+  WriteCsvFile(kNumberOfRows, 100.0);
+  CsvScenarioInterface::Initialize(ini_file_path_);
+  ExpectLookups(kNumberOfRows, 100.0);
+
+  // The size of the CSV file is changed
+  WriteCsvFile(kNumberOfRows + 10, 100.0);
+  CsvScenarioInterface::Initialize(ini_file_path_);
+  ExpectLookups(kNumberOfRows + 10, 100.0);
+
+  // The binary file is rebuilt for the new CSV file
+  std::remove(csv_file_path_.c_str());
+  CsvScenarioInterface::Initialize(ini_file_path_);
+  ExpectLookups(kNumberOfRows + 10, 100.0);
+
+  // Only the modified time of the CSV file is changed
+  WriteCsvFile(kNumberOfRows, 100.0);
+  CsvScenarioInterface::Initialize(ini_file_path_);
+  const std::filesystem::file_time_type modified_time = std::filesystem::last_write_time(csv_file_path_);
+  WriteCsvFile(kNumberOfRows, 200.0);
+  std::filesystem::last_write_time(csv_file_path_, modified_time + std::chrono::seconds(10));
+  CsvScenarioInterface::Initialize(ini_file_path_);
+  ExpectLookups(kNumberOfRows, 200.0);
+
+  // A broken binary file is not used
+  WriteCsvFile(kNumberOfRows, 100.0);
+  {
+    std::ofstream file(binary_file_path_, std::ios::binary);
+    file << "S2ESCNR";
+  }
+  CsvScenarioInterface::Initialize(ini_file_path_);
+  ExpectLookups(kNumberOfRows, 100.0);
+}
@@ -20,6 +20,7 @@ SimpleThruster::SimpleThruster(const int prescaler, ClockGenerator* clock_genera
       thrust_direction_b_(thrust_direction_b),
       thrust_magnitude_max_N_(max_magnitude_N),
       direction_noise_standard_deviation_rad_(direction_standard_deviation_rad),
+      direction_axis_randomizer_(global_randomization.MakeSeed()),
       structure_(structure),
       dynamics_(dynamics) {
   Initialize(magnitude_standard_deviation_N, direction_standard_deviation_rad);
@@ -35,6 +36,7 @@ SimpleThruster::SimpleThruster(const int prescaler, ClockGenerator* clock_genera
       thrust_direction_b_(thrust_direction_b),
       thrust_magnitude_max_N_(max_magnitude_N),
       direction_noise_standard_deviation_rad_(direction_standard_deviation_rad),
+      direction_axis_randomizer_(global_randomization.MakeSeed()),
       structure_(structure),
       dynamics_(dynamics) {
   Initialize(magnitude_standard_deviation_N, direction_standard_deviation_rad);
@@ -93,6 +95,12 @@ std::string SimpleThruster::GetLogValue() const {
   return str_tmp;
 }
 
+void SimpleThruster::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, output_thrust_b_N_);
+  AppendVector(values, output_torque_b_Nm_);
+  AppendScalar(values, output_thrust_b_N_.CalcNorm());
+}
+
 double SimpleThruster::CalcThrustMagnitude() { return duty_ * thrust_magnitude_max_N_; }
 
 libra::Vector<3> SimpleThruster::CalcThrustDirection() {
@@ -102,13 +110,8 @@ libra::Vector<3> SimpleThruster::CalcThrustDirection() {
     ex[0] = 1.0;
     ex[1] = 0.0;
     ex[2] = 0.0;
-    int flag = rand() % 2;
-    double make_axis_rot_rad;
-    if (flag == 0) {
-      make_axis_rot_rad = libra::pi * (double)rand() / RAND_MAX;
-    } else {
-      make_axis_rot_rad = -libra::pi * (double)rand() / RAND_MAX;
-    }
+    // Uniform random rotation angle in [-pi, pi]
+    const double make_axis_rot_rad = libra::pi * (2.0 * (double)direction_axis_randomizer_ - 1.0);
 
     libra::Quaternion make_axis_rot(thrust_dir_b_true, make_axis_rot_rad);
     libra::Vector<3> axis_rot = make_axis_rot.FrameConversion(ex);
@@ -10,6 +10,7 @@
 #include <library/logger/logger.hpp>
 #include <library/math/quaternion.hpp>
 #include <library/math/vector.hpp>
+#include <library/randomization/minimal_standard_linear_congruential_generator.hpp>
 #include <library/randomization/normal_randomization.hpp>
 #include <simulation/spacecraft/structure/structure.hpp>
 
@@ -86,6 +87,11 @@ class SimpleThruster : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const override;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const override;
 
   // Getter
   /**
@@ -116,6 +122,7 @@ class SimpleThruster : public Component, public ILoggable {
   double direction_noise_standard_deviation_rad_ = 0.0;  //!< Standard deviation of thrust direction error [rad]
   libra::NormalRand magnitude_random_noise_;             //!< Normal random for thrust magnitude error
   libra::NormalRand direction_random_noise_;             //!< Normal random for thrust direction error
+  libra::MinimalStandardLcg direction_axis_randomizer_;  //!< Uniform random for the axis of thrust direction error
   // outputs
   Vector<3> output_thrust_b_N_{0.0};   //!< Generated thrust on the body fixed frame [N]
   Vector<3> output_torque_b_Nm_{0.0};  //!< Generated torque on the body fixed frame [Nm]
@@ -93,6 +93,11 @@ std::string AirDrag::GetLogValue() const {
   return str_tmp;
 }
 
+void AirDrag::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, torque_b_Nm_);
+  AppendVector(values, force_b_N_);
+}
+
 AirDrag InitAirDrag(const std::string initialize_file_path, const std::vector<Surface>& surfaces, const Vector<3>& center_of_gravity_b_m) {
   auto conf = IniAccess(initialize_file_path);
   const char* section = "AIR_DRAG";
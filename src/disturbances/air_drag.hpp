@@ -52,6 +52,11 @@ class AirDrag : public SurfaceForce {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
  private:
   std::vector<double> cn_;          //!< Coefficients for out-plane force
@@ -113,6 +113,15 @@ std::string Geopotential::GetLogValue() const {
   return str_tmp;
 }
 
+void Geopotential::AppendLogValue(std::vector<double>& values) const {
+#ifdef DEBUG_GEOPOTENTIAL
+  AppendVector(values, debug_pos_ecef_m_);
+  AppendScalar(values, time_ms_);
+#endif
+
+  AppendVector(values, acceleration_ecef_m_s2_);
+}
+
 Geopotential InitGeopotential(const std::string initialize_file_path) {
   auto conf = IniAccess(initialize_file_path);
   const char *section = "GEOPOTENTIAL";
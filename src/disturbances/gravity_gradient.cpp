@@ -50,6 +50,10 @@ std::string GravityGradient::GetLogValue() const {
   return str_tmp;
 }
 
+void GravityGradient::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, torque_b_Nm_);
+}
+
 GravityGradient InitGravityGradient(const std::string initialize_file_path) {
   auto conf = IniAccess(initialize_file_path);
   const char* section = "GRAVITY_GRADIENT";
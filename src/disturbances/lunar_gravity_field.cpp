@@ -136,6 +136,15 @@ std::string LunarGravityField::GetLogValue() const {
   return str_tmp;
 }
 
+void LunarGravityField::AppendLogValue(std::vector<double>& values) const {
+#ifdef DEBUG_LUNAR_GRAVITY_FIELD
+  AppendVector(values, debug_pos_mcmf_m_);
+  AppendScalar(values, time_ms_);
+#endif
+
+  AppendVector(values, acceleration_mcmf_m_s2_);
+}
+
 LunarGravityField InitLunarGravityField(const std::string initialize_file_path) {
   auto conf = IniAccess(initialize_file_path);
   const char *section = "LUNAR_GRAVITY_FIELD";
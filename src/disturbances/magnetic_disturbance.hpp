@@ -10,6 +10,8 @@
 
 #include "../library/logger/loggable.hpp"
 #include "../library/math/vector.hpp"
+#include "../library/randomization/normal_randomization.hpp"
+#include "../library/randomization/random_walk.hpp"
 #include "../simulation/spacecraft/structure/residual_magnetic_moment.hpp"
 #include "disturbance.hpp"
 
@@ -46,6 +48,11 @@ class MagneticDisturbance : public Disturbance {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
  private:
   const double kMagUnit_ = 1.0e-9;  //!< Constant value to change the unit [nT] -> [T]
@@ -53,6 +60,10 @@ class MagneticDisturbance : public Disturbance {
   libra::Vector<3> rmm_b_Am2_;                              //!< True RMM of the spacecraft in the body frame [Am2]
   const ResidualMagneticMoment& residual_magnetic_moment_;  //!< RMM parameters
 
+  // The noise generators are seeded from global_randomization at the construction, so each Monte-Carlo case starts its own streams
+  RandomWalk<3> random_walk_Am2_;       //!< Random walk of RMM [Am2]
+  libra::NormalRand random_noise_Am2_;  //!< Random noise of RMM [Am2]
+
   /**
    * @fn CalcRMM
    * @brief Calculate true RMM of the spacecraft
@@ -17,7 +17,11 @@ SolarRadiationPressureDisturbance::SolarRadiationPressureDisturbance(const std::
 void SolarRadiationPressureDisturbance::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
   UNUSED(dynamics);
 
-  libra::Vector<3> sun_position_from_sc_b_m = local_environment.GetCelestialInformation().GetPositionFromSpacecraft_b_m("SUN");
+  if (!is_sun_resolved_) {
+    sun_ = local_environment.GetCelestialInformation().GetGlobalInformation().GetBodyHandle("SUN");
+    is_sun_resolved_ = true;
+  }
+  libra::Vector<3> sun_position_from_sc_b_m = local_environment.GetCelestialInformation().GetPositionFromSpacecraft_b_m(sun_);
   CalcTorqueForce(sun_position_from_sc_b_m, local_environment.GetSolarRadiationPressure().GetPressure_N_m2());
 }
 
@@ -52,6 +56,11 @@ std::string SolarRadiationPressureDisturbance::GetLogValue() const {
   return str_tmp;
 }
 
+void SolarRadiationPressureDisturbance::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, torque_b_Nm_);
+  AppendVector(values, force_b_N_);
+}
+
 SolarRadiationPressureDisturbance InitSolarRadiationPressureDisturbance(const std::string initialize_file_path, const std::vector<Surface>& surfaces,
                                                                         const Vector<3>& center_of_gravity_b_m) {
   auto conf = IniAccess(initialize_file_path);
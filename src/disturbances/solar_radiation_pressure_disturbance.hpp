@@ -47,8 +47,16 @@ class SolarRadiationPressureDisturbance : public SurfaceForce {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
  private:
+  CelestialBodyHandle sun_;       //!< Handle of the sun resolved at the first update
+  bool is_sun_resolved_ = false;  //!< Flag to show the handle of the sun is resolved
+
   /**
    * @fn CalcCoefficients
    * @brief Override CalcCoefficients function of SurfaceForce
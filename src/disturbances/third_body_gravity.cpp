@@ -17,11 +17,19 @@ ThirdBodyGravity::~ThirdBodyGravity() {}
 void ThirdBodyGravity::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
   acceleration_i_m_s2_ = libra::Vector<3>(0.0);  // initialize
 
+  // Resolve the body names only once
+  if (!is_third_body_resolved_) {
+    for (auto third_body : third_body_list_) {
+      third_bodies_.push_back(local_environment.GetCelestialInformation().GetGlobalInformation().GetBodyHandle(third_body.c_str()));
+    }
+    is_third_body_resolved_ = true;
+  }
+
   libra::Vector<3> sc_position_i_m = dynamics.GetOrbit().GetPosition_i_m();
-  for (auto third_body : third_body_list_) {
-    libra::Vector<3> third_body_position_from_sc_i_m = local_environment.GetCelestialInformation().GetPositionFromSpacecraft_i_m(third_body.c_str());
+  for (auto third_body : third_bodies_) {
+    libra::Vector<3> third_body_position_from_sc_i_m = local_environment.GetCelestialInformation().GetPositionFromSpacecraft_i_m(third_body);
     libra::Vector<3> third_body_pos_i_m = sc_position_i_m + third_body_position_from_sc_i_m;
-    double gravity_constant = local_environment.GetCelestialInformation().GetGlobalInformation().GetGravityConstant_m3_s2(third_body.c_str());
+    double gravity_constant = local_environment.GetCelestialInformation().GetGlobalInformation().GetGravityConstant_m3_s2(third_body);
 
     third_body_acceleration_i_m_s2_ = CalcAcceleration_i_m_s2(third_body_pos_i_m, third_body_position_from_sc_i_m, gravity_constant);
     acceleration_i_m_s2_ += third_body_acceleration_i_m_s2_;
@@ -56,6 +64,10 @@ std::string ThirdBodyGravity::GetLogValue() const {
   return str_tmp;
 }
 
+void ThirdBodyGravity::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, acceleration_i_m_s2_);
+}
+
 ThirdBodyGravity InitThirdBodyGravity(const std::string initialize_file_path, const std::string ini_path_celes) {
   // Generate a list of bodies to be calculated in "CelesInfo"
   auto conf_celes = IniAccess(ini_path_celes);
@@ -9,6 +9,7 @@
 #include <cassert>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "../library/logger/loggable.hpp"
 #include "../library/math/vector.hpp"
@@ -43,6 +44,8 @@ class ThirdBodyGravity : public Disturbance {
 
  private:
   std::set<std::string> third_body_list_;                 //!< List of celestial bodies to calculate the third body disturbances
+  std::vector<CelestialBodyHandle> third_bodies_;         //!< Handles of the third bodies resolved at the first update
+  bool is_third_body_resolved_ = false;                   //!< Flag to show the handles of the third bodies are resolved
   libra::Vector<3> third_body_acceleration_i_m_s2_{0.0};  //!< Calculated third body disturbance acceleration in the inertial frame [m/s2]
 
   // Override classes for ILoggable
@@ -56,6 +59,11 @@ class ThirdBodyGravity : public Disturbance {
    * @brief Override function of GetLogValue
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
   /**
    * @fn CalcAcceleration_i_m_s2
@@ -43,6 +43,14 @@ std::string Attitude::GetLogValue() const {
   return str_tmp;
 }
 
+void Attitude::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, angular_velocity_b_rad_s_);
+  AppendQuaternion(values, quaternion_i2b_);
+  AppendVector(values, torque_b_Nm_);
+  AppendScalar(values, angular_momentum_total_Nms_);
+  AppendScalar(values, kinetic_energy_J_);
+}
+
 void Attitude::SetParameters(const MonteCarloSimulationExecutor& mc_simulator) {
   GetInitializedMonteCarloParameterQuaternion(mc_simulator, "quaternion_i2b", quaternion_i2b_);
 }
@@ -112,6 +112,8 @@ class ControlledAttitude : public Attitude {
   // Inputs
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
   const Orbit* orbit_;                                            //!< Orbit information
+  CelestialBodyHandle sun_;                                       //!< Handle of the sun
+  CelestialBodyHandle earth_;                                     //!< Handle of the earth
 
   // Local functions
   /**
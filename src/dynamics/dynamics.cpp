@@ -14,6 +14,9 @@ Dynamics::Dynamics(const SimulationConfiguration* simulation_configuration, cons
   Initialize(simulation_configuration, simulation_time, spacecraft_id, structure, relative_information);
 }
 
+Dynamics::Dynamics(Attitude* attitude, Orbit* orbit)
+    : attitude_(attitude), orbit_(orbit), temperature_(nullptr), structure_(nullptr), local_environment_(nullptr) {}
+
 Dynamics::~Dynamics() {
   delete attitude_;
   delete orbit_;
@@ -23,6 +26,7 @@ Dynamics::~Dynamics() {
 void Dynamics::Initialize(const SimulationConfiguration* simulation_configuration, const SimulationTime* simulation_time, const int spacecraft_id,
                           Structure* structure, RelativeInformation* relative_information) {
   const LocalCelestialInformation& local_celestial_information = local_environment_->GetCelestialInformation();
+  sun_ = local_celestial_information.GetGlobalInformation().GetBodyHandle("SUN");
   // Initialize
   orbit_ = InitOrbit(&(local_celestial_information.GetGlobalInformation()), simulation_configuration->spacecraft_file_list_[spacecraft_id],
                      simulation_time->GetOrbitRkStepTime_s(), simulation_time->GetCurrentTime_jd(),
@@ -49,12 +53,8 @@ void Dynamics::Update(const SimulationTime* simulation_time, const LocalCelestia
   orbit_->UpdateByAttitude(attitude_->GetQuaternion_i2b());
 
   // Thermal
-  if (simulation_time->GetThermalPropagateFlag()) {
-    std::string sun_str = "SUN";
-    char* c_sun = new char[sun_str.size() + 1];
-    std::char_traits<char>::copy(c_sun, sun_str.c_str(), sun_str.size() + 1);  // string -> char*
-    temperature_->Propagate(local_celestial_information->GetPositionFromSpacecraft_b_m(c_sun), simulation_time->GetElapsedTime_s());
-    delete[] c_sun;
+  if (simulation_time->GetThermalPropagateFlag() && temperature_ != nullptr) {
+    temperature_->Propagate(local_celestial_information->GetPositionFromSpacecraft_b_m(sun_), simulation_time->GetElapsedTime_s());
   }
 }
 
@@ -67,5 +67,5 @@ void Dynamics::ClearForceTorque(void) {
 void Dynamics::LogSetup(Logger& logger) {
   logger.AddLogList(attitude_);
   logger.AddLogList(orbit_);
-  logger.AddLogList(temperature_);
+  if (temperature_ != nullptr) logger.AddLogList(temperature_);
 }
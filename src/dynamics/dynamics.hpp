@@ -38,6 +38,15 @@ class Dynamics {
    */
   Dynamics(const SimulationConfiguration* simulation_configuration, const SimulationTime* simulation_time, const LocalEnvironment* local_environment,
            const int spacecraft_id, Structure* structure, RelativeInformation* relative_information = (RelativeInformation*)nullptr);
+  /**
+   * @fn Dynamics
+   * @brief Constructor with the attitude and the orbit made by the caller, e.g. for the tests of the users of the spacecraft states
+   * @note The ownership of the attitude and the orbit is moved to this instance.
+   *       The thermal dynamics is not calculated, and AddForce_b_N is not available since the structure is not given.
+   * @param [in] attitude: Attitude dynamics
+   * @param [in] orbit: Orbit dynamics
+   */
+  Dynamics(Attitude* attitude, Orbit* orbit);
   /**
    * @fn ~Dynamics
    * @brief Destructor
@@ -112,6 +121,7 @@ class Dynamics {
   Temperature* temperature_;                   //!< Thermal dynamics
   const Structure* structure_;                 //!< Structure information
   const LocalEnvironment* local_environment_;  //!< Local environment
+  CelestialBodyHandle sun_;                    //!< Handle of the sun
 
   /**
    * @fn Initialize
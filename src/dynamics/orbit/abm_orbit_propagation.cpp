@@ -0,0 +1,90 @@
+/**
+ * @file abm_orbit_propagation.cpp
+ * @brief Class to propagate spacecraft orbit with 8th order Adams-Bashforth-Moulton method
+ */
+#include "abm_orbit_propagation.hpp"
+
+#include <library/utilities/macros.hpp>
+
+AbmOrbitPropagation::AbmOrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2,
+                                         const double step_width_s, const double acceleration_change_tolerance_m_s2,
+                                         const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s, const double initial_time_s)
+    : Orbit(celestial_information),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      acceleration_change_tolerance_m_s2_(acceleration_change_tolerance_m_s2),
+      step_acceleration_i_m_s2_(0.0),
+      integrator_(step_width_s, *this) {
+  propagate_mode_ = OrbitPropagateMode::kAbm;
+
+  Initialize(position_i_m, velocity_i_m_s, initial_time_s);
+}
+
+libra::Vector<6> AbmOrbitPropagation::DerivativeFunction(const double time_s, const libra::Vector<6>& state) const {
+  UNUSED(time_s);
+
+  libra::Vector<6> rhs;
+  const double r3 = pow(state[0] * state[0] + state[1] * state[1] + state[2] * state[2], 1.5);
+  for (size_t i = 0; i < 3; i++) {
+    rhs[i] = state[i + 3];
+    rhs[i + 3] = step_acceleration_i_m_s2_[i] - gravity_constant_m3_s2_ / r3 * state[i];
+  }
+  return rhs;
+}
+
+void AbmOrbitPropagation::Initialize(const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s, const double initial_time_s) {
+  // state vector [x,y,z,vx,vy,vz]
+  libra::Vector<6> initial_state;
+  for (size_t i = 0; i < 3; i++) {
+    initial_state[i] = position_i_m[i];
+    initial_state[i + 3] = velocity_i_m_s[i];
+  }
+  integrator_.SetState(initial_time_s, initial_state);
+  propagation_time_s_ = initial_time_s;
+
+  // initialize
+  spacecraft_acceleration_i_m_s2_ *= 0;
+  step_acceleration_i_m_s2_ *= 0;
+  spacecraft_position_i_m_ = position_i_m;
+  spacecraft_velocity_i_m_s_ = velocity_i_m_s;
+
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+void AbmOrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
+  UNUSED(current_time_jd);
+
+  if (!is_calc_enabled_) return;
+
+  // Restart from the latest output state when the acceleration jumps. Small changes are taken into account at the following nodes.
+  if ((spacecraft_acceleration_i_m_s2_ - step_acceleration_i_m_s2_).CalcNorm() > acceleration_change_tolerance_m_s2_) {
+    libra::Vector<6> state;
+    for (size_t i = 0; i < 3; i++) {
+      state[i] = spacecraft_position_i_m_[i];
+      state[i + 3] = spacecraft_velocity_i_m_s_[i];
+    }
+    integrator_.SetState(propagation_time_s_, state);
+  }
+  step_acceleration_i_m_s2_ = spacecraft_acceleration_i_m_s2_;
+
+  while (integrator_.GetIndependentVariable() < end_time_s) {
+    integrator_.Integrate();
+  }
+  propagation_time_s_ = end_time_s;
+
+  // Dense output
+  libra::Vector<6> state = integrator_.GetState();
+  const double step_width_s = integrator_.GetStepWidth();
+  const double sigma = 1.0 - (integrator_.GetIndependentVariable() - end_time_s) / step_width_s;
+  if (sigma < 1.0) {
+    state = integrator_.CalcInterpolationState(sigma);
+  }
+
+  for (size_t i = 0; i < 3; i++) {
+    spacecraft_position_i_m_[i] = state[i];
+    spacecraft_velocity_i_m_s_[i] = state[i + 3];
+  }
+
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
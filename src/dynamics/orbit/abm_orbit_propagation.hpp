@@ -0,0 +1,86 @@
+/**
+ * @file abm_orbit_propagation.hpp
+ * @brief Class to propagate spacecraft orbit with 8th order Adams-Bashforth-Moulton method
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_ABM_ORBIT_PROPAGATION_HPP_
+#define S2E_DYNAMICS_ORBIT_ABM_ORBIT_PROPAGATION_HPP_
+
+#include <library/numerical_integration/adams_bashforth_moulton.hpp>
+
+#include "orbit.hpp"
+
+/**
+ * @class AbmOrbitPropagation
+ * @brief Class to propagate spacecraft orbit with 8th order Adams-Bashforth-Moulton method
+ * @details The predictor-corrector integrator takes fixed steps, which can be longer than the simulation step, and the position and velocity at
+ *          the simulation time are calculated by the dense output of the integrator. The acceleration by disturbances and thrusters is
+ *          evaluated with the latest value at each node, and the integration is restarted from the current time when the acceleration jumps
+ *          more than the tolerance since the history of the derivatives cannot express the discontinuity.
+ */
+class AbmOrbitPropagation : public Orbit, public libra::numerical_integration::InterfaceOde<6> {
+ public:
+  /**
+   * @fn AbmOrbitPropagation
+   * @brief Constructor
+   * @param [in] celestial_information: Celestial information
+   * @param [in] gravity_constant_m3_s2: Gravity constant [m3/s2]
+   * @param [in] step_width_s: Step width of the integrator [sec]
+   * @param [in] acceleration_change_tolerance_m_s2: Tolerance of the change of the acceleration to restart the integration [m/s2]
+   * @param [in] position_i_m: Initial value of position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
+   * @param [in] initial_time_s: Initial time [sec]
+   */
+  AbmOrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2, const double step_width_s,
+                      const double acceleration_change_tolerance_m_s2, const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s,
+                      const double initial_time_s = 0.0);
+  /**
+   * @fn ~AbmOrbitPropagation
+   * @brief Destructor
+   */
+  ~AbmOrbitPropagation() {}
+
+  // Override InterfaceOde
+  /**
+   * @fn DerivativeFunction
+   * @brief Right Hand Side of ordinary difference equation
+   * @param [in] time_s: Time as independent variable [sec]
+   * @param [in] state: Position and velocity as state vector
+   * @return Differentiated value of state vector
+   */
+  virtual libra::Vector<6> DerivativeFunction(const double time_s, const libra::Vector<6>& state) const;
+
+  // Override Orbit
+  /**
+   * @fn Propagate
+   * @brief Propagate orbit
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  virtual void Propagate(const double end_time_s, const double current_time_jd);
+
+  /**
+   * @fn IsStartUp
+   * @brief Return true when the integrator uses RK4 in the start up after the initialization or the restart
+   */
+  inline bool IsStartUp() const { return integrator_.IsStartUp(); }
+
+ private:
+  const double gravity_constant_m3_s2_;              //!< Gravity constant [m3/s2]
+  const double acceleration_change_tolerance_m_s2_;  //!< Tolerance of the change of the acceleration to restart the integration [m/s2]
+
+  libra::Vector<3> step_acceleration_i_m_s2_;                          //!< Acceleration by disturbances and thrusters used in the integration [m/s2]
+  libra::numerical_integration::AdamsBashforthMoulton<6> integrator_;  //!< Integrator
+  double propagation_time_s_;                                          //!< Time of the latest output position and velocity [sec]
+
+  /**
+   * @fn Initialize
+   * @brief Initialize function
+   * @param [in] position_i_m: Initial value of position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
+   * @param [in] initial_time_s: Initial time [sec]
+   */
+  void Initialize(const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s, const double initial_time_s);
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_ABM_ORBIT_PROPAGATION_HPP_
@@ -6,10 +6,12 @@
 
 #include <library/initialize/initialize_file_access.hpp>
 
+#include "abm_orbit_propagation.hpp"
 #include "encke_orbit_propagation.hpp"
 #include "kepler_orbit_propagation.hpp"
 #include "relative_orbit.hpp"
 #include "rk4_orbit_propagation.hpp"
+#include "rkf78_orbit_propagation.hpp"
 #include "sgp4_orbit_propagation.hpp"
 
 Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string initialize_file, double step_width_s, double current_time_jd,
@@ -96,6 +98,35 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
     double error_tolerance = conf.ReadDouble(section_, "error_tolerance");
     orbit = new EnckeOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, current_time_jd, position_i_m, velocity_i_m_s,
                                       error_tolerance);
+  } else if (propagate_mode == "RKF78") {
+    // initialize RKF78 orbit propagator
+    libra::Vector<3> position_i_m;
+    libra::Vector<3> velocity_i_m_s;
+    libra::Vector<6> pos_vel = InitializePosVel(initialize_file, current_time_jd, gravity_constant_m3_s2);
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = pos_vel[i];
+      velocity_i_m_s[i] = pos_vel[i + 3];
+    }
+
+    double maximum_step_width_s = conf.ReadDouble(section_, "rkf78_maximum_step_width_s");
+    double error_tolerance = conf.ReadDouble(section_, "rkf78_error_tolerance");
+    double acceleration_change_tolerance_m_s2 = conf.ReadDouble(section_, "rkf78_acceleration_change_tolerance_m_s2");
+    orbit = new Rkf78OrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, maximum_step_width_s, error_tolerance,
+                                      acceleration_change_tolerance_m_s2, position_i_m, velocity_i_m_s);
+  } else if (propagate_mode == "ABM") {
+    // initialize ABM orbit propagator
+    libra::Vector<3> position_i_m;
+    libra::Vector<3> velocity_i_m_s;
+    libra::Vector<6> pos_vel = InitializePosVel(initialize_file, current_time_jd, gravity_constant_m3_s2);
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = pos_vel[i];
+      velocity_i_m_s[i] = pos_vel[i + 3];
+    }
+
+    double abm_step_width_s = conf.ReadDouble(section_, "abm_step_width_s");
+    double acceleration_change_tolerance_m_s2 = conf.ReadDouble(section_, "abm_acceleration_change_tolerance_m_s2");
+    orbit = new AbmOrbitPropagation(celestial_information, gravity_constant_m3_s2, abm_step_width_s, acceleration_change_tolerance_m_s2,
+                                    position_i_m, velocity_i_m_s);
   } else {
     std::cerr << "ERROR: orbit propagation mode: " << propagate_mode << " is not defined!" << std::endl;
     std::cerr << "The orbit mode is automatically set as RK4" << std::endl;
@@ -4,11 +4,12 @@
  */
 #include "orbit.hpp"
 
-libra::Quaternion Orbit::CalcQuaternion_i2lvlh() const {
-  libra::Vector<3> lvlh_x = spacecraft_position_i_m_;  // x-axis in LVLH frame is position vector direction from geocenter to satellite
+libra::Quaternion Orbit::CalcQuaternion_i2lvlh() const { return CalcQuaternion_i2lvlh(spacecraft_position_i_m_, spacecraft_velocity_i_m_s_); }
+
+libra::Quaternion Orbit::CalcQuaternion_i2lvlh(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) {
+  libra::Vector<3> lvlh_x = position_i_m;  // x-axis in LVLH frame is position vector direction from geocenter to satellite
   libra::Vector<3> lvlh_ex = lvlh_x.CalcNormalizedVector();
-  libra::Vector<3> lvlh_z =
-      OuterProduct(spacecraft_position_i_m_, spacecraft_velocity_i_m_s_);  // z-axis in LVLH frame is angular momentum vector direction of orbit
+  libra::Vector<3> lvlh_z = OuterProduct(position_i_m, velocity_i_m_s);  // z-axis in LVLH frame is angular momentum vector direction of orbit
   libra::Vector<3> lvlh_ez = lvlh_z.CalcNormalizedVector();
   libra::Vector<3> lvlh_y = OuterProduct(lvlh_z, lvlh_x);
   libra::Vector<3> lvlh_ey = lvlh_y.CalcNormalizedVector();
@@ -91,3 +92,13 @@ std::string Orbit::GetLogValue() const {
 
   return str_tmp;
 }
+
+void Orbit::AppendLogValue(std::vector<double>& values) const {
+  AppendVector(values, spacecraft_position_i_m_);
+  AppendVector(values, spacecraft_velocity_i_m_s_);
+  AppendVector(values, spacecraft_velocity_b_m_s_);
+  AppendVector(values, spacecraft_acceleration_i_m_s2_);
+  AppendScalar(values, spacecraft_geodetic_position_.GetLatitude_rad());
+  AppendScalar(values, spacecraft_geodetic_position_.GetLongitude_rad());
+  AppendScalar(values, spacecraft_geodetic_position_.GetAltitude_m());
+}
@@ -25,7 +25,9 @@ enum class OrbitPropagateMode {
   kSgp4,           //!< SGP4 propagation using TLE without thruster maneuver
   kRelativeOrbit,  //!< Relative dynamics (for formation flying simulation)
   kKepler,         //!< Kepler orbit propagation without disturbances and thruster maneuver
-  kEncke           //!< Encke orbit propagation with disturbances and thruster maneuver
+  kEncke,          //!< Encke orbit propagation with disturbances and thruster maneuver
+  kRkf78,          //!< 7th/8th order Runge-Kutta-Fehlberg propagation with step width control, disturbances and thruster maneuver
+  kAbm             //!< 8th order Adams-Bashforth-Moulton propagation with disturbances and thruster maneuver
 };
 
 /**
@@ -171,6 +173,13 @@ class Orbit : public ILoggable {
    * @brief Calculate and return quaternion from the inertial frame to the LVLH frame
    */
   libra::Quaternion CalcQuaternion_i2lvlh() const;
+  /**
+   * @fn CalcQuaternion_i2lvlh
+   * @brief Calculate and return quaternion from the inertial frame to the LVLH frame for the given orbital state
+   * @param [in] position_i_m: Position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Velocity in the inertial frame [m/s]
+   */
+  static libra::Quaternion CalcQuaternion_i2lvlh(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s);
 
   // Override ILoggable
   /**
@@ -183,6 +192,11 @@ class Orbit : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
  protected:
   const CelestialInformation* celestial_information_;  //!< Celestial information
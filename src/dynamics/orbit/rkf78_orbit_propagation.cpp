@@ -0,0 +1,129 @@
+/**
+ * @file rkf78_orbit_propagation.cpp
+ * @brief Class to propagate spacecraft orbit with 7th/8th order Runge-Kutta-Fehlberg method and step width control
+ */
+#include "rkf78_orbit_propagation.hpp"
+
+#include <algorithm>
+#include <library/utilities/macros.hpp>
+
+Rkf78OrbitPropagation::Rkf78OrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2,
+                                             const double initial_step_width_s, const double maximum_step_width_s, const double error_tolerance,
+                                             const double acceleration_change_tolerance_m_s2, const libra::Vector<3> position_i_m,
+                                             const libra::Vector<3> velocity_i_m_s, const double initial_time_s)
+    : Orbit(celestial_information),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      maximum_step_width_s_(maximum_step_width_s),
+      error_tolerance_(error_tolerance),
+      acceleration_change_tolerance_m_s2_(acceleration_change_tolerance_m_s2),
+      step_acceleration_i_m_s2_(0.0),
+      integrator_(initial_step_width_s, *this) {
+  propagate_mode_ = OrbitPropagateMode::kRkf78;
+  if (maximum_step_width_s_ < initial_step_width_s) maximum_step_width_s_ = initial_step_width_s;
+
+  Initialize(position_i_m, velocity_i_m_s, initial_time_s);
+}
+
+libra::Vector<6> Rkf78OrbitPropagation::DerivativeFunction(const double time_s, const libra::Vector<6>& state) const {
+  UNUSED(time_s);
+
+  libra::Vector<6> rhs;
+  const double r3 = pow(state[0] * state[0] + state[1] * state[1] + state[2] * state[2], 1.5);
+  for (size_t i = 0; i < 3; i++) {
+    rhs[i] = state[i + 3];
+    rhs[i + 3] = step_acceleration_i_m_s2_[i] - gravity_constant_m3_s2_ / r3 * state[i];
+  }
+  return rhs;
+}
+
+void Rkf78OrbitPropagation::Initialize(const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s, const double initial_time_s) {
+  // state vector [x,y,z,vx,vy,vz]
+  libra::Vector<6> initial_state;
+  for (size_t i = 0; i < 3; i++) {
+    initial_state[i] = position_i_m[i];
+    initial_state[i + 3] = velocity_i_m_s[i];
+  }
+  integrator_.SetState(initial_time_s, initial_state);
+  propagation_time_s_ = initial_time_s;
+  step_begin_time_s_ = initial_time_s;
+  is_restarted_ = true;
+
+  // initialize
+  spacecraft_acceleration_i_m_s2_ *= 0;
+  step_acceleration_i_m_s2_ *= 0;
+  spacecraft_position_i_m_ = position_i_m;
+  spacecraft_velocity_i_m_s_ = velocity_i_m_s;
+
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+void Rkf78OrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
+  UNUSED(current_time_jd);
+
+  if (!is_calc_enabled_) return;
+
+  // Restart from the latest output state since the steps after it used the old acceleration
+  if ((spacecraft_acceleration_i_m_s2_ - step_acceleration_i_m_s2_).CalcNorm() > acceleration_change_tolerance_m_s2_) {
+    step_acceleration_i_m_s2_ = spacecraft_acceleration_i_m_s2_;
+    libra::Vector<6> state;
+    for (size_t i = 0; i < 3; i++) {
+      state[i] = spacecraft_position_i_m_[i];
+      state[i + 3] = spacecraft_velocity_i_m_s_[i];
+    }
+    integrator_.SetState(propagation_time_s_, state);
+    step_begin_time_s_ = propagation_time_s_;
+    is_restarted_ = true;
+  }
+
+  while (integrator_.GetIndependentVariable() < end_time_s) {
+    if (is_restarted_) {
+      // The dense output of the first step after the restart is cubic, so the step ends at the output time and the step width is restored
+      const double step_width_s = integrator_.GetStepWidth();
+      integrator_.SetStepWidth(std::min(step_width_s, end_time_s - integrator_.GetIndependentVariable()));
+      Step();
+      integrator_.SetStepWidth(std::max(integrator_.GetStepWidth(), step_width_s));
+      is_restarted_ = false;
+    } else {
+      Step();
+    }
+  }
+  propagation_time_s_ = end_time_s;
+
+  // Dense output
+  libra::Vector<6> state = integrator_.GetState();
+  const double step_width_s = integrator_.GetIndependentVariable() - step_begin_time_s_;
+  if (step_width_s > 0.0) {
+    state = integrator_.CalcInterpolationState((end_time_s - step_begin_time_s_) / step_width_s);
+  }
+
+  for (size_t i = 0; i < 3; i++) {
+    spacecraft_position_i_m_[i] = state[i];
+    spacecraft_velocity_i_m_s_[i] = state[i + 3];
+  }
+
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+void Rkf78OrbitPropagation::Step() {
+  const double begin_time_s = integrator_.GetIndependentVariable();
+  const double minimum_step_width_s = 1.0e-3;
+  while (true) {
+    const double step_width_s = integrator_.GetStepWidth();
+    integrator_.Integrate();
+
+    // Step width control with the safety factor 0.9 and the exponent 1 / (p + 1) for the 7th order error estimation
+    const double error_ratio = integrator_.GetLocalTruncationError() / error_tolerance_;
+    double scale = 5.0;
+    if (error_ratio > 0.0) scale = std::min(std::max(0.9 * pow(error_ratio, -1.0 / 8.0), 0.2), 5.0);
+    const double next_step_width_s = std::max(std::min(step_width_s * scale, maximum_step_width_s_), minimum_step_width_s);
+
+    if (error_ratio <= 1.0 || step_width_s <= minimum_step_width_s) {
+      integrator_.SetStepWidth(next_step_width_s);
+      break;
+    }
+    integrator_.RetryStep(next_step_width_s);
+  }
+  step_begin_time_s_ = begin_time_s;
+}
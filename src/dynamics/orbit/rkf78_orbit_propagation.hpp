@@ -0,0 +1,91 @@
+/**
+ * @file rkf78_orbit_propagation.hpp
+ * @brief Class to propagate spacecraft orbit with 7th/8th order Runge-Kutta-Fehlberg method and step width control
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_RKF78_ORBIT_PROPAGATION_HPP_
+#define S2E_DYNAMICS_ORBIT_RKF78_ORBIT_PROPAGATION_HPP_
+
+#include <library/numerical_integration/runge_kutta_fehlberg_78.hpp>
+
+#include "orbit.hpp"
+
+/**
+ * @class Rkf78OrbitPropagation
+ * @brief Class to propagate spacecraft orbit with 7th/8th order Runge-Kutta-Fehlberg method and step width control
+ * @details The integrator takes large steps controlled by the local truncation error, and the position and velocity at the simulation time are
+ *          calculated by the dense output of the integrator. The acceleration by disturbances and thrusters is regarded as constant in a step,
+ *          and the integration is restarted from the current time when the acceleration changes more than the tolerance. The first step
+ *          after the restart ends at the output time since only the cubic interpolation is available in the step.
+ */
+class Rkf78OrbitPropagation : public Orbit, public libra::numerical_integration::InterfaceOde<6> {
+ public:
+  /**
+   * @fn Rkf78OrbitPropagation
+   * @brief Constructor
+   * @param [in] celestial_information: Celestial information
+   * @param [in] gravity_constant_m3_s2: Gravity constant [m3/s2]
+   * @param [in] initial_step_width_s: Initial step width [sec]
+   * @param [in] maximum_step_width_s: Maximum step width [sec]
+   * @param [in] error_tolerance: Tolerance of the local truncation error of position [m] and velocity [m/s] in a step
+   * @param [in] acceleration_change_tolerance_m_s2: Tolerance of the change of the acceleration to restart the integration [m/s2]
+   * @param [in] position_i_m: Initial value of position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
+   * @param [in] initial_time_s: Initial time [sec]
+   */
+  Rkf78OrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2, const double initial_step_width_s,
+                        const double maximum_step_width_s, const double error_tolerance, const double acceleration_change_tolerance_m_s2,
+                        const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s, const double initial_time_s = 0.0);
+  /**
+   * @fn ~Rkf78OrbitPropagation
+   * @brief Destructor
+   */
+  ~Rkf78OrbitPropagation() {}
+
+  // Override InterfaceOde
+  /**
+   * @fn DerivativeFunction
+   * @brief Right Hand Side of ordinary difference equation
+   * @param [in] time_s: Time as independent variable [sec]
+   * @param [in] state: Position and velocity as state vector
+   * @return Differentiated value of state vector
+   */
+  virtual libra::Vector<6> DerivativeFunction(const double time_s, const libra::Vector<6>& state) const;
+
+  // Override Orbit
+  /**
+   * @fn Propagate
+   * @brief Propagate orbit
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  virtual void Propagate(const double end_time_s, const double current_time_jd);
+
+ private:
+  const double gravity_constant_m3_s2_;              //!< Gravity constant [m3/s2]
+  double maximum_step_width_s_;                      //!< Maximum step width [sec]
+  const double error_tolerance_;                     //!< Tolerance of the local truncation error in a step
+  const double acceleration_change_tolerance_m_s2_;  //!< Tolerance of the change of the acceleration to restart the integration [m/s2]
+
+  libra::Vector<3> step_acceleration_i_m_s2_;                         //!< Acceleration by disturbances and thrusters used in the integration [m/s2]
+  libra::numerical_integration::RungeKuttaFehlberg78<6> integrator_;  //!< Integrator
+  double propagation_time_s_;                                         //!< Time of the latest output position and velocity [sec]
+  double step_begin_time_s_;                                          //!< Beginning time of the latest step of the integrator [sec]
+  bool is_restarted_;                                                 //!< The integration is restarted and the first step is not taken yet
+
+  /**
+   * @fn Initialize
+   * @brief Initialize function
+   * @param [in] position_i_m: Initial value of position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
+   * @param [in] initial_time_s: Initial time [sec]
+   */
+  void Initialize(const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s, const double initial_time_s);
+  /**
+   * @fn Step
+   * @brief Integrate one step with the step width control. The step is retried with a smaller step width when the error is too large.
+   */
+  void Step();
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_RKF78_ORBIT_PROPAGATION_HPP_
@@ -0,0 +1,178 @@
+/**
+ * @file test_abm_orbit_propagation.cpp
+ * @brief Test codes for AbmOrbitPropagation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <library/orbit/kepler_orbit.hpp>
+
+#include "abm_orbit_propagation.hpp"
+#include "rk4_orbit_propagation.hpp"
+#include "test_orbit_propagation_helper.hpp"
+
+using namespace test_orbit_propagation;
+
+namespace {
+const double kStepWidth_s = 10.0;                         //!< Step width of the integrator as the sample satellite [s]
+const double kAccelerationChangeTolerance_m_s2 = 1.0e-7;  //!< Tolerance of the acceleration change as the sample satellite [m/s2]
+const int kNumberOfStartUpSteps = 7;                      //!< Number of the RK4 steps before the predictor-corrector is used
+}  // namespace
+
+/**
+ * @brief Test the two-body propagation with the Kepler orbit for several orbits
+ * @note The simulation step is shorter than the integrator step, so the most of the outputs are given by the dense output.
+ */
+TEST(AbmOrbitPropagation, TwoBody) {
+  CelestialInformation celestial_information = MakeEarthCenteredCelestialInformation();
+  KeplerOrbit kepler_orbit(kGravityConstant_m3_s2, MakeLeoOrbitalElements());
+  kepler_orbit.CalcOrbit(0.0);
+
+  AbmOrbitPropagation orbit(&celestial_information, kGravityConstant_m3_s2, kStepWidth_s, kAccelerationChangeTolerance_m_s2,
+                            kepler_orbit.GetPosition_i_m(), kepler_orbit.GetVelocity_i_m_s());
+  orbit.SetIsCalcEnabled(true);
+
+  // Three orbits with the simulation step of 1 s
+  for (int step = 1; step <= 3 * 5600; step++) {
+    const double time_s = step * 1.0;
+    orbit.Propagate(time_s, 0.0);
+    kepler_orbit.CalcOrbit(time_s / kSecondsPerDay);
+    EXPECT_NEAR(0.0, (orbit.GetPosition_i_m() - kepler_orbit.GetPosition_i_m()).CalcNorm(), 1.0e-2);
+    EXPECT_NEAR(0.0, (orbit.GetVelocity_i_m_s() - kepler_orbit.GetVelocity_i_m_s()).CalcNorm(), 1.0e-5);
+  }
+}
+
+/**
+ * @brief Test the RK4 start up and the switch to the predictor-corrector
+ * @note The integrator takes RK4 steps until the history of the derivatives is filled. The outputs in and after the start up are compared with
+ *       the Kepler orbit at the simulation step of 1 s, so the Hermite interpolation and the interpolation of the corrector are both used.
+ */
+TEST(AbmOrbitPropagation, StartUp) {
+  CelestialInformation celestial_information = MakeEarthCenteredCelestialInformation();
+  KeplerOrbit kepler_orbit(kGravityConstant_m3_s2, MakeLeoOrbitalElements());
+  kepler_orbit.CalcOrbit(0.0);
+
+  AbmOrbitPropagation orbit(&celestial_information, kGravityConstant_m3_s2, kStepWidth_s, kAccelerationChangeTolerance_m_s2,
+                            kepler_orbit.GetPosition_i_m(), kepler_orbit.GetVelocity_i_m_s());
+  orbit.SetIsCalcEnabled(true);
+  EXPECT_TRUE(orbit.IsStartUp());
+
+  for (int step = 1; step <= 20 * kStepWidth_s; step++) {
+    const double time_s = step * 1.0;
+    orbit.Propagate(time_s, 0.0);
+    // The derivative at the end node of the k-th step is the (k + 1)-th in the history
+    const int number_of_steps = (int)std::ceil(time_s / kStepWidth_s);
+    EXPECT_EQ(number_of_steps < kNumberOfStartUpSteps, orbit.IsStartUp()) << "time_s: " << time_s;
+
+    kepler_orbit.CalcOrbit(time_s / kSecondsPerDay);
+    EXPECT_NEAR(0.0, (orbit.GetPosition_i_m() - kepler_orbit.GetPosition_i_m()).CalcNorm(), 1.0e-2) << "time_s: " << time_s;
+    EXPECT_NEAR(0.0, (orbit.GetVelocity_i_m_s() - kepler_orbit.GetVelocity_i_m_s()).CalcNorm(), 1.0e-5) << "time_s: " << time_s;
+  }
+}
+
+/**
+ * @brief Test the dense output between the steps of the integrator
+ * @note The nodes of the integrator do not depend on the output times, so the outputs at the same time must agree for any output schedule.
+ */
+TEST(AbmOrbitPropagation, DenseOutput) {
+  CelestialInformation celestial_information = MakeEarthCenteredCelestialInformation();
+  KeplerOrbit kepler_orbit(kGravityConstant_m3_s2, MakeLeoOrbitalElements());
+  kepler_orbit.CalcOrbit(0.0);
+
+  AbmOrbitPropagation fine_orbit(&celestial_information, kGravityConstant_m3_s2, kStepWidth_s, kAccelerationChangeTolerance_m_s2,
+                                 kepler_orbit.GetPosition_i_m(), kepler_orbit.GetVelocity_i_m_s());
+  fine_orbit.SetIsCalcEnabled(true);
+  AbmOrbitPropagation coarse_orbit(&celestial_information, kGravityConstant_m3_s2, kStepWidth_s, kAccelerationChangeTolerance_m_s2,
+                                   kepler_orbit.GetPosition_i_m(), kepler_orbit.GetVelocity_i_m_s());
+  coarse_orbit.SetIsCalcEnabled(true);
+
+  // Output times on the nodes, close to the nodes, and in the middle of the steps
+  const std::vector<double> output_times_s = {3.7, 10.0, 10.001, 19.999, 125.0, 1000.0, 1003.3, 2718.28, 5599.5};
+  double fine_time_s = 0.0;
+  for (const double output_time_s : output_times_s) {
+    // The fine orbit is output at every 0.1 s until the output time
+    while (fine_time_s + 0.1 < output_time_s) {
+      fine_time_s += 0.1;
+      fine_orbit.Propagate(fine_time_s, 0.0);
+    }
+    fine_time_s = output_time_s;
+    fine_orbit.Propagate(output_time_s, 0.0);
+    coarse_orbit.Propagate(output_time_s, 0.0);
+
+    EXPECT_NEAR(0.0, (fine_orbit.GetPosition_i_m() - coarse_orbit.GetPosition_i_m()).CalcNorm(), 1.0e-6) << "time_s: " << output_time_s;
+    EXPECT_NEAR(0.0, (fine_orbit.GetVelocity_i_m_s() - coarse_orbit.GetVelocity_i_m_s()).CalcNorm(), 1.0e-9) << "time_s: " << output_time_s;
+
+    kepler_orbit.CalcOrbit(output_time_s / kSecondsPerDay);
+    EXPECT_NEAR(0.0, (coarse_orbit.GetPosition_i_m() - kepler_orbit.GetPosition_i_m()).CalcNorm(), 1.0e-2) << "time_s: " << output_time_s;
+    EXPECT_NEAR(0.0, (coarse_orbit.GetVelocity_i_m_s() - kepler_orbit.GetVelocity_i_m_s()).CalcNorm(), 1.0e-5) << "time_s: " << output_time_s;
+  }
+}
+
+/**
+ * @brief Test the restart of the integration by the change of the acceleration
+ * @note The acceleration is added for 10 s. The orbit after that is compared with the Kepler orbit of the state given by RK4 with a small step.
+ *       Before the maneuver, the acceleration changes less than the tolerance at every step.
+ */
+TEST(AbmOrbitPropagation, AccelerationChangeRestart) {
+  CelestialInformation celestial_information = MakeEarthCenteredCelestialInformation();
+  KeplerOrbit kepler_orbit(kGravityConstant_m3_s2, MakeLeoOrbitalElements());
+  kepler_orbit.CalcOrbit(0.0);
+
+  AbmOrbitPropagation orbit(&celestial_information, kGravityConstant_m3_s2, kStepWidth_s, kAccelerationChangeTolerance_m_s2,
+                            kepler_orbit.GetPosition_i_m(), kepler_orbit.GetVelocity_i_m_s());
+  orbit.SetIsCalcEnabled(true);
+
+  const double maneuver_start_time_s = 1000.0;
+  const double maneuver_end_time_s = 1010.0;
+  libra::Vector<3> acceleration_i_m_s2(0.0);
+  acceleration_i_m_s2[0] = 1.0e-3;
+  acceleration_i_m_s2[2] = -2.0e-3;
+
+  for (int step = 1; step <= maneuver_start_time_s; step++) {
+    // The acceleration smaller than the tolerance does not restart the integration
+    libra::Vector<3> small_acceleration_i_m_s2(0.0);
+    small_acceleration_i_m_s2[1] = (step % 2) * 0.1 * kAccelerationChangeTolerance_m_s2;
+    orbit.SetAcceleration_i_m_s2(small_acceleration_i_m_s2);
+    orbit.Propagate(step * 1.0, 0.0);
+  }
+  EXPECT_FALSE(orbit.IsStartUp());
+  kepler_orbit.CalcOrbit(maneuver_start_time_s / kSecondsPerDay);
+  EXPECT_NEAR(0.0, (orbit.GetPosition_i_m() - kepler_orbit.GetPosition_i_m()).CalcNorm(), 1.0e-2);
+
+  // The reference starts from the state including the small acceleration, and its time is measured from the start of the maneuver
+  Rk4OrbitPropagation reference_orbit(&celestial_information, kGravityConstant_m3_s2, 1.0e-2, orbit.GetPosition_i_m(),
+                                      orbit.GetVelocity_i_m_s());
+  reference_orbit.SetIsCalcEnabled(true);
+
+  // Maneuver
+  for (int step = maneuver_start_time_s + 1; step <= maneuver_end_time_s; step++) {
+    const double time_s = step * 1.0;
+    orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+    orbit.Propagate(time_s, 0.0);
+    EXPECT_TRUE(orbit.IsStartUp());
+    reference_orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+    reference_orbit.Propagate(time_s - maneuver_start_time_s, 0.0);
+    EXPECT_NEAR(0.0, (orbit.GetPosition_i_m() - reference_orbit.GetPosition_i_m()).CalcNorm(), 1.0e-2);
+  }
+
+  // Kepler orbit after the maneuver
+  KeplerOrbit maneuvered_kepler_orbit(kGravityConstant_m3_s2,
+                                      OrbitalElements(kGravityConstant_m3_s2, maneuver_end_time_s / kSecondsPerDay, reference_orbit.GetPosition_i_m(),
+                                                      reference_orbit.GetVelocity_i_m_s()));
+  maneuvered_kepler_orbit.CalcOrbit(maneuver_end_time_s / kSecondsPerDay);
+  kepler_orbit.CalcOrbit(maneuver_end_time_s / kSecondsPerDay);
+  EXPECT_GT((maneuvered_kepler_orbit.GetPosition_i_m() - kepler_orbit.GetPosition_i_m()).CalcNorm(), 0.1);
+
+  for (int step = maneuver_end_time_s + 1; step <= 3 * 5600; step++) {
+    const double time_s = step * 1.0;
+    orbit.SetAcceleration_i_m_s2(libra::Vector<3>(0.0));
+    orbit.Propagate(time_s, 0.0);
+    // Restarted again at the end of the maneuver
+    const int number_of_steps = (int)std::ceil((time_s - maneuver_end_time_s) / kStepWidth_s);
+    EXPECT_EQ(number_of_steps < kNumberOfStartUpSteps, orbit.IsStartUp()) << "time_s: " << time_s;
+
+    maneuvered_kepler_orbit.CalcOrbit(time_s / kSecondsPerDay);
+    EXPECT_NEAR(0.0, (orbit.GetPosition_i_m() - maneuvered_kepler_orbit.GetPosition_i_m()).CalcNorm(), 1.0e-2);
+    EXPECT_NEAR(0.0, (orbit.GetVelocity_i_m_s() - maneuvered_kepler_orbit.GetVelocity_i_m_s()).CalcNorm(), 1.0e-5);
+  }
+}
@@ -0,0 +1,37 @@
+/**
+ * @file test_orbit_propagation_helper.hpp
+ * @brief Common settings for the test codes of the orbit propagation classes
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_TEST_ORBIT_PROPAGATION_HELPER_HPP_
+#define S2E_DYNAMICS_ORBIT_TEST_ORBIT_PROPAGATION_HELPER_HPP_
+
+#include <environment/global/celestial_information.hpp>
+#include <environment/global/physical_constants.hpp>
+#include <library/orbit/orbital_elements.hpp>
+#include <string>
+#include <vector>
+
+namespace test_orbit_propagation {
+const double kGravityConstant_m3_s2 = environment::earth_gravitational_constant_m3_s2;  //!< Gravity constant of the Earth [m3/s2]
+const double kSecondsPerDay = 24.0 * 60.0 * 60.0;                                       //!< Seconds per day [s/day]
+
+/**
+ * @fn MakeLeoOrbitalElements
+ * @brief Return the orbital elements of the LEO in the sample satellite
+ * @note The epoch is zero so that the resolution of the time expressed as Julian day is enough for the comparison
+ */
+inline OrbitalElements MakeLeoOrbitalElements() { return OrbitalElements(0.0, 6794500.0, 0.0015, 0.9012, 0.1411, 1.7952); }
+
+/**
+ * @fn MakeEarthCenteredCelestialInformation
+ * @brief Return the celestial information without selected bodies
+ * @note Only the center body is used, so the SPICE kernels are not needed.
+ *       CelestialInformation takes the ownership of the array of the selected body IDs and deletes it in the destructor.
+ */
+inline CelestialInformation MakeEarthCenteredCelestialInformation() {
+  return CelestialInformation("J2000", "NONE", "EARTH", 0, new int[0], std::vector<std::string>());
+}
+}  // namespace test_orbit_propagation
+
+#endif  // S2E_DYNAMICS_ORBIT_TEST_ORBIT_PROPAGATION_HELPER_HPP_
@@ -0,0 +1,91 @@
+/**
+ * @file test_rkf78_orbit_propagation.cpp
+ * @brief Test codes for Rkf78OrbitPropagation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <library/orbit/kepler_orbit.hpp>
+
+#include "rk4_orbit_propagation.hpp"
+#include "rkf78_orbit_propagation.hpp"
+#include "test_orbit_propagation_helper.hpp"
+
+using namespace test_orbit_propagation;
+
+/**
+ * @brief Test the two-body propagation with the Kepler orbit
+ */
+TEST(Rkf78OrbitPropagation, TwoBody) {
+  CelestialInformation celestial_information = MakeEarthCenteredCelestialInformation();
+  KeplerOrbit kepler_orbit(kGravityConstant_m3_s2, MakeLeoOrbitalElements());
+  kepler_orbit.CalcOrbit(0.0);
+
+  Rkf78OrbitPropagation orbit(&celestial_information, kGravityConstant_m3_s2, 1.0, 300.0, 1.0e-6, 1.0e-8, kepler_orbit.GetPosition_i_m(),
+                              kepler_orbit.GetVelocity_i_m_s());
+  orbit.SetIsCalcEnabled(true);
+
+  // One orbit with the simulation step of 1 s
+  for (int step = 1; step <= 5600; step++) {
+    const double time_s = step * 1.0;
+    orbit.Propagate(time_s, 0.0);
+    kepler_orbit.CalcOrbit(time_s / kSecondsPerDay);
+    EXPECT_NEAR(0.0, (orbit.GetPosition_i_m() - kepler_orbit.GetPosition_i_m()).CalcNorm(), 1.0e-2);
+    EXPECT_NEAR(0.0, (orbit.GetVelocity_i_m_s() - kepler_orbit.GetVelocity_i_m_s()).CalcNorm(), 1.0e-5);
+  }
+}
+
+/**
+ * @brief Test the restart of the integration by the change of the acceleration
+ * @note The acceleration is added for 10 s. The orbit after that is compared with the Kepler orbit of the state given by RK4 with a small step.
+ */
+TEST(Rkf78OrbitPropagation, AccelerationChangeRestart) {
+  CelestialInformation celestial_information = MakeEarthCenteredCelestialInformation();
+  KeplerOrbit kepler_orbit(kGravityConstant_m3_s2, MakeLeoOrbitalElements());
+  kepler_orbit.CalcOrbit(0.0);
+
+  Rkf78OrbitPropagation orbit(&celestial_information, kGravityConstant_m3_s2, 1.0, 300.0, 1.0e-6, 1.0e-8, kepler_orbit.GetPosition_i_m(),
+                              kepler_orbit.GetVelocity_i_m_s());
+  orbit.SetIsCalcEnabled(true);
+
+  const double maneuver_start_time_s = 1000.0;
+  const double maneuver_end_time_s = 1010.0;
+  libra::Vector<3> acceleration_i_m_s2(0.0);
+  acceleration_i_m_s2[0] = 1.0e-3;
+  acceleration_i_m_s2[2] = -2.0e-3;
+
+  for (int step = 1; step <= maneuver_start_time_s; step++) {
+    orbit.Propagate(step * 1.0, 0.0);
+  }
+  kepler_orbit.CalcOrbit(maneuver_start_time_s / kSecondsPerDay);
+  // The time of the reference is measured from the start of the maneuver
+  Rk4OrbitPropagation reference_orbit(&celestial_information, kGravityConstant_m3_s2, 1.0e-2, kepler_orbit.GetPosition_i_m(),
+                                      kepler_orbit.GetVelocity_i_m_s());
+  reference_orbit.SetIsCalcEnabled(true);
+
+  // Maneuver
+  for (int step = maneuver_start_time_s + 1; step <= maneuver_end_time_s; step++) {
+    const double time_s = step * 1.0;
+    orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+    orbit.Propagate(time_s, 0.0);
+    reference_orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+    reference_orbit.Propagate(time_s - maneuver_start_time_s, 0.0);
+    EXPECT_NEAR(0.0, (orbit.GetPosition_i_m() - reference_orbit.GetPosition_i_m()).CalcNorm(), 1.0e-2);
+  }
+
+  // Kepler orbit after the maneuver
+  KeplerOrbit maneuvered_kepler_orbit(kGravityConstant_m3_s2,
+                                      OrbitalElements(kGravityConstant_m3_s2, maneuver_end_time_s / kSecondsPerDay, reference_orbit.GetPosition_i_m(),
+                                                      reference_orbit.GetVelocity_i_m_s()));
+  maneuvered_kepler_orbit.CalcOrbit(maneuver_end_time_s / kSecondsPerDay);
+  kepler_orbit.CalcOrbit(maneuver_end_time_s / kSecondsPerDay);
+  EXPECT_GT((maneuvered_kepler_orbit.GetPosition_i_m() - kepler_orbit.GetPosition_i_m()).CalcNorm(), 0.1);
+
+  for (int step = maneuver_end_time_s + 1; step <= 5600; step++) {
+    const double time_s = step * 1.0;
+    orbit.SetAcceleration_i_m_s2(libra::Vector<3>(0.0));
+    orbit.Propagate(time_s, 0.0);
+    maneuvered_kepler_orbit.CalcOrbit(time_s / kSecondsPerDay);
+    EXPECT_NEAR(0.0, (orbit.GetPosition_i_m() - maneuvered_kepler_orbit.GetPosition_i_m()).CalcNorm(), 1.0e-2);
+    EXPECT_NEAR(0.0, (orbit.GetVelocity_i_m_s() - maneuvered_kepler_orbit.GetVelocity_i_m_s()).CalcNorm(), 1.0e-5);
+  }
+}
@@ -5,22 +5,21 @@
 
 #include "temperature.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <iostream>
 #include <environment/global/physical_constants.hpp>
 #include <environment/global/simulation_time.hpp>
 #include <library/initialize/initialize_file_access.hpp>
-#include <library/utilities/macros.hpp>
 
 using namespace std;
 
 Temperature::Temperature(const vector<vector<double>> conductance_matrix_W_K, const vector<vector<double>> radiation_matrix_m2, vector<Node> nodes,
                          vector<Heatload> heatloads, vector<Heater> heaters, vector<HeaterController> heater_controllers, const size_t node_num,
                          const double propagation_step_s, const SolarRadiationPressureEnvironment* srp_environment, const bool is_calc_enabled,
-                         const SolarCalcSetting solar_calc_setting, const bool debug)
-    : conductance_matrix_W_K_(conductance_matrix_W_K),
-      radiation_matrix_m2_(radiation_matrix_m2),
-      nodes_(nodes),
+                         const SolarCalcSetting solar_calc_setting, const bool debug, const ThermalIntegrationMethod integration_method)
+    : nodes_(nodes),
       heatloads_(heatloads),
       heaters_(heaters),
       heater_controllers_(heater_controllers),
@@ -29,8 +28,43 @@ Temperature::Temperature(const vector<vector<double>> conductance_matrix_W_K, co
       srp_environment_(srp_environment),
       is_calc_enabled_(is_calc_enabled),
       solar_calc_setting_(solar_calc_setting),
-      debug_(debug) {
+      integration_method_(integration_method),
+      debug_(debug),
+      linear_solver_(node_num) {
   propagation_time_s_ = 0;
+
+  // Sparse couplings: the elements with non-zero conductance or radiation and the diagonal elements for the Jacobian
+  vector<vector<double>> coupling_pattern(node_num_, vector<double>(node_num_, 0.0));
+  for (size_t i = 0; i < node_num_; i++) {
+    for (size_t j = 0; j < node_num_; j++) {
+      if (conductance_matrix_W_K[i][j] != 0.0 || radiation_matrix_m2[i][j] != 0.0) coupling_pattern[i][j] = 1.0;
+    }
+  }
+  jacobian_ = libra::SparseMatrix(coupling_pattern, true);
+  const vector<size_t>& row_offsets = jacobian_.GetRowOffsets();
+  const vector<size_t>& column_indices = jacobian_.GetColumnIndices();
+  conductances_W_K_.resize(jacobian_.GetNonZeroNumber());
+  radiative_couplings_W_K4_.resize(jacobian_.GetNonZeroNumber());
+  diagonal_indices_.resize(node_num_);
+  for (size_t i = 0; i < node_num_; i++) {
+    for (size_t index = row_offsets[i]; index < row_offsets[i + 1]; index++) {
+      const size_t j = column_indices[index];
+      conductances_W_K_[index] = conductance_matrix_W_K[i][j];
+      radiative_couplings_W_K4_[index] = environment::stefan_boltzmann_constant_W_m2K4 * radiation_matrix_m2[i][j];
+      if (j == i) diagonal_indices_[i] = index;
+    }
+  }
+
+  temperatures_K_.assign(node_num_, 0.0);
+  previous_temperatures_K_.assign(node_num_, 0.0);
+  explicit_temperatures_K_.assign(node_num_, 0.0);
+  stage_temperatures_K_.assign(node_num_, 0.0);
+  temperatures4_K4_.assign(node_num_, 0.0);
+  heat_inputs_W_.assign(node_num_, 0.0);
+  for (auto& differentials_K_s : differentials_K_s_) differentials_K_s.assign(node_num_, 0.0);
+  corrections_K_.assign(node_num_, 0.0);
+  residuals_K_.assign(node_num_, 0.0);
+
   if (debug_) {
     PrintParams();
   }
@@ -41,6 +75,7 @@ Temperature::Temperature() {
   propagation_step_s_ = 0.0;
   propagation_time_s_ = 0.0;
   solar_calc_setting_ = SolarCalcSetting::kDisable;
+  integration_method_ = ThermalIntegrationMethod::kRungeKutta4;
   is_calc_enabled_ = false;
   debug_ = false;
 }
@@ -55,10 +90,18 @@ void Temperature::Propagate(libra::Vector<3> sun_position_b_m, const double time
     sun_direction_b[i] = sun_position_b_m[i] / sun_distance_m;
   }
   while (time_end_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
-    CalcRungeOneStep(propagation_time_s_, propagation_step_s_, sun_direction_b, node_num_);
+    if (integration_method_ == ThermalIntegrationMethod::kRungeKutta4) {
+      CalcRungeOneStep(propagation_time_s_, propagation_step_s_, sun_direction_b, node_num_);
+    } else {
+      CalcImplicitStep(propagation_time_s_, propagation_step_s_, sun_direction_b);
+    }
     propagation_time_s_ += propagation_step_s_;
   }
-  CalcRungeOneStep(propagation_time_s_, time_end_s - propagation_time_s_, sun_direction_b, node_num_);
+  if (integration_method_ == ThermalIntegrationMethod::kRungeKutta4) {
+    CalcRungeOneStep(propagation_time_s_, time_end_s - propagation_time_s_, sun_direction_b, node_num_);
+  } else {
+    CalcImplicitStep(propagation_time_s_, time_end_s - propagation_time_s_, sun_direction_b);
+  }
   propagation_time_s_ = time_end_s;
   UpdateHeaterStatus();
 
@@ -85,74 +128,180 @@ void Temperature::Propagate(libra::Vector<3> sun_position_b_m, const double time
 }
 
 void Temperature::CalcRungeOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, size_t node_num) {
-  vector<double> temperatures_now_K(node_num);
   for (size_t i = 0; i < node_num; i++) {
-    temperatures_now_K[i] = nodes_[i].GetTemperature_K();
+    temperatures_K_[i] = nodes_[i].GetTemperature_K();
   }
+  vector<double>& k1 = differentials_K_s_[0];
+  vector<double>& k2 = differentials_K_s_[1];
+  vector<double>& k3 = differentials_K_s_[2];
+  vector<double>& k4 = differentials_K_s_[3];
 
-  vector<double> k1(node_num), k2(node_num), k3(node_num), k4(node_num);
-  vector<double> xk2(node_num), xk3(node_num), xk4(node_num);
-
-  k1 = CalcTemperatureDifferentials(temperatures_now_K, time_now_s, sun_direction_b, node_num);
+  CalcHeatInputs(time_now_s, sun_direction_b);
+  CalcTemperatureDifferentials(temperatures_K_, k1);
   for (size_t i = 0; i < node_num; i++) {
-    xk2[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k1[i];
+    stage_temperatures_K_[i] = temperatures_K_[i] + (time_step_s / 2.0) * k1[i];
   }
 
-  k2 = CalcTemperatureDifferentials(xk2, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num);
+  CalcHeatInputs(time_now_s + time_step_s / 2.0, sun_direction_b);
+  CalcTemperatureDifferentials(stage_temperatures_K_, k2);
   for (size_t i = 0; i < node_num; i++) {
-    xk3[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k2[i];
+    stage_temperatures_K_[i] = temperatures_K_[i] + (time_step_s / 2.0) * k2[i];
   }
 
-  k3 = CalcTemperatureDifferentials(xk3, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num);
+  // The heatloads at the middle of the step are reused
+  CalcTemperatureDifferentials(stage_temperatures_K_, k3);
   for (size_t i = 0; i < node_num; i++) {
-    xk4[i] = temperatures_now_K[i] + time_step_s * k3[i];
+    stage_temperatures_K_[i] = temperatures_K_[i] + time_step_s * k3[i];
   }
 
-  k4 = CalcTemperatureDifferentials(xk4, (time_now_s + time_step_s), sun_direction_b, node_num);
+  CalcHeatInputs(time_now_s + time_step_s, sun_direction_b);
+  CalcTemperatureDifferentials(stage_temperatures_K_, k4);
 
-  vector<double> temperatures_next_K(node_num);
   for (size_t i = 0; i < node_num; i++) {
-    temperatures_next_K[i] = temperatures_now_K[i] + (time_step_s / 6.0) * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    nodes_[i].SetTemperature_K(temperatures_K_[i] + (time_step_s / 6.0) * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]));
   }
+}
 
-  for (size_t i = 0; i < node_num; i++) {
-    nodes_[i].SetTemperature_K(temperatures_next_K[i]);
+void Temperature::CalcImplicitStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, size_t depth) {
+  static const size_t kMaxStepHalvingDepth = 4;
+  if (CalcImplicitOneStep(time_now_s, time_step_s, sun_direction_b)) return;
+
+  if (depth < kMaxStepHalvingDepth) {
+    const double half_step_s = time_step_s / 2.0;
+    CalcImplicitStep(time_now_s, half_step_s, sun_direction_b, depth + 1);
+    CalcImplicitStep(time_now_s + half_step_s, half_step_s, sun_direction_b, depth + 1);
+    return;
   }
+
+  cerr << "[WARNING] Temperature: Newton iteration of the implicit method does not converge at " << time_now_s << " s. RK4 is used for the step."
+       << endl;
+  CalcRungeOneStep(time_now_s, time_step_s, sun_direction_b, node_num_);
+  // CalcRungeOneStep keeps the temperatures at the beginning of the step in temperatures_K_
+  previous_temperatures_K_ = temperatures_K_;
+  previous_step_s_ = time_step_s;
 }
 
-vector<double> Temperature::CalcTemperatureDifferentials(vector<double> temperatures_K, double t, libra::Vector<3> sun_direction_b, size_t node_num) {
-  // TODO: consider the following unused arguments are really needed
-  UNUSED(temperatures_K);
+bool Temperature::CalcImplicitOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b) {
+  static const size_t kMaxNewtonIteration = 20;
+  static const double kNewtonTolerance_K = 1.0e-9;
+  static const double kMaxBdf2StepRatio = 2.4;
+  if (time_step_s <= 0.0) return true;
 
-  vector<double> differentials_K_s(node_num);
-  for (size_t i = 0; i < node_num; i++) {
-    heatloads_[i].SetElapsedTime_s(t);
-    if (nodes_[i].GetNodeType() == NodeType::kDiffusive) {
-      double solar_flux_W_m2 = srp_environment_->GetPowerDensity_W_m2();
-      if (solar_calc_setting_ == SolarCalcSetting::kEnable) {
-        double solar_radiation_W = nodes_[i].CalcSolarRadiation_W(sun_direction_b, solar_flux_W_m2);
-        heatloads_[i].SetSolarHeatload_W(solar_radiation_W);
+  // The next temperatures T satisfy T = T_explicit + gamma * dt * f(T, t + dt)
+  // Backward Euler: T_explicit = T_n, gamma = 1
+  // Variable step BDF2: T_explicit = ((1 + w)^2 T_n - w^2 T_n-1) / (1 + 2w), gamma = (1 + w) / (1 + 2w), w = dt_n / dt_n-1
+  for (size_t i = 0; i < node_num_; i++) {
+    temperatures_K_[i] = nodes_[i].GetTemperature_K();
+  }
+  double gamma = 1.0;
+  const double step_ratio = previous_step_s_ > 0.0 ? time_step_s / previous_step_s_ : 0.0;
+  if (integration_method_ == ThermalIntegrationMethod::kBdf2 && previous_step_s_ > 0.0 && step_ratio <= kMaxBdf2StepRatio) {
+    const double denominator = 1.0 + 2.0 * step_ratio;
+    gamma = (1.0 + step_ratio) / denominator;
+    for (size_t i = 0; i < node_num_; i++) {
+      explicit_temperatures_K_[i] =
+          ((1.0 + step_ratio) * (1.0 + step_ratio) * temperatures_K_[i] - step_ratio * step_ratio * previous_temperatures_K_[i]) / denominator;
+    }
+  } else {
+    explicit_temperatures_K_ = temperatures_K_;
+  }
+  const double gamma_step_s = gamma * time_step_s;
+
+  CalcHeatInputs(time_now_s + time_step_s, sun_direction_b);
+  stage_temperatures_K_ = temperatures_K_;
+  vector<double>& differentials_K_s = differentials_K_s_[0];
+  const vector<size_t>& row_offsets = jacobian_.GetRowOffsets();
+  const vector<size_t>& column_indices = jacobian_.GetColumnIndices();
+  vector<double>& jacobian_values = jacobian_.GetValues();
+  bool is_converged = false;
+  for (size_t iteration = 0; iteration < kMaxNewtonIteration; iteration++) {
+    CalcTemperatureDifferentials(stage_temperatures_K_, differentials_K_s);
+
+    // Residual and Jacobian of G(T) = T - T_explicit - gamma * dt * f(T)
+    for (size_t i = 0; i < node_num_; i++) {
+      residuals_K_[i] = explicit_temperatures_K_[i] + gamma_step_s * differentials_K_s[i] - stage_temperatures_K_[i];
+      for (size_t index = row_offsets[i]; index < row_offsets[i + 1]; index++) {
+        jacobian_values[index] = 0.0;
       }
-      double heater_power_W = GetHeaterPower_W(i);
-      heatloads_[i].SetHeaterHeatload_W(heater_power_W);
-      heatloads_[i].CalcInternalHeatload();
-      heatloads_[i].UpdateTotalHeatload();
-      double total_heatload_W = heatloads_[i].GetTotalHeatload_W();  // Total heatload (solar + internal + heater)[W]
-
-      double conductive_heat_input_W = 0;
-      double radiative_heat_input_W = 0;
-      for (size_t j = 0; j < node_num; j++) {
-        conductive_heat_input_W += conductance_matrix_W_K_[i][j] * (nodes_[j].GetTemperature_K() - nodes_[i].GetTemperature_K());
-        radiative_heat_input_W += environment::stefan_boltzmann_constant_W_m2K4 * radiation_matrix_m2_[i][j] *
-                                  (pow(nodes_[j].GetTemperature_K(), 4) - pow(nodes_[i].GetTemperature_K(), 4));
+      jacobian_values[diagonal_indices_[i]] = 1.0;
+      if (nodes_[i].GetNodeType() != NodeType::kDiffusive) continue;
+
+      const double factor = gamma_step_s / nodes_[i].GetCapacity_J_K();
+      const double temperature_i_K = stage_temperatures_K_[i];
+      const double temperature3_i_K3 = temperature_i_K * temperature_i_K * temperature_i_K;
+      double diagonal_sum_W_K = 0.0;
+      for (size_t index = row_offsets[i]; index < row_offsets[i + 1]; index++) {
+        const size_t j = column_indices[index];
+        if (j == i) continue;
+        const double temperature_j_K = stage_temperatures_K_[j];
+        jacobian_values[index] =
+            -factor * (conductances_W_K_[index] + 4.0 * radiative_couplings_W_K4_[index] * temperature_j_K * temperature_j_K * temperature_j_K);
+        diagonal_sum_W_K += conductances_W_K_[index] + 4.0 * radiative_couplings_W_K4_[index] * temperature3_i_K3;
       }
-      double total_heat_input_W = conductive_heat_input_W + radiative_heat_input_W + total_heatload_W;
-      differentials_K_s[i] = total_heat_input_W / nodes_[i].GetCapacity_J_K();
-    } else if (nodes_[i].GetNodeType() == NodeType::kBoundary) {
-      differentials_K_s[i] = 0;
+      jacobian_values[diagonal_indices_[i]] += factor * diagonal_sum_W_K;
+    }
+
+    fill(corrections_K_.begin(), corrections_K_.end(), 0.0);
+    if (!linear_solver_.Solve(jacobian_, residuals_K_, corrections_K_)) break;
+    double max_correction_K = 0.0;
+    for (size_t i = 0; i < node_num_; i++) {
+      stage_temperatures_K_[i] += corrections_K_[i];
+      max_correction_K = max(max_correction_K, fabs(corrections_K_[i]));
+    }
+    // NaN is also regarded as not converged
+    if (max_correction_K < kNewtonTolerance_K) {
+      is_converged = true;
+      break;
     }
   }
-  return differentials_K_s;
+  if (!is_converged) return false;
+
+  previous_temperatures_K_ = temperatures_K_;
+  previous_step_s_ = time_step_s;
+  for (size_t i = 0; i < node_num_; i++) {
+    nodes_[i].SetTemperature_K(stage_temperatures_K_[i]);
+  }
+  return true;
+}
+
+void Temperature::CalcHeatInputs(double time_now_s, const libra::Vector<3>& sun_direction_b) {
+  for (size_t i = 0; i < node_num_; i++) {
+    heatloads_[i].SetElapsedTime_s(time_now_s);
+    if (nodes_[i].GetNodeType() != NodeType::kDiffusive) continue;
+    if (solar_calc_setting_ == SolarCalcSetting::kEnable) {
+      double solar_flux_W_m2 = srp_environment_->GetPowerDensity_W_m2();
+      double solar_radiation_W = nodes_[i].CalcSolarRadiation_W(sun_direction_b, solar_flux_W_m2);
+      heatloads_[i].SetSolarHeatload_W(solar_radiation_W);
+    }
+    double heater_power_W = GetHeaterPower_W(i);
+    heatloads_[i].SetHeaterHeatload_W(heater_power_W);
+    heatloads_[i].CalcInternalHeatload();
+    heatloads_[i].UpdateTotalHeatload();
+    heat_inputs_W_[i] = heatloads_[i].GetTotalHeatload_W();  // Total heatload (solar + internal + heater)[W]
+  }
+}
+
+void Temperature::CalcTemperatureDifferentials(const vector<double>& temperatures_K, vector<double>& differentials_K_s) {
+  for (size_t i = 0; i < node_num_; i++) {
+    const double temperature2_K2 = temperatures_K[i] * temperatures_K[i];
+    temperatures4_K4_[i] = temperature2_K2 * temperature2_K2;
+  }
+
+  const vector<size_t>& row_offsets = jacobian_.GetRowOffsets();
+  const vector<size_t>& column_indices = jacobian_.GetColumnIndices();
+  for (size_t i = 0; i < node_num_; i++) {
+    if (nodes_[i].GetNodeType() != NodeType::kDiffusive) {
+      differentials_K_s[i] = 0.0;
+      continue;
+    }
+    double total_heat_input_W = heat_inputs_W_[i];
+    for (size_t index = row_offsets[i]; index < row_offsets[i + 1]; index++) {
+      const size_t j = column_indices[index];
+      total_heat_input_W += conductances_W_K_[index] * (temperatures_K[j] - temperatures_K[i]) +
+                            radiative_couplings_W_K4_[index] * (temperatures4_K4_[j] - temperatures4_K4_[i]);
+    }
+    differentials_K_s[i] = total_heat_input_W / nodes_[i].GetCapacity_J_K();
+  }
 }
 
 double Temperature::GetHeaterPower_W(size_t node_id) {
@@ -211,6 +360,21 @@ string Temperature::GetLogValue() const {
   return str_tmp;
 }
 
+void Temperature::AppendLogValue(std::vector<double>& values) const {
+  for (size_t i = 0; i < node_num_; i++) {
+    // Do not retrieve boundary node values
+    if (nodes_[i].GetNodeType() != NodeType::kBoundary) {
+      AppendScalar(values, nodes_[i].GetTemperature_degC());
+    }
+  }
+  for (size_t i = 0; i < node_num_; i++) {
+    // Do not retrieve boundary node values
+    if (nodes_[i].GetNodeType() != NodeType::kBoundary) {
+      AppendScalar(values, heatloads_[i].GetTotalHeatload_W());
+    }
+  }
+}
+
 void Temperature::PrintParams(void) {
   cout << "< Print Thermal Parameters >" << endl;
   cout << "IsCalcEnabled: " << is_calc_enabled_ << endl;
@@ -226,14 +390,18 @@ void Temperature::PrintParams(void) {
   cout << "Cij:" << endl;
   for (size_t i = 0; i < (node_num_); i++) {
     for (size_t j = 0; j < (node_num_); j++) {
-      cout << std::setprecision(4) << conductance_matrix_W_K_[i][j] << "  ";
+      const size_t index = jacobian_.FindIndex(i, j);
+      cout << std::setprecision(4) << (index < conductances_W_K_.size() ? conductances_W_K_[index] : 0.0) << "  ";
     }
     cout << endl;
   }
   cout << "Rij:" << endl;
   for (size_t i = 0; i < (node_num_); i++) {
     for (size_t j = 0; j < (node_num_); j++) {
-      cout << std::setprecision(4) << radiation_matrix_m2_[i][j] << "  ";
+      const size_t index = jacobian_.FindIndex(i, j);
+      const double radiation_m2 =
+          index < radiative_couplings_W_K4_.size() ? radiative_couplings_W_K4_[index] / environment::stefan_boltzmann_constant_W_m2K4 : 0.0;
+      cout << std::setprecision(4) << radiation_m2 << "  ";
     }
     cout << endl;
   }
@@ -313,6 +481,16 @@ Temperature* InitTemperature(const std::string file_name, const double rk_prop_s
 
   bool debug = mainIni.ReadEnable("THERMAL", "debug");
 
+  ThermalIntegrationMethod integration_method = ThermalIntegrationMethod::kRungeKutta4;
+  string integration_method_name = mainIni.ReadString("THERMAL", "integration_method");
+  if (integration_method_name == "BACKWARD_EULER") {
+    integration_method = ThermalIntegrationMethod::kBackwardEuler;
+  } else if (integration_method_name == "BDF2") {
+    integration_method = ThermalIntegrationMethod::kBdf2;
+  } else if (integration_method_name != "RK4" && integration_method_name != "NULL") {
+    cerr << "[Warning] Unknown thermal integration method: " << integration_method_name << ". RK4 is used." << endl;
+  }
+
   // Read Heatloads from CSV File
   string filepath_heatload = file_path + "heatload.csv";
   IniAccess conf_heatload(filepath_heatload);
@@ -371,6 +549,6 @@ Temperature* InitTemperature(const std::string file_name, const double rk_prop_s
 
   Temperature* temperature;
   temperature = new Temperature(conductance_matrix, radiation_matrix, node_list, heatload_list, heater_list, heater_controller_list, node_num,
-                                rk_prop_step_s, srp_environment, is_calc_enabled, solar_calc_setting, debug);
+                                rk_prop_step_s, srp_environment, is_calc_enabled, solar_calc_setting, debug, integration_method);
   return temperature;
 }
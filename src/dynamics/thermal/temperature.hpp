@@ -8,6 +8,7 @@
 
 #include <environment/local/solar_radiation_pressure_environment.hpp>
 #include <library/logger/loggable.hpp>
+#include <library/math/sparse_matrix.hpp>
 #include <string>
 #include <vector>
 
@@ -25,26 +26,52 @@ enum class SolarCalcSetting {
   kDisable,
 };
 
+/**
+ * @enum ThermalIntegrationMethod
+ * @brief Numerical integration method of the thermal network
+ */
+enum class ThermalIntegrationMethod {
+  kRungeKutta4,    //!< Explicit 4th order Runge-Kutta method
+  kBackwardEuler,  //!< Implicit backward Euler method with Newton iteration
+  kBdf2,           //!< Implicit 2nd order backward differentiation formula with Newton iteration
+};
+
 /**
  * @class Temperature
  * @brief class to calculate temperature of all nodes
  */
 class Temperature : public ILoggable {
  protected:
-  std::vector<std::vector<double>> conductance_matrix_W_K_;  // Coupling of node i and node j by heat conduction [W/K]
-  std::vector<std::vector<double>> radiation_matrix_m2_;     // Coupling of node i and node j by thermal radiation [m2]
-  std::vector<Node> nodes_;                                  // vector of nodes
-  std::vector<Heatload> heatloads_;                          // vector of heatloads
-  std::vector<Heater> heaters_;                              // vector of heaters
-  std::vector<HeaterController> heater_controllers_;         // vector of heater controllers
-  size_t node_num_;                                          // number of nodes
-  double propagation_step_s_;                                // propagation step [s]
+  libra::SparseMatrix jacobian_;                              // Jacobian of the implicit step. The pattern is the couplings and the diagonal.
+  std::vector<double> conductances_W_K_;                      // Coupling of node i and node j by heat conduction for each element of jacobian_ [W/K]
+  std::vector<double> radiative_couplings_W_K4_;              // Coupling by thermal radiation times Stefan-Boltzmann constant for each element [W/K4]
+  std::vector<size_t> diagonal_indices_;                      // Index of the diagonal element of each row in jacobian_
+  std::vector<Node> nodes_;                                   // vector of nodes
+  std::vector<Heatload> heatloads_;                           // vector of heatloads
+  std::vector<Heater> heaters_;                               // vector of heaters
+  std::vector<HeaterController> heater_controllers_;          // vector of heater controllers
+  size_t node_num_;                                           // number of nodes
+  double propagation_step_s_;                                 // propagation step [s]
   double propagation_time_s_;  // Incremented time inside class Temperature [s], finish propagation when reaching end_time
   const SolarRadiationPressureEnvironment* srp_environment_;  // SolarRadiationPressureEnvironment for calculating solar flux
   bool is_calc_enabled_;                                      // Whether temperature calculation is enabled
   SolarCalcSetting solar_calc_setting_;                       // setting for solar calculation
+  ThermalIntegrationMethod integration_method_;               // Numerical integration method
   bool debug_;                                                // Activate debug output or not
 
+  // Work area preallocated at the construction
+  std::vector<double> temperatures_K_;           // Temperatures at the beginning of the step [K]
+  std::vector<double> previous_temperatures_K_;  // Temperatures at the beginning of the previous step for BDF2 [K]
+  double previous_step_s_ = 0.0;                 // Previous step for BDF2 (0 when not available) [s]
+  std::vector<double> explicit_temperatures_K_;  // Explicit part of the implicit step [K]
+  std::vector<double> stage_temperatures_K_;     // Temperatures at the stage or the Newton iteration [K]
+  std::vector<double> temperatures4_K4_;         // Fourth power of stage_temperatures_K_ [K4]
+  std::vector<double> heat_inputs_W_;            // Total heatload of each node at the stage time [W]
+  std::vector<double> differentials_K_s_[4];     // Differentials of the temperatures at each stage [K/s]
+  std::vector<double> corrections_K_;            // Newton corrections [K]
+  std::vector<double> residuals_K_;              // Newton residuals with the sign inverted [K]
+  libra::BiCgStabSolver linear_solver_;          // Solver for the Newton corrections
+
   /**
    * @fn CalcRungeOneStep
    * @brief Calculate one step of RK4 for thermal equilibrium equation and update temperatures of nodes
@@ -56,17 +83,47 @@ class Temperature : public ILoggable {
    */
   void CalcRungeOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, size_t node_num);
   /**
-   * @fn CalcTemperatureDifferentials
-   * @brief Calculate differential of thermal equilibrium equation
+   * @fn CalcImplicitStep
+   * @brief Calculate the implicit method over the time step and update temperatures of nodes
+   * @note When the Newton iteration does not converge, the step is divided into halves up to kMaxStepHalvingDepth times, and RK4 is used
+   *       for the step after that.
    *
-   * @param temperatures_K: [UNUSED] Temperatures of each node [K]
-   * @param time_now_s: Current elapsed time [s]
+   * @param[in] time_now_s: Current elapsed time [s]
+   * @param[in] time_step_s: Time step [s]
    * @param[in] sun_direction_b: Sun direction in body frame
-   * @param node_num: Number of nodes
-   * @return std::vector<double>: Differential of thermal equilibrium equation at time now
+   * @param[in] depth: Number of the step halvings to reach this step
    */
-  std::vector<double> CalcTemperatureDifferentials(std::vector<double> temperatures_K, double time_now_s, const libra::Vector<3> sun_direction_b,
-                                                   size_t node_num);
+  void CalcImplicitStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, size_t depth = 0);
+  /**
+   * @fn CalcImplicitOneStep
+   * @brief Calculate one step of the implicit method (backward Euler or BDF2) and update temperatures of nodes
+   * @note The nonlinear equation is solved by the Newton method with the sparse Jacobian of the thermal network.
+   *       BDF2 uses the variable step formula and starts with backward Euler. Backward Euler is also used when the ratio of the step to the
+   *       previous step is larger than kMaxBdf2StepRatio since the variable step BDF2 is zero-unstable for the ratio over 1 + sqrt(2).
+   *
+   * @param[in] time_now_s: Current elapsed time [s]
+   * @param[in] time_step_s: Time step [s]
+   * @param[in] sun_direction_b: Sun direction in body frame
+   * @return True when the Newton iteration converges. The temperatures of nodes are not updated when false.
+   */
+  bool CalcImplicitOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b);
+  /**
+   * @fn CalcHeatInputs
+   * @brief Update heatloads of nodes at the time and store the total heatloads in heat_inputs_W_
+   *
+   * @param[in] time_now_s: Elapsed time [s]
+   * @param[in] sun_direction_b: Sun direction in body frame
+   */
+  void CalcHeatInputs(double time_now_s, const libra::Vector<3>& sun_direction_b);
+  /**
+   * @fn CalcTemperatureDifferentials
+   * @brief Calculate differential of thermal equilibrium equation with the heatloads in heat_inputs_W_
+   * @note The fourth power of the temperatures is stored in temperatures4_K4_
+   *
+   * @param[in] temperatures_K: Temperatures of each node [K]
+   * @param[out] differentials_K_s: Differential of thermal equilibrium equation [K/s]
+   */
+  void CalcTemperatureDifferentials(const std::vector<double>& temperatures_K, std::vector<double>& differentials_K_s);
 
  public:
   /**
@@ -84,11 +141,13 @@ class Temperature : public ILoggable {
    * @param is_calc_enabled: Whether calculation is enabled
    * @param solar_calc_setting: Solar calculation settings
    * @param debug: Whether debug is enabled
+   * @param integration_method: Numerical integration method
    */
   Temperature(const std::vector<std::vector<double>> conductance_matrix_W_K, const std::vector<std::vector<double>> radiation_matrix_m2,
               std::vector<Node> nodes, std::vector<Heatload> heatloads, std::vector<Heater> heaters, std::vector<HeaterController> heater_controllers,
               const size_t node_num, const double propagation_step_s, const SolarRadiationPressureEnvironment* srp_environment,
-              const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting, const bool debug);
+              const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting, const bool debug,
+              const ThermalIntegrationMethod integration_method = ThermalIntegrationMethod::kRungeKutta4);
   /**
    * @fn Temperature
    * @brief Construct a new Temperature object, used when thermal calculation is disabled.
@@ -136,6 +195,11 @@ class Temperature : public ILoggable {
    * @return std::string
    */
   std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  void AppendLogValue(std::vector<double>& values) const;
 
   /**
    * @fn UpdateHeaterStatus
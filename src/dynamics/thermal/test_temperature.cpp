@@ -0,0 +1,118 @@
+/**
+ * @file test_temperature.cpp
+ * @brief Test codes for Temperature class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "temperature.hpp"
+
+/**
+ * @fn MakeTwoNodeNetwork
+ * @brief Make a thermal network of two diffusive nodes without heatloads
+ * @param [in] temperatures_K: Initial temperatures of the nodes [K]
+ * @param [in] capacity_J_K: Heat capacity of each node [J/K]
+ * @param [in] conductance_W_K: Conductance between the nodes [W/K]
+ * @param [in] radiation_m2: Radiative coupling between the nodes [m2]
+ * @param [in] step_s: Propagation step [s]
+ * @param [in] integration_method: Numerical integration method
+ */
+Temperature MakeTwoNodeNetwork(const double temperatures_K[2], const double capacity_J_K, const double conductance_W_K, const double radiation_m2,
+                               const double step_s, const ThermalIntegrationMethod integration_method) {
+  std::vector<Node> nodes;
+  std::vector<Heatload> heatloads;
+  for (size_t i = 0; i < 2; i++) {
+    nodes.push_back(Node(i, "node" + std::to_string(i), NodeType::kDiffusive, 0, temperatures_K[i], capacity_J_K, 0.0, 0.0, libra::Vector<3>(0.0)));
+    heatloads.push_back(Heatload((int)i, {0.0, 1000.0}, {0.0, 0.0}));
+  }
+  const std::vector<std::vector<double>> conductance_matrix_W_K = {{0.0, conductance_W_K}, {conductance_W_K, 0.0}};
+  const std::vector<std::vector<double>> radiation_matrix_m2 = {{0.0, radiation_m2}, {radiation_m2, 0.0}};
+  return Temperature(conductance_matrix_W_K, radiation_matrix_m2, nodes, heatloads, {}, {}, 2, step_s, nullptr, true, SolarCalcSetting::kDisable,
+                     false, integration_method);
+}
+
+/**
+ * @brief Test that two nodes coupled by conduction relax exponentially with all integration methods
+ */
+TEST(Temperature, TwoNodeConduction) {
+  const double temperatures_K[2] = {350.0, 250.0};
+  const double capacity_J_K = 100.0;
+  const double conductance_W_K = 1.0;
+  const double time_constant_s = capacity_J_K / (2.0 * conductance_W_K);
+  const double step_s = 1.0;
+  const libra::Vector<3> sun_position_b_m(1.0);
+
+  // Tolerance of the difference between the nodes with the global errors of the order of each method
+  const ThermalIntegrationMethod methods[3] = {ThermalIntegrationMethod::kRungeKutta4, ThermalIntegrationMethod::kBackwardEuler,
+                                               ThermalIntegrationMethod::kBdf2};
+  const double tolerances_K[3] = {1.0e-6, 0.6, 5.0e-2};
+  for (size_t method_id = 0; method_id < 3; method_id++) {
+    Temperature temperature = MakeTwoNodeNetwork(temperatures_K, capacity_J_K, conductance_W_K, 0.0, step_s, methods[method_id]);
+    for (double time_s = 10.0; time_s <= 100.0; time_s += 10.0) {
+      temperature.Propagate(sun_position_b_m, time_s);
+
+      const std::vector<Node> nodes = temperature.GetNodes();
+      const double expected_difference_K = (temperatures_K[0] - temperatures_K[1]) * exp(-time_s / time_constant_s);
+      EXPECT_NEAR(300.0, (nodes[0].GetTemperature_K() + nodes[1].GetTemperature_K()) / 2.0, 1.0e-9);
+      EXPECT_NEAR(expected_difference_K, nodes[0].GetTemperature_K() - nodes[1].GetTemperature_K(), tolerances_K[method_id]);
+      if (methods[method_id] == ThermalIntegrationMethod::kBackwardEuler) {
+        // The difference is divided by (1 + step / time constant) at each step
+        const double discrete_difference_K = (temperatures_K[0] - temperatures_K[1]) / pow(1.0 + step_s / time_constant_s, time_s / step_s);
+        EXPECT_NEAR(discrete_difference_K, nodes[0].GetTemperature_K() - nodes[1].GetTemperature_K(), 1.0e-6);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test that BDF2 is stable after a tiny remainder step of Propagate
+ */
+TEST(Temperature, Bdf2AfterTinyStep) {
+  const double temperatures_K[2] = {350.0, 250.0};
+  const double capacity_J_K = 100.0;
+  const double conductance_W_K = 1.0;
+  const double time_constant_s = capacity_J_K / (2.0 * conductance_W_K);
+  const libra::Vector<3> sun_position_b_m(1.0);
+
+  Temperature temperature = MakeTwoNodeNetwork(temperatures_K, capacity_J_K, conductance_W_K, 0.0, 1.0, ThermalIntegrationMethod::kBdf2);
+  for (double time_s = 10.0; time_s <= 100.0; time_s += 10.0) {
+    temperature.Propagate(sun_position_b_m, time_s);
+    temperature.Propagate(sun_position_b_m, time_s + 1.0e-6);
+  }
+  const std::vector<Node> nodes = temperature.GetNodes();
+  const double expected_difference_K = (temperatures_K[0] - temperatures_K[1]) * exp(-(100.0 + 1.0e-6) / time_constant_s);
+  EXPECT_NEAR(expected_difference_K, nodes[0].GetTemperature_K() - nodes[1].GetTemperature_K(), 5.0e-2);
+}
+
+/**
+ * @brief Test that the implicit methods with the sparse Jacobian agree with RK4 for the network with radiation
+ */
+TEST(Temperature, TwoNodeRadiation) {
+  const double temperatures_K[2] = {400.0, 200.0};
+  const double capacity_J_K = 100.0;
+  const double conductance_W_K = 0.2;
+  const double radiation_m2 = 0.5;
+  const libra::Vector<3> sun_position_b_m(1.0);
+
+  Temperature reference =
+      MakeTwoNodeNetwork(temperatures_K, capacity_J_K, conductance_W_K, radiation_m2, 0.1, ThermalIntegrationMethod::kRungeKutta4);
+  Temperature backward_euler =
+      MakeTwoNodeNetwork(temperatures_K, capacity_J_K, conductance_W_K, radiation_m2, 1.0, ThermalIntegrationMethod::kBackwardEuler);
+  Temperature bdf2 = MakeTwoNodeNetwork(temperatures_K, capacity_J_K, conductance_W_K, radiation_m2, 1.0, ThermalIntegrationMethod::kBdf2);
+  for (double time_s = 20.0; time_s <= 200.0; time_s += 20.0) {
+    reference.Propagate(sun_position_b_m, time_s);
+    backward_euler.Propagate(sun_position_b_m, time_s);
+    bdf2.Propagate(sun_position_b_m, time_s);
+  }
+
+  const std::vector<Node> reference_nodes = reference.GetNodes();
+  const std::vector<Node> backward_euler_nodes = backward_euler.GetNodes();
+  const std::vector<Node> bdf2_nodes = bdf2.GetNodes();
+  for (size_t i = 0; i < 2; i++) {
+    EXPECT_NEAR(reference_nodes[i].GetTemperature_K(), backward_euler_nodes[i].GetTemperature_K(), 0.5);
+    EXPECT_NEAR(reference_nodes[i].GetTemperature_K(), bdf2_nodes[i].GetTemperature_K(), 2.0e-2);
+  }
+  // The heat flows from the hot node to the cold node
+  EXPECT_LT(reference_nodes[0].GetTemperature_K() - reference_nodes[1].GetTemperature_K(), 100.0);
+}
@@ -0,0 +1,39 @@
+/**
+ * @file celestial_body_handle.hpp
+ * @brief Handle of a selected celestial body
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_CELESTIAL_BODY_HANDLE_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_CELESTIAL_BODY_HANDLE_HPP_
+
+/**
+ * @class CelestialBodyHandle
+ * @brief Handle of a selected celestial body
+ * @note The handle is resolved from the body name once with CelestialInformation::GetBodyHandle, and it gives direct access to the information
+ *       of the body without the name lookup.
+ */
+class CelestialBodyHandle {
+ public:
+  /**
+   * @fn CelestialBodyHandle
+   * @brief Default constructor which points the first selected body
+   */
+  CelestialBodyHandle() : id_(0) {}
+  /**
+   * @fn CelestialBodyHandle
+   * @brief Constructor
+   * @param [in] id: ID of CelestialInformation list
+   */
+  explicit CelestialBodyHandle(const unsigned int id) : id_(id) {}
+
+  /**
+   * @fn GetId
+   * @brief Return ID of CelestialInformation list
+   */
+  inline unsigned int GetId() const { return id_; }
+
+ private:
+  unsigned int id_;  //!< ID of CelestialInformation list
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_CELESTIAL_BODY_HANDLE_HPP_
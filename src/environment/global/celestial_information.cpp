@@ -17,6 +17,7 @@
 
 #include "library/initialize/initialize_file_access.hpp"
 #include "library/logger/log_utility.hpp"
+#include "library/utilities/external_library_mutex.hpp"
 
 CelestialInformation::CelestialInformation(const std::string inertial_frame_name, const std::string aberration_correction_setting,
                                            const std::string center_body_name, const unsigned int number_of_selected_body, int* selected_body_ids,
@@ -40,7 +41,10 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
     SpiceInt planet_id = selected_body_ids_[i];
     SpiceInt dim;
     SpiceDouble gravity_constant_km3_s2;
-    bodvcd_c(planet_id, "GM", 1, &dim, &gravity_constant_km3_s2);
+    {
+      std::lock_guard<std::mutex> lock(GetExternalLibraryMutex(ExternalLibrary::kCspice));
+      bodvcd_c(planet_id, "GM", 1, &dim, &gravity_constant_km3_s2);
+    }
     // Convert unit [km^3/s^2] to [m^3/s^2]
     celestial_body_gravity_constant_m3_s2_[i] = gravity_constant_km3_s2 * 1E+9;
   }
@@ -51,7 +55,10 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
     SpiceInt dim;
     SpiceDouble radii_km[3];
 
-    bodvcd_c(planet_id, "RADII", 3, &dim, (SpiceDouble*)radii_km);
+    {
+      std::lock_guard<std::mutex> lock(GetExternalLibraryMutex(ExternalLibrary::kCspice));
+      bodvcd_c(planet_id, "RADII", 3, &dim, (SpiceDouble*)radii_km);
+    }
     for (int j = 0; j < 3; j++) {
       celestial_body_planetographic_radii_m_[i * 3 + j] = radii_km[j] * 1000.0;
     }
@@ -63,6 +70,8 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
     celestial_body_mean_radius_m_[i] = pow(rx * ry * rz, 1.0 / 3.0);
   }
 
+  center_body_handle_ = GetBodyHandle(center_body_name_.c_str());
+
   // Initialize rotation
   earth_rotation_ = new EarthRotation(ConvertEarthRotationMode(GetRotationMode("EARTH")));
   moon_rotation_ = new MoonRotation(*this, ConvertMoonRotationMode(GetRotationMode("MOON")));
@@ -72,7 +81,9 @@ CelestialInformation::CelestialInformation(const CelestialInformation& obj)
     : number_of_selected_bodies_(obj.number_of_selected_bodies_),
       inertial_frame_name_(obj.inertial_frame_name_),
       center_body_name_(obj.center_body_name_),
-      aberration_correction_setting_(obj.aberration_correction_setting_) {
+      aberration_correction_setting_(obj.aberration_correction_setting_),
+      center_body_handle_(obj.center_body_handle_),
+      ephemeris_caches_(obj.ephemeris_caches_) {
   unsigned int num_of_state = number_of_selected_bodies_ * 3;
 
   selected_body_ids_ = new int[number_of_selected_bodies_];
@@ -105,22 +116,18 @@ CelestialInformation::~CelestialInformation() {
 
 void CelestialInformation::UpdateAllObjectsInformation(const SimulationTime& simulation_time) {
   // Update celestial body orbit
+  const double et = simulation_time.GetCurrentEphemerisTime();
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
-
-    // Acquisition of body name from id
-    SpiceBoolean found;
-    const int kMaxNameLength = 100;
-    char name_buffer[kMaxNameLength];
-    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
-
-    // Acquisition of position and velocity
-    SpiceDouble orbit_buffer_km[6];
-    GetPlanetOrbit(name_buffer, simulation_time.GetCurrentEphemerisTime(), (SpiceDouble*)orbit_buffer_km);
-    // Convert unit [km], [km/s] to [m], [m/s]
+    double state_m[6];
+    if (ephemeris_caches_.empty()) {
+      GetSelectedBodyState(i, et, state_m);
+    } else {
+      ephemeris_caches_[i].GetState(
+          et, [this, i](const double node_et, double node_state_m[6]) { GetSelectedBodyState(i, node_et, node_state_m); }, state_m);
+    }
     for (int j = 0; j < 3; j++) {
-      celestial_body_position_from_center_i_m_[i * 3 + j] = orbit_buffer_km[j] * 1000.0;
-      celestial_body_velocity_from_center_i_m_s_[i * 3 + j] = orbit_buffer_km[j + 3] * 1000.0;
+      celestial_body_position_from_center_i_m_[i * 3 + j] = state_m[j];
+      celestial_body_velocity_from_center_i_m_s_[i * 3 + j] = state_m[j + 3];
     }
   }
 
@@ -130,13 +137,41 @@ void CelestialInformation::UpdateAllObjectsInformation(const SimulationTime& sim
   moon_rotation_->Update(simulation_time);
 }
 
+void CelestialInformation::EnableEphemerisCache(const double tolerance_m, const double maximum_node_interval_s) {
+  ephemeris_caches_.assign(number_of_selected_bodies_, EphemerisCache(tolerance_m, maximum_node_interval_s));
+}
+
+void CelestialInformation::GetSelectedBodyState(const unsigned int id, const double et, double state_m[6]) {
+  SpiceInt planet_id = selected_body_ids_[id];
+
+  // Acquisition of body name from id
+  SpiceBoolean found;
+  const int kMaxNameLength = 100;
+  char name_buffer[kMaxNameLength];
+  {
+    std::lock_guard<std::mutex> lock(GetExternalLibraryMutex(ExternalLibrary::kCspice));
+    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
+  }
+
+  // Acquisition of position and velocity
+  SpiceDouble orbit_buffer_km[6];
+  GetPlanetOrbit(name_buffer, et, (SpiceDouble*)orbit_buffer_km);
+  // Convert unit [km], [km/s] to [m], [m/s]
+  for (int j = 0; j < 6; j++) {
+    state_m[j] = orbit_buffer_km[j] * 1000.0;
+  }
+}
+
 int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
   int index = 0;
   SpiceInt planet_id;
   SpiceBoolean found;
 
   // Acquisition of ID from body name
-  bodn2c_c(body_name, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+  {
+    std::lock_guard<std::mutex> lock(GetExternalLibraryMutex(ExternalLibrary::kCspice));
+    bodn2c_c(body_name, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+  }
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
     if (selected_body_ids_[i] == planet_id) {
       index = i;
@@ -154,7 +189,10 @@ std::string CelestialInformation::GetLogHeader() const {
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
     SpiceInt planet_id = selected_body_ids_[i];
     // Acquisition of body name from id
-    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
+    {
+      std::lock_guard<std::mutex> lock(GetExternalLibraryMutex(ExternalLibrary::kCspice));
+      bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
+    }
     std::string name = name_buffer;
 
     std::locale loc = std::locale::classic();
@@ -182,6 +220,17 @@ std::string CelestialInformation::GetLogValue() const {
   return str_tmp;
 }
 
+void CelestialInformation::AppendLogValue(std::vector<double>& values) const {
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    for (int j = 0; j < 3; j++) {
+      AppendScalar(values, celestial_body_position_from_center_i_m_[i * 3 + j]);
+    }
+    for (int j = 0; j < 3; j++) {
+      AppendScalar(values, celestial_body_velocity_from_center_i_m_s_[i * 3 + j]);
+    }
+  }
+}
+
 void CelestialInformation::GetPlanetOrbit(const char* planet_name, const double et, double orbit[6]) {
   // Add `BARYCENTER` if needed
   std::string planet_name_string = planet_name;
@@ -192,6 +241,7 @@ void CelestialInformation::GetPlanetOrbit(const char* planet_name, const double
 
   // Get orbit
   SpiceDouble lt;
+  std::lock_guard<std::mutex> lock(GetExternalLibraryMutex(ExternalLibrary::kCspice));
   spkezr_c((ConstSpiceChar*)planet_name_string.c_str(), (SpiceDouble)et, (ConstSpiceChar*)inertial_frame_name_.c_str(),
            (ConstSpiceChar*)aberration_correction_setting_.c_str(), (ConstSpiceChar*)center_body_name_.c_str(), (SpiceDouble*)orbit,
            (SpiceDouble*)&lt);
@@ -212,6 +262,7 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
   std::vector<std::string> keywords = {"tls", "tpc1", "tpc2", "tpc3", "bsp"};
   for (size_t i = 0; i < keywords.size(); i++) {
     std::string fname = ini_file.ReadString(furnsh_section, keywords[i].c_str());
+    std::lock_guard<std::mutex> lock(GetExternalLibraryMutex(ExternalLibrary::kCspice));
     furnsh_c(fname.c_str());
   }
 
@@ -225,7 +276,10 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
     ini_file.ReadChar(section, selected_body_i.c_str(), 30, selected_body_temp);
     SpiceInt planet_id;
     SpiceBoolean found;
-    bodn2c_c(selected_body_temp, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+    {
+      std::lock_guard<std::mutex> lock(GetExternalLibraryMutex(ExternalLibrary::kCspice));
+      bodn2c_c(selected_body_temp, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+    }
 
     // If the object specified in the ini file is not found, exit the program.
     assert(found == SPICETRUE);
@@ -239,6 +293,13 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
   CelestialInformation* celestial_info;
   celestial_info = new CelestialInformation(inertial_frame, aber_cor, center_obj, num_of_selected_body, selected_body, rotation_mode_list);
 
+  // Ephemeris cache setting
+  if (ini_file.ReadEnable(section, "ephemeris_cache_enable")) {
+    const double tolerance_m = ini_file.ReadDouble(section, "ephemeris_cache_tolerance_m");
+    const double maximum_node_interval_s = ini_file.ReadDouble(section, "ephemeris_cache_maximum_node_interval_s");
+    celestial_info->EnableEphemerisCache(tolerance_m, maximum_node_interval_s);
+  }
+
   // log setting
   celestial_info->is_log_enabled_ = ini_file.ReadEnable(section, INI_LOG_LABEL);
 
@@ -9,9 +9,11 @@
 
 #include <vector>
 
+#include "celestial_body_handle.hpp"
 #include "earth_rotation.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/vector.hpp"
+#include "library/orbit/ephemeris_cache.hpp"
 #include "moon_rotation.hpp"
 #include "simulation_time.hpp"
 
@@ -58,6 +60,11 @@ class CelestialInformation : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
   /**
    * @fn UpdateAllObjectsInformation
@@ -66,6 +73,14 @@ class CelestialInformation : public ILoggable {
    */
   void UpdateAllObjectsInformation(const SimulationTime& simulation_time);
 
+  /**
+   * @fn EnableEphemerisCache
+   * @brief Enable the ephemeris cache which interpolates the SPICE ephemeris between coarse nodes
+   * @param [in] tolerance_m: Tolerance of the interpolated position [m]
+   * @param [in] maximum_node_interval_s: Maximum interval of the nodes [s]
+   */
+  void EnableEphemerisCache(const double tolerance_m, const double maximum_node_interval_s);
+
   // Getters
   // Orbit information
   /**
@@ -84,10 +99,13 @@ class CelestialInformation : public ILoggable {
    * @brief Return position from the center body in the inertial frame [m]
    * @param [in] body_name: Name of the body defined in the SPICE
    */
-  inline libra::Vector<3> GetPositionFromCenter_i_m(const char* body_name) const {
-    int id = CalcBodyIdFromName(body_name);
-    return GetPositionFromCenter_i_m(id);
-  }
+  inline libra::Vector<3> GetPositionFromCenter_i_m(const char* body_name) const { return GetPositionFromCenter_i_m(GetBodyHandle(body_name)); }
+  /**
+   * @fn GetPositionFromCenter_i_m
+   * @brief Return position from the center body in the inertial frame [m]
+   * @param [in] body: Handle of the body
+   */
+  inline libra::Vector<3> GetPositionFromCenter_i_m(const CelestialBodyHandle body) const { return GetPositionFromCenter_i_m(body.GetId()); }
   /**
    * @fn GetPositionFromSelectedBody_i_m
    * @brief Return position from the selected reference body in the inertial frame [m]
@@ -95,12 +113,16 @@ class CelestialInformation : public ILoggable {
    * @param [in] reference_body_name: Name of the reference body defined in the SPICE
    */
   inline libra::Vector<3> GetPositionFromSelectedBody_i_m(const char* target_body_name, const char* reference_body_name) const {
-    int target_id = CalcBodyIdFromName(target_body_name);
-    libra::Vector<3> target_body_position_i_m = GetPositionFromCenter_i_m(target_id);
-    int reference_id = CalcBodyIdFromName(reference_body_name);
-    libra::Vector<3> reference_body_position_i_m = GetPositionFromCenter_i_m(reference_id);
-
-    return target_body_position_i_m - reference_body_position_i_m;
+    return GetPositionFromSelectedBody_i_m(GetBodyHandle(target_body_name), GetBodyHandle(reference_body_name));
+  }
+  /**
+   * @fn GetPositionFromSelectedBody_i_m
+   * @brief Return position from the selected reference body in the inertial frame [m]
+   * @param [in] target_body: Handle of the target body
+   * @param [in] reference_body: Handle of the reference body
+   */
+  inline libra::Vector<3> GetPositionFromSelectedBody_i_m(const CelestialBodyHandle target_body, const CelestialBodyHandle reference_body) const {
+    return GetPositionFromCenter_i_m(target_body) - GetPositionFromCenter_i_m(reference_body);
   }
 
   /**
@@ -119,10 +141,13 @@ class CelestialInformation : public ILoggable {
    * @brief Return velocity from the center body in the inertial frame [m/s]
    * @param [in] body_name: Name of the body defined in the SPICE
    */
-  inline libra::Vector<3> GetVelocityFromCenter_i_m_s(const char* body_name) const {
-    int id = CalcBodyIdFromName(body_name);
-    return GetVelocityFromCenter_i_m_s(id);
-  }
+  inline libra::Vector<3> GetVelocityFromCenter_i_m_s(const char* body_name) const { return GetVelocityFromCenter_i_m_s(GetBodyHandle(body_name)); }
+  /**
+   * @fn GetVelocityFromCenter_i_m_s
+   * @brief Return velocity from the center body in the inertial frame [m/s]
+   * @param [in] body: Handle of the body
+   */
+  inline libra::Vector<3> GetVelocityFromCenter_i_m_s(const CelestialBodyHandle body) const { return GetVelocityFromCenter_i_m_s(body.GetId()); }
   /**
    * @fn GetVelocityFromSelectedBody_i_m_s
    * @brief Return position from the selected reference body in the inertial frame [m]
@@ -130,12 +155,16 @@ class CelestialInformation : public ILoggable {
    * @param [in] reference_body_name: Name of the reference body defined in the SPICE
    */
   inline libra::Vector<3> GetVelocityFromSelectedBody_i_m_s(const char* target_body_name, const char* reference_body_name) const {
-    int target_id = CalcBodyIdFromName(target_body_name);
-    libra::Vector<3> target_body_velocity_i_m_s = GetVelocityFromCenter_i_m_s(target_id);
-    int reference_id = CalcBodyIdFromName(reference_body_name);
-    libra::Vector<3> reference_body_velocity_i_m_s = GetVelocityFromCenter_i_m_s(reference_id);
-
-    return target_body_velocity_i_m_s - reference_body_velocity_i_m_s;
+    return GetVelocityFromSelectedBody_i_m_s(GetBodyHandle(target_body_name), GetBodyHandle(reference_body_name));
+  }
+  /**
+   * @fn GetVelocityFromSelectedBody_i_m_s
+   * @brief Return velocity from the selected reference body in the inertial frame [m/s]
+   * @param [in] target_body: Handle of the target body
+   * @param [in] reference_body: Handle of the reference body
+   */
+  inline libra::Vector<3> GetVelocityFromSelectedBody_i_m_s(const CelestialBodyHandle target_body, const CelestialBodyHandle reference_body) const {
+    return GetVelocityFromCenter_i_m_s(target_body) - GetVelocityFromCenter_i_m_s(reference_body);
   }
 
   // Gravity constants
@@ -144,15 +173,18 @@ class CelestialInformation : public ILoggable {
    * @brief Return gravity constant of the celestial body [m^3/s^2]
    * @param [in] body_name: Name of the body defined in the SPICE
    */
-  inline double GetGravityConstant_m3_s2(const char* body_name) const {
-    int index = CalcBodyIdFromName(body_name);
-    return celestial_body_gravity_constant_m3_s2_[index];
-  }
+  inline double GetGravityConstant_m3_s2(const char* body_name) const { return GetGravityConstant_m3_s2(GetBodyHandle(body_name)); }
+  /**
+   * @fn GetGravityConstant_m3_s2
+   * @brief Return gravity constant of the celestial body [m^3/s^2]
+   * @param [in] body: Handle of the body
+   */
+  inline double GetGravityConstant_m3_s2(const CelestialBodyHandle body) const { return celestial_body_gravity_constant_m3_s2_[body.GetId()]; }
   /**
    * @fn GetCenterBodyGravityConstant_m3_s2
    * @brief Return gravity constant of the center body [m^3/s^2]
    */
-  inline double GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant_m3_s2(center_body_name_.c_str()); }
+  inline double GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant_m3_s2(center_body_handle_); }
 
   // Shape information
   /**
@@ -171,19 +203,25 @@ class CelestialInformation : public ILoggable {
    * @brief Return 3 axis planetographic radii of a celestial body [m]
    * @param [in] body_name: Name of the body defined in the SPICE
    */
-  inline libra::Vector<3> GetRadiiFromName_m(const char* body_name) const {
-    int id = CalcBodyIdFromName(body_name);
-    return GetRadii_m(id);
-  }
+  inline libra::Vector<3> GetRadiiFromName_m(const char* body_name) const { return GetRadii_m(GetBodyHandle(body_name)); }
+  /**
+   * @fn GetRadii_m
+   * @brief Return 3 axis planetographic radii of a celestial body [m]
+   * @param [in] body: Handle of the body
+   */
+  inline libra::Vector<3> GetRadii_m(const CelestialBodyHandle body) const { return GetRadii_m(body.GetId()); }
   /**
    * @fn GetMeanRadiusFromName_m
    * @brief Return mean radius of a celestial body [m]
    * @param [in] id: ID of CelestialInformation list
    */
-  inline double GetMeanRadiusFromName_m(const char* body_name) const {
-    int index = CalcBodyIdFromName(body_name);
-    return celestial_body_mean_radius_m_[index];
-  }
+  inline double GetMeanRadiusFromName_m(const char* body_name) const { return GetMeanRadius_m(GetBodyHandle(body_name)); }
+  /**
+   * @fn GetMeanRadius_m
+   * @brief Return mean radius of a celestial body [m]
+   * @param [in] body: Handle of the body
+   */
+  inline double GetMeanRadius_m(const CelestialBodyHandle body) const { return celestial_body_mean_radius_m_[body.GetId()]; }
 
   // Parameters
   /**
@@ -201,6 +239,11 @@ class CelestialInformation : public ILoggable {
    * @brief Return name of the center body
    */
   inline std::string GetCenterBodyName(void) const { return center_body_name_; }
+  /**
+   * @fn GetCenterBodyHandle
+   * @brief Return handle of the center body
+   */
+  inline CelestialBodyHandle GetCenterBodyHandle(void) const { return center_body_handle_; }
 
   // Members
   /**
@@ -222,6 +265,14 @@ class CelestialInformation : public ILoggable {
    * @return ID of CelestialInformation list
    */
   int CalcBodyIdFromName(const char* body_name) const;
+  /**
+   * @fn GetBodyHandle
+   * @brief Resolve handle of a selected body from the body name
+   * @note The name lookup uses SPICE, so the handle should be resolved once at the initialization and reused.
+   * @param [in] body_name: Name of the body defined in the SPICE
+   * @return Handle of the body (The first selected body when the body is not selected)
+   */
+  inline CelestialBodyHandle GetBodyHandle(const char* body_name) const { return CelestialBodyHandle(CalcBodyIdFromName(body_name)); }
   /**
    * @fn DebugOutput
    * @brief Debug output
@@ -235,6 +286,7 @@ class CelestialInformation : public ILoggable {
   std::string inertial_frame_name_;            //!< Definition of inertial frame
   std::string center_body_name_;               //!< Center object name of inertial frame
   std::string aberration_correction_setting_;  //!< Stellar aberration correction
+  CelestialBodyHandle center_body_handle_;     //!< Handle of the center object
                                                //!< Ref：http://fermi.gsfc.nasa.gov/ssc/library/fug/051108/Aberration_Julie.ppt
 
   // Calculated values
@@ -252,6 +304,17 @@ class CelestialInformation : public ILoggable {
   MoonRotation* moon_rotation_;                  //!< Instance of Moon rotation
   std::vector<std::string> rotation_mode_list_;  //!< Rotation mode list for planets
 
+  std::vector<EphemerisCache> ephemeris_caches_;  //!< Ephemeris cache of the selected bodies (Empty when the cache is disabled)
+
+  /**
+   * @fn GetSelectedBodyState
+   * @brief Get position/velocity of the selected body from SPICE
+   * @param [in] id: ID of CelestialInformation list
+   * @param [in] et: Ephemeris time
+   * @param [out] state_m: Position [m] and velocity [m/s] from the center body in the inertial frame
+   */
+  void GetSelectedBodyState(const unsigned int id, const double et, double state_m[6]);
+
   /**
    * @fn GetPlanetOrbit
    * @brief Get position/velocity of planet.
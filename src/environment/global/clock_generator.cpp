@@ -5,29 +5,54 @@
 
 #include "clock_generator.hpp"
 
+#include <chrono>
+#include <numeric>
+
 ClockGenerator::~ClockGenerator() {}
 
-void ClockGenerator::RegisterComponent(ITickable* tickable) { components_.push_back(tickable); }
+void ClockGenerator::RegisterComponent(ITickable* tickable) {
+  components_.push_back(tickable);
+  tick_timings_.push_back(TickTiming{tickable, 0, 0.0, 0.0});
+  is_dispatch_table_valid_ = false;
+}
 
 void ClockGenerator::RemoveComponent(ITickable* tickable) {
-  for (auto itr = components_.begin(); itr != components_.end();) {
-    if (*itr == tickable) {
-      components_.erase(itr++);
+  for (size_t index = 0; index < components_.size(); index++) {
+    if (components_[index] == tickable) {
+      components_.erase(components_.begin() + index);
+      tick_timings_.erase(tick_timings_.begin() + index);
+      is_dispatch_table_valid_ = false;
       break;
-    } else {
-      ++itr;
     }
   }
 }
 
 void ClockGenerator::TickToComponents() {
-  // Update for each component
-  for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
-    // Run MainRoutine
-    (*itr)->Tick(timer_count_);
-    // Run FastUpdate (Processes that are executed more frequently than MainRoutine)
-    if ((*itr)->GetNeedsFastUpdate()) {
-      (*itr)->FastTick(timer_count_);
+  if (!is_dispatch_table_valid_ || fast_update_setting_version_ != ITickable::GetFastUpdateSettingVersion()) BuildDispatchTable();
+
+  const DispatchEntry* begin = dispatch_entries_.data();
+  const DispatchEntry* end = begin + dispatch_entries_.size();
+  if (cycle_length_ > 0) {
+    // Only the components due at the count are listed
+    const unsigned int cycle_count = timer_count_ % cycle_length_;
+    end = begin + dispatch_offsets_[cycle_count + 1];
+    begin += dispatch_offsets_[cycle_count];
+  }
+  for (const DispatchEntry* entry = begin; entry != end; ++entry) {
+    // The table is too large when cycle_length_ is 0, so the prescalers are checked at every count
+    if (cycle_length_ == 0) {
+      const unsigned int prescaler = entry->is_fast_tick ? entry->component->GetFastPrescaler() : entry->component->GetPrescaler();
+      if (timer_count_ % prescaler != 0) continue;
+    }
+
+    if (is_timing_measurement_enabled_) {
+      DispatchWithTimingMeasurement(*entry);
+    } else if (entry->is_fast_tick) {
+      // Run FastUpdate (Processes that are executed more frequently than MainRoutine)
+      entry->component->FastTick(timer_count_);
+    } else {
+      // Run MainRoutine
+      entry->component->Tick(timer_count_);
     }
   }
   timer_count_++;  // TODO: Consider if "timer_count" is necessary
@@ -38,3 +63,66 @@ void ClockGenerator::UpdateComponents(const SimulationTime* simulation_time) {
     TickToComponents();
   }
 }
+
+std::vector<TickTiming> ClockGenerator::GetTickTimings() const { return tick_timings_; }
+
+void ClockGenerator::BuildDispatchTable() {
+  const unsigned long long kMaxCycleLength = 100000;
+  const size_t kMaxEntryNumber = 65536;
+  fast_update_setting_version_ = ITickable::GetFastUpdateSettingVersion();
+  is_dispatch_table_valid_ = true;
+
+  // Least common multiple of all prescalers
+  unsigned long long cycle_length = 1;
+  size_t entry_number = 0;
+  for (ITickable* component : components_) {
+    cycle_length = cycle_length / std::gcd(cycle_length, (unsigned long long)component->GetPrescaler()) * component->GetPrescaler();
+    entry_number += 1;
+    if (component->GetNeedsFastUpdate()) {
+      cycle_length = cycle_length / std::gcd(cycle_length, (unsigned long long)component->GetFastPrescaler()) * component->GetFastPrescaler();
+      entry_number += 1;
+    }
+    if (cycle_length > kMaxCycleLength) break;
+  }
+
+  dispatch_offsets_.clear();
+  dispatch_entries_.clear();
+  if (cycle_length > kMaxCycleLength || entry_number * cycle_length > kMaxEntryNumber) {
+    // List all entries once and check the prescalers at every count
+    cycle_length_ = 0;
+    for (size_t index = 0; index < components_.size(); index++) {
+      dispatch_entries_.push_back(DispatchEntry{components_[index], index, false});
+      if (components_[index]->GetNeedsFastUpdate()) dispatch_entries_.push_back(DispatchEntry{components_[index], index, true});
+    }
+    return;
+  }
+
+  cycle_length_ = (unsigned int)cycle_length;
+  dispatch_offsets_.reserve(cycle_length_ + 1);
+  dispatch_offsets_.push_back(0);
+  for (unsigned int cycle_count = 0; cycle_count < cycle_length_; cycle_count++) {
+    for (size_t index = 0; index < components_.size(); index++) {
+      ITickable* component = components_[index];
+      if (cycle_count % component->GetPrescaler() == 0) dispatch_entries_.push_back(DispatchEntry{component, index, false});
+      if (component->GetNeedsFastUpdate() && cycle_count % component->GetFastPrescaler() == 0) {
+        dispatch_entries_.push_back(DispatchEntry{component, index, true});
+      }
+    }
+    dispatch_offsets_.push_back(dispatch_entries_.size());
+  }
+}
+
+void ClockGenerator::DispatchWithTimingMeasurement(const DispatchEntry& entry) {
+  const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+  if (entry.is_fast_tick) {
+    entry.component->FastTick(timer_count_);
+  } else {
+    entry.component->Tick(timer_count_);
+  }
+  const double time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+  TickTiming& tick_timing = tick_timings_[entry.component_index];
+  tick_timing.call_count++;
+  tick_timing.total_time_s += time_s;
+  if (time_s > tick_timing.max_time_s) tick_timing.max_time_s = time_s;
+}
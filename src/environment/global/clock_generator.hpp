@@ -7,13 +7,29 @@
 #define S2E_ENVIRONMENT_GLOBAL_CLOCK_GENERATOR_HPP_
 
 #include <components/base/interface_tickable.hpp>
+#include <cstdint>
 #include <vector>
 
 #include "simulation_time.hpp"
 
+/**
+ * @struct TickTiming
+ * @brief Execution time statistics of the tick functions of a component
+ */
+struct TickTiming {
+  const ITickable* tickable;  //!< Measured component
+  uint64_t call_count;        //!< Number of the calls of Tick and FastTick
+  double total_time_s;        //!< Total execution time [s]
+  double max_time_s;          //!< Maximum execution time of a call [s]
+};
+
 /**
  * @class ClockGenerator
  * @brief Class to generate clock for classes which have ITickable
+ * @note The components due at each count are listed in a dispatch table indexed by the count modulo the least common multiple of the prescalers.
+ *       Therefore only the due components are called without checking the prescalers of the others.
+ *       The table is built at the first tick after the registration or the fast update flag is changed,
+ *       and the components are called in the registration order.
  */
 class ClockGenerator {
  public:
@@ -52,9 +68,54 @@ class ClockGenerator {
    */
   inline void ClearTimerCount(void) { timer_count_ = 0; }
 
+  /**
+   * @fn SetTimingMeasurement
+   * @brief Enable or disable the measurement of the execution time of each component
+   * @param [in] is_enabled: Enable flag
+   */
+  inline void SetTimingMeasurement(const bool is_enabled) { is_timing_measurement_enabled_ = is_enabled; }
+  /**
+   * @fn GetTickTimings
+   * @brief Return the execution time statistics of the registered components in the registration order
+   */
+  std::vector<TickTiming> GetTickTimings() const;
+
  private:
+  /**
+   * @struct DispatchEntry
+   * @brief Entry of the dispatch table
+   */
+  struct DispatchEntry {
+    ITickable* component;    //!< Component to be called
+    size_t component_index;  //!< Index of the component in components_
+    bool is_fast_tick;       //!< Call FastTick instead of Tick
+  };
+
   std::vector<ITickable*> components_;  //!< Component list fot tick
   unsigned int timer_count_;            //!< Timer count TODO: change to long?
+
+  // Dispatch table
+  bool is_dispatch_table_valid_ = false;          //!< Whether the dispatch table is consistent with the registered components
+  unsigned int fast_update_setting_version_ = 0;  //!< Version of the fast update flags at the table build
+  unsigned int cycle_length_ = 0;                 //!< Cycle length of the table (0 when the table is not used)
+  std::vector<size_t> dispatch_offsets_;          //!< Offsets of the entries for each count in the cycle. The size is cycle_length_ + 1.
+  std::vector<DispatchEntry> dispatch_entries_;   //!< Entries of all counts in the cycle
+
+  // Timing measurement
+  bool is_timing_measurement_enabled_ = false;  //!< Whether the execution time is measured
+  std::vector<TickTiming> tick_timings_;        //!< Execution time statistics for each component
+
+  /**
+   * @fn BuildDispatchTable
+   * @brief Build the dispatch table from the prescalers of the registered components
+   */
+  void BuildDispatchTable();
+  /**
+   * @fn DispatchWithTimingMeasurement
+   * @brief Call Tick or FastTick of the component and measure the execution time
+   * @param [in] entry: Dispatch entry
+   */
+  void DispatchWithTimingMeasurement(const DispatchEntry& entry);
 };
 
 #endif  // S2E_ENVIRONMENT_GLOBAL_CLOCK_GENERATOR_HPP_
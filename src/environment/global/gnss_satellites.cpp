@@ -6,6 +6,10 @@
 #include "gnss_satellites.hpp"
 
 #include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -15,7 +19,9 @@
 #include "library/external/sgp4/sgp4unit.h"  //for gstime()
 #include "library/logger/log_utility.hpp"
 #include "library/math/constants.hpp"
+#include "library/utilities/file_utility.hpp"
 #include "library/utilities/macros.hpp"
+#include "library/utilities/memory_mapped_file.hpp"
 
 const double nan99 = 999999.999999;
 
@@ -64,97 +70,368 @@ tm* initialized_tm() {
 }
 
 /**
- * @fn get_unixtime_from_timestamp_line
+ * @fn CalcUnixTime
  * @brief Calculate unix time from calendar expression
- * @param [in] s: Time as calendar expression
+ * @param [in] year: Year
+ * @param [in] month: Month (1 - 12)
+ * @param [in] day: Day
+ * @param [in] hour: Hour
+ * @param [in] minute: Minute
+ * @param [in] second: Second
  * @return Unix time
  */
-double get_unixtime_from_timestamp_line(std::vector<string>& s) {
+double CalcUnixTime(const int year, const int month, const int day, const int hour, const int minute, const double second) {
   tm* time_tm = initialized_tm();
-  time_tm->tm_year = stoi(s.at(1)) - 1900;
-  time_tm->tm_mon = stoi(s.at(2)) - 1;  // 0 - 11, in time struct, 1 - 12 month is expressed by 1 - 12
-  time_tm->tm_mday = stoi(s.at(3));
-  time_tm->tm_hour = stoi(s.at(4));
-  time_tm->tm_min = stoi(s.at(5));
-  time_tm->tm_sec = (int)(stod(s.at(6)) + 1e-4);  // for the numerical error, plus 1e-4 (tm_sec is to be int)
+  time_tm->tm_year = year - 1900;
+  time_tm->tm_mon = month - 1;  // 0 - 11, in time struct, 1 - 12 month is expressed by 1 - 12
+  time_tm->tm_mday = day;
+  time_tm->tm_hour = hour;
+  time_tm->tm_min = minute;
+  time_tm->tm_sec = (int)(second + 1e-4);  // for the numerical error, plus 1e-4 (tm_sec is to be int)
   double unix_time = (double)mktime(time_tm);
   std::free(time_tm);
 
   return unix_time;
 }
 
-// GnssSatelliteBase
-template <size_t N>
-libra::Vector<N> GnssSatelliteBase::TrigonometricInterpolation(const vector<double>& time_vector, const vector<libra::Vector<N>>& values,
-                                                               double time) const {
-  size_t n = time_vector.size();
-  double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
-  libra::Vector<N> res(0.0);
-
-  for (size_t i = 0; i < n; ++i) {
-    double t_k = 1.0;
-    for (size_t j = 0; j < n; ++j) {
-      if (i == j) continue;
-      t_k *= sin(w * (time - time_vector.at(j)) / 2.0) / sin(w * (time_vector.at(i) - time_vector.at(j)) / 2.0);
+/**
+ * @struct TextToken
+ * @brief Whitespace separated token in a text on memory
+ */
+struct TextToken {
+  const char* begin;  //!< Top of the token
+  size_t length;      //!< Length of the token
+};
+
+/**
+ * @fn GetNextLine
+ * @brief Get the next line of a text on memory
+ * @param [in/out] cursor: Current position in the text. It moves to the top of the next line.
+ * @param [in] end: End of the text
+ * @param [out] line_begin: Top of the line
+ * @param [out] line_end: End of the line without newline characters
+ * @return False when the text ends
+ */
+bool GetNextLine(const char*& cursor, const char* end, const char*& line_begin, const char*& line_end) {
+  if (cursor >= end) return false;
+  line_begin = cursor;
+  const char* newline = static_cast<const char*>(memchr(cursor, '\n', end - cursor));
+  if (newline == nullptr) {
+    line_end = end;
+    cursor = end;
+  } else {
+    line_end = newline;
+    cursor = newline + 1;
+  }
+  if (line_end > line_begin && *(line_end - 1) == '\r') --line_end;
+  return true;
+}
+
+/**
+ * @fn SplitTokens
+ * @brief Split a line into whitespace separated tokens without copy
+ * @param [in] line_begin: Top of the line
+ * @param [in] line_end: End of the line
+ * @param [out] tokens: Tokens
+ * @param [in] max_number: Maximum number of tokens
+ * @return Number of tokens
+ */
+size_t SplitTokens(const char* line_begin, const char* line_end, TextToken* tokens, const size_t max_number) {
+  size_t number = 0;
+  const char* p = line_begin;
+  while (number < max_number) {
+    while (p < line_end && isspace((unsigned char)*p)) ++p;
+    if (p >= line_end) break;
+    tokens[number].begin = p;
+    while (p < line_end && !isspace((unsigned char)*p)) ++p;
+    tokens[number].length = p - tokens[number].begin;
+    ++number;
+  }
+  return number;
+}
+
+/**
+ * @fn ParseDouble
+ * @brief Convert a token to double value
+ * @note The token is copied to a null-terminated buffer since the mapped file is not null-terminated
+ */
+double ParseDouble(const TextToken& token) {
+  char buffer[64];
+  const size_t length = token.length < sizeof(buffer) - 1 ? token.length : sizeof(buffer) - 1;
+  memcpy(buffer, token.begin, length);
+  buffer[length] = '\0';
+  return strtod(buffer, nullptr);
+}
+
+/**
+ * @fn ParseInt
+ * @brief Convert a token to int value
+ */
+int ParseInt(const TextToken& token) { return (int)ParseDouble(token); }
+
+/**
+ * @fn ReadSp3Records
+ * @brief Read epoch lines and satellite lines of a SP3 file on memory
+ * @note Ref: http://epncb.oma.be/ftp/data/format/sp3c.txt
+ * @param [in] file: SP3 file
+ * @param [in] ur_flag: Ultra Rapid flag
+ * @param [out] time_interval_s: Epoch interval written in the header [s]
+ * @param [in] epoch_function: Function called at each epoch line with tokens of the line
+ * @param [in] satellite_function: Function called at each satellite line with tokens of the line
+ */
+template <typename EpochFunction, typename SatelliteFunction>
+void ReadSp3Records(const MemoryMappedFile& file, const UltraRapidMode ur_flag, double& time_interval_s, EpochFunction epoch_function,
+                    SatelliteFunction satellite_function) {
+  const char* cursor = file.GetData();
+  const char* end = cursor + file.GetSize_B();
+  const char* line_begin = nullptr;
+  const char* line_end = nullptr;
+  TextToken tokens[8];
+
+  // Read Header Info
+  int num_of_time_stamps = 0;
+  int num_of_sat = 0;
+  for (int line = 0; line < 3; ++line) {
+    if (!GetNextLine(cursor, end, line_begin, line_end)) return;
+    const size_t number_of_tokens = SplitTokens(line_begin, line_end, tokens, 7);
+    if (line == 0 && number_of_tokens > 6) {
+      // in the first line, the number of time stamps is written
+      num_of_time_stamps = ParseInt(tokens[6]);
+    } else if (line == 1 && number_of_tokens > 3) {
+      time_interval_s = ParseDouble(tokens[3]);
+    } else if (line == 2 && number_of_tokens > 1) {
+      num_of_sat = ParseInt(tokens[1]);
     }
-    for (size_t j = 0; j < (int)N; ++j) {
-      res(j) += t_k * values.at(i)(j);
+  }
+  do {
+    if (!GetNextLine(cursor, end, line_begin, line_end)) return;
+  } while (line_begin == line_end || *line_begin != '*');
+
+  // Calculate number of data lines
+  int skipped_lines, data_lines;
+  if (ur_flag == kNotUse) {
+    skipped_lines = 0;
+    data_lines = (num_of_sat + 1) * num_of_time_stamps;
+  } else {
+    int offset = (int)ur_flag - (int)kObserve1;
+    skipped_lines = (num_of_sat + 1) * num_of_time_stamps / 8 * offset;
+    data_lines = (num_of_sat + 1) * num_of_time_stamps / 8;
+  }
+  for (int i = 0; i < skipped_lines; ++i) {
+    if (!GetNextLine(cursor, end, line_begin, line_end)) return;
+  }
+
+  for (int i = 0; i < data_lines; ++i) {
+    if (i > 0 && !GetNextLine(cursor, end, line_begin, line_end)) return;
+    if (i % (num_of_sat + 1) == 0) {
+      if (SplitTokens(line_begin, line_end, tokens, 7) < 7) return;
+      epoch_function(tokens);
+    } else {
+      if (SplitTokens(line_begin, line_end, tokens, 5) < 5) continue;
+      satellite_function(tokens);
     }
   }
+}
 
-  return res;
+/**
+ * @fn CalcFilesHash
+ * @brief Map the files and calculate hash of the contents as a key of the cache
+ * @param [in] file_paths: Paths of the files
+ * @return Hash value. The time zone is also included since unix time is calculated by mktime.
+ * @note The paths are not included so that the cache is still valid after the files are moved.
+ */
+uint64_t CalcFilesHash(const vector<string>& file_paths) {
+  uint64_t hash = MemoryMappedFile::kHashSeed;
+  for (const auto& file_path : file_paths) {
+    MemoryMappedFile file(file_path);
+    const uint64_t size_B = file.GetSize_B();
+    hash = MemoryMappedFile::CalcHash(&size_B, sizeof(size_B), hash);
+    hash = file.CalcHash(hash);
+  }
+  const double reference_unix_time = CalcUnixTime(2000, 1, 1, 0, 0, 0.0);
+  return MemoryMappedFile::CalcHash(&reference_unix_time, sizeof(reference_unix_time), hash);
 }
 
-double GnssSatelliteBase::TrigonometricInterpolation(const vector<double>& time_vector, const vector<double>& values, double time) const {
-  size_t n = time_vector.size();
-  double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
-  double res = 0.0;
+/**
+ * @fn GetCacheFilePath
+ * @brief Return path of the cache file
+ * @param [in] cache_directory: Directory of the cache file
+ * @param [in] kind: Kind of the data (position or clock)
+ * @param [in] key: Key of the cache
+ */
+string GetCacheFilePath(const string& cache_directory, const string& kind, const uint64_t key) {
+  ostringstream file_name;
+  file_name << "gnss_" << kind << "_" << hex << setw(16) << setfill('0') << key << ".bin";
+  return cache_directory + file_name.str();
+}
 
-  for (size_t i = 0; i < n; ++i) {
-    double t_k = 1.0;
-    for (size_t j = 0; j < n; ++j) {
-      if (i == j) continue;
-      t_k *= sin(w * (time - time_vector.at(j)) / 2.0) / sin(w * (time_vector.at(i) - time_vector.at(j)) / 2.0);
+const char kCacheMagic[8] = {'S', '2', 'E', 'G', 'N', 'S', 'S', '\0'};  //!< Magic number of the cache file
+const uint32_t kCacheFormatVersion = 1;                                //!< Format version of the cache file
+
+/**
+ * @fn WriteCacheFile
+ * @brief Write parsed time series into the binary cache file
+ * @note File layout (host byte order)
+ *         magic "S2EGNSS" + '\0' (8 bytes), format version (uint32), key (uint64)
+ *         number of header values (uint32), header values (double)
+ *         number of series (uint32), and for each series: length (uint64), values (double)
+ * @param [in] file_path: Path to the cache file
+ * @param [in] key: Key of the cache
+ * @param [in] header_values: Scalar values
+ * @param [in] series_list: Time series
+ */
+void WriteCacheFile(const string& file_path, const uint64_t key, const vector<double>& header_values, const vector<vector<double>>& series_list) {
+  // The cache is replaced atomically, so that the parallel runs never map the partially written file
+  const bool is_written = ReplaceFileAtomically(file_path, [&](ofstream& file) {
+    const uint32_t number_of_header_values = (uint32_t)header_values.size();
+    const uint32_t number_of_series = (uint32_t)series_list.size();
+    file.write(kCacheMagic, sizeof(kCacheMagic));
+    file.write(reinterpret_cast<const char*>(&kCacheFormatVersion), sizeof(kCacheFormatVersion));
+    file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+    file.write(reinterpret_cast<const char*>(&number_of_header_values), sizeof(number_of_header_values));
+    file.write(reinterpret_cast<const char*>(header_values.data()), sizeof(double) * header_values.size());
+    file.write(reinterpret_cast<const char*>(&number_of_series), sizeof(number_of_series));
+    for (const auto& series : series_list) {
+      const uint64_t length = series.size();
+      file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+      file.write(reinterpret_cast<const char*>(series.data()), sizeof(double) * series.size());
     }
-    res += t_k * values.at(i);
+  });
+  if (!is_written) {
+    cout << "GNSS cache file cannot be written: " << file_path << endl;
   }
+}
 
-  return res;
+/**
+ * @fn ReadCacheFile
+ * @brief Read time series from the binary cache file
+ * @param [in] file_path: Path to the cache file
+ * @param [in] key: Key of the cache
+ * @param [out] header_values: Scalar values
+ * @param [out] series_list: Time series
+ * @return True when the cache file exists and matches with the key
+ */
+bool ReadCacheFile(const string& file_path, const uint64_t key, vector<double>& header_values, vector<vector<double>>& series_list) {
+  MemoryMappedFile file(file_path);
+  if (!file.IsOpened()) return false;
+  const char* cursor = file.GetData();
+  const char* end = cursor + file.GetSize_B();
+
+  // Copy a value from the mapped file with the range check
+  auto read = [&cursor, end](void* value, const size_t size_B) {
+    if ((size_t)(end - cursor) < size_B) return false;
+    memcpy(value, cursor, size_B);
+    cursor += size_B;
+    return true;
+  };
+
+  char magic[8];
+  uint32_t format_version = 0, number_of_header_values = 0, number_of_series = 0;
+  uint64_t file_key = 0;
+  if (!read(magic, sizeof(magic)) || memcmp(magic, kCacheMagic, sizeof(magic)) != 0) return false;
+  if (!read(&format_version, sizeof(format_version)) || format_version != kCacheFormatVersion) return false;
+  if (!read(&file_key, sizeof(file_key)) || file_key != key) return false;
+  if (!read(&number_of_header_values, sizeof(number_of_header_values))) return false;
+  header_values.resize(number_of_header_values);
+  if (!read(header_values.data(), sizeof(double) * number_of_header_values)) return false;
+  if (!read(&number_of_series, sizeof(number_of_series))) return false;
+  series_list.resize(number_of_series);
+  for (auto& series : series_list) {
+    uint64_t length = 0;
+    if (!read(&length, sizeof(length)) || length > (uint64_t)(end - cursor) / sizeof(double)) return false;
+    series.resize((size_t)length);
+    if (!read(series.data(), sizeof(double) * series.size())) return false;
+  }
+  return true;
+}
+
+// GnssSatelliteBase
+void GnssSatelliteBase::InitializeWindows() {
+  window_begin_index_.assign(all_sat_num_, 0);
+  is_window_full_.assign(all_sat_num_, false);
+  barycentric_weights_.assign(all_sat_num_, vector<double>(interpolation_number_, 0.0));
+  interpolation_coefficients_.assign(interpolation_number_, 0.0);
 }
 
-template <size_t N>
-libra::Vector<N> GnssSatelliteBase::LagrangeInterpolation(const vector<double>& time_vector, const vector<libra::Vector<N>>& values,
-                                                          double time) const {
-  int n = time_vector.size();
-  libra::Vector<N> res(0.0);
+double GnssSatelliteBase::CalcNodeDifference(const double time_1, const double time_2) const {
+  if (is_trigonometric_interpolation_) {
+    const double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
+    return sin(w * (time_1 - time_2) / 2.0);
+  }
+  return time_1 - time_2;
+}
 
-  for (int i = 0; i < n; ++i) {
-    double l_i = 1.0;
-    for (int j = 0; j < n; ++j) {
+void GnssSatelliteBase::SetWindow(const int gnss_satellite_id, const int nearest_index) {
+  const vector<double>& unix_time = unix_time_list.at(gnss_satellite_id);
+  // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
+  const int begin_index = nearest_index - interpolation_number_ / 2;
+  window_begin_index_.at(gnss_satellite_id) = begin_index;
+  is_window_full_.at(gnss_satellite_id) =
+      (interpolation_number_ > 0 && begin_index >= 0 && begin_index + interpolation_number_ <= (int)unix_time.size());
+  if (!is_window_full_.at(gnss_satellite_id)) return;
+
+  vector<double>& weights = barycentric_weights_.at(gnss_satellite_id);
+  for (int i = 0; i < interpolation_number_; ++i) {
+    double product = 1.0;
+    for (int j = 0; j < interpolation_number_; ++j) {
       if (i == j) continue;
-      l_i *= (time - time_vector.at(j)) / (time_vector.at(i) - time_vector.at(j));
-    }
-    for (int j = 0; j < N; ++j) {
-      res(j) += l_i * values.at(i)(j);
+      product *= CalcNodeDifference(unix_time[begin_index + i], unix_time[begin_index + j]);
     }
+    weights[i] = 1.0 / product;
   }
+}
 
-  return res;
+void GnssSatelliteBase::ShiftWindow(const int gnss_satellite_id, const int nearest_index) {
+  const vector<double>& unix_time = unix_time_list.at(gnss_satellite_id);
+  const int begin_index = nearest_index - interpolation_number_ / 2;
+  if (!is_window_full_.at(gnss_satellite_id) || begin_index != window_begin_index_.at(gnss_satellite_id) + 1 ||
+      begin_index + interpolation_number_ > (int)unix_time.size()) {
+    SetWindow(gnss_satellite_id, nearest_index);
+    return;
+  }
+  window_begin_index_.at(gnss_satellite_id) = begin_index;
+
+  // Remove the contribution of the first node and add the new last node to the weights of the remaining nodes
+  vector<double>& weights = barycentric_weights_.at(gnss_satellite_id);
+  const double removed_time = unix_time[begin_index - 1];
+  const double added_time = unix_time[begin_index + interpolation_number_ - 1];
+  double product = 1.0;
+  for (int i = 0; i < interpolation_number_ - 1; ++i) {
+    const double node_time = unix_time[begin_index + i];
+    weights[i] = weights[i + 1] * CalcNodeDifference(node_time, removed_time) / CalcNodeDifference(node_time, added_time);
+    product *= CalcNodeDifference(added_time, node_time);
+  }
+  weights[interpolation_number_ - 1] = 1.0 / product;
 }
 
-double GnssSatelliteBase::LagrangeInterpolation(const vector<double>& time_vector, const vector<double>& values, double time) const {
-  size_t n = time_vector.size();
-  double res = 0.0;
-  for (size_t i = 0; i < n; ++i) {
-    double l_i = 1.0;
-    for (size_t j = 0; j < n; ++j) {
-      if (i == j) continue;
-      l_i *= (time - time_vector.at(j)) / (time_vector.at(i) - time_vector.at(j));
+void GnssSatelliteBase::CalcInterpolationCoefficients(const int gnss_satellite_id, const double time) {
+  const vector<double>& unix_time = unix_time_list.at(gnss_satellite_id);
+  const vector<double>& weights = barycentric_weights_.at(gnss_satellite_id);
+  const int begin_index = window_begin_index_.at(gnss_satellite_id);
+
+  // First form of the barycentric formula: l(t) * w_i / d(t, t_i), where l(t) is the product of d(t, t_j) for all nodes
+  double node_polynomial = 1.0;
+  for (int i = 0; i < interpolation_number_; ++i) {
+    interpolation_coefficients_[i] = CalcNodeDifference(time, unix_time[begin_index + i]);
+    node_polynomial *= interpolation_coefficients_[i];
+  }
+  for (int i = 0; i < interpolation_number_; ++i) {
+    if (interpolation_coefficients_[i] == 0.0) {
+      // The time is on the node
+      interpolation_coefficients_.assign(interpolation_number_, 0.0);
+      interpolation_coefficients_[i] = 1.0;
+      return;
     }
-    res += values.at(i) * l_i;
   }
+  for (int i = 0; i < interpolation_number_; ++i) {
+    interpolation_coefficients_[i] = node_polynomial * weights[i] / interpolation_coefficients_[i];
+  }
+}
 
-  return res;
+double GnssSatelliteBase::GetWindowLength_s(const int gnss_satellite_id) const {
+  const vector<double>& unix_time = unix_time_list.at(gnss_satellite_id);
+  const int begin_index = window_begin_index_.at(gnss_satellite_id);
+  return unix_time.at(begin_index + interpolation_number_ - 1) - unix_time.at(begin_index);
 }
 
 int GnssSatelliteBase::GetIndexFromId(string sat_num) const {
@@ -228,138 +505,134 @@ bool GnssSatelliteBase::GetWhetherValid(int gnss_satellite_id) const {
 }
 
 // GnssSatellitePosition
-pair<double, double> GnssSatellitePosition::Initialize(vector<vector<string>>& file, int interpolation_method, int interpolation_number,
-                                                       UltraRapidMode ur_flag) {
+pair<double, double> GnssSatellitePosition::Initialize(const vector<string>& file_paths, int interpolation_method, int interpolation_number,
+                                                       UltraRapidMode ur_flag, const string& cache_directory) {
   UNUSED(interpolation_method);
 
   interpolation_number_ = interpolation_number;
 
   // Expansion
-  time_series_position_ecef_m_.resize(all_sat_num_);  // first vector size is the satellite number
-  time_series_position_eci_m_.resize(all_sat_num_);
-  unix_time_list.resize(all_sat_num_);
+  time_series_position_ecef_m_.assign(all_sat_num_, vector<libra::Vector<3>>());  // first vector size is the satellite number
+  time_series_position_eci_m_.assign(all_sat_num_, vector<libra::Vector<3>>());
+  unix_time_list.assign(all_sat_num_, vector<double>());
 
   // for using min and max, set the sup & inf before
   double start_unix_time = 1e16;
   double end_unix_time = 0;
 
-  for (int page = 0; page < (int)file.size(); ++page) {
-    // Read Header Info
-    int num_of_time_stamps = 0;
-    int num_of_sat = 0;
-    int line;
-    for (line = 0; line < 3; ++line) {
-      istringstream iss{file.at(page).at(line)};
-
-      if (line == 0) {
-        // in seventh line, there is time stamps
-        // http://epncb.oma.be/ftp/data/format/sp3c.txt
-        for (int i = 0; i < 7; ++i) {
-          // how many time stamps are written?
-          string each;
-          iss >> each;
-          if (i == 6) num_of_time_stamps = stoi(each);
-        }
-      } else if (line == 1) {
-        for (int i = 0; i < 4; ++i) {
-          string each;
-          iss >> each;
-          if (i == 3) time_interval_ = stod(each);
-        }
-      } else if (line == 2) {
-        for (int i = 0; i < 2; ++i) {
-          string each;
-          iss >> each;
-          if (i == 1) num_of_sat = stoi(each);
+  // Use the cache when the same files are already parsed
+  uint64_t cache_key = 0;
+  string cache_file_path;
+  if (!cache_directory.empty()) {
+    cache_key = CalcFilesHash(file_paths);
+    cache_key = MemoryMappedFile::CalcHash(&ur_flag, sizeof(ur_flag), cache_key);
+    cache_file_path = GetCacheFilePath(cache_directory, "position", cache_key);
+
+    vector<double> header_values;
+    vector<vector<double>> series_list;
+    if (ReadCacheFile(cache_file_path, cache_key, header_values, series_list) && header_values.size() == 3 &&
+        series_list.size() == 3 * (size_t)all_sat_num_) {
+      time_interval_ = header_values[0];
+      for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+        const vector<double>& unix_time_series = series_list[3 * gnss_satellite_id];
+        const vector<double>& ecef_series = series_list[3 * gnss_satellite_id + 1];
+        const vector<double>& eci_series = series_list[3 * gnss_satellite_id + 2];
+        const size_t length = unix_time_series.size();
+        if (ecef_series.size() != 3 * length || eci_series.size() != 3 * length) continue;
+
+        unix_time_list.at(gnss_satellite_id) = unix_time_series;
+        time_series_position_ecef_m_.at(gnss_satellite_id).resize(length);
+        time_series_position_eci_m_.at(gnss_satellite_id).resize(length);
+        for (size_t i = 0; i < length; ++i) {
+          for (size_t j = 0; j < 3; ++j) {
+            time_series_position_ecef_m_.at(gnss_satellite_id)[i][j] = ecef_series[3 * i + j];
+            time_series_position_eci_m_.at(gnss_satellite_id)[i][j] = eci_series[3 * i + j];
+          }
         }
       }
+      return make_pair(header_values[1], header_values[2]);
     }
-    line = 3;
-    while (file.at(page).at(line).front() != '*') ++line;
-
-    // Calculate number of data lines
-    int start_line, end_line;
-    if (ur_flag == kNotUse) {
-      start_line = line;
-      end_line = line + (num_of_sat + 1) * num_of_time_stamps;
-    } else {
-      int offset = (int)ur_flag - (int)kObserve1;
-      start_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * offset;
-      end_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * (offset + 1);
+  }
+
+  for (const auto& file_path : file_paths) {
+    MemoryMappedFile file(file_path);
+    if (!file.IsOpened()) {
+      cout << "gnss file: " << file_path << " cannot be opened" << endl;
+      exit(1);
     }
 
     // Read time and position data
     double unix_time = 0;
     double cos_ = 0.0;  //!< cos value for ECEF->ECI conversion
     double sin_ = 0.0;  //!< sin value for ECEF->ECI conversion
-    for (int i = 0; i < end_line - start_line; ++i) {
-      line = i + start_line;
+    auto epoch_function = [&](const TextToken* s) {
+      // Epoch information
+      const int year = ParseInt(s[1]);
+      const int month = ParseInt(s[2]);
+      const int day = ParseInt(s[3]);
+      const int hour = ParseInt(s[4]);
+      const int minute = ParseInt(s[5]);
+      const double second = ParseDouble(s[6]);
+      unix_time = CalcUnixTime(year, month, day, hour, minute, second);
+      // Convert to julian date
+      double jd;
+      jday(year, month, day, hour, minute, second, jd);
+      // Calculate frame conversion
+      double gs_time_ = gstime(jd);
+      cos_ = cos(gs_time_);
+      sin_ = sin(gs_time_);
+      // Set start and end unix time
+      start_unix_time = std::min(start_unix_time, unix_time);
+      end_unix_time = std::max(end_unix_time, unix_time);
+    };
+    auto satellite_function = [&](const TextToken* s) {
+      // Position and clock data of each GNSS satellite
+      int gnss_satellite_id = GetIndexFromId(string(s[0].begin, s[0].length));
+
+      libra::Vector<3> ecef_position_m(0.0);
+      for (int j = 0; j < 3; ++j) {
+        ecef_position_m(j) = ParseDouble(s[j + 1]);
+        if (std::abs(ecef_position_m(j) - nan99) < 1.0) return;
+      }
 
-      istringstream iss{file.at(page).at(line)};
-      vector<string> s;
-      if (i % (num_of_sat + 1) == 0) {
-        // Epoch information
-        for (int j = 0; j < 7; ++j) {
-          string tmp;
-          iss >> tmp;
-          s.push_back(tmp);
-        }
-        // Convert to julian date
-        unix_time = get_unixtime_from_timestamp_line(s);
-        double jd;
-        jday(stoi(s.at(1)), stoi(s.at(2)), stoi(s.at(3)), stoi(s.at(4)), stoi(s.at(5)), stod(s.at(6)), jd);
-        // Calculate frame conversion
-        double gs_time_ = gstime(jd);
-        cos_ = cos(gs_time_);
-        sin_ = sin(gs_time_);
-        // Set start and end unix time
-        start_unix_time = std::min(start_unix_time, unix_time);
-        end_unix_time = std::max(end_unix_time, unix_time);
+      // [km] -> [m]
+      ecef_position_m *= 1000.0;
+
+      // ECI frame conversion
+      libra::Vector<3> eci_position(0.0);
+      double x = ecef_position_m(0);
+      double y = ecef_position_m(1);
+      double z = ecef_position_m(2);
+      eci_position(0) = cos_ * x - sin_ * y;
+      eci_position(1) = sin_ * x + cos_ * y;
+      eci_position(2) = z;
+
+      // Set data
+      if (!unix_time_list.at(gnss_satellite_id).empty() && std::abs(unix_time - unix_time_list.at(gnss_satellite_id).back()) < 1.0) {
+        unix_time_list.at(gnss_satellite_id).back() = unix_time;
+        time_series_position_ecef_m_.at(gnss_satellite_id).back() = ecef_position_m;
+        time_series_position_eci_m_.at(gnss_satellite_id).back() = eci_position;
       } else {
-        // Position and clock data of each GNSS satellite
-        for (int j = 0; j < 5; ++j) {
-          string tmp;
-          iss >> tmp;
-          s.push_back(tmp);
-        }
-        int gnss_satellite_id = GetIndexFromId(s.front());
-
-        bool available_flag = true;
-        libra::Vector<3> ecef_position_m(0.0);
-        for (int j = 0; j < 3; ++j) {
-          if (std::abs(stod(s.at(j + 1)) - nan99) < 1.0) {
-            available_flag = false;
-            break;
-          } else {
-            ecef_position_m(j) = stod(s.at(j + 1));
-          }
-        }
-        if (!available_flag) continue;
-
-        // [km] -> [m]
-        ecef_position_m *= 1000.0;
-
-        // ECI frame conversion
-        libra::Vector<3> eci_position(0.0);
-        double x = ecef_position_m(0);
-        double y = ecef_position_m(1);
-        double z = ecef_position_m(2);
-        eci_position(0) = cos_ * x - sin_ * y;
-        eci_position(1) = sin_ * x + cos_ * y;
-        eci_position(2) = z;
+        unix_time_list.at(gnss_satellite_id).emplace_back(unix_time);
+        time_series_position_ecef_m_.at(gnss_satellite_id).emplace_back(ecef_position_m);
+        time_series_position_eci_m_.at(gnss_satellite_id).emplace_back(eci_position);
+      }
+    };
+    ReadSp3Records(file, ur_flag, time_interval_, epoch_function, satellite_function);
+  }
 
-        // Set data
-        if (!unix_time_list.at(gnss_satellite_id).empty() && std::abs(unix_time - unix_time_list.at(gnss_satellite_id).back()) < 1.0) {
-          unix_time_list.at(gnss_satellite_id).back() = unix_time;
-          time_series_position_ecef_m_.at(gnss_satellite_id).back() = ecef_position_m;
-          time_series_position_eci_m_.at(gnss_satellite_id).back() = eci_position;
-        } else {
-          unix_time_list.at(gnss_satellite_id).emplace_back(unix_time);
-          time_series_position_ecef_m_.at(gnss_satellite_id).emplace_back(ecef_position_m);
-          time_series_position_eci_m_.at(gnss_satellite_id).emplace_back(eci_position);
+  if (!cache_file_path.empty()) {
+    vector<vector<double>> series_list(3 * all_sat_num_);
+    for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+      series_list[3 * gnss_satellite_id] = unix_time_list.at(gnss_satellite_id);
+      for (size_t i = 0; i < unix_time_list.at(gnss_satellite_id).size(); ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+          series_list[3 * gnss_satellite_id + 1].push_back(time_series_position_ecef_m_.at(gnss_satellite_id)[i][j]);
+          series_list[3 * gnss_satellite_id + 2].push_back(time_series_position_eci_m_.at(gnss_satellite_id)[i][j]);
         }
       }
     }
+    WriteCacheFile(cache_file_path, cache_key, {time_interval_, start_unix_time, end_unix_time}, series_list);
   }
 
   return make_pair(start_unix_time, end_unix_time);
@@ -372,11 +645,8 @@ void GnssSatellitePosition::SetUp(const double start_unix_time, const double ste
   position_eci_m_.assign(all_sat_num_, libra::Vector<3>(0.0));
   validate_.assign(all_sat_num_, false);
 
-  nearest_index_.resize(all_sat_num_);
-  time_period_list_.resize(all_sat_num_);
-
-  ecef_.resize(all_sat_num_);
-  eci_.resize(all_sat_num_);
+  nearest_index_.assign(all_sat_num_, 0);
+  InitializeWindows();
 
   for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
     if (unix_time_list.at(gnss_satellite_id).empty()) {
@@ -404,37 +674,8 @@ void GnssSatellitePosition::SetUp(const double start_unix_time, const double ste
       continue;
     }
 
-    // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-    for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-      int now_index = index + j;
-      if (now_index < 0 || now_index >= (int)unix_time_list.at(gnss_satellite_id).size()) continue;
-
-      time_period_list_.at(gnss_satellite_id).push_back(unix_time_list.at(gnss_satellite_id).at(now_index));
-      ecef_.at(gnss_satellite_id).push_back(time_series_position_ecef_m_.at(gnss_satellite_id).at(now_index));
-      eci_.at(gnss_satellite_id).push_back(time_series_position_eci_m_.at(gnss_satellite_id).at(now_index));
-    }
-    if ((int)time_period_list_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    double time_period_length = time_period_list_.at(gnss_satellite_id).back() - time_period_list_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1 + 3) + 1e-4) {  // allow for 3 missing
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
-
-    if (std::abs(start_unix_time - nearest_unixtime) < 1e-4) {  // for the numerical error, plus 1e-4
-      position_ecef_m_.at(gnss_satellite_id) = time_series_position_ecef_m_.at(gnss_satellite_id).at(index);
-      position_eci_m_.at(gnss_satellite_id) = time_series_position_eci_m_.at(gnss_satellite_id).at(index);
-    } else {
-      position_ecef_m_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_list_.at(gnss_satellite_id), ecef_.at(gnss_satellite_id), start_unix_time);
-      position_eci_m_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_list_.at(gnss_satellite_id), eci_.at(gnss_satellite_id), start_unix_time);
-    }
+    SetWindow(gnss_satellite_id, index);
+    UpdatePosition(gnss_satellite_id, start_unix_time, nearest_unixtime);
   }
 }
 
@@ -458,20 +699,7 @@ void GnssSatellitePosition::Update(const double current_unix_time) {
       if (std::abs(current_unix_time - post_unix) < std::abs(current_unix_time - pre_unix)) {
         ++index;
         nearest_index_.at(gnss_satellite_id) = index;
-
-        time_period_list_.at(gnss_satellite_id).clear();
-        ecef_.at(gnss_satellite_id).clear();
-        eci_.at(gnss_satellite_id).clear();
-
-        // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-        for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-          int now_index = index + j;
-          if (now_index < 0 || now_index >= (int)unix_time_list.at(gnss_satellite_id).size()) continue;
-
-          time_period_list_.at(gnss_satellite_id).push_back(unix_time_list.at(gnss_satellite_id).at(now_index));
-          ecef_.at(gnss_satellite_id).push_back(time_series_position_ecef_m_.at(gnss_satellite_id).at(now_index));
-          eci_.at(gnss_satellite_id).push_back(time_series_position_eci_m_.at(gnss_satellite_id).at(now_index));
-        }
+        ShiftWindow(gnss_satellite_id, index);
       }
     }
     double nearest_unix_time = unix_time_list.at(gnss_satellite_id).at(index);
@@ -480,29 +708,40 @@ void GnssSatellitePosition::Update(const double current_unix_time) {
       continue;
     }
 
-    if ((int)time_period_list_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
+    UpdatePosition(gnss_satellite_id, current_unix_time, nearest_unix_time);
+  }
+}
 
-    double time_period_length = time_period_list_.at(gnss_satellite_id).back() - time_period_list_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1 + 3) + 1e-4) {  // allow for 3 missing
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
+void GnssSatellitePosition::UpdatePosition(const int gnss_satellite_id, const double current_unix_time, const double nearest_unix_time) {
+  if (!is_window_full_.at(gnss_satellite_id)) {
+    validate_.at(gnss_satellite_id) = false;
+    return;
+  }
 
-    if (std::abs(current_unix_time - nearest_unix_time) < 1e-4) {  // for the numerical error, plus 1e-4
-      position_ecef_m_.at(gnss_satellite_id) = time_series_position_ecef_m_.at(gnss_satellite_id).at(index);
-      position_eci_m_.at(gnss_satellite_id) = time_series_position_eci_m_.at(gnss_satellite_id).at(index);
-    } else {
-      position_ecef_m_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_list_.at(gnss_satellite_id), ecef_.at(gnss_satellite_id), current_unix_time);
-      position_eci_m_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_list_.at(gnss_satellite_id), eci_.at(gnss_satellite_id), current_unix_time);
-    }
+  if (GetWindowLength_s(gnss_satellite_id) > time_interval_ * (interpolation_number_ - 1 + 3) + 1e-4) {  // allow for 3 missing
+    validate_.at(gnss_satellite_id) = false;
+    return;
+  } else {
+    validate_.at(gnss_satellite_id) = true;
   }
+
+  const int index = nearest_index_.at(gnss_satellite_id);
+  if (std::abs(current_unix_time - nearest_unix_time) < 1e-4) {  // for the numerical error, plus 1e-4
+    position_ecef_m_.at(gnss_satellite_id) = time_series_position_ecef_m_.at(gnss_satellite_id).at(index);
+    position_eci_m_.at(gnss_satellite_id) = time_series_position_eci_m_.at(gnss_satellite_id).at(index);
+    return;
+  }
+
+  // The same coefficients are used for both frames
+  CalcInterpolationCoefficients(gnss_satellite_id, current_unix_time);
+  const int begin_index = window_begin_index_.at(gnss_satellite_id);
+  libra::Vector<3> position_ecef_m(0.0), position_eci_m(0.0);
+  for (int i = 0; i < interpolation_number_; ++i) {
+    position_ecef_m += interpolation_coefficients_[i] * time_series_position_ecef_m_.at(gnss_satellite_id)[begin_index + i];
+    position_eci_m += interpolation_coefficients_[i] * time_series_position_eci_m_.at(gnss_satellite_id)[begin_index + i];
+  }
+  position_ecef_m_.at(gnss_satellite_id) = position_ecef_m;
+  position_eci_m_.at(gnss_satellite_id) = position_eci_m;
 }
 
 libra::Vector<3> GnssSatellitePosition::GetPosition_ecef_m(int gnss_satellite_id) const {
@@ -516,104 +755,84 @@ libra::Vector<3> GnssSatellitePosition::GetPosition_eci_m(int gnss_satellite_id)
 }
 
 // GnssSatelliteClock
-void GnssSatelliteClock::Initialize(vector<vector<string>>& file, string file_extension, int interpolation_number, UltraRapidMode ur_flag,
-                                    pair<double, double> unix_time_period) {
+void GnssSatelliteClock::Initialize(const vector<string>& file_paths, string file_extension, int interpolation_number, UltraRapidMode ur_flag,
+                                    pair<double, double> unix_time_period, const string& cache_directory) {
   interpolation_number_ = interpolation_number;
-  time_series_clock_offset_m_.resize(all_sat_num_);  // first vector size is the sat num
-  unix_time_list.resize(all_sat_num_);
+  time_series_clock_offset_m_.assign(all_sat_num_, vector<double>());  // first vector size is the sat num
+  unix_time_list.assign(all_sat_num_, vector<double>());
 
-  if (file_extension == ".sp3") {
-    for (int page = 0; page < (int)file.size(); ++page) {
-      // Read Header Info
-      int num_of_time_stamps = 0;
-      int num_of_sat = 0;
-      int line;
-      for (line = 0; line < 3; ++line) {
-        istringstream iss{file.at(page).at(line)};
-
-        if (line == 0) {
-          // in seventh line, there is time stamps
-          // http://epncb.oma.be/ftp/data/format/sp3c.txt
-          for (int i = 0; i < 7; ++i) {
-            // how many time stamps are written?
-            string each;
-            iss >> each;
-            if (i == 6) num_of_time_stamps = stoi(each);
-          }
-        } else if (line == 1) {
-          for (int i = 0; i < 4; ++i) {
-            string each;
-            iss >> each;
-            if (i == 3) time_interval_ = stod(each);
-          }
-        } else if (line == 2) {
-          for (int i = 0; i < 2; ++i) {
-            string each;
-            iss >> each;
-            if (i == 1) num_of_sat = stoi(each);
-          }
-        }
+  if (file_extension != ".sp3" && kPredict1 <= ur_flag && ur_flag <= kPredict4) {
+    cout << "clock settings has something wrong" << endl;
+    exit(1);
+  }
+
+  // Use the cache when the same files are already parsed
+  uint64_t cache_key = 0;
+  string cache_file_path;
+  if (!cache_directory.empty()) {
+    cache_key = CalcFilesHash(file_paths);
+    cache_key = MemoryMappedFile::CalcHash(file_extension.data(), file_extension.size(), cache_key);
+    cache_key = MemoryMappedFile::CalcHash(&ur_flag, sizeof(ur_flag), cache_key);
+    cache_key = MemoryMappedFile::CalcHash(&unix_time_period.first, sizeof(unix_time_period.first), cache_key);
+    cache_key = MemoryMappedFile::CalcHash(&unix_time_period.second, sizeof(unix_time_period.second), cache_key);
+    cache_file_path = GetCacheFilePath(cache_directory, "clock", cache_key);
+
+    vector<double> header_values;
+    vector<vector<double>> series_list;
+    if (ReadCacheFile(cache_file_path, cache_key, header_values, series_list) && header_values.size() == 1 &&
+        series_list.size() == 2 * (size_t)all_sat_num_) {
+      time_interval_ = header_values[0];
+      for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+        if (series_list[2 * gnss_satellite_id].size() != series_list[2 * gnss_satellite_id + 1].size()) continue;
+        unix_time_list.at(gnss_satellite_id) = series_list[2 * gnss_satellite_id];
+        time_series_clock_offset_m_.at(gnss_satellite_id) = series_list[2 * gnss_satellite_id + 1];
       }
-      line = 3;
-      while (file.at(page).at(line).front() != '*') ++line;
+      return;
+    }
+  }
 
-      // Calculate number of data lines
-      int start_line, end_line;
-      if (ur_flag == kNotUse) {
-        start_line = line;
-        end_line = line + (num_of_sat + 1) * num_of_time_stamps;
-      } else {
-        int offset = (int)ur_flag - (int)kObserve1;
-        start_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * offset;
-        end_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * (offset + 1);
+  if (file_extension == ".sp3") {
+    for (const auto& file_path : file_paths) {
+      MemoryMappedFile file(file_path);
+      if (!file.IsOpened()) {
+        cout << "gnss file: " << file_path << " cannot be opened" << endl;
+        exit(1);
       }
 
       // Read time and clock data
       double unix_time = 0;
-      for (int i = 0; i < end_line - start_line; ++i) {
-        line = i + start_line;
-
-        istringstream iss{file.at(page).at(line)};
-        vector<string> s;
-        if (i % (num_of_sat + 1) == 0) {
-          // Epoch information
-          for (int j = 0; j < 7; ++j) {
-            string tmp;
-            iss >> tmp;
-            s.push_back(tmp);
-          }
-          unix_time = get_unixtime_from_timestamp_line(s);
+      auto epoch_function = [&](const TextToken* s) {
+        // Epoch information
+        unix_time = CalcUnixTime(ParseInt(s[1]), ParseInt(s[2]), ParseInt(s[3]), ParseInt(s[4]), ParseInt(s[5]), ParseDouble(s[6]));
+      };
+      auto satellite_function = [&](const TextToken* s) {
+        int gnss_satellite_id = GetIndexFromId(string(s[0].begin, s[0].length));
+
+        double clock = ParseDouble(s[4]);
+        if (std::abs(clock - nan99) < 1.0) return;
+
+        // In the file, clock bias is expressed in [micro second], so by multiplying by the speed_of_light & 1e-6, they are converted to [m]
+        clock *= (environment::speed_of_light_m_s * 1e-6);
+        if (!unix_time_list.at(gnss_satellite_id).empty() && std::abs(unix_time - unix_time_list.at(gnss_satellite_id).back()) < 1.0) {
+          unix_time_list.at(gnss_satellite_id).back() = unix_time;
+          time_series_clock_offset_m_.at(gnss_satellite_id).back() = clock;
         } else {
-          for (int j = 0; j < 5; ++j) {
-            string tmp;
-            iss >> tmp;
-            s.push_back(tmp);
-          }
-          int gnss_satellite_id = GetIndexFromId(s.front());
-
-          double clock = stod(s.at(4));
-          if (std::abs(clock - nan99) < 1.0) continue;
-
-          // In the file, clock bias is expressed in [micro second], so by multiplying by the speed_of_light & 1e-6, they are converted to [m]
-          clock *= (environment::speed_of_light_m_s * 1e-6);
-          if (!unix_time_list.at(gnss_satellite_id).empty() && std::abs(unix_time - unix_time_list.at(gnss_satellite_id).back()) < 1.0) {
-            unix_time_list.at(gnss_satellite_id).back() = unix_time;
-            time_series_clock_offset_m_.at(gnss_satellite_id).back() = clock;
-          } else {
-            unix_time_list.at(gnss_satellite_id).push_back(unix_time);
-            time_series_clock_offset_m_.at(gnss_satellite_id).emplace_back(clock);
-          }
+          unix_time_list.at(gnss_satellite_id).push_back(unix_time);
+          time_series_clock_offset_m_.at(gnss_satellite_id).emplace_back(clock);
         }
-      }
+      };
+      ReadSp3Records(file, ur_flag, time_interval_, epoch_function, satellite_function);
     }
   } else {  // .clk30s
-    if (kPredict1 <= ur_flag && ur_flag <= kPredict4) {
-      cout << "clock settings has something wrong" << endl;
-      exit(1);
-    }
     time_interval_ = 1e9;
 
-    for (int page = 0; page < (int)file.size(); ++page) {
+    for (const auto& file_path : file_paths) {
+      MemoryMappedFile file(file_path);
+      if (!file.IsOpened()) {
+        cout << "gnss file: " << file_path << " cannot be opened" << endl;
+        exit(1);
+      }
+
       double start_unix_time, end_unix_time;
       if (ur_flag == kNotUse) {
         start_unix_time = unix_time_period.first;
@@ -622,36 +841,35 @@ void GnssSatelliteClock::Initialize(vector<vector<string>>& file, string file_ex
         start_unix_time = -1;
         end_unix_time = 0;
       }
-      for (int line = 0; line < (int)file.at(page).size(); ++line) {
-        if (file.at(page).at(line).substr(0, 3) != "AS ") continue;
-
-        istringstream iss{file.at(page).at(line)};
-        vector<string> s;
-        for (int i = 0; i < 11; ++i) {
-          string tmp;
-          iss >> tmp;
-          s.push_back(tmp);
-        }
 
-        tm* time_tm = initialized_tm();
-        time_tm->tm_year = stoi(s.at(2)) - 1900;
-        time_tm->tm_mon = stoi(s.at(3)) - 1;  // 0 - 11, in time struct, 1 - 12 month is expressed by 1 - 12
-        time_tm->tm_mday = stoi(s.at(4));
-        time_tm->tm_hour = stoi(s.at(5));
-        time_tm->tm_min = stoi(s.at(6));
-        time_tm->tm_sec = (int)(stod(s.at(7)) + 1e-4);  // for the numerical error, plus 1e-4. tm_sec is to be int
-        double unix_time = (double)mktime(time_tm);
+      const char* cursor = file.GetData();
+      const char* end = cursor + file.GetSize_B();
+      const char* line_begin = nullptr;
+      const char* line_end = nullptr;
+      TextToken s[10];
+      // All satellites share the same epoch in a block of lines, so the last converted epoch is reused
+      const char* last_epoch_begin = nullptr;
+      size_t last_epoch_length = 0;
+      double unix_time = 0.0;
+      while (GetNextLine(cursor, end, line_begin, line_end)) {
+        if (line_end - line_begin < 3 || memcmp(line_begin, "AS ", 3) != 0) continue;
+        if (SplitTokens(line_begin, line_end, s, 10) < 10) continue;
+
+        const size_t epoch_length = s[7].begin + s[7].length - s[2].begin;
+        if (last_epoch_begin == nullptr || epoch_length != last_epoch_length || memcmp(last_epoch_begin, s[2].begin, epoch_length) != 0) {
+          unix_time = CalcUnixTime(ParseInt(s[2]), ParseInt(s[3]), ParseInt(s[4]), ParseInt(s[5]), ParseInt(s[6]), ParseDouble(s[7]));
+          last_epoch_begin = s[2].begin;
+          last_epoch_length = epoch_length;
+        }
         const double interval = 6 * 60 * 60;
         if (start_unix_time < 0) {
           start_unix_time = unix_time + (ur_flag - kObserve1) * interval;  // Fix here to use enum class
           end_unix_time = start_unix_time + interval;
         }
 
-        std::free(time_tm);
-
-        int gnss_satellite_id = GetIndexFromId(s.at(1));
-        double clock_bias = stod(s.at(9)) * environment::speed_of_light_m_s;  // [s] -> [m]
-        if (start_unix_time - unix_time > 1e-4) continue;                     // for the numerical error
+        int gnss_satellite_id = GetIndexFromId(string(s[1].begin, s[1].length));
+        double clock_bias = ParseDouble(s[9]) * environment::speed_of_light_m_s;  // [s] -> [m]
+        if (start_unix_time - unix_time > 1e-4) continue;                         // for the numerical error
         if (end_unix_time - unix_time < 1e-4) break;
         if (!unix_time_list.at(gnss_satellite_id).empty() &&
             std::abs(unix_time - unix_time_list.at(gnss_satellite_id).back()) < 1e-4) {  // for the numerical error
@@ -666,18 +884,25 @@ void GnssSatelliteClock::Initialize(vector<vector<string>>& file, string file_ex
       }
     }
   }
+
+  if (!cache_file_path.empty()) {
+    vector<vector<double>> series_list(2 * all_sat_num_);
+    for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+      series_list[2 * gnss_satellite_id] = unix_time_list.at(gnss_satellite_id);
+      series_list[2 * gnss_satellite_id + 1] = time_series_clock_offset_m_.at(gnss_satellite_id);
+    }
+    WriteCacheFile(cache_file_path, cache_key, {time_interval_}, series_list);
+  }
 }
 
 void GnssSatelliteClock::SetUp(const double start_unix_time, const double step_width_s) {
   step_width_s_ = step_width_s;
 
-  clock_offset_m_.resize(all_sat_num_);
+  clock_offset_m_.assign(all_sat_num_, 0.0);
   validate_.assign(all_sat_num_, false);
 
-  nearest_index_.resize(all_sat_num_);
-  time_period_list_.resize(all_sat_num_);
-
-  clock_bias_.resize(all_sat_num_);
+  nearest_index_.assign(all_sat_num_, 0);
+  InitializeWindows();
 
   for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
     if (unix_time_list.at(gnss_satellite_id).empty()) {
@@ -705,33 +930,8 @@ void GnssSatelliteClock::SetUp(const double start_unix_time, const double step_w
       continue;
     }
 
-    // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-    for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-      int now_index = index + j;
-      if (now_index < 0 || now_index >= (int)unix_time_list.at(gnss_satellite_id).size()) continue;
-
-      time_period_list_.at(gnss_satellite_id).push_back(unix_time_list.at(gnss_satellite_id).at(now_index));
-      clock_bias_.at(gnss_satellite_id).push_back(time_series_clock_offset_m_.at(gnss_satellite_id).at(now_index));
-    }
-
-    if ((int)time_period_list_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-    double time_period_length = time_period_list_.at(gnss_satellite_id).back() - time_period_list_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1) + 1e-4) {  // more strict for clock_bias
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
-
-    if (std::abs(start_unix_time - nearest_unixtime) < 1e-4) {  // for the numerical error
-      clock_offset_m_.at(gnss_satellite_id) = time_series_clock_offset_m_.at(gnss_satellite_id).at(index);
-    } else {
-      clock_offset_m_.at(gnss_satellite_id) =
-          LagrangeInterpolation(time_period_list_.at(gnss_satellite_id), clock_bias_.at(gnss_satellite_id), start_unix_time);
-    }
+    SetWindow(gnss_satellite_id, index);
+    UpdateClock(gnss_satellite_id, start_unix_time, nearest_unixtime);
   }
 }
 
@@ -755,24 +955,9 @@ void GnssSatelliteClock::Update(const double current_unix_time) {
       if (std::abs(current_unix_time - post_unix) < std::abs(current_unix_time - pre_unix)) {
         ++index;
         nearest_index_.at(gnss_satellite_id) = index;
-
-        time_period_list_.at(gnss_satellite_id).clear();
-        clock_bias_.at(gnss_satellite_id).clear();
-
-        // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-        for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-          int now_index = index + j;
-          if (now_index < 0 || now_index >= (int)unix_time_list.at(gnss_satellite_id).size()) continue;
-
-          time_period_list_.at(gnss_satellite_id).push_back(unix_time_list.at(gnss_satellite_id).at(now_index));
-          clock_bias_.at(gnss_satellite_id).push_back(time_series_clock_offset_m_.at(gnss_satellite_id).at(now_index));
-        }
+        ShiftWindow(gnss_satellite_id, index);
       }
     }
-    if ((int)time_period_list_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
 
     double nearest_unix_time = unix_time_list.at(gnss_satellite_id).at(index);
     if (std::abs(current_unix_time - nearest_unix_time) > time_interval_) {
@@ -780,22 +965,37 @@ void GnssSatelliteClock::Update(const double current_unix_time) {
       continue;
     }
 
-    // in clock_bias, more strict.
-    double time_period_length = time_period_list_.at(gnss_satellite_id).back() - time_period_list_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1) + 1e-4) {  // more strict for clock_bias
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
+    UpdateClock(gnss_satellite_id, current_unix_time, nearest_unix_time);
+  }
+}
 
-    if (std::abs(current_unix_time - nearest_unix_time) < 1e-4) {
-      clock_offset_m_.at(gnss_satellite_id) = time_series_clock_offset_m_.at(gnss_satellite_id).at(index);
-    } else {
-      clock_offset_m_.at(gnss_satellite_id) =
-          LagrangeInterpolation(time_period_list_.at(gnss_satellite_id), clock_bias_.at(gnss_satellite_id), current_unix_time);
-    }
+void GnssSatelliteClock::UpdateClock(const int gnss_satellite_id, const double current_unix_time, const double nearest_unix_time) {
+  if (!is_window_full_.at(gnss_satellite_id)) {
+    validate_.at(gnss_satellite_id) = false;
+    return;
+  }
+
+  // in clock_bias, more strict.
+  if (GetWindowLength_s(gnss_satellite_id) > time_interval_ * (interpolation_number_ - 1) + 1e-4) {
+    validate_.at(gnss_satellite_id) = false;
+    return;
+  } else {
+    validate_.at(gnss_satellite_id) = true;
+  }
+
+  const int index = nearest_index_.at(gnss_satellite_id);
+  if (std::abs(current_unix_time - nearest_unix_time) < 1e-4) {  // for the numerical error
+    clock_offset_m_.at(gnss_satellite_id) = time_series_clock_offset_m_.at(gnss_satellite_id).at(index);
+    return;
   }
+
+  CalcInterpolationCoefficients(gnss_satellite_id, current_unix_time);
+  const int begin_index = window_begin_index_.at(gnss_satellite_id);
+  double clock_offset_m = 0.0;
+  for (int i = 0; i < interpolation_number_; ++i) {
+    clock_offset_m += interpolation_coefficients_[i] * time_series_clock_offset_m_.at(gnss_satellite_id)[begin_index + i];
+  }
+  clock_offset_m_.at(gnss_satellite_id) = clock_offset_m;
 }
 
 double GnssSatelliteClock::GetSatClock(int gnss_satellite_id) const {
@@ -805,11 +1005,13 @@ double GnssSatelliteClock::GetSatClock(int gnss_satellite_id) const {
 
 // GnssSatelliteInformation
 GnssSatelliteInformation::GnssSatelliteInformation() {}
-void GnssSatelliteInformation::Initialize(vector<vector<string>>& position_file, int position_interpolation_method, int position_interpolation_number,
-                                          UltraRapidMode position_ur_flag, vector<vector<string>>& clock_file, string clock_file_extension,
-                                          int clock_interpolation_number, UltraRapidMode clock_ur_flag) {
-  auto unix_time_period = position_.Initialize(position_file, position_interpolation_method, position_interpolation_number, position_ur_flag);
-  clock_.Initialize(clock_file, clock_file_extension, clock_interpolation_number, clock_ur_flag, unix_time_period);
+void GnssSatelliteInformation::Initialize(const vector<string>& position_file_paths, int position_interpolation_method,
+                                          int position_interpolation_number, UltraRapidMode position_ur_flag, const vector<string>& clock_file_paths,
+                                          string clock_file_extension, int clock_interpolation_number, UltraRapidMode clock_ur_flag,
+                                          const string& cache_directory) {
+  auto unix_time_period =
+      position_.Initialize(position_file_paths, position_interpolation_method, position_interpolation_number, position_ur_flag, cache_directory);
+  clock_.Initialize(clock_file_paths, clock_file_extension, clock_interpolation_number, clock_ur_flag, unix_time_period, cache_directory);
 }
 
 void GnssSatelliteInformation::SetUp(const double start_unix_time, const double step_width_s) {
@@ -865,25 +1067,26 @@ GnssSatellites::GnssSatellites(bool is_calc_enabled)
 
 bool GnssSatellites::IsCalcEnabled() const { return is_calc_enabled_; }
 
-void GnssSatellites::Initialize(vector<vector<string>>& true_position_file, int true_position_interpolation_method,
+void GnssSatellites::Initialize(const vector<string>& true_position_file_paths, int true_position_interpolation_method,
                                 int true_position_interpolation_number, UltraRapidMode true_position_ur_flag,
 
-                                vector<vector<string>>& true_clock_file, string true_clock_file_extension, int true_clock_interpolation_number,
+                                const vector<string>& true_clock_file_paths, string true_clock_file_extension, int true_clock_interpolation_number,
                                 UltraRapidMode true_clock_ur_flag,
 
-                                vector<vector<string>>& estimate_position_file, int estimate_position_interpolation_method,
+                                const vector<string>& estimate_position_file_paths, int estimate_position_interpolation_method,
                                 int estimate_position_interpolation_number, UltraRapidMode estimate_position_ur_flag,
 
-                                vector<vector<string>>& estimate_clock_file, string estimate_clock_file_extension,
-                                int estimate_clock_interpolation_number, UltraRapidMode estimate_clock_ur_flag) {
-  true_info_.Initialize(true_position_file, true_position_interpolation_method, true_position_interpolation_number, true_position_ur_flag,
+                                const vector<string>& estimate_clock_file_paths, string estimate_clock_file_extension,
+                                int estimate_clock_interpolation_number, UltraRapidMode estimate_clock_ur_flag, const string& cache_directory) {
+  true_info_.Initialize(true_position_file_paths, true_position_interpolation_method, true_position_interpolation_number, true_position_ur_flag,
 
-                        true_clock_file, true_clock_file_extension, true_clock_interpolation_number, true_clock_ur_flag);
+                        true_clock_file_paths, true_clock_file_extension, true_clock_interpolation_number, true_clock_ur_flag, cache_directory);
 
-  estimate_info_.Initialize(estimate_position_file, estimate_position_interpolation_method, estimate_position_interpolation_number,
+  estimate_info_.Initialize(estimate_position_file_paths, estimate_position_interpolation_method, estimate_position_interpolation_number,
                             estimate_position_ur_flag,
 
-                            estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag);
+                            estimate_clock_file_paths, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag,
+                            cache_directory);
 
   return;
 }
@@ -1126,6 +1329,13 @@ std::string GnssSatellites::GetLogValue() const {
   return str_tmp;
 }
 
+void GnssSatellites::AppendLogValue(std::vector<double>& values) const {
+  for (size_t gps_index = 0; gps_index < gps_sat_num_; gps_index++) {
+    AppendVector(values, true_info_.GetSatellitePositionEcef((int)gps_index));
+    AppendScalar(values, true_info_.GetSatelliteClock((int)gps_index));
+  }
+}
+
 void GnssSatellites::DebugOutput() {
 #ifdef GNSS_SATELLITES_DEBUG_OUTPUT
   for (int gnss_satellite_id = 0; gnss_satellite_id < gps_sat_num_; ++gnss_satellite_id) {
@@ -11,6 +11,7 @@
 #include <fstream>
 #include <iomanip>
 #include <map>
+#include <string>
 #include <vector>
 
 #include "library/logger/loggable.hpp"
@@ -77,42 +78,77 @@ class GnssSatelliteBase {
    * @param [in] gnss_satellite_id: Index of GNSS satellite
    */
   bool GetWhetherValid(int gnss_satellite_id) const;
+  /**
+   * @fn GetUnixTimeList
+   * @brief Return the unix time of the nodes read from the files for a GNSS satellite
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
+   */
+  inline const std::vector<double>& GetUnixTimeList(const int gnss_satellite_id) const { return unix_time_list.at(gnss_satellite_id); }
+  /**
+   * @fn GetTimeInterval_s
+   * @brief Return the time interval of the nodes read from the files [s]
+   */
+  inline double GetTimeInterval_s() const { return time_interval_; }
 
  protected:
   /**
-   * @fn TrigonometricInterpolation
-   * @brief Interpolate with Trigonometric method
-   * @note Ref: http://acc.igs.org/orbits/orbit-interp_gpssoln03.pdf
-   *            https://en.wikipedia.org/wiki/Trigonometric_interpolation#
-   * @param [in] time_vector: List of given time
-   * @param [in] values: List of given value
-   * @param [in] time: Time to calculate the interpolated value
-   * @return Interpolated value
+   * @fn InitializeWindows
+   * @brief Allocate the interpolation windows and the barycentric weights for all satellites
    */
-  template <size_t N>
-  libra::Vector<N> TrigonometricInterpolation(const std::vector<double>& time_vector, const std::vector<libra::Vector<N>>& values, double time) const;
-  double TrigonometricInterpolation(const std::vector<double>& time_vector, const std::vector<double>& values, double time) const;
-
+  void InitializeWindows();
+  /**
+   * @fn SetWindow
+   * @brief Set the interpolation window around the nearest node and calculate the barycentric weights in O(n^2)
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
+   * @param [in] nearest_index: Index of the nearest node in unix_time_list
+   */
+  void SetWindow(const int gnss_satellite_id, const int nearest_index);
   /**
-   * @fn LagrangeInterpolation
-   * @brief Interpolate with Lagrange method
-   * @param [in] time_vector: List of given time
-   * @param [in] values: List of given value
+   * @fn ShiftWindow
+   * @brief Move the interpolation window to the new nearest node
+   * @note When the window moves forward by one node, the barycentric weights are updated in place in O(n).
+   *       Otherwise, the window is set again with SetWindow.
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
+   * @param [in] nearest_index: Index of the new nearest node in unix_time_list
+   */
+  void ShiftWindow(const int gnss_satellite_id, const int nearest_index);
+  /**
+   * @fn CalcInterpolationCoefficients
+   * @brief Calculate interpolation_coefficients_ with the first form of the barycentric formula in O(n)
+   * @note The interpolated value is the sum of the coefficients multiplied by the values at the nodes in the window.
+   *       Trigonometric interpolation (Ref: http://acc.igs.org/orbits/orbit-interp_gpssoln03.pdf) or Lagrange interpolation is used.
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
    * @param [in] time: Time to calculate the interpolated value
-   * @return Interpolated value
    */
-  template <size_t N>
-  libra::Vector<N> LagrangeInterpolation(const std::vector<double>& time_vector, const std::vector<libra::Vector<N>>& values, double time) const;
-  double LagrangeInterpolation(const std::vector<double>& time_vector, const std::vector<double>& values, double time) const;
+  void CalcInterpolationCoefficients(const int gnss_satellite_id, const double time);
+  /**
+   * @fn GetWindowLength_s
+   * @brief Return time length between the first and the last nodes in the interpolation window [s]
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
+   */
+  double GetWindowLength_s(const int gnss_satellite_id) const;
+
+  std::vector<std::vector<double>> unix_time_list;  //!< List of unixtime for all satellite
+  std::vector<bool> validate_;                      //!< List of whether the satellite is available at the time
+  std::vector<int> nearest_index_;                  //!< Index list for update(in position, time_and_index_list_. in clock_bias, time_table_)
 
-  std::vector<std::vector<double>> unix_time_list;     //!< List of unixtime for all satellite
-  std::vector<std::vector<double>> time_period_list_;  //!< List of time period for interpolation
-  std::vector<bool> validate_;                         //!< List of whether the satellite is available at the time
-  std::vector<int> nearest_index_;                     //!< Index list for update(in position, time_and_index_list_. in clock_bias, time_table_)
+  std::vector<int> window_begin_index_;                   //!< Index of the first node in the interpolation window of each satellite
+  std::vector<bool> is_window_full_;                      //!< Whether the interpolation window has interpolation_number_ nodes
+  std::vector<std::vector<double>> barycentric_weights_;  //!< Barycentric weights of the nodes in the interpolation window
+  std::vector<double> interpolation_coefficients_;        //!< Interpolation coefficients of the nodes at the current time
+  bool is_trigonometric_interpolation_ = false;           //!< Use trigonometric interpolation instead of Lagrange interpolation
 
   double step_width_s_ = 0.0;     //!< Step width [sec]
   double time_interval_ = 0.0;    //!< Time interval
   int interpolation_number_ = 0;  //!< Interpolation number
+
+ private:
+  /**
+   * @fn CalcNodeDifference
+   * @brief Return difference between two times used in the interpolation basis
+   * @note sin(w * (time_1 - time_2) / 2) for trigonometric interpolation, and time_1 - time_2 for Lagrange interpolation
+   */
+  double CalcNodeDifference(const double time_1, const double time_2) const;
 };
 
 /**
@@ -125,18 +161,22 @@ class GnssSatellitePosition : public GnssSatelliteBase {
    * @fn GnssSatellitePosition
    * @brief Constructor
    */
-  GnssSatellitePosition() {}
+  GnssSatellitePosition() { is_trigonometric_interpolation_ = true; }
   /**
    * @fn Initialize
    * @brief Initialize GNSS satellite position
-   * @param[in] file: File path for position calculation
+   * @note The SP3 files are memory-mapped and parsed into the time series of each satellite directly.
+   *       When the cache directory is given, the parsed time series are stored in a binary cache file keyed on the hash of the file contents,
+   *       and the cache file is read instead of the SP3 files in the next run.
+   * @param[in] file_paths: File paths for position calculation
    * @param[in] interpolation_method: Interpolation method for position calculation
    * @param[in] interpolation_number: Interpolation number for position calculation
    * @param[in] ur_flag: Ultra Rapid flag for position calculation
+   * @param[in] cache_directory: Directory of the binary cache file. Empty string disables the cache.
    * @return Start unix time and end unix time
    */
-  std::pair<double, double> Initialize(std::vector<std::vector<std::string>>& file, int interpolation_method, int interpolation_number,
-                                       UltraRapidMode ur_flag);
+  std::pair<double, double> Initialize(const std::vector<std::string>& file_paths, int interpolation_method, int interpolation_number,
+                                       UltraRapidMode ur_flag, const std::string& cache_directory = "");
 
   /**
    * @fn Setup
@@ -164,6 +204,22 @@ class GnssSatellitePosition : public GnssSatelliteBase {
    * @param [in] gnss_satellite_id: GNSS satellite ID defined in this class
    */
   libra::Vector<3> GetPosition_eci_m(int gnss_satellite_id) const;
+  /**
+   * @fn GetTimeSeriesPosition_ecef_m
+   * @brief Return the position of the nodes read from the files in the ECEF frame [m]
+   * @param [in] gnss_satellite_id: GNSS satellite ID defined in this class
+   */
+  inline const std::vector<libra::Vector<3>>& GetTimeSeriesPosition_ecef_m(const int gnss_satellite_id) const {
+    return time_series_position_ecef_m_.at(gnss_satellite_id);
+  }
+  /**
+   * @fn GetTimeSeriesPosition_eci_m
+   * @brief Return the position of the nodes read from the files in the ECI frame [m]
+   * @param [in] gnss_satellite_id: GNSS satellite ID defined in this class
+   */
+  inline const std::vector<libra::Vector<3>>& GetTimeSeriesPosition_eci_m(const int gnss_satellite_id) const {
+    return time_series_position_eci_m_.at(gnss_satellite_id);
+  }
 
  private:
   std::vector<libra::Vector<3>> position_ecef_m_;  //!< List of GNSS satellite position at specific time in the ECEF frame [m]
@@ -172,9 +228,14 @@ class GnssSatellitePosition : public GnssSatelliteBase {
   std::vector<std::vector<libra::Vector<3>>> time_series_position_ecef_m_;  //!< Time series of position of all GNSS satellites in the ECEF frame [m]
   std::vector<std::vector<libra::Vector<3>>> time_series_position_eci_m_;   //!< Time series of position of all GNSS satellites in the ECEF frame [m]
 
-  // TODO: move to local function?
-  std::vector<std::vector<libra::Vector<3>>> ecef_;  //!< Time series of position of all GNSS satellites in the ECEF frame before interpolation [m]
-  std::vector<std::vector<libra::Vector<3>>> eci_;   //!< Time series of position of all GNSS satellites in the ECEF frame before interpolation [m]
+  /**
+   * @fn UpdatePosition
+   * @brief Check the interpolation window and update the position of the satellite
+   * @param [in] gnss_satellite_id: GNSS satellite ID defined in this class
+   * @param [in] current_unix_time: Current unix time
+   * @param [in] nearest_unix_time: Unix time of the nearest node
+   */
+  void UpdatePosition(const int gnss_satellite_id, const double current_unix_time, const double nearest_unix_time);
 };
 
 /**
@@ -191,13 +252,16 @@ class GnssSatelliteClock : public GnssSatelliteBase {
   /**
    * @fn Initialize
    * @brief Initialize GNSS satellite clock
-   * @param[in] file: File path for clock calculation
+   * @note The files are memory-mapped and cached in the same way as GnssSatellitePosition::Initialize
+   * @param[in] file_paths: File paths for clock calculation
    * @param[in] file_extension: Extension of the clock file (ex. .sp3, .clk30s)
    * @param[in] interpolation_number: Interpolation number for clock calculation
    * @param[in] ur_flag: Ultra Rapid flag for clock calculation
+   * @param[in] unix_time_period: Start unix time and end unix time of the position data
+   * @param[in] cache_directory: Directory of the binary cache file. Empty string disables the cache.
    */
-  void Initialize(std::vector<std::vector<std::string>>& file, std::string file_extension, int interpolation_number, UltraRapidMode ur_flag,
-                  std::pair<double, double> unix_time_period);
+  void Initialize(const std::vector<std::string>& file_paths, std::string file_extension, int interpolation_number, UltraRapidMode ur_flag,
+                  std::pair<double, double> unix_time_period, const std::string& cache_directory = "");
   /**
    * @fn SetUp
    * @brief Setup GNSS satellite clock information
@@ -217,13 +281,27 @@ class GnssSatelliteClock : public GnssSatelliteBase {
    * @param [in] gnss_satellite_id: GNSS satellite ID defined in this class
    */
   double GetSatClock(int gnss_satellite_id) const;
+  /**
+   * @fn GetTimeSeriesClockOffset_m
+   * @brief Return the clock bias of the nodes read from the files in distance expression [m]
+   * @param [in] gnss_satellite_id: GNSS satellite ID defined in this class
+   */
+  inline const std::vector<double>& GetTimeSeriesClockOffset_m(const int gnss_satellite_id) const {
+    return time_series_clock_offset_m_.at(gnss_satellite_id);
+  }
 
  private:
-  std::vector<double> clock_offset_m_;  //!< List of clock bias of all GNSS satellites at specific time expressed in distance [m]
+  std::vector<double> clock_offset_m_;                           //!< List of clock bias of all GNSS satellites at specific time expressed in distance [m]
   std::vector<std::vector<double>> time_series_clock_offset_m_;  //!< Time series of clock bias of all GNSS satellites expressed in distance [m]
 
-  // TODO: move to local function?
-  std::vector<std::vector<double>> clock_bias_;  //!< Time series of clock bias of all GNSS satellites expressed in distance before interpolation [m]
+  /**
+   * @fn UpdateClock
+   * @brief Check the interpolation window and update the clock of the satellite
+   * @param [in] gnss_satellite_id: GNSS satellite ID defined in this class
+   * @param [in] current_unix_time: Current unix time
+   * @param [in] nearest_unix_time: Unix time of the nearest node
+   */
+  void UpdateClock(const int gnss_satellite_id, const double current_unix_time, const double nearest_unix_time);
 };
 
 /**
@@ -240,18 +318,19 @@ class GnssSatelliteInformation {
   /**
    * @fn Initialize
    * @brief Initialize position and clock
-   * @param[in] position_file: File path for position calculation
+   * @param[in] position_file_paths: File paths for position calculation
    * @param[in] position_interpolation_method: Interpolation method for position calculation
    * @param[in] position_interpolation_number: Interpolation number for position calculation
    * @param[in] position_ur_flag: Ultra Rapid flag for position calculation
-   * @param[in] clock_file: File path for clock calculation
+   * @param[in] clock_file_paths: File paths for clock calculation
    * @param[in] clock_file_extension: Extension of the clock file (ex. .sp3, .clk30s)
    * @param[in] clock_interpolation_number: Interpolation number for clock calculation
    * @param[in] clock_ur_flag: Ultra Rapid flag for clock calculation
+   * @param[in] cache_directory: Directory of the binary cache file. Empty string disables the cache.
    */
-  void Initialize(std::vector<std::vector<std::string>>& position_file, int position_interpolation_method, int position_interpolation_number,
-                  UltraRapidMode position_ur_flag, std::vector<std::vector<std::string>>& clock_file, std::string clock_file_extension,
-                  int clock_interpolation_number, UltraRapidMode clock_ur_flag);
+  void Initialize(const std::vector<std::string>& position_file_paths, int position_interpolation_method, int position_interpolation_number,
+                  UltraRapidMode position_ur_flag, const std::vector<std::string>& clock_file_paths, std::string clock_file_extension,
+                  int clock_interpolation_number, UltraRapidMode clock_ur_flag, const std::string& cache_directory = "");
   /**
    * @fn SetUp
    * @brief Setup GNSS satellite position and clock information
@@ -335,13 +414,13 @@ class GnssSatellites : public ILoggable {
    * @brief Initialize function
    * @note Parameters are defined in GNSSSat_Info for true and estimated information
    */
-  void Initialize(std::vector<std::vector<std::string>>& true_position_file, int true_position_interpolation_method,
+  void Initialize(const std::vector<std::string>& true_position_file_paths, int true_position_interpolation_method,
                   int true_position_interpolation_number, UltraRapidMode true_position_ur_flag,
-                  std::vector<std::vector<std::string>>& true_clock_file, std::string true_clock_file_extension, int true_clock_interpolation_number,
-                  UltraRapidMode true_clock_ur_flag, std::vector<std::vector<std::string>>& estimate_position_file,
+                  const std::vector<std::string>& true_clock_file_paths, std::string true_clock_file_extension, int true_clock_interpolation_number,
+                  UltraRapidMode true_clock_ur_flag, const std::vector<std::string>& estimate_position_file_paths,
                   int estimate_position_interpolation_method, int estimate_position_interpolation_number, UltraRapidMode estimate_position_ur_flag,
-                  std::vector<std::vector<std::string>>& estimate_clock_file, std::string estimate_clock_file_extension,
-                  int estimate_clock_interpolation_number, UltraRapidMode estimate_clock_ur_flag);
+                  const std::vector<std::string>& estimate_clock_file_paths, std::string estimate_clock_file_extension,
+                  int estimate_clock_interpolation_number, UltraRapidMode estimate_clock_ur_flag, const std::string& cache_directory = "");
   /**
    * @fn IsCalcEnabled
    * @brief Return calculated enabled flag
@@ -476,6 +555,11 @@ class GnssSatellites : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   std::string GetLogValue() const override;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  void AppendLogValue(std::vector<double>& values) const override;
 
   /**
    * @fn DebugOutput
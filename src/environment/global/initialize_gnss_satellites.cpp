@@ -53,13 +53,14 @@ std::string ReturnDirectoryPathWithFileType(std::string sort) {
 }
 
 /**
- *@fn ReadFileContents
- *@brief Read file and convert to a vector of one line strings
+ *@fn AddFilePath
+ *@brief Check existence of the file and add the path to the list
+ *@note The contents are read by GnssSatellites with memory mapping
  *@param [in] directory_path: Directory path of the file
  *@param [in] file_name: File name
- *@param [out] storage: vector of one line strings
+ *@param [out] file_paths: List of file paths
  */
-void ReadFileContents(std::string directory_path, std::string file_name, std::vector<std::string>& storage) {
+void AddFilePath(std::string directory_path, std::string file_name, std::vector<std::string>& file_paths) {
   std::string all_file_path = directory_path + file_name;
   std::ifstream ifs(all_file_path);
 
@@ -67,28 +68,24 @@ void ReadFileContents(std::string directory_path, std::string file_name, std::ve
     std::cout << "in " << directory_path << "gnss file: " << file_name << " not found" << std::endl;
     exit(1);
   }
-  std::string str;
-  while (std::getline(ifs, str)) {
-    storage.push_back(str);
-  }
   ifs.close();
-  if (storage.back() == "EOF") storage.pop_back();
+  file_paths.push_back(all_file_path);
 
   return;
 }
 
 /**
  *@fn ReadSp3Files
- *@brief Read multiple SP3 files in the directory and generate multiple vectors of one line strings
+ *@brief Generate the list of multiple SP3 files in the directory
  *@param [in] directory_path: Directory path of the file
  *@param [in] file_sort: File type
  *@param [in] first: The first SP3 file name
  *@param [in] last: The last SP3 file name
- *@param [out] file_contents: Generated files as multiple vectors of one line strings
+ *@param [out] file_paths: List of file paths
  *@param [out] ur_flag: Ultra rapid flag
  */
 void ReadSp3Files(std::string directory_path, std::string file_sort, std::string first, std::string last,
-                  std::vector<std::vector<std::string>>& file_contents, UltraRapidMode& ur_flag) {
+                  std::vector<std::string>& file_paths, UltraRapidMode& ur_flag) {
   std::string all_directory_path = directory_path + ReturnDirectoryPathWithFileType(file_sort);
   ur_flag = kNotUse;
 
@@ -99,7 +96,7 @@ void ReadSp3Files(std::string directory_path, std::string file_sort, std::string
     int year_last_day = 365 + (year % 4 == 0) - (year % 100 == 0) + (year % 400 == 0);
     int day = stoi(first.substr(file_header.size() + 4, 3));
 
-    file_contents.clear();
+    file_paths.clear();
 
     while (true) {
       if (day > year_last_day) {
@@ -115,9 +112,7 @@ void ReadSp3Files(std::string directory_path, std::string file_sort, std::string
       else
         s_day = "00" + std::to_string(day);
       std::string file_name = file_header + std::to_string(year) + s_day + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      ReadFileContents(all_directory_path, file_name, file_contents.back());
+      AddFilePath(all_directory_path, file_name, file_paths);
 
       if (file_name == last) break;
       ++day;
@@ -140,7 +135,7 @@ void ReadSp3Files(std::string directory_path, std::string file_sort, std::string
       }
     }
 
-    file_contents.clear();
+    file_paths.clear();
 
     while (true) {
       if (hour == 24) {
@@ -156,9 +151,7 @@ void ReadSp3Files(std::string directory_path, std::string file_sort, std::string
         file_name += "0";
       }
       file_name += std::to_string(hour) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      ReadFileContents(all_directory_path, file_name, file_contents.back());
+      AddFilePath(all_directory_path, file_name, file_paths);
 
       if (file_name == last) break;
       hour += 6;
@@ -178,7 +171,7 @@ void ReadSp3Files(std::string directory_path, std::string file_sort, std::string
       }
     }
 
-    file_contents.clear();
+    file_paths.clear();
 
     while (true) {
       if (day == 7) {
@@ -186,9 +179,7 @@ void ReadSp3Files(std::string directory_path, std::string file_sort, std::string
         day = 0;
       }
       std::string file_name = file_header + std::to_string(gps_week) + std::to_string(day) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      ReadFileContents(all_directory_path, file_name, file_contents.back());
+      AddFilePath(all_directory_path, file_name, file_paths);
 
       if (file_name == last) break;
       ++day;
@@ -200,16 +191,16 @@ void ReadSp3Files(std::string directory_path, std::string file_sort, std::string
 
 /**
  *@fn ReadClockFiles
- *@brief Read multiple SP3 files in the directory and generate multiple vectors of one line strings
+ *@brief Generate the list of multiple clock files in the directory
  *@param [in] directory_path: Directory path of the file
  *@param [in] extension: Extensions of the file
  *@param [in] file_sort: File type
  *@param [in] first: The first SP3 file name
  *@param [in] last: The last SP3 file name
- *@param [out] file_contents: Generated files as multiple vectors of one line strings
+ *@param [out] file_paths: List of file paths
  */
 void ReadClockFiles(std::string directory_path, std::string extension, std::string file_sort, std::string first, std::string last,
-                    std::vector<std::vector<std::string>>& file_contents) {
+                    std::vector<std::string>& file_paths) {
   std::string all_directory_path = directory_path + ReturnDirectoryPathWithFileType(file_sort) + extension.substr(1) + '/';
 
   if (file_sort.find("Ultra") != std::string::npos) {
@@ -229,7 +220,7 @@ void ReadClockFiles(std::string directory_path, std::string extension, std::stri
       }
     }
 
-    file_contents.clear();
+    file_paths.clear();
 
     while (true) {
       if (hour == 24) {
@@ -245,9 +236,7 @@ void ReadClockFiles(std::string directory_path, std::string extension, std::stri
         file_name += "0";
       }
       file_name += std::to_string(hour) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      ReadFileContents(all_directory_path, file_name, file_contents.back());
+      AddFilePath(all_directory_path, file_name, file_paths);
 
       if (file_name == last) break;
       hour += 6;
@@ -267,7 +256,7 @@ void ReadClockFiles(std::string directory_path, std::string extension, std::stri
       }
     }
 
-    file_contents.clear();
+    file_paths.clear();
 
     while (true) {
       if (day == 7) {
@@ -275,9 +264,7 @@ void ReadClockFiles(std::string directory_path, std::string extension, std::stri
         day = 0;
       }
       std::string file_name = file_header + std::to_string(gps_week) + std::to_string(day) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      ReadFileContents(all_directory_path, file_name, file_contents.back());
+      AddFilePath(all_directory_path, file_name, file_paths);
 
       if (file_name == last) break;
       ++day;
@@ -298,31 +285,31 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
   std::string directory_path = ini_file.ReadString(section, "directory_path");
 
   // True position
-  std::vector<std::vector<std::string>> true_position_file;
+  std::vector<std::string> true_position_file_paths;
   UltraRapidMode true_position_ur_flag = kNotUse;
   ReadSp3Files(directory_path, ini_file.ReadString(section, "true_position_file_sort"), ini_file.ReadString(section, "true_position_first"),
-               ini_file.ReadString(section, "true_position_last"), true_position_file, true_position_ur_flag);
+               ini_file.ReadString(section, "true_position_last"), true_position_file_paths, true_position_ur_flag);
   int true_position_interpolation_method = ini_file.ReadInt(section, "true_position_interpolation_method");
   int true_position_interpolation_number = ini_file.ReadInt(section, "true_position_interpolation_number");
 
   // True clock
-  std::vector<std::vector<std::string>> true_clock_file;
+  std::vector<std::string> true_clock_file_paths;
   UltraRapidMode true_clock_ur_flag = kNotUse;
   std::string true_clock_file_extension = ini_file.ReadString(section, "true_clock_file_extension");
   if (true_clock_file_extension == ".sp3") {
     ReadSp3Files(directory_path, ini_file.ReadString(section, "true_clock_file_sort"), ini_file.ReadString(section, "true_clock_first"),
-                 ini_file.ReadString(section, "true_clock_last"), true_clock_file, true_clock_ur_flag);
+                 ini_file.ReadString(section, "true_clock_last"), true_clock_file_paths, true_clock_ur_flag);
   } else {
     ReadClockFiles(directory_path, true_clock_file_extension, ini_file.ReadString(section, "true_clock_file_sort"),
-                   ini_file.ReadString(section, "true_clock_first"), ini_file.ReadString(section, "true_clock_last"), true_clock_file);
+                   ini_file.ReadString(section, "true_clock_first"), ini_file.ReadString(section, "true_clock_last"), true_clock_file_paths);
   }
   int true_clock_interpolation_number = ini_file.ReadInt(section, "true_clock_interpolation_number");
 
   // Estimated position
-  std::vector<std::vector<std::string>> estimate_position_file;
+  std::vector<std::string> estimate_position_file_paths;
   UltraRapidMode estimate_position_ur_flag = kNotUse;
   ReadSp3Files(directory_path, ini_file.ReadString(section, "estimate_position_file_sort"), ini_file.ReadString(section, "estimate_position_first"),
-               ini_file.ReadString(section, "estimate_position_last"), estimate_position_file, estimate_position_ur_flag);
+               ini_file.ReadString(section, "estimate_position_last"), estimate_position_file_paths, estimate_position_ur_flag);
   int estimate_position_interpolation_method = ini_file.ReadInt(section, "estimate_position_interpolation_method");
   int estimate_position_interpolation_number = ini_file.ReadInt(section, "estimate_position_interpolation_number");
   if (estimate_position_ur_flag != kNotUse) {
@@ -335,23 +322,29 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
   }
 
   // Estimated clock
-  std::vector<std::vector<std::string>> estimate_clock_file;
+  std::vector<std::string> estimate_clock_file_paths;
   UltraRapidMode estimate_clock_ur_flag = estimate_position_ur_flag;
   std::string estimate_clock_file_extension = ini_file.ReadString(section, "estimate_clock_file_extension");
   if (estimate_clock_file_extension == ".sp3") {
     ReadSp3Files(directory_path, ini_file.ReadString(section, "estimate_clock_file_sort"), ini_file.ReadString(section, "estimate_clock_first"),
-                 ini_file.ReadString(section, "estimate_clock_last"), estimate_clock_file, estimate_clock_ur_flag);
+                 ini_file.ReadString(section, "estimate_clock_last"), estimate_clock_file_paths, estimate_clock_ur_flag);
   } else {
     ReadClockFiles(directory_path, estimate_clock_file_extension, ini_file.ReadString(section, "estimate_clock_file_sort"),
-                   ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"), estimate_clock_file);
+                   ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"),
+                   estimate_clock_file_paths);
   }
   int estimate_clock_interpolation_number = ini_file.ReadInt(section, "estimate_clock_interpolation_number");
 
+  // Binary cache of the parsed files. Empty means that the cache is not used.
+  std::string cache_directory = ini_file.ReadString(section, "cache_directory");
+  if (cache_directory == "NULL") cache_directory = "";
+
   // Initialize GNSS satellites
-  gnss_satellites->Initialize(true_position_file, true_position_interpolation_method, true_position_interpolation_number, true_position_ur_flag,
-                              true_clock_file, true_clock_file_extension, true_clock_interpolation_number, true_clock_ur_flag, estimate_position_file,
-                              estimate_position_interpolation_method, estimate_position_interpolation_number, estimate_position_ur_flag,
-                              estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag);
+  gnss_satellites->Initialize(true_position_file_paths, true_position_interpolation_method, true_position_interpolation_number,
+                              true_position_ur_flag, true_clock_file_paths, true_clock_file_extension, true_clock_interpolation_number,
+                              true_clock_ur_flag, estimate_position_file_paths, estimate_position_interpolation_method,
+                              estimate_position_interpolation_number, estimate_position_ur_flag, estimate_clock_file_paths,
+                              estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag, cache_directory);
 
   return gnss_satellites;
 }
@@ -6,6 +6,7 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_MOON_ROTATION_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_MOON_ROTATION_HPP_
 
+#include "celestial_body_handle.hpp"
 #include "celestial_information.hpp"
 #include "library/math/matrix.hpp"
 #include "library/math/vector.hpp"
@@ -60,6 +61,8 @@ class MoonRotation {
   libra::Matrix<3, 3> dcm_j2000_to_mcmf_;  //!< Direction Cosine Matrix J2000 to MCMF (Moon Centered Moon Fixed)
 
   const CelestialInformation &celestial_information_;  //!< Celestial Information to get moon orbit
+  CelestialBodyHandle moon_;                           //!< Handle of the moon
+  CelestialBodyHandle earth_;                          //!< Handle of the earth
 };
 
 #endif  // S2E_ENVIRONMENT_GLOBAL_MOON_ROTATION_HPP_
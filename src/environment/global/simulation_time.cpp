@@ -9,22 +9,54 @@
 #include <SpiceUsr.h>
 
 #include <cassert>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 
 #include "library/initialize/initialize_file_access.hpp"
-#ifdef WIN32
-#include <Windows.h>
-#else
-#include <errno.h>
-#endif
+#include "library/utilities/external_library_mutex.hpp"
 
 using namespace std;
 
+/**
+ * @fn ConvJdToUtc
+ * @brief Convert Julian day to UTC calendar day with invjday @ sgp4ext
+ * @param [in] JD: Julian day
+ */
+static UTC ConvJdToUtc(const double JD) {
+  int year, mon, day, hr, minute;
+  double sec;
+  invjday(JD, year, mon, day, hr, minute, sec);
+  UTC utc;
+  utc.year = (unsigned int)(year);
+  utc.month = (unsigned int)(mon);
+  utc.day = (unsigned int)(day);
+  utc.hour = (unsigned int)(hr);
+  utc.minute = (unsigned int)(minute);
+  utc.second = sec;
+  return utc;
+}
+
+/**
+ * @fn WriteUtc
+ * @brief Write UTC calendar day for the log output without the comma
+ * @param [in] utc: UTC calendar day
+ */
+static string WriteUtc(const UTC& utc) {
+  const char kSize = 100;
+  char ymdhms[kSize];
+  double sec_floor = floor(utc.second * 1e3) / 1e3;
+
+  snprintf(ymdhms, kSize, "%4d/%02d/%02d %02d:%02d:%.3f", utc.year, utc.month, utc.day, utc.hour, utc.minute, sec_floor);
+  return ymdhms;
+}
+
 SimulationTime::SimulationTime(const double end_sec, const double step_sec, const double attitude_update_interval_sec,
                                const double attitude_rk_step_sec, const double orbit_update_interval_sec, const double orbit_rk_step_sec,
                                const double thermal_update_interval_sec, const double thermal_rk_step_sec, const double compo_propagate_step_sec,
-                               const double log_output_interval_sec, const char* start_ymdhms, const double sim_speed) {
+                               const double log_output_interval_sec, const char* start_ymdhms, const double sim_speed,
+                               const double real_time_spin_wait_sec)
+    : real_time_pacer_(sim_speed > 0.0 ? sim_speed : 1.0, real_time_spin_wait_sec) {
   end_sec_ = end_sec;
   step_sec_ = step_sec;
   attitude_update_interval_sec_ = attitude_update_interval_sec;
@@ -48,12 +80,14 @@ SimulationTime::SimulationTime(const double end_sec, const double step_sec, cons
   JdToDecyear(current_jd_, &current_decyear_);
   ConvJDtoCalendarDay(current_jd_);
   AssertTimeStepParams();
+  InitializeScheduler();
   InitializeState();
   SetParameters();
 
   // Ephemeris time initialize
   std::ostringstream stream;
   stream << std::fixed << std::setprecision(11) << "jd " << start_jd_;
+  std::lock_guard<std::mutex> lock(GetExternalLibraryMutex(ExternalLibrary::kCspice));
   str2et_c(stream.str().c_str(), &start_ephemeris_time_);
 }
 
@@ -73,63 +107,64 @@ void SimulationTime::AssertTimeStepParams() {
   assert(step_sec_ <= log_output_interval_sec_);
 }
 
+void SimulationTime::InitializeScheduler() {
+  const uint64_t attitude_period_steps = CalcPeriod_steps(attitude_update_interval_sec_);
+  const uint64_t orbit_period_steps = CalcPeriod_steps(orbit_update_interval_sec_);
+  const uint64_t thermal_period_steps = CalcPeriod_steps(thermal_update_interval_sec_);
+  const uint64_t component_period_steps = CalcPeriod_steps(component_update_interval_sec_);
+  const uint64_t log_period_steps = CalcPeriod_steps(log_output_interval_sec_);
+  attitude_group_id_ = scheduler_.AddRateGroup(attitude_period_steps, attitude_period_steps - 1);
+  orbit_group_id_ = scheduler_.AddRateGroup(orbit_period_steps, orbit_period_steps - 1);
+  thermal_group_id_ = scheduler_.AddRateGroup(thermal_period_steps, thermal_period_steps - 1);
+  component_group_id_ = scheduler_.AddRateGroup(component_period_steps, component_period_steps - 1);
+  log_group_id_ = scheduler_.AddRateGroup(log_period_steps, log_period_steps);
+  const uint64_t display_period_steps = display_period_ >= 1.0 ? (uint64_t)display_period_ : 1;
+  display_group_id_ = scheduler_.AddRateGroup(display_period_steps, (uint64_t)ceil(display_period_));
+
+  end_tick_ = (uint64_t)floor(end_sec_ / step_sec_);
+  while (double(end_tick_) * step_sec_ <= end_sec_) end_tick_++;
+  while (end_tick_ > 1 && double(end_tick_ - 1) * step_sec_ > end_sec_) end_tick_--;
+}
+
+uint64_t SimulationTime::CalcPeriod_steps(const double interval_sec) const {
+  uint64_t period_steps = (uint64_t)ceil(interval_sec / step_sec_);
+  while (double(period_steps) * step_sec_ < interval_sec) period_steps++;
+  while (period_steps > 1 && double(period_steps - 1) * step_sec_ >= interval_sec) period_steps--;
+  return period_steps > 0 ? period_steps : 1;
+}
+
 void SimulationTime::SetParameters(void) {
   elapsed_time_sec_ = 0.0;
-  attitude_update_counter_ = 1;
-  attitude_update_flag_ = false;
-  orbit_update_counter_ = 1;
-  orbit_update_flag_ = false;
-  thermal_update_counter_ = 1;
-  thermal_update_flag_ = false;
-  component_update_counter_ = 1;
-  component_update_flag_ = false;
-  log_counter_ = 0;
-  display_counter_ = 0;
+  scheduler_.Reset();
   state_.log_output = true;
 }
 
 void SimulationTime::UpdateTime(void) {
   InitializeState();
-  elapsed_time_sec_ += step_sec_;
+  // Jump to the next tick at which any rate group is due
+  uint64_t next_tick = scheduler_.GetNextEventTick();
+  if (next_tick > end_tick_) next_tick = end_tick_;
+  if (next_tick <= scheduler_.GetCurrentTick()) next_tick = scheduler_.GetCurrentTick() + 1;
+  elapsed_time_sec_ = double(next_tick) * step_sec_;
   if (simulation_speed_ > 0) {
-    chrono::system_clock clk;
-    int toWaitTime = (int)(elapsed_time_sec_ * 1000 -
-                           chrono::duration_cast<chrono::milliseconds>(clk.now() - clock_start_time_millisec_).count() * simulation_speed_);
-    if (toWaitTime <= 0) {
-      // When the execution time is larger than specified step_sec
-
-      int exceeded_duration_ms = (int)chrono::duration_cast<chrono::milliseconds>(clk.now() - clock_last_time_completed_step_in_time_).count();
-      if (exceeded_duration_ms > time_exceeds_continuously_limit_sec_ * 1000) {
-        // Skip time and warn only when execution time exceeds continuously for long time
-
-        cout << "Error: the specified step_sec is too small for this computer.\r\n";
-
-        // Forcibly set elapsed_tim_sec_ as actual elapsed time Reason: to catch up with real time when resume from a breakpoint
-        elapsed_time_sec_ =
-            (chrono::duration_cast<chrono::duration<double, ratio<1, 1>>>(clk.now() - clock_start_time_millisec_).count() * simulation_speed_);
-
-        clock_last_time_completed_step_in_time_ = clk.now();
-      }
-    } else {
-      clock_last_time_completed_step_in_time_ = clk.now();
-
-#ifdef WIN32
-      Sleep(toWaitTime);
-#else
-      const struct timespec req = {toWaitTime / 1000, (toWaitTime % 1000) * 1000000};
-      nanosleep(&req, NULL);
-#endif
+    const double overrun_sec = real_time_pacer_.WaitUntil(elapsed_time_sec_);
+    // Skip time and warn only when execution time exceeds continuously for long time
+    if (overrun_sec > 0.0 && real_time_pacer_.GetContinuousOverrunDuration_s() > time_exceeds_continuously_limit_sec_) {
+      cout << "Error: the specified step_sec is too small for this computer.\r\n";
+
+      // Forcibly set the tick to the actual elapsed time Reason: to catch up with real time when resume from a breakpoint
+      // All rate groups which are overdue become due at the tick
+      const uint64_t actual_tick = (uint64_t)floor(real_time_pacer_.GetSimulationTimeNow_s() / step_sec_);
+      if (actual_tick > next_tick) next_tick = actual_tick;
+      elapsed_time_sec_ = double(next_tick) * step_sec_;
+
+      real_time_pacer_.ClearOverrun();
     }
   }
 
-  attitude_update_counter_++;
-  orbit_update_counter_++;
-  thermal_update_counter_++;
-  component_update_counter_++;
-  log_counter_++;
-  display_counter_++;
+  scheduler_.AdvanceTo(next_tick);
 
-  if (elapsed_time_sec_ > end_sec_) {
+  if (next_tick >= end_tick_) {
     state_.finish = true;
   }
 
@@ -138,44 +173,12 @@ void SimulationTime::UpdateTime(void) {
   JdToDecyear(current_jd_, &current_decyear_);
   ConvJDtoCalendarDay(current_jd_);
 
-  attitude_update_flag_ = false;
-  if (double(attitude_update_counter_) * step_sec_ >= attitude_update_interval_sec_) {
-    attitude_update_counter_ = 0;
-    attitude_update_flag_ = true;
-  }
-
-  orbit_update_flag_ = false;
-  if (double(orbit_update_counter_) * step_sec_ >= orbit_update_interval_sec_) {
-    orbit_update_counter_ = 0;
-    orbit_update_flag_ = true;
-  }
-
-  thermal_update_flag_ = false;
-  if (double(thermal_update_counter_) * step_sec_ >= thermal_update_interval_sec_) {
-    thermal_update_counter_ = 0;
-    thermal_update_flag_ = true;
-  }
-
-  component_update_flag_ = false;
-  if (double(component_update_counter_) * step_sec_ >= component_update_interval_sec_) {
-    component_update_counter_ = 0;
-    component_update_flag_ = true;
-  }
-
-  if (double(log_counter_) * step_sec_ >= log_output_interval_sec_) {
-    log_counter_ = 0;
-    state_.log_output = true;
-  }
-
-  if (display_counter_ >= display_period_) {
-    display_counter_ -= (int)display_period_;
-    state_.disp_output = true;
-  }
-
+  state_.log_output = scheduler_.IsDue(log_group_id_);
+  state_.disp_output = scheduler_.IsDue(display_group_id_);
   state_.running = true;
 }
 
-void SimulationTime::ResetClock(void) { clock_start_time_millisec_ = chrono::system_clock::now(); }
+void SimulationTime::ResetClock(void) { real_time_pacer_.Reset(); }
 
 void SimulationTime::PrintStartDateTime(void) const {
   int sec_int = int(start_sec_ + 0.5);
@@ -204,6 +207,13 @@ string SimulationTime::GetLogHeader() const {
 
   str_tmp += WriteScalar("elapsed_time", "s");
   str_tmp += WriteScalar("time", "UTC");
+  if (simulation_speed_ > 0) {
+    str_tmp += WriteScalar("pacing_jitter", "s");
+    str_tmp += WriteScalar("pacing_max_jitter", "s");
+    str_tmp += WriteScalar("pacing_mean_jitter", "s");
+    str_tmp += WriteScalar("pacing_overrun_count", "-");
+    str_tmp += WriteScalar("pacing_max_overrun", "s");
+  }
 
   return str_tmp;
 }
@@ -212,16 +222,38 @@ string SimulationTime::GetLogValue() const {
   string str_tmp = "";
 
   str_tmp += WriteScalar(elapsed_time_sec_);
+  str_tmp += WriteUtc(current_utc_) + ",";
+  if (simulation_speed_ > 0) {
+    str_tmp += WriteScalar(real_time_pacer_.GetLastJitter_s());
+    str_tmp += WriteScalar(real_time_pacer_.GetMaxJitter_s());
+    str_tmp += WriteScalar(real_time_pacer_.GetMeanJitter_s());
+    str_tmp += WriteScalar(real_time_pacer_.GetOverrunCount());
+    str_tmp += WriteScalar(real_time_pacer_.GetMaxOverrun_s());
+  }
 
-  const char kSize = 100;
-  char ymdhms[kSize];
-  double sec_floor = floor(current_utc_.second * 1e3) / 1e3;
+  return str_tmp;
+}
 
-  snprintf(ymdhms, kSize, "%4d/%02d/%02d %02d:%02d:%.3f,", current_utc_.year, current_utc_.month, current_utc_.day, current_utc_.hour,
-           current_utc_.minute, sec_floor);
-  str_tmp += ymdhms;
+void SimulationTime::AppendLogValue(std::vector<double>& values) const {
+  AppendScalar(values, elapsed_time_sec_);
+  AppendScalar(values, current_jd_);
+  if (simulation_speed_ > 0) {
+    AppendScalar(values, real_time_pacer_.GetLastJitter_s());
+    AppendScalar(values, real_time_pacer_.GetMaxJitter_s());
+    AppendScalar(values, real_time_pacer_.GetMeanJitter_s());
+    AppendScalar(values, (double)real_time_pacer_.GetOverrunCount());
+    AppendScalar(values, real_time_pacer_.GetMaxOverrun_s());
+  }
+}
 
-  return str_tmp;
+void SimulationTime::AppendLogFormat(std::vector<LogColumnFormat>& formats) const {
+  // The UTC string is converted from the Julian day, and the other columns are written with the log utility functions
+  const size_t utc_column = formats.size() + 1;
+  ILoggable::AppendLogFormat(formats);
+  LogColumnFormat utc_format;
+  utc_format.type = LogValueType::kString;
+  utc_format.string_converter = [](const double JD) { return WriteUtc(ConvJdToUtc(JD)); };
+  formats.insert(formats.begin() + utc_column, utc_format);
 }
 
 void SimulationTime::InitializeState() {
@@ -232,17 +264,7 @@ void SimulationTime::InitializeState() {
 }
 
 // wrapper function of invjday @ sgp4ext for interface adjustment
-void SimulationTime::ConvJDtoCalendarDay(const double JD) {
-  int year, mon, day, hr, minute;
-  double sec;
-  invjday(JD, year, mon, day, hr, minute, sec);
-  current_utc_.year = (unsigned int)(year);
-  current_utc_.month = (unsigned int)(mon);
-  current_utc_.day = (unsigned int)(day);
-  current_utc_.hour = (unsigned int)(hr);
-  current_utc_.minute = (unsigned int)(minute);
-  current_utc_.second = sec;
-}
+void SimulationTime::ConvJDtoCalendarDay(const double JD) { current_utc_ = ConvJdToUtc(JD); }
 
 SimulationTime* InitSimulationTime(std::string file_name) {
   IniAccess ini_file(file_name);
@@ -268,10 +290,11 @@ SimulationTime* InitSimulationTime(std::string file_name) {
   double log_output_interval_sec = ini_file.ReadDouble(section, "log_output_period_s");
 
   double sim_speed = ini_file.ReadDouble(section, "simulation_speed_setting");
+  double real_time_spin_wait_sec = ini_file.ReadDouble(section, "real_time_spin_wait_duration_s");
 
   SimulationTime* simTime = new SimulationTime(end_sec, step_sec, attitude_update_interval_sec, attitude_rk_step_sec, orbit_update_interval_sec,
                                                orbit_rk_step_sec, thermal_update_interval_sec, thermal_rk_step_sec, compo_propagate_step_sec,
-                                               log_output_interval_sec, start_ymdhms.c_str(), sim_speed);
+                                               log_output_interval_sec, start_ymdhms.c_str(), sim_speed, real_time_spin_wait_sec);
 
   return simTime;
 }
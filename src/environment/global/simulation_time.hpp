@@ -11,13 +11,13 @@
 #endif
 
 #include <string>
-// #include <time.h>
-#include <chrono>
 
 #include "library/external/sgp4/sgp4ext.h"
 #include "library/external/sgp4/sgp4io.h"
 #include "library/external/sgp4/sgp4unit.h"
 #include "library/logger/loggable.hpp"
+#include "library/utilities/multi_rate_scheduler.hpp"
+#include "library/utilities/real_time_pacer.hpp"
 
 /**
  *@struct TimeState
@@ -46,6 +46,8 @@ struct UTC {
 /**
  *@class SimulationTime
  *@brief Class to manage simulation time related information
+ *@note The time advances by integer ticks of the simulation step, and the update timings are managed by MultiRateScheduler.
+ *      When no rate group is due at the next step, UpdateTime jumps directly to the next due tick.
  */
 class SimulationTime : public ILoggable {
  public:
@@ -64,11 +66,12 @@ class SimulationTime : public ILoggable {
    *@param [in] log_output_interval_sec: Log output interval [sec]
    *@param [in] start_ymdhms: Simulation start time in UTC [YYYYMMDD hh:mm:ss]
    *@param [in] sim_speed: Simulation speed setting
+   *@param [in] real_time_spin_wait_sec: Duration of the busy wait before the target time in the real time simulation [sec]
    */
   SimulationTime(const double end_sec, const double step_sec, const double attitude_update_interval_sec, const double attitude_rk_step_sec,
                  const double orbit_update_interval_sec, const double orbit_rk_step_sec, const double thermal_update_interval_sec,
                  const double thermal_rk_step_sec, const double compo_propagate_step_sec, const double log_output_interval_sec,
-                 const char* start_ymdhms, const double sim_speed);
+                 const char* start_ymdhms, const double sim_speed, const double real_time_spin_wait_sec = 0.0);
   /**
    *@fn ~SimulationTime
    *@brief Destructor
@@ -92,6 +95,12 @@ class SimulationTime : public ILoggable {
    */
   void ResetClock(void);
 
+  /**
+   *@fn GetRealTimePacer
+   *@brief Return the pacer of the real time simulation to access the jitter and overrun statistics
+   */
+  inline const RealTimePacer& GetRealTimePacer(void) const { return real_time_pacer_; };
+
   /**
    *@fn GetState
    *@brief Return time state
@@ -116,7 +125,7 @@ class SimulationTime : public ILoggable {
    *@fn GetAttitudePropagateFlag
    *@brief Return attitude propagate flag
    */
-  inline bool GetAttitudePropagateFlag(void) const { return attitude_update_flag_; };
+  inline bool GetAttitudePropagateFlag(void) const { return scheduler_.IsDue(attitude_group_id_); };
   /**
    *@fn GetAttitudeRkStepTime_s
    *@brief Return attitude Runge-Kutta step time [sec]
@@ -132,7 +141,7 @@ class SimulationTime : public ILoggable {
    *@fn GetOrbitPropagateFlag
    *@brief Return orbit propagate flag
    */
-  inline bool GetOrbitPropagateFlag(void) const { return orbit_update_flag_; };
+  inline bool GetOrbitPropagateFlag(void) const { return scheduler_.IsDue(orbit_group_id_); };
   /**
    *@fn GetOrbitRkStepTime_s
    *@brief Return orbit Runge-Kutta step time [sec]
@@ -148,7 +157,7 @@ class SimulationTime : public ILoggable {
    *@fn GetThermalPropagateFlag
    *@brief Return thermal propagate flag
    */
-  inline bool GetThermalPropagateFlag(void) const { return thermal_update_flag_; };
+  inline bool GetThermalPropagateFlag(void) const { return scheduler_.IsDue(thermal_group_id_); };
   /**
    *@fn GetThermalRkStepTime_s
    *@brief Return thermal Runge-Kutta step time [sec]
@@ -164,7 +173,7 @@ class SimulationTime : public ILoggable {
    *@fn GetCompoUpdateFlag
    *@brief Return component update flag
    */
-  inline bool GetCompoUpdateFlag() const { return component_update_flag_; }
+  inline bool GetCompoUpdateFlag() const { return scheduler_.IsDue(component_group_id_); }
   /**
    *@fn GetComponentPropagateFrequency_Hz
    *@brief Return component propagate frequency [Hz]
@@ -243,6 +252,7 @@ class SimulationTime : public ILoggable {
   /**
    * @fn GetLogHeader
    * @brief Override GetLogHeader function of ILoggable
+   * @note The jitter and overrun statistics of the pacing are added when the real time simulation is enabled
    */
   virtual std::string GetLogHeader() const;
   /**
@@ -250,6 +260,18 @@ class SimulationTime : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   * @note The Julian day is stored for the UTC string column, and AppendLogFormat converts it to the string
+   *       The jitter and overrun statistics of the pacing are added when the real time simulation is enabled
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
+  /**
+   * @fn AppendLogFormat
+   * @brief Override AppendLogFormat function of ILoggable
+   */
+  virtual void AppendLogFormat(std::vector<LogColumnFormat>& formats) const;
 
   /**
    * @fn PrintStartDateTime
@@ -266,22 +288,18 @@ class SimulationTime : public ILoggable {
   UTC current_utc_;          //!< UTC calendar day
 
   // Timing controller
-  int attitude_update_counter_;   //!< Update counter for attitude calculation
-  bool attitude_update_flag_;     //!< Update flag for attitude calculation
-  int orbit_update_counter_;      //!< Update counter for orbit calculation
-  bool orbit_update_flag_;        //!< Update flag for orbit calculation
-  int thermal_update_counter_;    //!< Update counter for thermal calculation
-  bool thermal_update_flag_;      //!< Update flag for thermal calculation
-  int component_update_counter_;  //!< Update counter for component calculation
-  bool component_update_flag_;    //!< Update flag for component calculation
-  int log_counter_;               //!< Update counter for log output
-  int display_counter_;           //!< Update counter for display output
+  MultiRateScheduler scheduler_;  //!< Scheduler of the update timings
+  size_t attitude_group_id_;      //!< Rate group ID for attitude calculation
+  size_t orbit_group_id_;         //!< Rate group ID for orbit calculation
+  size_t thermal_group_id_;       //!< Rate group ID for thermal calculation
+  size_t component_group_id_;     //!< Rate group ID for component calculation
+  size_t log_group_id_;           //!< Rate group ID for log output
+  size_t display_group_id_;       //!< Rate group ID for display output
+  uint64_t end_tick_;             //!< First tick whose elapsed time exceeds the end time
   TimeState state_;               //!< State of timing controller
 
   // Calculation time measure
-  std::chrono::system_clock::time_point clock_start_time_millisec_;  //!< Simulation start time [ms]
-  // chrono::system_clock::time_point clock_elapsed_time_millisec_;  //!< Simulation elapsed time in real time simulation [ms]
-  std::chrono::system_clock::time_point clock_last_time_completed_step_in_time_;  //!< Simulation finished time [ms]
+  RealTimePacer real_time_pacer_;  //!< Pacer with the wall clock time for the real time simulation
 
   // Constants
   double end_sec_;                        //!< Time from start of simulation to end [sec]
@@ -306,7 +324,7 @@ class SimulationTime : public ILoggable {
   int start_minute_;             //!< Simulation start minute
   double start_sec_;             //!< Simulation start seconds
 
-  double simulation_speed_;  //!< The speed of the simulation relative to real time (if negative, real time is not taken into account)
+  double simulation_speed_;                     //!< The speed of the simulation relative to real time (if negative, real time is not taken into account)
   double time_exceeds_continuously_limit_sec_;  //!< Maximum duration to allow actual step_sec to be larger than specified continuously
 
   /**
@@ -319,6 +337,18 @@ class SimulationTime : public ILoggable {
    * @brief Check the timing setting parameters are correct
    */
   void AssertTimeStepParams();
+  /**
+   * @fn InitializeScheduler
+   * @brief Register the rate groups to the scheduler
+   * @note A group with the period of N steps is due at the (N-1)th step first for the dynamics and the components, and at the Nth step for the log.
+   */
+  void InitializeScheduler();
+  /**
+   * @fn CalcPeriod_steps
+   * @brief Return the smallest number of steps N which satisfies N * step_sec_ >= interval_sec (at least 1)
+   * @param [in] interval_sec: Interval [sec]
+   */
+  uint64_t CalcPeriod_steps(const double interval_sec) const;
   /**
    * @fn ConvJDtoCalendarDay
    * @brief Convert Julian date to UTC Calendar date
@@ -0,0 +1,153 @@
+/**
+ * @file test_clock_generator.cpp
+ * @brief Test codes for ClockGenerator class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "clock_generator.hpp"
+
+/**
+ * @brief Record of a call of Tick or FastTick as (component id, is fast tick, count)
+ */
+using TickRecord = std::tuple<int, bool, unsigned int>;
+
+/**
+ * @class RecordingTickable
+ * @brief ITickable which records all calls of Tick and FastTick in the shared list
+ */
+class RecordingTickable : public ITickable {
+ public:
+  RecordingTickable(const int id, const unsigned int prescaler, const unsigned int fast_prescaler, const bool needs_fast_update,
+                    std::vector<TickRecord>* records)
+      : id_(id), records_(records) {
+    prescaler_ = prescaler;
+    fast_prescaler_ = fast_prescaler;
+    SetNeedsFastUpdate(needs_fast_update);
+  }
+  void Tick(const unsigned int count) override { records_->push_back(TickRecord(id_, false, count)); }
+  void FastTick(const unsigned int fast_count) override { records_->push_back(TickRecord(id_, true, fast_count)); }
+
+ private:
+  int id_;
+  std::vector<TickRecord>* records_;
+};
+
+/**
+ * @brief Tick the components with the previous loop of ClockGenerator
+ * @note The previous loop called Tick and FastTick of all components in the registration order at every count, and Component ignored the
+ *       calls whose count is not a multiple of the prescaler. Only the calls which Component did not ignore are made here.
+ * @param [in] components: Registered components
+ * @param [in] first_count: First count
+ * @param [in] count_number: Number of counts
+ */
+void TickWithPreviousLoop(const std::vector<std::unique_ptr<RecordingTickable>>& components, const unsigned int first_count,
+                          const unsigned int count_number) {
+  for (unsigned int count = first_count; count < first_count + count_number; count++) {
+    for (const std::unique_ptr<RecordingTickable>& component : components) {
+      if (count % component->GetPrescaler() == 0) component->Tick(count);
+      if (component->GetNeedsFastUpdate() && count % component->GetFastPrescaler() == 0) component->FastTick(count);
+    }
+  }
+}
+
+/**
+ * @brief Test the calls with mixed prescalers, which are dispatched from the table
+ */
+TEST(ClockGenerator, MixedPrescalers) {
+  std::vector<TickRecord> records;
+  std::vector<std::unique_ptr<RecordingTickable>> components;
+  components.emplace_back(new RecordingTickable(0, 1, 1, false, &records));
+  components.emplace_back(new RecordingTickable(1, 10, 1, true, &records));
+  components.emplace_back(new RecordingTickable(2, 4, 2, true, &records));
+  components.emplace_back(new RecordingTickable(3, 6, 1, false, &records));
+  components.emplace_back(new RecordingTickable(4, 10, 1, false, &records));
+
+  ClockGenerator clock_generator;
+  clock_generator.ClearTimerCount();
+  for (const std::unique_ptr<RecordingTickable>& component : components) clock_generator.RegisterComponent(component.get());
+
+  const unsigned int kCountNumber = 200;
+  for (unsigned int count = 0; count < kCountNumber; count++) clock_generator.TickToComponents();
+  const std::vector<TickRecord> dispatched_records = records;
+
+  records.clear();
+  TickWithPreviousLoop(components, 0, kCountNumber);
+  EXPECT_EQ(records, dispatched_records);
+
+  // Number of the calls of each component: Tick and FastTick
+  const size_t expected_tick_number[] = {200, 20 + 200, 50 + 100, 34, 20};
+  for (int id = 0; id < 5; id++) {
+    size_t tick_number = 0;
+    for (const TickRecord& record : dispatched_records) {
+      if (std::get<0>(record) == id) tick_number++;
+    }
+    EXPECT_EQ(expected_tick_number[id], tick_number);
+  }
+}
+
+/**
+ * @brief Test the calls with coprime large prescalers, whose cycle is too long for the table
+ */
+TEST(ClockGenerator, CoprimePrescalers) {
+  std::vector<TickRecord> records;
+  std::vector<std::unique_ptr<RecordingTickable>> components;
+  components.emplace_back(new RecordingTickable(0, 499, 1, false, &records));
+  components.emplace_back(new RecordingTickable(1, 503, 7, true, &records));
+  components.emplace_back(new RecordingTickable(2, 509, 1, false, &records));
+  components.emplace_back(new RecordingTickable(3, 1, 1, false, &records));
+
+  ClockGenerator clock_generator;
+  clock_generator.ClearTimerCount();
+  for (const std::unique_ptr<RecordingTickable>& component : components) clock_generator.RegisterComponent(component.get());
+
+  const unsigned int kCountNumber = 2000;
+  for (unsigned int count = 0; count < kCountNumber; count++) clock_generator.TickToComponents();
+  const std::vector<TickRecord> dispatched_records = records;
+
+  records.clear();
+  TickWithPreviousLoop(components, 0, kCountNumber);
+  EXPECT_EQ(records, dispatched_records);
+}
+
+/**
+ * @brief Test the rebuild of the table after the change of the fast update flag and the removal of a component
+ */
+TEST(ClockGenerator, RebuildAfterChange) {
+  std::vector<TickRecord> records;
+  std::vector<std::unique_ptr<RecordingTickable>> components;
+  components.emplace_back(new RecordingTickable(0, 2, 1, false, &records));
+  components.emplace_back(new RecordingTickable(1, 3, 1, false, &records));
+  components.emplace_back(new RecordingTickable(2, 5, 2, false, &records));
+
+  ClockGenerator clock_generator;
+  clock_generator.ClearTimerCount();
+  for (const std::unique_ptr<RecordingTickable>& component : components) clock_generator.RegisterComponent(component.get());
+
+  const unsigned int kCountNumber = 60;
+  for (unsigned int count = 0; count < kCountNumber; count++) clock_generator.TickToComponents();
+  std::vector<TickRecord> dispatched_records = records;
+  records.clear();
+  TickWithPreviousLoop(components, 0, kCountNumber);
+  EXPECT_EQ(records, dispatched_records);
+
+  records.clear();
+  components[2]->SetNeedsFastUpdate(true);
+  for (unsigned int count = 0; count < kCountNumber; count++) clock_generator.TickToComponents();
+  dispatched_records = records;
+  records.clear();
+  TickWithPreviousLoop(components, kCountNumber, kCountNumber);
+  EXPECT_EQ(records, dispatched_records);
+
+  records.clear();
+  clock_generator.RemoveComponent(components[1].get());
+  components.erase(components.begin() + 1);
+  for (unsigned int count = 0; count < kCountNumber; count++) clock_generator.TickToComponents();
+  dispatched_records = records;
+  records.clear();
+  TickWithPreviousLoop(components, 2 * kCountNumber, kCountNumber);
+  EXPECT_EQ(records, dispatched_records);
+}
@@ -0,0 +1,576 @@
+/**
+ * @file test_gnss_satellites.cpp
+ * @brief Test codes for GnssSatellites class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gnss_satellites.hpp"
+#include "library/external/sgp4/sgp4ext.h"
+#include "library/external/sgp4/sgp4unit.h"
+#include "library/math/constants.hpp"
+#include "physical_constants.hpp"
+
+namespace {
+const std::string kFileDirectory = std::string(CORE_DIR_FROM_EXE) + "/src/environment/global/";
+const std::string kCacheDirectory = "test_gnss_satellites_cache/";  //!< Directory of the cache files made in the tests
+
+/**
+ * @struct ReferenceData
+ * @brief Time series read by the reference parser
+ */
+struct ReferenceData {
+  std::vector<std::vector<double>> unix_time;                 //!< Unix time of each satellite
+  std::vector<std::vector<libra::Vector<3>>> position_ecef_m;  //!< Position in the ECEF frame [m]
+  std::vector<std::vector<libra::Vector<3>>> position_eci_m;   //!< Position in the ECI frame [m]
+  std::vector<std::vector<double>> clock_offset_m;            //!< Clock bias [m]
+  double time_interval_s = 0.0;                               //!< Time interval [s]
+  double start_unix_time = 1e16;                              //!< Start unix time
+  double end_unix_time = 0.0;                                 //!< End unix time
+};
+
+/**
+ * @fn ReadLines
+ * @brief Read all lines of a file
+ */
+std::vector<std::string> ReadLines(const std::string& file_path) {
+  std::ifstream file(file_path);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(file, line)) lines.push_back(line);
+  return lines;
+}
+
+/**
+ * @fn SplitWithStringStream
+ * @brief Split a line into the given number of tokens with istringstream
+ */
+std::vector<std::string> SplitWithStringStream(const std::string& line, const int number) {
+  std::istringstream iss{line};
+  std::vector<std::string> s;
+  for (int i = 0; i < number; ++i) {
+    std::string tmp;
+    iss >> tmp;
+    s.push_back(tmp);
+  }
+  return s;
+}
+
+/**
+ * @fn CalcReferenceUnixTime
+ * @brief Calculate unix time from the tokens of calendar expression with mktime
+ * @param [in] s: Tokens
+ * @param [in] offset: Index of the token of the year
+ */
+double CalcReferenceUnixTime(const std::vector<std::string>& s, const size_t offset) {
+  tm time_tm = {};
+  time_tm.tm_year = stoi(s.at(offset)) - 1900;
+  time_tm.tm_mon = stoi(s.at(offset + 1)) - 1;
+  time_tm.tm_mday = stoi(s.at(offset + 2));
+  time_tm.tm_hour = stoi(s.at(offset + 3));
+  time_tm.tm_min = stoi(s.at(offset + 4));
+  time_tm.tm_sec = (int)(stod(s.at(offset + 5)) + 1e-4);
+  time_tm.tm_isdst = 0;
+  return (double)mktime(&time_tm);
+}
+
+/**
+ * @fn ReadSp3WithStringStream
+ * @brief Read SP3 files line by line with istringstream in the same way as the parser before the memory mapping
+ */
+ReferenceData ReadSp3WithStringStream(const std::vector<std::string>& file_paths, const UltraRapidMode ur_flag) {
+  GnssSatellitePosition id_converter;
+  ReferenceData data;
+  const size_t satellite_number = id_converter.GetNumberOfSatellites();
+  data.unix_time.resize(satellite_number);
+  data.position_ecef_m.resize(satellite_number);
+  data.position_eci_m.resize(satellite_number);
+  data.clock_offset_m.resize(satellite_number);
+
+  for (const auto& file_path : file_paths) {
+    const std::vector<std::string> lines = ReadLines(file_path);
+    const int num_of_time_stamps = stoi(SplitWithStringStream(lines.at(0), 7).at(6));
+    data.time_interval_s = stod(SplitWithStringStream(lines.at(1), 4).at(3));
+    const int num_of_sat = stoi(SplitWithStringStream(lines.at(2), 2).at(1));
+    int line = 3;
+    while (lines.at(line).front() != '*') ++line;
+
+    int start_line = line;
+    int end_line = line + (num_of_sat + 1) * num_of_time_stamps;
+    if (ur_flag != kNotUse) {
+      const int offset = (int)ur_flag - (int)kObserve1;
+      start_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * offset;
+      end_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * (offset + 1);
+    }
+
+    double unix_time = 0.0, cos_gst = 0.0, sin_gst = 0.0;
+    for (int i = 0; i < end_line - start_line; ++i) {
+      if (i % (num_of_sat + 1) == 0) {
+        const std::vector<std::string> s = SplitWithStringStream(lines.at(start_line + i), 7);
+        unix_time = CalcReferenceUnixTime(s, 1);
+        double jd;
+        jday(stoi(s.at(1)), stoi(s.at(2)), stoi(s.at(3)), stoi(s.at(4)), stoi(s.at(5)), stod(s.at(6)), jd);
+        cos_gst = cos(gstime(jd));
+        sin_gst = sin(gstime(jd));
+        data.start_unix_time = std::min(data.start_unix_time, unix_time);
+        data.end_unix_time = std::max(data.end_unix_time, unix_time);
+        continue;
+      }
+      const std::vector<std::string> s = SplitWithStringStream(lines.at(start_line + i), 5);
+      const int id = id_converter.GetIndexFromId(s.front());
+
+      // Position
+      bool is_position_available = true;
+      libra::Vector<3> ecef_position_m(0.0);
+      for (int j = 0; j < 3; ++j) {
+        if (std::abs(stod(s.at(j + 1)) - nan99) < 1.0) is_position_available = false;
+        ecef_position_m[j] = stod(s.at(j + 1)) * 1000.0;
+      }
+      if (is_position_available) {
+        libra::Vector<3> eci_position_m(0.0);
+        eci_position_m[0] = cos_gst * ecef_position_m[0] - sin_gst * ecef_position_m[1];
+        eci_position_m[1] = sin_gst * ecef_position_m[0] + cos_gst * ecef_position_m[1];
+        eci_position_m[2] = ecef_position_m[2];
+        if (!data.unix_time[id].empty() && std::abs(unix_time - data.unix_time[id].back()) < 1.0) {
+          data.unix_time[id].back() = unix_time;
+          data.position_ecef_m[id].back() = ecef_position_m;
+          data.position_eci_m[id].back() = eci_position_m;
+        } else {
+          data.unix_time[id].push_back(unix_time);
+          data.position_ecef_m[id].push_back(ecef_position_m);
+          data.position_eci_m[id].push_back(eci_position_m);
+        }
+      }
+    }
+  }
+  return data;
+}
+
+/**
+ * @fn ReadSp3ClockWithStringStream
+ * @brief Read clock bias in SP3 files line by line with istringstream in the same way as the parser before the memory mapping
+ */
+ReferenceData ReadSp3ClockWithStringStream(const std::vector<std::string>& file_paths) {
+  GnssSatelliteClock id_converter;
+  ReferenceData data;
+  const size_t satellite_number = id_converter.GetNumberOfSatellites();
+  data.unix_time.resize(satellite_number);
+  data.clock_offset_m.resize(satellite_number);
+
+  for (const auto& file_path : file_paths) {
+    const std::vector<std::string> lines = ReadLines(file_path);
+    const int num_of_time_stamps = stoi(SplitWithStringStream(lines.at(0), 7).at(6));
+    data.time_interval_s = stod(SplitWithStringStream(lines.at(1), 4).at(3));
+    const int num_of_sat = stoi(SplitWithStringStream(lines.at(2), 2).at(1));
+    int line = 3;
+    while (lines.at(line).front() != '*') ++line;
+
+    double unix_time = 0.0;
+    for (int i = 0; i < (num_of_sat + 1) * num_of_time_stamps; ++i) {
+      if (i % (num_of_sat + 1) == 0) {
+        unix_time = CalcReferenceUnixTime(SplitWithStringStream(lines.at(line + i), 7), 1);
+        continue;
+      }
+      const std::vector<std::string> s = SplitWithStringStream(lines.at(line + i), 5);
+      const int id = id_converter.GetIndexFromId(s.front());
+      double clock = stod(s.at(4));
+      if (std::abs(clock - nan99) < 1.0) continue;
+      clock *= (environment::speed_of_light_m_s * 1e-6);
+      if (!data.unix_time[id].empty() && std::abs(unix_time - data.unix_time[id].back()) < 1.0) {
+        data.unix_time[id].back() = unix_time;
+        data.clock_offset_m[id].back() = clock;
+      } else {
+        data.unix_time[id].push_back(unix_time);
+        data.clock_offset_m[id].push_back(clock);
+      }
+    }
+  }
+  return data;
+}
+
+/**
+ * @fn ReadClk30sWithStringStream
+ * @brief Read a clock file line by line with istringstream in the same way as the parser before the memory mapping
+ */
+ReferenceData ReadClk30sWithStringStream(const std::string& file_path, const std::pair<double, double> unix_time_period) {
+  GnssSatelliteClock id_converter;
+  ReferenceData data;
+  const size_t satellite_number = id_converter.GetNumberOfSatellites();
+  data.unix_time.resize(satellite_number);
+  data.clock_offset_m.resize(satellite_number);
+  data.time_interval_s = 1e9;
+
+  const double start_unix_time = unix_time_period.first;
+  const double end_unix_time = unix_time_period.second + 30;
+  for (const auto& line : ReadLines(file_path)) {
+    if (line.substr(0, 3) != "AS ") continue;
+    const std::vector<std::string> s = SplitWithStringStream(line, 11);
+    const double unix_time = CalcReferenceUnixTime(s, 2);
+    const int id = id_converter.GetIndexFromId(s.at(1));
+    const double clock_bias = stod(s.at(9)) * environment::speed_of_light_m_s;
+    if (start_unix_time - unix_time > 1e-4) continue;
+    if (end_unix_time - unix_time < 1e-4) break;
+    if (!data.unix_time[id].empty() && std::abs(unix_time - data.unix_time[id].back()) < 1e-4) {
+      data.unix_time[id].back() = unix_time;
+      data.clock_offset_m[id].back() = clock_bias;
+    } else {
+      if (!data.unix_time[id].empty()) data.time_interval_s = std::min(data.time_interval_s, unix_time - data.unix_time[id].back());
+      data.unix_time[id].push_back(unix_time);
+      data.clock_offset_m[id].push_back(clock_bias);
+    }
+  }
+  return data;
+}
+
+/**
+ * @fn ExpectSamePosition
+ * @brief Compare the position time series with the reference
+ */
+void ExpectSamePosition(const ReferenceData& reference, const GnssSatellitePosition& position) {
+  EXPECT_DOUBLE_EQ(reference.time_interval_s, position.GetTimeInterval_s());
+  for (int id = 0; id < position.GetNumberOfSatellites(); ++id) {
+    ASSERT_EQ(reference.unix_time[id].size(), position.GetUnixTimeList(id).size()) << position.GetIdFromIndex(id);
+    ASSERT_EQ(reference.unix_time[id].size(), position.GetTimeSeriesPosition_ecef_m(id).size());
+    ASSERT_EQ(reference.unix_time[id].size(), position.GetTimeSeriesPosition_eci_m(id).size());
+    for (size_t i = 0; i < reference.unix_time[id].size(); ++i) {
+      EXPECT_DOUBLE_EQ(reference.unix_time[id][i], position.GetUnixTimeList(id)[i]);
+      for (size_t j = 0; j < 3; ++j) {
+        EXPECT_DOUBLE_EQ(reference.position_ecef_m[id][i][j], position.GetTimeSeriesPosition_ecef_m(id)[i][j]);
+        EXPECT_DOUBLE_EQ(reference.position_eci_m[id][i][j], position.GetTimeSeriesPosition_eci_m(id)[i][j]);
+      }
+    }
+  }
+}
+
+/**
+ * @fn ExpectSameClock
+ * @brief Compare the clock time series with the reference
+ */
+void ExpectSameClock(const ReferenceData& reference, const GnssSatelliteClock& clock) {
+  EXPECT_DOUBLE_EQ(reference.time_interval_s, clock.GetTimeInterval_s());
+  for (int id = 0; id < clock.GetNumberOfSatellites(); ++id) {
+    ASSERT_EQ(reference.unix_time[id].size(), clock.GetUnixTimeList(id).size()) << clock.GetIdFromIndex(id);
+    ASSERT_EQ(reference.unix_time[id].size(), clock.GetTimeSeriesClockOffset_m(id).size());
+    for (size_t i = 0; i < reference.unix_time[id].size(); ++i) {
+      EXPECT_DOUBLE_EQ(reference.unix_time[id][i], clock.GetUnixTimeList(id)[i]);
+      EXPECT_DOUBLE_EQ(reference.clock_offset_m[id][i], clock.GetTimeSeriesClockOffset_m(id)[i]);
+    }
+  }
+}
+
+/**
+ * @class InterpolationWindow
+ * @brief GnssSatelliteBase with a synthetic time series to test the interpolation window of the first satellite
+ */
+class InterpolationWindow : public GnssSatelliteBase {
+ public:
+  /**
+   * @fn InterpolationWindow
+   * @brief Constructor
+   * @param [in] unix_time: Unix time of the nodes
+   * @param [in] interpolation_number: Interpolation number
+   * @param [in] is_trigonometric_interpolation: Use trigonometric interpolation instead of Lagrange interpolation
+   */
+  InterpolationWindow(const std::vector<double>& unix_time, const int interpolation_number, const bool is_trigonometric_interpolation) {
+    unix_time_list.assign(GetNumberOfSatellites(), std::vector<double>());
+    unix_time_list[0] = unix_time;
+    interpolation_number_ = interpolation_number;
+    is_trigonometric_interpolation_ = is_trigonometric_interpolation;
+    InitializeWindows();
+  }
+
+  inline void Set(const int nearest_index) { SetWindow(0, nearest_index); }
+  inline void Shift(const int nearest_index) { ShiftWindow(0, nearest_index); }
+  inline bool IsFull() const { return is_window_full_[0]; }
+  inline int GetBeginIndex() const { return window_begin_index_[0]; }
+  inline const std::vector<double>& GetWeights() const { return barycentric_weights_[0]; }
+
+  /**
+   * @fn Interpolate
+   * @brief Return the interpolated value with the coefficients of the window
+   */
+  double Interpolate(const std::vector<double>& values, const double time) {
+    CalcInterpolationCoefficients(0, time);
+    double result = 0.0;
+    for (int i = 0; i < interpolation_number_; ++i) result += interpolation_coefficients_[i] * values[GetBeginIndex() + i];
+    return result;
+  }
+
+  /**
+   * @fn InterpolateWithProduct
+   * @brief Return the interpolated value with the product formula of each basis as the interpolation before the barycentric weights
+   */
+  double InterpolateWithProduct(const std::vector<double>& values, const double time) const {
+    const double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;
+    const std::vector<double>& t = unix_time_list[0];
+    const int begin_index = GetBeginIndex();
+    double result = 0.0;
+    for (int i = begin_index; i < begin_index + interpolation_number_; ++i) {
+      double basis = 1.0;
+      for (int j = begin_index; j < begin_index + interpolation_number_; ++j) {
+        if (i == j) continue;
+        if (is_trigonometric_interpolation_) {
+          basis *= sin(w * (time - t[j]) / 2.0) / sin(w * (t[i] - t[j]) / 2.0);
+        } else {
+          basis *= (time - t[j]) / (t[i] - t[j]);
+        }
+      }
+      result += basis * values[i];
+    }
+    return result;
+  }
+};
+
+/**
+ * @fn CheckInterpolationWindow
+ * @brief Move the window along the nodes as GnssSatellitePosition::Update and compare the interpolation with the product formula
+ * @param [in] interpolation_number: Interpolation number
+ * @param [in] is_trigonometric_interpolation: Use trigonometric interpolation instead of Lagrange interpolation
+ */
+void CheckInterpolationWindow(const int interpolation_number, const bool is_trigonometric_interpolation) {
+  SCOPED_TRACE("interpolation_number = " + std::to_string(interpolation_number) + ", trigonometric = " + std::to_string(is_trigonometric_interpolation));
+
+  // 300 s interval with a gap of two missing epochs
+  std::vector<double> unix_time, values;
+  for (int k = 0; k < 40; ++k) {
+    if (k == 20 || k == 21) continue;
+    const double time = 1.69e9 + 300.0 * k;
+    unix_time.push_back(time);
+    values.push_back(2.6e7 * sin(libra::tau * time / 43080.0) + 1.0e6 * cos(libra::tau * time / 21540.0));
+  }
+  const int node_number = (int)unix_time.size();
+  InterpolationWindow window(unix_time, interpolation_number, is_trigonometric_interpolation);
+
+  int nearest_index = 0;
+  window.Set(nearest_index);
+  for (double time = unix_time.front(); time <= unix_time.back(); time += 37.0) {
+    if (nearest_index + 1 < node_number && std::abs(time - unix_time[nearest_index + 1]) < std::abs(time - unix_time[nearest_index])) {
+      window.Shift(++nearest_index);
+    }
+
+    // The window is not full at the edges of the series
+    const int begin_index = nearest_index - interpolation_number / 2;
+    ASSERT_EQ(begin_index, window.GetBeginIndex());
+    ASSERT_EQ(begin_index >= 0 && begin_index + interpolation_number <= node_number, window.IsFull());
+    if (!window.IsFull()) continue;
+
+    // The weights updated in place are the same as the weights calculated for the window
+    InterpolationWindow reference(unix_time, interpolation_number, is_trigonometric_interpolation);
+    reference.Set(nearest_index);
+    for (int i = 0; i < interpolation_number; ++i) {
+      EXPECT_NEAR(reference.GetWeights()[i], window.GetWeights()[i], 1.0e-9 * std::abs(reference.GetWeights()[i]));
+    }
+
+    const double expected = window.InterpolateWithProduct(values, time);
+    EXPECT_NEAR(expected, window.Interpolate(values, time), 1.0e-6);
+  }
+
+  // The value at the node is the value of the node
+  const int node_index = node_number / 2;
+  window.Set(node_index);
+  ASSERT_TRUE(window.IsFull());
+  EXPECT_DOUBLE_EQ(values[node_index], window.Interpolate(values, unix_time[node_index]));
+
+  // Jumps forward, backward and beyond the edge set the window again
+  for (const int jump_index : {node_index + 3, node_index - 4, interpolation_number / 2, node_number - 1, node_index + 1}) {
+    window.Shift(jump_index);
+    const int begin_index = jump_index - interpolation_number / 2;
+    ASSERT_EQ(begin_index, window.GetBeginIndex());
+    ASSERT_EQ(begin_index >= 0 && begin_index + interpolation_number <= node_number, window.IsFull());
+    if (!window.IsFull()) continue;
+    const double time = unix_time[jump_index] + 100.0;
+    EXPECT_NEAR(window.InterpolateWithProduct(values, time), window.Interpolate(values, time), 1.0e-6);
+  }
+}
+
+/**
+ * @fn GetCacheFilePaths
+ * @brief Return paths of the cache files in the cache directory
+ */
+std::vector<std::string> GetCacheFilePaths() {
+  std::vector<std::string> file_paths;
+  for (const auto& entry : std::filesystem::directory_iterator(kCacheDirectory)) {
+    file_paths.push_back(entry.path().string());
+  }
+  return file_paths;
+}
+
+/**
+ * @fn CopyFile
+ * @brief Copy a file with replacement of a text
+ */
+void CopyFile(const std::string& source_path, const std::string& destination_path, const std::string& from = "", const std::string& to = "") {
+  std::ifstream source(source_path, std::ios::binary);
+  std::stringstream contents;
+  contents << source.rdbuf();
+  std::string text = contents.str();
+  if (!from.empty()) {
+    const size_t position = text.find(from);
+    ASSERT_NE(std::string::npos, position);
+    text.replace(position, from.size(), to);
+  }
+  std::ofstream destination(destination_path, std::ios::binary);
+  destination << text;
+}
+}  // namespace
+
+/**
+ * @brief Test that the SP3 files are read in the same way as the parser before the memory mapping
+ * @note The two files overlap at one epoch, and some positions and clocks are missing
+ */
+TEST(GnssSatellites, ReadSp3) {
+  const std::vector<std::string> file_paths = {kFileDirectory + "example_gnss_1.sp3", kFileDirectory + "example_gnss_2.sp3"};
+
+  for (const UltraRapidMode ur_flag : {kNotUse, kObserve2}) {
+    const ReferenceData reference = ReadSp3WithStringStream(file_paths, ur_flag);
+    GnssSatellitePosition position;
+    const std::pair<double, double> unix_time_period = position.Initialize(file_paths, 0, 5, ur_flag);
+    EXPECT_DOUBLE_EQ(reference.start_unix_time, unix_time_period.first);
+    EXPECT_DOUBLE_EQ(reference.end_unix_time, unix_time_period.second);
+    ExpectSamePosition(reference, position);
+  }
+
+  // 15 epochs with one overlap, and one missing position for G02 and R01
+  GnssSatellitePosition position;
+  position.Initialize(file_paths, 0, 5, kNotUse);
+  EXPECT_EQ(15, position.GetUnixTimeList(position.GetIndexFromId("G01")).size());
+  EXPECT_EQ(14, position.GetUnixTimeList(position.GetIndexFromId("G02")).size());
+  EXPECT_EQ(14, position.GetUnixTimeList(position.GetIndexFromId("R01")).size());
+  EXPECT_DOUBLE_EQ(26560.0e3, position.GetTimeSeriesPosition_ecef_m(position.GetIndexFromId("G01"))[0][0]);
+  EXPECT_DOUBLE_EQ(300.0, position.GetUnixTimeList(0)[1] - position.GetUnixTimeList(0)[0]);
+}
+
+/**
+ * @brief Test that the clock bias in the SP3 files is read in the same way as the parser before the memory mapping
+ */
+TEST(GnssSatellites, ReadSp3Clock) {
+  const std::vector<std::string> file_paths = {kFileDirectory + "example_gnss_1.sp3", kFileDirectory + "example_gnss_2.sp3"};
+  const ReferenceData reference = ReadSp3ClockWithStringStream(file_paths);
+
+  GnssSatelliteClock clock;
+  clock.Initialize(file_paths, ".sp3", 5, kNotUse, std::make_pair(0.0, 0.0));
+  ExpectSameClock(reference, clock);
+  EXPECT_EQ(14, clock.GetUnixTimeList(clock.GetIndexFromId("R01")).size());
+}
+
+/**
+ * @brief Test that the clock file is read in the same way as the parser before the memory mapping
+ * @note The records before the start and after the end of the period are skipped
+ */
+TEST(GnssSatellites, ReadClk30s) {
+  const std::string file_path = kFileDirectory + "example_gnss.clk30s";
+  const std::vector<std::string> start_line = SplitWithStringStream("AS G01  2023 07 23 00 00 30.000000", 8);
+  const std::vector<std::string> end_line = SplitWithStringStream("AS G01  2023 07 23 00 02  0.000000", 8);
+  const std::pair<double, double> unix_time_period(CalcReferenceUnixTime(start_line, 2), CalcReferenceUnixTime(end_line, 2));
+  const ReferenceData reference = ReadClk30sWithStringStream(file_path, unix_time_period);
+
+  GnssSatelliteClock clock;
+  clock.Initialize({file_path}, ".clk30s", 5, kNotUse, unix_time_period);
+  ExpectSameClock(reference, clock);
+
+  // From 00:00:30 to 00:02:00 with 30 s interval
+  const int id = clock.GetIndexFromId("G02");
+  ASSERT_EQ(4, clock.GetUnixTimeList(id).size());
+  EXPECT_DOUBLE_EQ(unix_time_period.first, clock.GetUnixTimeList(id).front());
+  EXPECT_DOUBLE_EQ(30.0, clock.GetTimeInterval_s());
+  EXPECT_DOUBLE_EQ(-5.734052365678e-04 * environment::speed_of_light_m_s, clock.GetTimeSeriesClockOffset_m(id).front());
+}
+
+/**
+ * @brief Test that the data read from the cache files is identical to the data read from the text files
+ */
+TEST(GnssSatellites, CacheRoundTrip) {
+  std::filesystem::remove_all(kCacheDirectory);
+  std::filesystem::create_directory(kCacheDirectory);
+  const std::vector<std::string> file_paths = {kFileDirectory + "example_gnss_1.sp3", kFileDirectory + "example_gnss_2.sp3"};
+  const ReferenceData reference = ReadSp3WithStringStream(file_paths, kNotUse);
+  const ReferenceData clock_reference = ReadSp3ClockWithStringStream(file_paths);
+
+  // The first reading writes the cache files, and the second reading reads them
+  for (size_t trial = 0; trial < 2; ++trial) {
+    GnssSatellitePosition position;
+    const std::pair<double, double> unix_time_period = position.Initialize(file_paths, 0, 5, kNotUse, kCacheDirectory);
+    EXPECT_DOUBLE_EQ(reference.start_unix_time, unix_time_period.first);
+    EXPECT_DOUBLE_EQ(reference.end_unix_time, unix_time_period.second);
+    ExpectSamePosition(reference, position);
+
+    GnssSatelliteClock clock;
+    clock.Initialize(file_paths, ".sp3", 5, kNotUse, unix_time_period, kCacheDirectory);
+    ExpectSameClock(clock_reference, clock);
+    EXPECT_EQ(2, GetCacheFilePaths().size());
+  }
+
+  // The key includes the ultra rapid mode
+  GnssSatellitePosition position;
+  position.Initialize(file_paths, 0, 5, kObserve2, kCacheDirectory);
+  ExpectSamePosition(ReadSp3WithStringStream(file_paths, kObserve2), position);
+  EXPECT_EQ(3, GetCacheFilePaths().size());
+
+  std::filesystem::remove_all(kCacheDirectory);
+}
+
+/**
+ * @brief Test that the cache file is not used when the text file is changed or the key in the cache file does not match
+ */
+TEST(GnssSatellites, CacheInvalidation) {
+  std::filesystem::remove_all(kCacheDirectory);
+  std::filesystem::create_directory(kCacheDirectory);
+  const std::vector<std::string> file_paths = {kCacheDirectory + "test.sp3"};
+  CopyFile(kFileDirectory + "example_gnss_1.sp3", file_paths[0]);
+
+  GnssSatellitePosition original_position;
+  original_position.Initialize(file_paths, 0, 5, kNotUse, kCacheDirectory);
+  ExpectSamePosition(ReadSp3WithStringStream(file_paths, kNotUse), original_position);
+  std::vector<std::string> cache_file_paths = GetCacheFilePaths();
+  ASSERT_EQ(2, cache_file_paths.size());
+  const std::string original_cache_file_path = cache_file_paths[0] == file_paths[0] ? cache_file_paths[1] : cache_file_paths[0];
+
+  // Change a value in the text file
+  CopyFile(kFileDirectory + "example_gnss_1.sp3", file_paths[0], "PG01  26560.000000", "PG01  26561.000000");
+  const ReferenceData changed_reference = ReadSp3WithStringStream(file_paths, kNotUse);
+  const int id = original_position.GetIndexFromId("G01");
+  EXPECT_DOUBLE_EQ(26561.0e3, changed_reference.position_ecef_m[id][0][0]);
+
+  GnssSatellitePosition changed_position;
+  changed_position.Initialize(file_paths, 0, 5, kNotUse, kCacheDirectory);
+  ExpectSamePosition(changed_reference, changed_position);
+  cache_file_paths = GetCacheFilePaths();
+  ASSERT_EQ(3, cache_file_paths.size());
+  std::string changed_cache_file_path;
+  for (const auto& cache_file_path : cache_file_paths) {
+    if (cache_file_path != file_paths[0] && cache_file_path != original_cache_file_path) changed_cache_file_path = cache_file_path;
+  }
+
+  // The cache file of the changed text file has the key of the original one in the file
+  CopyFile(original_cache_file_path, changed_cache_file_path);
+  GnssSatellitePosition mismatched_position;
+  mismatched_position.Initialize(file_paths, 0, 5, kNotUse, kCacheDirectory);
+  ExpectSamePosition(changed_reference, mismatched_position);
+
+  // The truncated cache file is not used
+  std::filesystem::resize_file(changed_cache_file_path, std::filesystem::file_size(changed_cache_file_path) / 2);
+  GnssSatellitePosition truncated_position;
+  truncated_position.Initialize(file_paths, 0, 5, kNotUse, kCacheDirectory);
+  ExpectSamePosition(changed_reference, truncated_position);
+
+  std::filesystem::remove_all(kCacheDirectory);
+}
+
+/**
+ * @brief Test the interpolation window moved along the nodes with the product formula of the basis
+ * @note Trigonometric and Lagrange interpolation with odd and even interpolation numbers, and a gap of missing epochs are checked.
+ */
+TEST(GnssSatellites, InterpolationWindow) {
+  for (const bool is_trigonometric_interpolation : {true, false}) {
+    for (const int interpolation_number : {4, 5, 9, 10}) {
+      CheckInterpolationWindow(interpolation_number, is_trigonometric_interpolation);
+    }
+  }
+}
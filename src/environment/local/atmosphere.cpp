@@ -11,20 +11,24 @@
 #include "library/logger/log_utility.hpp"
 #include "library/math/vector.hpp"
 #include "library/randomization/global_randomization.hpp"
-#include "library/randomization/normal_randomization.hpp"
 #include "library/randomization/random_walk.hpp"
+#include "library/utilities/external_library_mutex.hpp"
 
 Atmosphere::Atmosphere(const std::string model, const std::string space_weather_file_name, const double gauss_standard_deviation_rate,
                        const bool is_manual_param, const double manual_f107, const double manual_f107a, const double manual_ap,
-                       const LocalCelestialInformation* local_celestial_information, const SimulationTime* simulation_time)
+                       const LocalCelestialInformation* local_celestial_information, const SimulationTime* simulation_time,
+                       const bool is_space_weather_interpolated)
     : model_(model),
       air_density_kg_m3_(0.0),
+      is_space_weather_interpolated_(is_space_weather_interpolated),
       is_manual_param_used_(is_manual_param),
       manual_daily_f107_(manual_f107),
       manual_average_f107_(manual_f107a),
       manual_ap_(manual_ap),
       gauss_standard_deviation_rate_(gauss_standard_deviation_rate),
+      density_noise_(0.0, 1.0, global_randomization.MakeSeed()),
       local_celestial_information_(local_celestial_information) {
+  sun_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("SUN");
   if (model_ == "STANDARD") {
     // Standard
     std::cerr << "Air density model : STANDARD" << std::endl;
@@ -34,7 +38,7 @@ Atmosphere::Atmosphere(const std::string model, const std::string space_weather_
     if (!is_manual_param_used_) {
       double decimal_year = simulation_time->GetCurrentDecimalYear();
       double end_time_s = simulation_time->GetEndTime_s();
-      if (GetSpaceWeatherTable_(decimal_year, end_time_s, space_weather_file_name, space_weather_table_)) {
+      if (space_weather_table_.ReadFile(space_weather_file_name, decimal_year, end_time_s)) {
       } else {
         std::cerr << "Space Weather file read error!" << std::endl;
         std::cerr << "Air density is switched to STANDARD model" << std::endl;
@@ -62,11 +66,12 @@ double Atmosphere::CalcAirDensity_kg_m3(const double decimal_year, const Orbit&
     double lat_rad = orbit.GetGeodeticPosition().GetLatitude_rad();
     double lon_rad = orbit.GetGeodeticPosition().GetLongitude_rad();
     double alt_m = orbit.GetGeodeticPosition().GetAltitude_m();
+    std::lock_guard<std::mutex> lock(GetExternalLibraryMutex(ExternalLibrary::kNrlmsise00));
     air_density_kg_m3_ = CalcNRLMSISE00(decimal_year, lat_rad, lon_rad, alt_m, space_weather_table_, is_manual_param_used_, manual_daily_f107_,
-                                        manual_average_f107_, manual_ap_);
+                                        manual_average_f107_, manual_ap_, is_space_weather_interpolated_);
   } else if (model_ == "HARRIS_PRIESTER") {
     // Harris-Priester
-    libra::Vector<3> sun_direction_eci = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m("SUN").CalcNormalizedVector();
+    libra::Vector<3> sun_direction_eci = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m(sun_).CalcNormalizedVector();
     air_density_kg_m3_ = libra::atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(orbit.GetGeodeticPosition(), sun_direction_eci);
   } else {
     // No suitable model
@@ -78,8 +83,7 @@ double Atmosphere::CalcAirDensity_kg_m3(const double decimal_year, const Orbit&
 
 double Atmosphere::AddNoise(const double rho_kg_m3) {
   // RandomWalk rw(rho_kg_m3*rw_stepwidth_,rho_kg_m3*rw_stddev_,rho_kg_m3*rw_limit_);
-  libra::NormalRand nr(0.0, rho_kg_m3 * gauss_standard_deviation_rate_, global_randomization.MakeSeed());
-  double nrd = nr;
+  double nrd = rho_kg_m3 * gauss_standard_deviation_rate_ * density_noise_;
 
   return rho_kg_m3 + nrd;
 }
@@ -91,6 +95,10 @@ std::string Atmosphere::GetLogValue() const {
   return str_tmp;
 }
 
+void Atmosphere::AppendLogValue(std::vector<double>& values) const {
+  AppendScalar(values, air_density_kg_m3_);
+}
+
 std::string Atmosphere::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -125,9 +133,10 @@ Atmosphere InitAtmosphere(const std::string initialize_file_path, const LocalCel
     manual_average_f107 = f107_default;
   }
   double manual_ap = conf.ReadDouble(section, "manual_ap");
+  bool is_space_weather_interpolated = conf.ReadEnable(section, "is_space_weather_interpolated");
 
   Atmosphere atmosphere(model, table_path, rho_stddev, is_manual_param_used, manual_daily_f107, manual_average_f107, manual_ap,
-                        local_celestial_information, simulation_time);
+                        local_celestial_information, simulation_time, is_space_weather_interpolated);
   atmosphere.SetCalcFlag(conf.ReadEnable(section, INI_CALC_LABEL));
   atmosphere.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
 
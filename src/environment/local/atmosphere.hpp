@@ -14,6 +14,7 @@
 #include "library/external/nrlmsise00/wrapper_nrlmsise00.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/vector.hpp"
+#include "library/randomization/normal_randomization.hpp"
 
 /**
  * @class Atmosphere
@@ -33,10 +34,12 @@ class Atmosphere : public ILoggable {
    * @param [in] manual_ap: Manual value of ap value
    * @param [in] local_celestial_information: Local Celestial information
    * @param [in] simulation_time: Simulation Time information
+   * @param [in] is_space_weather_interpolated: Flag to interpolate f10.7 and ap value in the space weather table between days
    */
   Atmosphere(const std::string model, const std::string space_weather_file_name, const double gauss_standard_deviation_rate,
              const bool is_manual_param, const double manual_f107, const double manual_f107a, const double manual_ap,
-             const LocalCelestialInformation* local_celestial_information, const SimulationTime* simulation_time);
+             const LocalCelestialInformation* local_celestial_information, const SimulationTime* simulation_time,
+             const bool is_space_weather_interpolated = false);
   /**
    * @fn ~Atmosphere
    * @brief Destructor
@@ -72,6 +75,11 @@ class Atmosphere : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
  private:
   // General information
@@ -80,8 +88,9 @@ class Atmosphere : public ILoggable {
   double air_density_kg_m3_;     //!< Atmospheric density [kg/m^3]
 
   // NRLMSISE-00 model information
-  std::vector<nrlmsise_table> space_weather_table_;  //!< Space weather table
-  bool is_manual_param_used_;                        //!< Flag to use manual parameters
+  libra::atmosphere::SpaceWeatherTable space_weather_table_;  //!< Space weather table
+  bool is_space_weather_interpolated_;                        //!< Flag to interpolate the space weather table between days
+  bool is_manual_param_used_;                                 //!< Flag to use manual parameters
   // Reference of the following setting parameters https://www.swpc.noaa.gov/phenomena/f107-cm-radio-emissions
   double manual_daily_f107_;    //!< Manual daily f10.7 value
   double manual_average_f107_;  //!< Manual 3-month averaged f10.7 value
@@ -89,6 +98,7 @@ class Atmosphere : public ILoggable {
 
   // Noise Information
   double gauss_standard_deviation_rate_;  //!< Standard deviation of density noise (defined as percentage)
+  libra::NormalRand density_noise_;       //!< Standard normal random for the density noise
   // TODO: Add random walk noise
   //  double rw_stepwidth_;
   //  double rw_stddev_;
@@ -96,6 +106,7 @@ class Atmosphere : public ILoggable {
 
   // References
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
+  CelestialBodyHandle sun_;                                       //!< Handle of the sun
 
   // Functions
   /**
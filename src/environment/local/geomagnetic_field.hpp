@@ -6,10 +6,15 @@
 #ifndef S2E_ENVIRONMENT_LOCAL_GEOMAGNETIC_FIELD_HPP_
 #define S2E_ENVIRONMENT_LOCAL_GEOMAGNETIC_FIELD_HPP_
 
+#include <memory>
+
 #include "library/geodesy/geodetic_position.hpp"
+#include "library/geomagnetism/igrf_model.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/quaternion.hpp"
 #include "library/math/vector.hpp"
+#include "library/randomization/normal_randomization.hpp"
+#include "library/randomization/random_walk.hpp"
 
 /**
  * @class GeomagneticField
@@ -68,14 +73,24 @@ class GeomagneticField : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
  private:
-  libra::Vector<3> magnetic_field_i_nT_;      //!< Magnetic field vector at the inertial frame [nT]
-  libra::Vector<3> magnetic_field_b_nT_;      //!< Magnetic field vector at the spacecraft body fixed frame [nT]
-  double random_walk_standard_deviation_nT_;  //!< Standard deviation of Random Walk [nT]
-  double random_walk_limit_nT_;               //!< Limit of Random Walk [nT]
-  double white_noise_standard_deviation_nT_;  //!< Standard deviation of white noise [nT]
-  std::string igrf_file_name_;                //!< Path to the initialize file
+  libra::Vector<3> magnetic_field_i_nT_;         //!< Magnetic field vector at the inertial frame [nT]
+  libra::Vector<3> magnetic_field_b_nT_;         //!< Magnetic field vector at the spacecraft body fixed frame [nT]
+  double random_walk_standard_deviation_nT_;     //!< Standard deviation of Random Walk [nT]
+  double random_walk_limit_nT_;                  //!< Limit of Random Walk [nT]
+  double white_noise_standard_deviation_nT_;     //!< Standard deviation of white noise [nT]
+  std::string igrf_file_name_;                   //!< Path to the initialize file
+  std::shared_ptr<const IgrfModel> igrf_model_;  //!< IGRF model shared with the other objects using the same coefficient file
+
+  // The noise generators are seeded from global_randomization at the construction, so each Monte-Carlo case starts its own streams
+  RandomWalk<3> random_walk_nT_;      //!< Random walk noise [nT]
+  libra::NormalRand white_noise_nT_;  //!< White noise [nT]
 
   /**
    * @fn AddNoise
@@ -13,6 +13,7 @@
 #include <sstream>
 
 #include "library/logger/log_utility.hpp"
+#include "library/utilities/external_library_mutex.hpp"
 
 LocalCelestialInformation::LocalCelestialInformation(const CelestialInformation* global_celestial_information)
     : global_celestial_information_(global_celestial_information) {
@@ -132,9 +133,12 @@ void LocalCelestialInformation::ConvertVelocityInertialToBody(const double* posi
 }
 
 libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const char* body_name) const {
+  return GetPositionFromSpacecraft_i_m(global_celestial_information_->GetBodyHandle(body_name));
+}
+
+libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const CelestialBodyHandle body) const {
   libra::Vector<3> position;
-  int index = 0;
-  index = global_celestial_information_->CalcBodyIdFromName(body_name);
+  const unsigned int index = body.GetId();
   for (int i = 0; i < 3; i++) {
     position[i] = celestial_body_position_from_spacecraft_i_m_[index * 3 + i];
   }
@@ -142,15 +146,16 @@ libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const
 }
 
 libra::Vector<3> LocalCelestialInformation::GetCenterBodyPositionFromSpacecraft_i_m() const {
-  std::string body_name = global_celestial_information_->GetCenterBodyName();
-  libra::Vector<3> position = GetPositionFromSpacecraft_i_m(body_name.c_str());
-  return position;
+  return GetPositionFromSpacecraft_i_m(global_celestial_information_->GetCenterBodyHandle());
 }
 
 libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const char* body_name) const {
+  return GetPositionFromSpacecraft_b_m(global_celestial_information_->GetBodyHandle(body_name));
+}
+
+libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const CelestialBodyHandle body) const {
   libra::Vector<3> position;
-  int index = 0;
-  index = global_celestial_information_->CalcBodyIdFromName(body_name);
+  const unsigned int index = body.GetId();
   for (int i = 0; i < 3; i++) {
     position[i] = celestial_body_position_from_spacecraft_b_m_[index * 3 + i];
   }
@@ -158,9 +163,7 @@ libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const
 }
 
 libra::Vector<3> LocalCelestialInformation::GetCenterBodyPositionFromSpacecraft_b_m(void) const {
-  std::string body_name = global_celestial_information_->GetCenterBodyName();
-  libra::Vector<3> position = GetPositionFromSpacecraft_b_m(body_name.c_str());
-  return position;
+  return GetPositionFromSpacecraft_b_m(global_celestial_information_->GetCenterBodyHandle());
 }
 
 std::string LocalCelestialInformation::GetLogHeader() const {
@@ -171,7 +174,10 @@ std::string LocalCelestialInformation::GetLogHeader() const {
   for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
     SpiceInt planet_id = global_celestial_information_->GetSelectedBodyIds()[i];
     // Acquisition of body name from id
-    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
+    {
+      std::lock_guard<std::mutex> lock(GetExternalLibraryMutex(ExternalLibrary::kCspice));
+      bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
+    }
     std::string name = namebuf;
 
     std::locale loc = std::locale::classic();
@@ -197,3 +203,14 @@ std::string LocalCelestialInformation::GetLogValue() const {
   }
   return str_tmp;
 }
+
+void LocalCelestialInformation::AppendLogValue(std::vector<double>& values) const {
+  for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
+    for (int j = 0; j < 3; j++) {
+      AppendScalar(values, celestial_body_position_from_spacecraft_b_m_[i * 3 + j]);
+    }
+    for (int j = 0; j < 3; j++) {
+      AppendScalar(values, celestial_body_velocity_from_spacecraft_b_m_s_[i * 3 + j]);
+    }
+  }
+}
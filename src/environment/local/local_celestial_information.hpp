@@ -44,6 +44,12 @@ class LocalCelestialInformation : public ILoggable {
    * @param [in] body_name Celestial body name
    */
   libra::Vector<3> GetPositionFromSpacecraft_i_m(const char* body_name) const;
+  /**
+   * @fn GetPositionFromSpacecraft_i_m
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Inertial frame)
+   * @param [in] body Handle of the celestial body
+   */
+  libra::Vector<3> GetPositionFromSpacecraft_i_m(const CelestialBodyHandle body) const;
   /**
    * @fn GetCenterBodyPositionFromSpacecraft_i_m
    * @brief Return position of the center body (Origin: Spacecraft, Frame: Inertial frame)
@@ -56,6 +62,12 @@ class LocalCelestialInformation : public ILoggable {
    * @param [in] body_name Celestial body name
    */
   libra::Vector<3> GetPositionFromSpacecraft_b_m(const char* body_name) const;
+  /**
+   * @fn GetPositionFromSpacecraft_b_m
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Body fixed frame)
+   * @param [in] body Handle of the celestial body
+   */
+  libra::Vector<3> GetPositionFromSpacecraft_b_m(const CelestialBodyHandle body) const;
   /**
    * @fn GetCenterBodyPositionFromSpacecraft_b_m
    * @brief Return position of the center body (Origin: Spacecraft, Frame: Body fixed frame)
@@ -79,6 +91,11 @@ class LocalCelestialInformation : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
  private:
   const CelestialInformation* global_celestial_information_;  //!< Global celestial information
@@ -16,8 +16,9 @@
 SolarRadiationPressureEnvironment::SolarRadiationPressureEnvironment(LocalCelestialInformation* local_celestial_information)
     : local_celestial_information_(local_celestial_information) {
   solar_radiation_pressure_N_m2_ = solar_constant_W_m2_ / environment::speed_of_light_m_s;
-  shadow_source_name_list_.push_back(local_celestial_information_->GetGlobalInformation().GetCenterBodyName());
-  sun_radius_m_ = local_celestial_information_->GetGlobalInformation().GetMeanRadiusFromName_m("SUN");
+  sun_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("SUN");
+  AddShadowSource(local_celestial_information_->GetGlobalInformation().GetCenterBodyName());
+  sun_radius_m_ = local_celestial_information_->GetGlobalInformation().GetMeanRadius_m(sun_);
 }
 
 void SolarRadiationPressureEnvironment::UpdateAllStates() {
@@ -25,13 +26,13 @@ void SolarRadiationPressureEnvironment::UpdateAllStates() {
 
   UpdatePressure();
   shadow_coefficient_ = 1.0;  // Initialize for multiple shadow source
-  for (auto shadow_source_name : shadow_source_name_list_) {
-    CalcShadowCoefficient(shadow_source_name);
+  for (auto shadow_source : shadow_source_list_) {
+    CalcShadowCoefficient(shadow_source);
   }
 }
 
 void SolarRadiationPressureEnvironment::UpdatePressure() {
-  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
+  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_);
   const double distance_sat_to_sun = r_sc2sun_eci.CalcNorm();
   solar_radiation_pressure_N_m2_ =
       solar_constant_W_m2_ / environment::speed_of_light_m_s / pow(distance_sat_to_sun / environment::astronomical_unit_m, 2.0);
@@ -55,16 +56,16 @@ std::string SolarRadiationPressureEnvironment::GetLogValue() const {
   return str_tmp;
 }
 
-void SolarRadiationPressureEnvironment::CalcShadowCoefficient(std::string shadow_source_name) {
-  if (shadow_source_name == "SUN") {
-    shadow_coefficient_ *= 1.0;
-    return;
-  }
+void SolarRadiationPressureEnvironment::AppendLogValue(std::vector<double>& values) const {
+  AppendScalar(values, solar_radiation_pressure_N_m2_ * shadow_coefficient_);
+  AppendScalar(values, shadow_coefficient_);
+}
 
-  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
-  const libra::Vector<3> r_sc2source_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(shadow_source_name.c_str());
+void SolarRadiationPressureEnvironment::CalcShadowCoefficient(const CelestialBodyHandle shadow_source) {
+  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_);
+  const libra::Vector<3> r_sc2source_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(shadow_source);
 
-  const double shadow_source_radius_m = local_celestial_information_->GetGlobalInformation().GetMeanRadiusFromName_m(shadow_source_name.c_str());
+  const double shadow_source_radius_m = local_celestial_information_->GetGlobalInformation().GetMeanRadius_m(shadow_source);
 
   const double distance_sat_to_sun = r_sc2sun_eci.CalcNorm();
   const double sd_sun = asin(sun_radius_m_ / distance_sat_to_sun);                     // Apparent radius of the sun
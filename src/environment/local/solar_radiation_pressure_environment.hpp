@@ -43,7 +43,8 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    */
   void AddShadowSource(const std::string shadow_source_name) {
     // TODO: Add assertion
-    shadow_source_name_list_.push_back(shadow_source_name);
+    if (shadow_source_name == "SUN") return;  // The sun does not make shadow
+    shadow_source_list_.push_back(local_celestial_information_->GetGlobalInformation().GetBodyHandle(shadow_source_name.c_str()));
   }
 
   // Getter
@@ -89,13 +90,19 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
  private:
-  double solar_radiation_pressure_N_m2_;              //!< Solar radiation pressure [N/m^2]
-  double solar_constant_W_m2_ = 1366.0;               //!< Solar constant [W/m^2] TODO: We need to change the value depends on sun activity.
-  double shadow_coefficient_ = 1.0;                   //!< Shadow function
-  double sun_radius_m_;                               //!< Sun radius [m]
-  std::vector<std::string> shadow_source_name_list_;  //!< Shadow source name list
+  double solar_radiation_pressure_N_m2_;                 //!< Solar radiation pressure [N/m^2]
+  double solar_constant_W_m2_ = 1366.0;                  //!< Solar constant [W/m^2] TODO: We need to change the value depends on sun activity.
+  double shadow_coefficient_ = 1.0;                      //!< Shadow function
+  double sun_radius_m_;                                  //!< Sun radius [m]
+  std::vector<CelestialBodyHandle> shadow_source_list_;  //!< Shadow source list
+  CelestialBodyHandle sun_;                              //!< Handle of the sun
 
   LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
 
@@ -108,9 +115,9 @@ class SolarRadiationPressureEnvironment : public ILoggable {
   /**
    * @fn CalcShadowCoefficient
    * @brief Calculate shadow coefficient
-   * @param [in] shadow_source_name_: Shadow source name
+   * @param [in] shadow_source: Handle of the shadow source
    */
-  void CalcShadowCoefficient(std::string shadow_source_name);
+  void CalcShadowCoefficient(const CelestialBodyHandle shadow_source);
 };
 
 /**
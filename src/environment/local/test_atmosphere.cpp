@@ -0,0 +1,83 @@
+/**
+ * @file test_atmosphere.cpp
+ * @brief Test codes for Atmosphere class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <dynamics/orbit/rk4_orbit_propagation.hpp>
+#include <library/randomization/global_randomization.hpp>
+#include <library/utilities/thread_pool.hpp>
+#include <vector>
+
+#include "atmosphere.hpp"
+
+namespace {
+const double kGravityConstant_m3_s2 = 3.986004418e14;  //!< Gravity constant of the Earth [m3/s2]
+const size_t kSpacecraftNumber = 8;                    //!< Number of the spacecraft
+const size_t kStepNumber = 100;                        //!< Number of the update steps
+
+/**
+ * @brief Return the air density with noise of each spacecraft at each step
+ * @param [in] seed: Seed of the global randomization set before the construction
+ * @param [in] thread_pool: Thread pool to update the spacecraft. The update is serial when it is nullptr.
+ */
+std::vector<double> CalcAirDensities(const long seed, ThreadPool* thread_pool) {
+  // Only the center body is used, so the SPICE kernels are not needed.
+  // CelestialInformation takes the ownership of the array of the selected body IDs.
+  CelestialInformation celestial_information("J2000", "NONE", "EARTH", 0, new int[0], std::vector<std::string>());
+  LocalCelestialInformation local_celestial_information(&celestial_information);
+
+  // The atmospheres are constructed on this thread in the order of the spacecraft, as in the simulation case
+  global_randomization.SetSeed(seed);
+  std::vector<Atmosphere> atmospheres;
+  std::vector<Rk4OrbitPropagation> orbits;
+  atmospheres.reserve(kSpacecraftNumber);
+  orbits.reserve(kSpacecraftNumber);
+  for (size_t i = 0; i < kSpacecraftNumber; i++) {
+    atmospheres.emplace_back("STANDARD", "", 0.1, false, 150.0, 150.0, 3.0, &local_celestial_information, nullptr, false);
+    libra::Vector<3> position_i_m(0.0);
+    position_i_m[0] = 6778137.0 + 10000.0 * i;
+    libra::Vector<3> velocity_i_m_s(0.0);
+    velocity_i_m_s[1] = 7600.0;
+    orbits.emplace_back(&celestial_information, kGravityConstant_m3_s2, 1.0, position_i_m, velocity_i_m_s);
+  }
+
+  std::vector<double> air_densities_kg_m3(kSpacecraftNumber * kStepNumber);
+  auto update = [&](size_t index, size_t step) {
+    air_densities_kg_m3[step * kSpacecraftNumber + index] = atmospheres[index].CalcAirDensity_kg_m3(2020.0, orbits[index]);
+  };
+  for (size_t step = 0; step < kStepNumber; step++) {
+    if (thread_pool == nullptr) {
+      for (size_t i = 0; i < kSpacecraftNumber; i++) update(i, step);
+    } else {
+      thread_pool->ParallelFor(kSpacecraftNumber, [&update, step](size_t index) { update(index, step); });
+    }
+  }
+  return air_densities_kg_m3;
+}
+}  // namespace
+
+/**
+ * @brief Test that the air density noise of the parallel update is identical to the serial update
+ */
+TEST(Atmosphere, ParallelUpdate) {
+  const long seed = 12345;
+  const std::vector<double> serial = CalcAirDensities(seed, nullptr);
+
+  ThreadPool thread_pool(4);
+  for (int trial = 0; trial < 3; trial++) {
+    const std::vector<double> parallel = CalcAirDensities(seed, &thread_pool);
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (size_t i = 0; i < serial.size(); i++) {
+      EXPECT_EQ(serial[i], parallel[i]);
+    }
+  }
+
+  // The noise is added, so the air density of a spacecraft at the fixed position changes between the steps
+  EXPECT_NE(serial[0], serial[kSpacecraftNumber]);
+  EXPECT_NE(serial[kSpacecraftNumber], serial[2 * kSpacecraftNumber]);
+
+  // The seed of the global randomization, e.g. the seed of a Monte-Carlo case, reaches the noise
+  const std::vector<double> other_seed = CalcAirDensities(seed + 1, &thread_pool);
+  EXPECT_NE(serial[0], other_seed[0]);
+}
@@ -0,0 +1,240 @@
+/**
+ * @file space_weather_table.cpp
+ * @brief Day-indexed space weather table for the NRLMSISE-00 atmosphere model
+ */
+
+#include "space_weather_table.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace libra::atmosphere {
+
+static bool IsLeapYear(const int year) { return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0); }
+
+/**
+ * @fn CalcDayNumber
+ * @brief Calculate the number of days from 1970/1/1 in the proleptic Gregorian calendar
+ */
+static long CalcDayNumber(const int year, const int month, const int day) {
+  const long y = (long)year - (month <= 2 ? 1 : 0);
+  const long era = (y >= 0 ? y : y - 399) / 400;
+  const long year_of_era = y - era * 400;
+  const long day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const long day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+/**
+ * @fn CalcDate
+ * @brief Calculate the date from the number of days from 1970/1/1 in the proleptic Gregorian calendar
+ */
+static void CalcDate(const long day_number, int& year, int& month, int& day) {
+  const long z = day_number + 719468;
+  const long era = (z >= 0 ? z : z - 146096) / 146097;
+  const long day_of_era = z - era * 146097;
+  const long year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+  const long day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const long month_position = (5 * day_of_year + 2) / 153;
+  day = (int)(day_of_year - (153 * month_position + 2) / 5 + 1);
+  month = (int)(month_position < 10 ? month_position + 3 : month_position - 9);
+  year = (int)(year_of_era + era * 400 + (month <= 2 ? 1 : 0));
+}
+
+/**
+ * @fn ConvertDateToDecimalYear
+ * @brief Convert the date to the decimal year in the same way as the legacy NRLMSISE-00 wrapper
+ */
+static double ConvertDateToDecimalYear(const int year, const int month, const int day) {
+  const double days_per_year = IsLeapYear(year) ? 366.0 : 365.0;
+  const double days = (double)(CalcDayNumber(year, month, day) - CalcDayNumber(year, 1, 1) + 1);
+  return (double)year + days / days_per_year;
+}
+
+/**
+ * @fn ConvertMonthStringToNumber
+ * @brief Convert three letters month name to the month number (1 to 12). Return 0 for unknown names.
+ */
+static int ConvertMonthStringToNumber(const std::string& month_string) {
+  const char* kMonthNames[12] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+  for (int i = 0; i < 12; i++) {
+    if (month_string == kMonthNames[i]) return i + 1;
+  }
+  return 0;
+}
+
+static const size_t kRecordLength = 130;  //!< End of the last column (Lst81_obs) of a record line
+
+/**
+ * @fn ParseColumn
+ * @brief Parse a number in the fixed columns of the line
+ * @note The caller checks that the line is not shorter than kRecordLength.
+ */
+static double ParseColumn(const std::string& line, const size_t begin, const size_t length) {
+  if (begin >= line.size()) return 0.0;
+  char buffer[32];
+  const size_t copy_length = std::min(std::min(length, line.size() - begin), sizeof(buffer) - 1);
+  memcpy(buffer, line.data() + begin, copy_length);
+  buffer[copy_length] = '\0';
+  return strtod(buffer, nullptr);
+}
+
+static bool IsDigits(const std::string& line, const size_t length) {
+  if (line.size() < length) return false;
+  for (size_t i = 0; i < length; i++) {
+    if (line[i] < '0' || line[i] > '9') return false;
+  }
+  return true;
+}
+
+size_t SpaceWeatherTable::ReadFile(const std::string& file_path, const double start_decimal_year, const double end_time_s) {
+  std::ifstream file(file_path);
+  if (!file.is_open()) {
+    std::cerr << "File open error (SpaceWether.txt)" << std::endl;
+    return 0;
+  }
+
+  double fraction_of_day;
+  int start_date[3], end_date[3];
+  CalcDate(ConvertDecimalYearToDay(start_decimal_year, fraction_of_day), start_date[0], start_date[1], start_date[2]);
+  CalcDate(ConvertDecimalYearToDay(start_decimal_year + end_time_s / 86400.0 / 365.0, fraction_of_day), end_date[0], end_date[1], end_date[2]);
+  if (start_date[0] < 2015 || start_date[0] > 2043 || end_date[0] > 2043) {
+    std::cerr << "Year must be between 2015 and 2043 for NRLMSISE00 atmosphere model" << std::endl;
+  }
+  // To get 1 month data, read the data before a month from the simulation starting date
+  const double read_start_decimal_year = ConvertDateToDecimalYear(start_date[0], start_date[1], start_date[2]) - 31.0 / 365.0;
+  const double read_end_decimal_year = ConvertDateToDecimalYear(end_date[0], end_date[1], end_date[2]);
+
+  records_.clear();
+  std::string line;
+  while (std::getline(file, line)) {
+    if (!IsDigits(line, 4)) {
+      if (line.compare(0, 4, "UPDA") == 0 && line.size() >= 19) {
+        const int year_updated = atoi(line.substr(8, 4).c_str());
+        const int month_updated = ConvertMonthStringToNumber(line.substr(13, 3));
+        const int day_updated = atoi(line.substr(17, 2).c_str());
+        const double decimal_year_updated = ConvertDateToDecimalYear(year_updated, month_updated, day_updated);
+
+        // After 1.5 month from the update date, the data is updated once per month. So calculate the decimal year of the date
+        const int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        monthly_prediction_start_decimal_year_ = decimal_year_updated + (days_month[month_updated % 12] + 14) / 365.0;
+      }
+      continue;
+    }
+
+    SpaceWeatherRecord record;
+    record.year = (int)ParseColumn(line, 0, 4);
+    record.month = (int)ParseColumn(line, 5, 2);
+    record.day = (int)ParseColumn(line, 8, 2);
+    const double decimal_year = ConvertDateToDecimalYear(record.year, record.month, record.day);
+    if (decimal_year < read_start_decimal_year || decimal_year > read_end_decimal_year) continue;
+    if (line.size() < kRecordLength) {
+      std::cerr << "Space weather record of " << line.substr(0, 10) << " is shorter than " << kRecordLength << " characters and skipped" << std::endl;
+      continue;
+    }
+
+    record.Ap_avg = ParseColumn(line, 80, 3);
+    record.F107_adj = ParseColumn(line, 93, 5);
+    record.Ctr81_adj = ParseColumn(line, 101, 5);
+    record.Lst81_adj = ParseColumn(line, 107, 5);
+    record.F107_obs = ParseColumn(line, 113, 5);
+    record.Ctr81_obs = ParseColumn(line, 119, 5);
+    record.Lst81_obs = ParseColumn(line, 125, 5);
+    records_.push_back(record);
+  }
+
+  // Index the records by the day and the month. The first record is used when the same date appears multiple times.
+  daily_indices_.clear();
+  monthly_indices_.clear();
+  is_cached_ = false;
+  if (records_.empty()) return 0;
+
+  long last_day_number = first_day_number_ = CalcDayNumber(records_[0].year, records_[0].month, records_[0].day);
+  for (const auto& record : records_) {
+    const long day_number = CalcDayNumber(record.year, record.month, record.day);
+    first_day_number_ = std::min(first_day_number_, day_number);
+    last_day_number = std::max(last_day_number, day_number);
+  }
+  int first_year, first_month, last_year, last_month, day;
+  CalcDate(first_day_number_, first_year, first_month, day);
+  CalcDate(last_day_number, last_year, last_month, day);
+  first_month_number_ = (long)first_year * 12 + first_month - 1;
+  const long last_month_number = (long)last_year * 12 + last_month - 1;
+
+  daily_indices_.assign(last_day_number - first_day_number_ + 1, -1);
+  monthly_indices_.assign(last_month_number - first_month_number_ + 1, -1);
+  for (size_t i = 0; i < records_.size(); i++) {
+    const SpaceWeatherRecord& record = records_[i];
+    int& daily_index = daily_indices_[CalcDayNumber(record.year, record.month, record.day) - first_day_number_];
+    if (daily_index < 0) daily_index = (int)i;
+    int& monthly_index = monthly_indices_[(long)record.year * 12 + record.month - 1 - first_month_number_];
+    if (monthly_index < 0) monthly_index = (int)i;
+  }
+
+  return records_.size();
+}
+
+const SpaceWeatherRecord& SpaceWeatherTable::GetRecord(const double decimal_year) const {
+  double fraction_of_day;
+  const long day_number = ConvertDecimalYearToDay(decimal_year, fraction_of_day);
+  const bool is_monthly = decimal_year >= monthly_prediction_start_decimal_year_;
+  if (!is_cached_ || day_number != cached_day_number_ || is_monthly != cached_is_monthly_) {
+    cached_index_ = FindIndex(day_number, is_monthly);
+    is_cached_ = true;
+    cached_day_number_ = day_number;
+    cached_is_monthly_ = is_monthly;
+  }
+  return records_[cached_index_];
+}
+
+void SpaceWeatherTable::GetParameters(const double decimal_year, const bool is_interpolated, double& f107, double& f107_average,
+                                      double& ap) const {
+  const SpaceWeatherRecord& record = GetRecord(decimal_year);
+  f107 = record.F107_adj;
+  f107_average = record.Ctr81_adj;
+  ap = record.Ap_avg;
+  if (!is_interpolated) return;
+
+  double fraction_of_day;
+  const long day_number = ConvertDecimalYearToDay(decimal_year, fraction_of_day);
+  if (fraction_of_day <= 0.0) return;
+  const SpaceWeatherRecord& next_record = records_[FindIndex(day_number + 1, decimal_year >= monthly_prediction_start_decimal_year_)];
+  f107 += (next_record.F107_adj - record.F107_adj) * fraction_of_day;
+  f107_average += (next_record.Ctr81_adj - record.Ctr81_adj) * fraction_of_day;
+  ap += (next_record.Ap_avg - record.Ap_avg) * fraction_of_day;
+}
+
+size_t SpaceWeatherTable::FindIndex(const long day_number, const bool is_monthly) const {
+  int index = -1;
+  if (is_monthly) {
+    int year, month, day;
+    CalcDate(day_number, year, month, day);
+    const long offset = (long)year * 12 + month - 1 - first_month_number_;
+    if (offset >= 0 && offset < (long)monthly_indices_.size()) index = monthly_indices_[offset];
+  } else {
+    const long offset = day_number - first_day_number_;
+    if (offset >= 0 && offset < (long)daily_indices_.size()) index = daily_indices_[offset];
+  }
+  // Same as the legacy linear search, the first record is used when no record matches
+  return index < 0 ? 0 : (size_t)index;
+}
+
+long SpaceWeatherTable::ConvertDecimalYearToDay(const double decimal_year, double& fraction_of_day) {
+  const int year = (int)decimal_year;
+  const double days_per_year = IsLeapYear(year) ? 366.0 : 365.0;
+  const double elapsed_days = (decimal_year - year) * days_per_year;
+  int day_of_year = (int)elapsed_days;
+  fraction_of_day = elapsed_days - day_of_year;
+  // As same as ConvertDecyearToDate in the NRLMSISE-00 wrapper, the elapsed days are used as the day of year,
+  // and the first day covers the first two days.
+  if (day_of_year == 0) {
+    day_of_year = 1;
+    fraction_of_day = 0.0;
+  }
+  return CalcDayNumber(year, 1, 1) + day_of_year - 1;
+}
+
+}  // namespace libra::atmosphere
@@ -0,0 +1,125 @@
+/**
+ * @file space_weather_table.hpp
+ * @brief Day-indexed space weather table for the NRLMSISE-00 atmosphere model
+ */
+
+#ifndef S2E_LIBRARY_ATMOSPHERE_SPACE_WEATHER_TABLE_HPP_
+#define S2E_LIBRARY_ATMOSPHERE_SPACE_WEATHER_TABLE_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace libra::atmosphere {
+
+/**
+ * @struct SpaceWeatherRecord
+ * @brief Space weather parameters of a day
+ * @note Ref: https://celestrak.org/SpaceData/SpaceWx-format.php
+ */
+struct SpaceWeatherRecord {
+  int year;          //!< Year
+  int month;         //!< Month
+  int day;           //!< Day
+  double Ap_avg;     //!< Average of Ap-index (Planetary Equivalent Amplitude) for the day
+  double F107_adj;   //!< F10.7 (10.7-cm Solar Radio Flux) adjusted to 1AU
+  double Ctr81_adj;  //!< Centered 81-day arithmetic average of F10.7 (adjusted)
+  double Lst81_adj;  //!< Last 81-day arithmetic average of F10.7 (adjusted).
+  double F107_obs;   //!< Observed F10.7
+  double Ctr81_obs;  //!< Centered 81-day arithmetic average of F10.7 (observed)
+  double Lst81_obs;  //!< Last 81-day arithmetic average of F10.7 (observed).
+};
+
+/**
+ * @class SpaceWeatherTable
+ * @brief Space weather table with O(1) lookup by the date
+ * @note The records are indexed by the day number and the month number at the reading.
+ *       The index of the last evaluated day is cached since the same day is evaluated many times in the orbit propagation.
+ *       The const getters update the cache without synchronization, so an instance must be read by one thread at a time.
+ *       Each Atmosphere owns its table.
+ */
+class SpaceWeatherTable {
+ public:
+  /**
+   * @fn SpaceWeatherTable
+   * @brief Default constructor
+   */
+  SpaceWeatherTable() {}
+
+  /**
+   * @fn ReadFile
+   * @brief Read the space weather table file
+   * @note The records from a month before the simulation start date to the simulation end date are read.
+   *       A record line shorter than the last column is skipped with an error message.
+   * @param [in] file_path: Path to the SpaceWeather file (Ex: ftp://ftp.agi.com/pub/DynamicEarthData/SpaceWeather-v1.2.txt)
+   * @param [in] start_decimal_year: Decimal year of the simulation start time
+   * @param [in] end_time_s: Simulation end time [sec]
+   * @return Number of the read records
+   */
+  size_t ReadFile(const std::string& file_path, const double start_decimal_year, const double end_time_s);
+
+  /**
+   * @fn GetRecord
+   * @brief Return the record for the time
+   * @note The record of the day is used before the monthly prediction starts. After that, the first record of the month is used.
+   *       The first record is returned when no record matches. The table must not be empty.
+   * @param [in] decimal_year: Decimal year
+   */
+  const SpaceWeatherRecord& GetRecord(const double decimal_year) const;
+  /**
+   * @fn GetParameters
+   * @brief Calculate the parameters for NRLMSISE-00 at the time
+   * @param [in] decimal_year: Decimal year
+   * @param [in] is_interpolated: Flag to interpolate the parameters linearly between the day and the next day
+   * @param [out] f107: Daily F10.7
+   * @param [out] f107_average: Centered 81-day average of F10.7
+   * @param [out] ap: Daily average of Ap-index
+   */
+  void GetParameters(const double decimal_year, const bool is_interpolated, double& f107, double& f107_average, double& ap) const;
+
+  // Getters
+  /**
+   * @fn GetSize
+   * @brief Return number of the records
+   */
+  inline size_t GetSize() const { return records_.size(); }
+  /**
+   * @fn GetMonthlyPredictionStart_decimal_year
+   * @brief Return the decimal year after which the table has only monthly predictions
+   */
+  inline double GetMonthlyPredictionStart_decimal_year() const { return monthly_prediction_start_decimal_year_; }
+
+ private:
+  std::vector<SpaceWeatherRecord> records_;           //!< Records in the file order
+  std::vector<int> daily_indices_;                    //!< Index of records_ for each day from first_day_number_ (-1: no record)
+  std::vector<int> monthly_indices_;                  //!< Index of the first record for each month from first_month_number_ (-1: no record)
+  long first_day_number_ = 0;                         //!< Day number of the first element of daily_indices_
+  long first_month_number_ = 0;                       //!< Month number of the first element of monthly_indices_
+  double monthly_prediction_start_decimal_year_ = 0;  //!< Decimal year after which the first record of the month is used
+
+  // Cache of the last evaluated day
+  mutable bool is_cached_ = false;          //!< Flag to show the cache is valid
+  mutable long cached_day_number_ = 0;      //!< Day number of the last evaluated day
+  mutable bool cached_is_monthly_ = false;  //!< Lookup mode of the last evaluated day
+  mutable size_t cached_index_ = 0;         //!< Index of records_ for the last evaluated day
+
+  /**
+   * @fn FindIndex
+   * @brief Return the index of records_ for the day
+   * @param [in] day_number: Day number of the target day
+   * @param [in] is_monthly: Flag to use the first record of the month
+   */
+  size_t FindIndex(const long day_number, const bool is_monthly) const;
+  /**
+   * @fn ConvertDecimalYearToDay
+   * @brief Convert the decimal year to the day number in the same way as the legacy date conversion for NRLMSISE-00
+   * @param [in] decimal_year: Decimal year
+   * @param [out] fraction_of_day: Elapsed fraction of the day
+   * @return Day number
+   */
+  static long ConvertDecimalYearToDay(const double decimal_year, double& fraction_of_day);
+};
+
+}  // namespace libra::atmosphere
+
+#endif  // S2E_LIBRARY_ATMOSPHERE_SPACE_WEATHER_TABLE_HPP_
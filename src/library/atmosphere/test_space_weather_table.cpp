@@ -0,0 +1,137 @@
+/**
+ * @file test_space_weather_table.cpp
+ * @brief Test codes for SpaceWeatherTable class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "space_weather_table.hpp"
+
+using libra::atmosphere::SpaceWeatherRecord;
+using libra::atmosphere::SpaceWeatherTable;
+
+/**
+ * @brief Make a line of the space weather file with the column format of CelesTrak
+ */
+static std::string MakeLine(const int year, const int month, const int day, const double ap, const double f107) {
+  std::string line(130, ' ');
+  char buffer[16];
+  auto write = [&](const size_t begin, const size_t length, const std::string& value) { line.replace(begin, length, value.substr(0, length)); };
+  snprintf(buffer, sizeof(buffer), "%04d %02d %02d", year, month, day);
+  write(0, 10, buffer);
+  snprintf(buffer, sizeof(buffer), "%3.0f", ap);
+  write(80, 3, buffer);
+  snprintf(buffer, sizeof(buffer), "%5.1f", f107);
+  write(93, 5, buffer);
+  snprintf(buffer, sizeof(buffer), "%5.1f", f107 + 10.0);
+  write(101, 5, buffer);
+  return line;
+}
+
+/**
+ * @brief Decimal year at the middle of the day of year in the same conversion as the table
+ */
+static double CalcDecimalYear(const int year, const int day_of_year) {
+  const double days_per_year = (year % 4 == 0) ? 366.0 : 365.0;
+  return year + (day_of_year + 0.5) / days_per_year;
+}
+
+class SpaceWeatherTableTest : public ::testing::Test {
+ protected:
+  const std::string file_path_ = "test_space_weather_table.txt";
+
+  void SetUp() override {
+    std::ofstream file(file_path_);
+    file << "DATATYPE CelesTrak Space Weather Data" << std::endl;
+    file << "UPDATED 2020 Jan 10 12:00:00 UTC" << std::endl;
+    file << "BEGIN OBSERVED" << std::endl;
+    // F10.7 is 100 + day of month in December, 200 + day in January, 300 + day in February
+    for (int day = 1; day <= 31; day++) file << MakeLine(2019, 12, day, day, 100.0 + day) << std::endl;
+    for (int day = 1; day <= 31; day++) file << MakeLine(2020, 1, day, day, 200.0 + day) << std::endl;
+    for (int day = 1; day <= 29; day++) file << MakeLine(2020, 2, day, day, 300.0 + day) << std::endl;
+    file << "END OBSERVED" << std::endl;
+    file << "BEGIN MONTHLY_PREDICTED" << std::endl;
+    for (int month = 3; month <= 6; month++) file << MakeLine(2020, month, 1, 5.0, 100.0 * month) << std::endl;
+    file << "END MONTHLY_PREDICTED" << std::endl;
+  }
+  void TearDown() override { std::remove(file_path_.c_str()); }
+};
+
+/**
+ * @brief Test the read range and the lookup of the daily and the monthly records
+ */
+TEST_F(SpaceWeatherTableTest, ReadAndLookup) {
+  SpaceWeatherTable table;
+  // Simulation from 2020/1/15 for 100 days
+  // Records from a month before the start date (2019/12/15) to the end date (2020/4/24) are read
+  ASSERT_EQ(17 + 31 + 29 + 2, table.ReadFile(file_path_, CalcDecimalYear(2020, 15), 100.0 * 86400.0));
+
+  // Daily records
+  EXPECT_EQ(20, table.GetRecord(CalcDecimalYear(2020, 20)).day);
+  EXPECT_DOUBLE_EQ(220.0, table.GetRecord(CalcDecimalYear(2020, 20)).F107_adj);
+  EXPECT_DOUBLE_EQ(230.0, table.GetRecord(CalcDecimalYear(2020, 20)).Ctr81_adj);
+  EXPECT_DOUBLE_EQ(20.0, table.GetRecord(CalcDecimalYear(2020, 20)).Ap_avg);
+  EXPECT_DOUBLE_EQ(305.0, table.GetRecord(CalcDecimalYear(2020, 31 + 5)).F107_adj);
+  EXPECT_DOUBLE_EQ(120.0, table.GetRecord(CalcDecimalYear(2019, 365 - 11)).F107_adj);
+
+  // The first record of the month is used after 1.5 month from the update date
+  EXPECT_LT(CalcDecimalYear(2020, 31 + 20), table.GetMonthlyPredictionStart_decimal_year());
+  EXPECT_GT(CalcDecimalYear(2020, 31 + 22), table.GetMonthlyPredictionStart_decimal_year());
+  EXPECT_DOUBLE_EQ(320.0, table.GetRecord(CalcDecimalYear(2020, 31 + 20)).F107_adj);
+  EXPECT_DOUBLE_EQ(301.0, table.GetRecord(CalcDecimalYear(2020, 31 + 25)).F107_adj);
+  EXPECT_DOUBLE_EQ(400.0, table.GetRecord(CalcDecimalYear(2020, 31 + 29 + 31 + 10)).F107_adj);
+
+  // The first record is used when no record matches
+  EXPECT_DOUBLE_EQ(115.0, table.GetRecord(CalcDecimalYear(2020, 31 + 29 + 31 + 30 + 31 + 10)).F107_adj);
+}
+
+/**
+ * @brief Test the linear interpolation of the parameters between days
+ */
+TEST_F(SpaceWeatherTableTest, Interpolation) {
+  SpaceWeatherTable table;
+  ASSERT_LT(0, table.ReadFile(file_path_, CalcDecimalYear(2020, 15), 10.0 * 86400.0));
+
+  double f107, f107_average, ap;
+  const double decimal_year = CalcDecimalYear(2020, 20) - 0.25 / 366.0;
+  table.GetParameters(decimal_year, false, f107, f107_average, ap);
+  EXPECT_DOUBLE_EQ(220.0, f107);
+  EXPECT_DOUBLE_EQ(230.0, f107_average);
+  EXPECT_DOUBLE_EQ(20.0, ap);
+
+  table.GetParameters(decimal_year, true, f107, f107_average, ap);
+  EXPECT_NEAR(220.25, f107, 1e-9);
+  EXPECT_NEAR(230.25, f107_average, 1e-9);
+  EXPECT_NEAR(20.25, ap, 1e-9);
+}
+
+/**
+ * @brief Test that a truncated record line is skipped instead of reading zero
+ */
+TEST_F(SpaceWeatherTableTest, TruncatedRecord) {
+  {
+    std::ofstream file(file_path_, std::ios::app);
+    // Truncated in the column of F10.7
+    file << MakeLine(2020, 7, 1, 5.0, 700.0).substr(0, 95) << std::endl;
+    // Truncated in the last column
+    file << MakeLine(2020, 7, 2, 5.0, 700.0).substr(0, 128) << std::endl;
+    file << MakeLine(2020, 7, 3, 5.0, 703.0) << std::endl;
+  }
+  SpaceWeatherTable table;
+  // Simulation from 2020/6/20 for 20 days
+  ASSERT_EQ(2, table.ReadFile(file_path_, CalcDecimalYear(2020, 31 + 29 + 31 + 30 + 31 + 20), 20.0 * 86400.0));
+  EXPECT_EQ(6, table.GetRecord(CalcDecimalYear(2020, 31 + 29 + 31 + 30 + 31 + 20)).month);
+  EXPECT_DOUBLE_EQ(703.0, table.GetRecord(CalcDecimalYear(2020, 31 + 29 + 31 + 30 + 31 + 30 + 3)).F107_adj);
+}
+
+/**
+ * @brief Test reading a file which does not exist
+ */
+TEST(SpaceWeatherTable, MissingFile) {
+  SpaceWeatherTable table;
+  EXPECT_EQ(0, table.ReadFile("not_existing_file.txt", 2020.0, 86400.0));
+  EXPECT_EQ(0, table.GetSize());
+}
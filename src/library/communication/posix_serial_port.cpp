@@ -0,0 +1,227 @@
+/**
+ * @file posix_serial_port.cpp
+ * @brief Class to manage serial ports and pseudo terminals with POSIX termios on Linux
+ */
+
+#include "posix_serial_port.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/uio.h>
+#include <termios.h>
+#include <unistd.h>
+
+/**
+ * @fn ConvertBaudRate
+ * @brief Convert the baud rate to the termios speed constant
+ * @param [in] baud_rate: Baud rate ex. 9600, 115200
+ * @param [out] speed: Speed constant
+ * @return True when the baud rate is supported
+ */
+static bool ConvertBaudRate(const unsigned int baud_rate, speed_t& speed) {
+  switch (baud_rate) {
+    case 1200:
+      speed = B1200;
+      return true;
+    case 2400:
+      speed = B2400;
+      return true;
+    case 4800:
+      speed = B4800;
+      return true;
+    case 9600:
+      speed = B9600;
+      return true;
+    case 19200:
+      speed = B19200;
+      return true;
+    case 38400:
+      speed = B38400;
+      return true;
+    case 57600:
+      speed = B57600;
+      return true;
+    case 115200:
+      speed = B115200;
+      return true;
+    case 230400:
+      speed = B230400;
+      return true;
+    case 460800:
+      speed = B460800;
+      return true;
+    case 921600:
+      speed = B921600;
+      return true;
+    case 1000000:
+      speed = B1000000;
+      return true;
+    case 2000000:
+      speed = B2000000;
+      return true;
+    default:
+      return false;
+  }
+}
+
+PosixSerialPort::PosixSerialPort(const std::string device_path, const unsigned int baud_rate, const unsigned int rx_buffer_size)
+    : device_path_(device_path), baud_rate_(baud_rate), rx_buffer_(rx_buffer_size + 1) {}
+
+PosixSerialPort::~PosixSerialPort() { Close(); }
+
+int PosixSerialPort::Open() {
+  if (IsOpened()) Close();
+
+  speed_t speed;
+  if (!ConvertBaudRate(baud_rate_, speed)) return -2;
+
+  file_descriptor_ = open(device_path_.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+  if (file_descriptor_ < 0) return -1;
+
+  // Raw 8N1 without flow control
+  struct termios settings;
+  if (tcgetattr(file_descriptor_, &settings) != 0) {
+    Close();
+    return -3;
+  }
+  cfmakeraw(&settings);
+  settings.c_cflag |= (CLOCAL | CREAD);
+  settings.c_cflag &= ~(CSTOPB | CRTSCTS);
+  settings.c_iflag &= ~(IXON | IXOFF | IXANY);
+  settings.c_cc[VMIN] = 0;
+  settings.c_cc[VTIME] = 0;
+  if (cfsetispeed(&settings, speed) != 0 || cfsetospeed(&settings, speed) != 0 || tcsetattr(file_descriptor_, TCSANOW, &settings) != 0) {
+    Close();
+    return -3;
+  }
+  tcflush(file_descriptor_, TCIOFLUSH);
+
+  epoll_descriptor_ = epoll_create1(EPOLL_CLOEXEC);
+  struct epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.fd = file_descriptor_;
+  if (epoll_descriptor_ < 0 || epoll_ctl(epoll_descriptor_, EPOLL_CTL_ADD, file_descriptor_, &event) != 0) {
+    Close();
+    return -4;
+  }
+  epoll_events_ = EPOLLIN;
+
+  rx_buffer_.Clear();
+  return 0;
+}
+
+int PosixSerialPort::Close() {
+  if (!IsOpened()) return -1;
+  if (epoll_descriptor_ >= 0) {
+    close(epoll_descriptor_);
+    epoll_descriptor_ = -1;
+  }
+  close(file_descriptor_);
+  file_descriptor_ = -1;
+  return 0;
+}
+
+int PosixSerialPort::Write(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  if (!IsOpened()) return -1;
+
+  unsigned int written_length = 0;
+  while (written_length < data_length) {
+    const ssize_t ret = write(file_descriptor_, buffer + offset + written_length, data_length - written_length);
+    if (ret > 0) {
+      written_length += (unsigned int)ret;
+    } else if (ret < 0 && errno == EINTR) {
+      continue;
+    } else if (ret < 0 && errno == EAGAIN) {
+      // The kernel buffer is full
+      if (WaitEvent(EPOLLOUT, write_timeout_ms_) != 1) return -1;
+    } else {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int PosixSerialPort::Read(unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  if (!IsOpened()) return -1;
+  if (Poll(0) < 0 && rx_buffer_.GetStoredSize() == 0) return -1;
+  return rx_buffer_.Read(buffer, offset, data_length);
+}
+
+int PosixSerialPort::Poll(const int timeout_ms) {
+  if (!IsOpened()) return -1;
+  const int ret = WaitEvent(EPOLLIN, timeout_ms);
+  if (ret <= 0) return ret;
+  return ReceiveToBuffer();
+}
+
+int PosixSerialPort::GetBytesToRead() {
+  if (!IsOpened()) return -1;
+  Poll(0);
+  return (int)rx_buffer_.GetStoredSize();
+}
+
+int PosixSerialPort::DiscardInBuffer() {
+  if (!IsOpened()) return -1;
+  rx_buffer_.Clear();
+  return tcflush(file_descriptor_, TCIFLUSH) == 0 ? 0 : -1;
+}
+
+int PosixSerialPort::DiscardOutBuffer() {
+  if (!IsOpened()) return -1;
+  return tcflush(file_descriptor_, TCOFLUSH) == 0 ? 0 : -1;
+}
+
+int PosixSerialPort::ReceiveToBuffer() {
+  int received_length = 0;
+  while (true) {
+    byte* regions[2];
+    unsigned int lengths[2];
+    const int region_number = rx_buffer_.GetWritableRegions(regions, lengths);
+    // The remaining data stays in the kernel until the user reads the RX buffer
+    if (region_number <= 0) return received_length;
+
+    struct iovec io_vectors[2];
+    size_t free_length = 0;
+    for (int i = 0; i < region_number; i++) {
+      io_vectors[i].iov_base = regions[i];
+      io_vectors[i].iov_len = lengths[i];
+      free_length += lengths[i];
+    }
+    const ssize_t ret = readv(file_descriptor_, io_vectors, region_number);
+    if (ret > 0) {
+      rx_buffer_.CommitWrite((unsigned int)ret);
+      received_length += (int)ret;
+      if ((size_t)ret < free_length) return received_length;
+    } else if (ret < 0 && errno == EINTR) {
+      continue;
+    } else if (ret == 0 || errno == EAGAIN) {
+      return received_length;
+    } else {
+      // e.g. EIO when the other side of the pseudo terminal is closed
+      return received_length > 0 ? received_length : -1;
+    }
+  }
+}
+
+int PosixSerialPort::WaitEvent(const unsigned int events, const int timeout_ms) {
+  if (events != epoll_events_) {
+    struct epoll_event event = {};
+    event.events = events;
+    event.data.fd = file_descriptor_;
+    if (epoll_ctl(epoll_descriptor_, EPOLL_CTL_MOD, file_descriptor_, &event) != 0) return -1;
+    epoll_events_ = events;
+  }
+
+  struct epoll_event ready_event;
+  int ret;
+  do {
+    ret = epoll_wait(epoll_descriptor_, &ready_event, 1, timeout_ms);
+  } while (ret < 0 && errno == EINTR);
+
+  if (ret < 0) return -1;
+  if (ret == 0) return 0;
+  // A hang up without data is regarded as an error for reading
+  if ((ready_event.events & events) == 0) return -1;
+  return 1;
+}
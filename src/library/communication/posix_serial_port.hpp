@@ -0,0 +1,132 @@
+/**
+ * @file posix_serial_port.hpp
+ * @brief Class to manage serial ports and pseudo terminals with POSIX termios on Linux
+ */
+
+#ifndef S2E_LIBRARY_COMMUNICATION_POSIX_SERIAL_PORT_HPP_
+#define S2E_LIBRARY_COMMUNICATION_POSIX_SERIAL_PORT_HPP_
+
+#include <library/utilities/ring_buffer.hpp>
+#include <string>
+
+/**
+ * @class PosixSerialPort
+ * @brief Class to manage serial ports (e.g. /dev/ttyUSB0) and pseudo terminals (e.g. /dev/pts/3) with POSIX termios
+ * @note The port is opened in the non-blocking raw mode (8N1, no flow control) and watched by epoll.
+ *       The received bytes are read from the kernel directly into the free regions of the RX ring buffer by readv,
+ *       so they are copied only once more when the user reads them.
+ */
+class PosixSerialPort {
+ public:
+  /**
+   * @fn PosixSerialPort
+   * @brief Constructor. This function doesn't open the port. Users need to call Open function after.
+   * @param [in] device_path: Path of the device like "/dev/ttyUSB0"
+   * @param [in] baud_rate: Baud rate ex. 9600, 115200
+   * @param [in] rx_buffer_size: RX buffer size
+   */
+  PosixSerialPort(const std::string device_path, const unsigned int baud_rate, const unsigned int rx_buffer_size);
+  /**
+   * @fn ~PosixSerialPort
+   * @brief Destructor. The port is closed.
+   */
+  ~PosixSerialPort();
+
+  PosixSerialPort(const PosixSerialPort&) = delete;
+  PosixSerialPort& operator=(const PosixSerialPort&) = delete;
+
+  /**
+   * @fn Open
+   * @brief Open and configure the port
+   * @return 0: success, -1: open error, -2: unsupported baud rate, -3: termios error, -4: epoll error
+   */
+  int Open();
+  /**
+   * @fn Close
+   * @brief Close the port
+   * @return 0: success, -1: the port is not opened
+   */
+  int Close();
+  /**
+   * @fn IsOpened
+   * @brief Return true when the port is opened
+   */
+  inline bool IsOpened() const { return file_descriptor_ >= 0; }
+
+  /**
+   * @fn Write
+   * @brief Write data to the port
+   * @note The function waits for the port to become writable up to the write timeout when the kernel buffer is full.
+   * @param [in] buffer: Data buffer to send
+   * @param [in] offset: Start offset for the data buffer to send
+   * @param [in] data_length: Length of data to send
+   * @return 0: success, -1: error or timeout
+   */
+  int Write(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length);
+  /**
+   * @fn Read
+   * @brief Read received data without blocking
+   * @param [out] buffer: Data buffer to store read data
+   * @param [in] offset: Start offset for the data buffer to read
+   * @param [in] data_length: Maximum length of data to read
+   * @return Length of read data (0 when no data is received), -1: error
+   */
+  int Read(unsigned char* buffer, const unsigned int offset, const unsigned int data_length);
+  /**
+   * @fn Poll
+   * @brief Wait for the port to become readable and move the received data into the RX buffer
+   * @param [in] timeout_ms: Timeout [ms]. 0 means to return immediately.
+   * @return Length of the newly received data, -1: error
+   */
+  int Poll(const int timeout_ms);
+  /**
+   * @fn GetBytesToRead
+   * @brief Return length of the received data in the RX buffer after polling without blocking
+   * @return Length of byte to read or -1 when error happened
+   */
+  int GetBytesToRead();
+  /**
+   * @fn DiscardInBuffer
+   * @brief Discard the received data in the RX buffer and the kernel
+   * @return 0: success, -1: error
+   */
+  int DiscardInBuffer();
+  /**
+   * @fn DiscardOutBuffer
+   * @brief Discard the data written but not transmitted yet
+   * @return 0: success, -1: error
+   */
+  int DiscardOutBuffer();
+
+  /**
+   * @fn GetDevicePath
+   * @brief Return the path of the device
+   */
+  inline const std::string& GetDevicePath() const { return device_path_; }
+
+ private:
+  const std::string device_path_;  //!< Path of the device
+  const unsigned int baud_rate_;   //!< Baud rate ex. 9600, 115200
+  int write_timeout_ms_ = 10;      //!< Timeout of writing [ms]
+  int file_descriptor_ = -1;       //!< File descriptor of the port
+  int epoll_descriptor_ = -1;      //!< File descriptor of the epoll instance
+  unsigned int epoll_events_ = 0;  //!< Events currently watched by the epoll instance
+  RingBuffer rx_buffer_;           //!< RX buffer
+
+  /**
+   * @fn ReceiveToBuffer
+   * @brief Read all available data from the port into the free regions of the RX buffer
+   * @return Length of the received data, -1: error
+   */
+  int ReceiveToBuffer();
+  /**
+   * @fn WaitEvent
+   * @brief Wait for the epoll events of the port
+   * @param [in] events: Events to wait (EPOLLIN or EPOLLOUT)
+   * @param [in] timeout_ms: Timeout [ms]
+   * @return 1: the event happened, 0: timeout, -1: error
+   */
+  int WaitEvent(const unsigned int events, const int timeout_ms);
+};
+
+#endif  // S2E_LIBRARY_COMMUNICATION_POSIX_SERIAL_PORT_HPP_
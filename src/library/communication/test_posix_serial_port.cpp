@@ -0,0 +1,115 @@
+/**
+ * @file test_posix_serial_port.cpp
+ * @brief Test codes for PosixSerialPort class with GoogleTest
+ * @note The port is tested with a pseudo terminal loopback instead of a real serial device.
+ */
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <vector>
+
+#include "posix_serial_port.hpp"
+
+/**
+ * @class PseudoTerminal
+ * @brief Master side of a pseudo terminal. The slave side is opened by PosixSerialPort.
+ */
+class PseudoTerminal {
+ public:
+  PseudoTerminal() {
+    master_ = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master_ >= 0 && grantpt(master_) == 0 && unlockpt(master_) == 0) {
+      slave_path_ = ptsname(master_);
+    }
+  }
+  ~PseudoTerminal() {
+    if (master_ >= 0) close(master_);
+  }
+  int master_ = -1;
+  std::string slave_path_;
+};
+
+/**
+ * @brief Test the transfer in both directions through the pseudo terminal
+ */
+TEST(PosixSerialPort, Loopback) {
+  PseudoTerminal terminal;
+  ASSERT_FALSE(terminal.slave_path_.empty());
+
+  PosixSerialPort port(terminal.slave_path_, 115200, 64);
+  EXPECT_FALSE(port.IsOpened());
+  ASSERT_EQ(0, port.Open());
+  EXPECT_TRUE(port.IsOpened());
+
+  // No data
+  unsigned char rx_data[64] = {0};
+  EXPECT_EQ(0, port.Read(rx_data, 0, 64));
+
+  // External device -> S2E
+  const unsigned char command[5] = {0x00, 0x11, 0x0d, 0x0a, 0xff};  // Raw mode keeps CR and LF as they are
+  ASSERT_EQ(5, write(terminal.master_, command, 5));
+  EXPECT_EQ(5, port.Poll(1000));
+  EXPECT_EQ(5, port.GetBytesToRead());
+  EXPECT_EQ(3, port.Read(rx_data, 1, 3));
+  EXPECT_EQ(2, port.Read(rx_data, 4, 10));
+  for (size_t i = 0; i < 5; i++) {
+    EXPECT_EQ(command[i], rx_data[i + 1]);
+  }
+
+  // S2E -> External device
+  const unsigned char telemetry[4] = {0xde, 0xad, 0xbe, 0xef};
+  EXPECT_EQ(0, port.Write(telemetry, 1, 3));
+  unsigned char master_rx[4] = {0};
+  EXPECT_EQ(3, read(terminal.master_, master_rx, 4));
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_EQ(telemetry[i + 1], master_rx[i]);
+  }
+
+  EXPECT_EQ(0, port.Close());
+  EXPECT_EQ(-1, port.Read(rx_data, 0, 64));
+  EXPECT_EQ(-1, port.Close());
+}
+
+/**
+ * @brief Test that the data exceeding the RX buffer waits in the kernel and the order is kept across the wrap around of the ring buffer
+ */
+TEST(PosixSerialPort, RxBufferWrapAround) {
+  PseudoTerminal terminal;
+  ASSERT_FALSE(terminal.slave_path_.empty());
+  PosixSerialPort port(terminal.slave_path_, 9600, 16);
+  ASSERT_EQ(0, port.Open());
+
+  std::vector<unsigned char> sent(40);
+  for (size_t i = 0; i < sent.size(); i++) sent[i] = (unsigned char)i;
+  ASSERT_EQ(40, write(terminal.master_, sent.data(), 40));
+  EXPECT_EQ(16, port.Poll(1000));
+
+  std::vector<unsigned char> received(40);
+  unsigned int received_length = 0;
+  while (received_length < 40) {
+    const int ret = port.Read(received.data(), received_length, 7);
+    ASSERT_LE(0, ret);
+    // The pseudo terminal may pass the data to the slave side asynchronously
+    if (ret == 0) {
+      ASSERT_LT(0, port.Poll(1000));
+    }
+    received_length += ret;
+  }
+  EXPECT_EQ(sent, received);
+  EXPECT_EQ(0, port.GetBytesToRead());
+}
+
+/**
+ * @brief Test the errors of opening
+ */
+TEST(PosixSerialPort, OpenError) {
+  PosixSerialPort no_device("/dev/s2e_no_such_device", 115200, 64);
+  EXPECT_EQ(-1, no_device.Open());
+  EXPECT_EQ(-1, no_device.Write((const unsigned char*)"a", 0, 1));
+
+  PseudoTerminal terminal;
+  PosixSerialPort illegal_baud_rate(terminal.slave_path_, 12345, 64);
+  EXPECT_EQ(-2, illegal_baud_rate.Open());
+}
@@ -12,8 +12,6 @@ extern "C" {
 }
 #include <stdlib.h> /* for malloc/free */
 
-#include <algorithm>
-#include <cctype>
 #include <cmath> /* maths functions */
 #include <environment/global/physical_constants.hpp>
 #include <library/math/constants.hpp>
@@ -27,8 +25,6 @@ using namespace std;
 /* ------------------------------ DEFINES ---------------------------- */
 /* ------------------------------------------------------------------- */
 
-static double decyear_monthly;
-
 int LeapYear(int year) { return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0); }
 
 void ConvertDaysToMonthDay(int days, int is_leap_year, int* month_day) {
@@ -118,55 +114,11 @@ void ConvertDecyearToDate(double decyear, int* date) {
   date[5] = seconds;
 }
 
-double ConvertDateToDecyear(int year, int month, int day) {
-  int is_leap_year = LeapYear(year);
-  int days_per_year = is_leap_year ? 366 : 365;
-
-  int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-  if (is_leap_year) {
-    days_month[1] = 29;
-  }
-
-  double days = (double)accumulate(days_month, days_month + month - 1, 0) + (double)day;
-
-  return (double)year + days / (double)days_per_year;
-}
-
-int ConvertMonthStrToMonthNum(string month_str) {
-  if (month_str == "Jan") {
-    return 1;
-  } else if (month_str == "Feb") {
-    return 2;
-  } else if (month_str == "Mar") {
-    return 3;
-  } else if (month_str == "Apr") {
-    return 4;
-  } else if (month_str == "May") {
-    return 5;
-  } else if (month_str == "Jun") {
-    return 6;
-  } else if (month_str == "Jul") {
-    return 7;
-  } else if (month_str == "Aug") {
-    return 8;
-  } else if (month_str == "Sep") {
-    return 9;
-  } else if (month_str == "Oct") {
-    return 10;
-  } else if (month_str == "Nov") {
-    return 11;
-  } else if (month_str == "Dec") {
-    return 12;
-  } else {
-    return 0;
-  }
-}
-
 /* ------------------------------------------------------------------- */
 /* --------------------------CalcNRLMSISE00--------------------------- */
 /* ------------------------------------------------------------------- */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const vector<nrlmsise_table>& table, bool is_manual_param,
-                      double manual_f107, double manual_f107a, double manual_ap) {
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const libra::atmosphere::SpaceWeatherTable& table,
+                      bool is_manual_param, double manual_f107, double manual_f107a, double manual_ap, bool is_interpolated) {
   struct nrlmsise_output output;
   struct nrlmsise_input input;
   struct nrlmsise_flags flags;
@@ -174,7 +126,6 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
 
   size_t i;
   int date[6];
-  size_t idx = 0;
 
   /* input values */
   for (i = 0; i < 24; i++) {
@@ -198,30 +149,12 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
   } else {
     // f10.7 and ap from table
     // If the table size is zero, return 0
-    if (table.size() == 0) {
+    if (table.GetSize() == 0) {
       return 0.0;
     }
 
-    // search table index
-    for (i = 0; i < table.size(); i++) {
-      if (decyear < decyear_monthly) {
-        // Match year, month, date
-        if ((date[0] == table[i].year) && (date[1] == table[i].month) && (date[2] == table[i].day)) {
-          idx = i;
-          break;
-        }
-      } else {
-        // Match year, month
-        if ((date[0] == table[i].year) && (date[1] == table[i].month)) {
-          idx = i;
-          break;
-        }
-      }
-    }
-
-    input.f107A = table[idx].Ctr81_adj;
-    input.f107 = table[idx].F107_adj;
-    input.ap = table[idx].Ap_avg;
+    // O(1) lookup with the day-indexed table
+    table.GetParameters(decyear, is_interpolated, input.f107, input.f107A, input.ap);
   }
 
   for (i = 0; i < 7; i++) {
@@ -232,76 +165,3 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
   gtd7(&input, &flags, &output);
   return output.d[5];
 }
-
-/* ------------------------------------------------------------------- */
-/* -----------------------ReadSpaceWeatherTable----------------------- */
-/* ------------------------------------------------------------------- */
-size_t GetSpaceWeatherTable_(double decyear, double endsec, const string& filename, vector<nrlmsise_table>& table) {
-  ifstream ifs(filename);
-
-  if (!ifs.is_open()) {
-    cerr << "File open error (SpaceWether.txt)" << endl;
-    return 0;
-  }
-
-  double decyear_ini = decyear;
-  double decyear_end = decyear + endsec / 86400.0 / 365.0;
-  int date_ini[6];
-  int date_end[6];
-
-  ConvertDecyearToDate(decyear_ini, date_ini);
-  ConvertDecyearToDate(decyear_end, date_end);
-
-  if (date_ini[0] < 2015 || date_ini[0] > 2043 || date_end[0] > 2043) {
-    cerr << "Year must be between 2015 and 2043 for NRLMSISE00 atmosphere model" << endl;
-  }
-
-  string line;
-  while (getline(ifs, line)) {
-    nrlmsise_table line_data;
-
-    string year_str = line.substr(0, 4);  // first 4 char
-    if (!std::all_of(year_str.cbegin(), year_str.cend(), ::isdigit) || year_str.empty()) {
-      if (year_str == "UPDA") {
-        int year_updated = atoi(line.substr(8, 4).c_str());
-        string month_updated_str = line.substr(13, 3).c_str();
-        int month_updated = ConvertMonthStrToMonthNum(month_updated_str);
-        int day_updated = atoi(line.substr(17, 2).c_str());
-
-        // Get table update date
-        double decyear_updated = ConvertDateToDecyear(year_updated, month_updated, day_updated);
-
-        // After 1.5 month from the update date, the data is updated once per month. So calculate the decimal year of the date
-        int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-        decyear_monthly = decyear_updated + (days_month[month_updated] + 14) / 365.0;
-      }
-      continue;
-    }
-
-    int year = atoi(year_str.c_str());
-    int month = atoi(line.substr(5, 2).c_str());
-    int day = atoi(line.substr(8, 2).c_str());
-    double decyear_line = ConvertDateToDecyear(year, month, day);
-    // To get 1 month data, read the data before a month from the simulation starting date
-    double decyear_ini_ymd = ConvertDateToDecyear(date_ini[0], date_ini[1], date_ini[2]) - 31.0 / 365.0;  // Subtract one month
-    double decyear_end_ymd = ConvertDateToDecyear(date_end[0], date_end[1], date_end[2]);
-
-    if (decyear_line < decyear_ini_ymd || decyear_line > decyear_end_ymd) continue;
-
-    // Read table data
-    line_data.year = year;
-    line_data.month = month;
-    line_data.day = day;
-    line_data.Ap_avg = atof(line.substr(80, 3).c_str());
-    line_data.F107_adj = atof(line.substr(93, 5).c_str());
-    line_data.Ctr81_adj = atof(line.substr(101, 5).c_str());
-    line_data.Lst81_adj = atof(line.substr(107, 5).c_str());
-    line_data.F107_obs = atof(line.substr(113, 5).c_str());
-    line_data.Ctr81_obs = atof(line.substr(119, 5).c_str());
-    line_data.Lst81_obs = atof(line.substr(125, 5).c_str());
-
-    table.push_back(line_data);
-  }
-
-  return table.size();
-}
@@ -12,23 +12,7 @@
 #include <string>
 #include <vector>
 
-/**
- * @struct nrlmsise_table
- * @brief Parameters for NRLMSISE calculation
- * @note Ref: https://celestrak.org/SpaceData/SpaceWx-format.php
- */
-struct nrlmsise_table {
-  int year;          //!< Year
-  int month;         //!< Month
-  int day;           //!< Day
-  double Ap_avg;     //!< Average of Ap-index (Planetary Equivalent Amplitude) for the day
-  double F107_adj;   //!< F10.7 (10.7-cm Solar Radio Flux) adjusted to 1AU
-  double Ctr81_adj;  //!< Centered 81-day arithmetic average of F10.7 (adjusted)
-  double Lst81_adj;  //!< Last 81-day arithmetic average of F10.7 (adjusted).
-  double F107_obs;   //!< Observed F10.7
-  double Ctr81_obs;  //!< Centered 81-day arithmetic average of F10.7 (observed)
-  double Lst81_obs;  //!< Last 81-day arithmetic average of F10.7 (observed).
-};
+#include "library/atmosphere/space_weather_table.hpp"
 
 /**
  * @fn CalcNRLMSISE00
@@ -42,21 +26,11 @@ struct nrlmsise_table {
  * @param [in] manual_f107: Manual setting F10.7
  * @param [in] manual_f107a: Manual setting averaged F10.7
  * @param [in] manual_ap: Manual setting Ap-index
+ * @param [in] is_interpolated: Flag to interpolate F10.7 and Ap-index in the table between the day and the next day
  * @return Atmospheric density [kg/m3]
  */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const std::vector<nrlmsise_table>& table, bool is_manual_param,
-                      double manual_f107, double manual_f107a, double manual_ap);
-
-/**
- * @fn GetSpaceWeatherTable_
- * @brief Read the space weather table file
- * @param [in] decyear: Decimal year of the simulation start time
- * @param [in] endsec: Simulation end time [sec]
- * @param [in] filename: Path to the SpaceWeather file (Ex: ftp://ftp.agi.com/pub/DynamicEarthData/SpaceWeather-v1.2.txt)
- * @param [out] table: Space weather table
- * @return Size of table
- */
-size_t GetSpaceWeatherTable_(double decyear, double endsec, const std::string& filename, std::vector<nrlmsise_table>& table);
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const libra::atmosphere::SpaceWeatherTable& table,
+                      bool is_manual_param, double manual_f107, double manual_f107a, double manual_ap, bool is_interpolated = false);
 
 /* ------------------------------------------------------------------- */
 /* ----------------------- COMPILATION TWEAKS ------------------------ */
@@ -0,0 +1,285 @@
+/**
+ * @file igrf_model.cpp
+ * @brief Reentrant IGRF (International Geomagnetic Reference Field) model
+ */
+
+#include "igrf_model.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#include "library/external/igrf/igrf.h"
+
+// Constants of the reference ellipsoid and the reference radius used in library/external/igrf
+static const double kEquatorRadius_km = 6378.137;    //!< Equator radius of WGS84 [km]
+static const double kInverseFlattening = 298.25722;  //!< Inverse flattening of WGS84
+static const double kReferenceRadius_km = 6371.2;    //!< Reference radius of the IGRF coefficients [km]
+static const double kMinimumSinTheta = 1.0e-10;      //!< Lower limit of sin(colatitude) to take the limit of the east component at the poles
+
+IgrfModel::IgrfModel(const std::string& coefficient_file_path) {
+  is_loaded_ = ReadCoefficientFile(coefficient_file_path);
+  if (!is_loaded_) {
+    std::cout << "[Warning] IGRF coefficient file cannot be read: " << coefficient_file_path << std::endl;
+    segments_.clear();
+    degree_ = 0;
+  }
+}
+
+std::shared_ptr<const IgrfModel> IgrfModel::GetSharedModel(const std::string& coefficient_file_path) {
+  static std::mutex shared_models_mutex;
+  static std::map<std::string, std::weak_ptr<const IgrfModel>> shared_models;
+
+  std::lock_guard<std::mutex> lock(shared_models_mutex);
+  std::shared_ptr<const IgrfModel> model = shared_models[coefficient_file_path].lock();
+  if (model == nullptr) {
+    model = std::make_shared<const IgrfModel>(coefficient_file_path);
+    shared_models[coefficient_file_path] = model;
+  }
+  return model;
+}
+
+libra::Vector<3> IgrfModel::CalcMagneticField_ned_nT(const double decimal_year, const double latitude_rad, const double longitude_rad,
+                                                     const double altitude_m, double* colatitude_rad) const {
+  double coefficients[kMaxDegree + 1][kMaxDegree + 1];
+  CalcCoefficients(decimal_year, coefficients);
+
+  double magnetic_field_ned_nT[3];
+  double colatitude_tmp_rad;
+  CalcMagneticField_ned_nT(coefficients, latitude_rad, longitude_rad, altitude_m, magnetic_field_ned_nT, colatitude_tmp_rad);
+  if (colatitude_rad != nullptr) *colatitude_rad = colatitude_tmp_rad;
+
+  libra::Vector<3> magnetic_field_nT;
+  for (size_t i = 0; i < 3; i++) magnetic_field_nT[i] = magnetic_field_ned_nT[i];
+  return magnetic_field_nT;
+}
+
+libra::Vector<3> IgrfModel::CalcMagneticField_i_nT(const double decimal_year, const double greenwich_sidereal_time_rad, const double latitude_rad,
+                                                   const double longitude_rad, const double altitude_m) const {
+  double magnetic_field_i_nT[3];
+  CalcMagneticField_i_nT(decimal_year, greenwich_sidereal_time_rad, 1, &latitude_rad, &longitude_rad, &altitude_m, magnetic_field_i_nT);
+
+  libra::Vector<3> magnetic_field_nT;
+  for (size_t i = 0; i < 3; i++) magnetic_field_nT[i] = magnetic_field_i_nT[i];
+  return magnetic_field_nT;
+}
+
+void IgrfModel::CalcMagneticField_i_nT(const double decimal_year, const double greenwich_sidereal_time_rad, const size_t number_of_positions,
+                                       const double* latitude_rad, const double* longitude_rad, const double* altitude_m,
+                                       double* magnetic_field_i_nT) const {
+  double coefficients[kMaxDegree + 1][kMaxDegree + 1];
+  CalcCoefficients(decimal_year, coefficients);
+
+  for (size_t i = 0; i < number_of_positions; i++) {
+    double magnetic_field_ned_nT[3];
+    double colatitude_rad;
+    CalcMagneticField_ned_nT(coefficients, latitude_rad[i], longitude_rad[i], altitude_m[i], magnetic_field_ned_nT, colatitude_rad);
+    TransMagaxisToECI(magnetic_field_ned_nT, &magnetic_field_i_nT[3 * i], longitude_rad[i], colatitude_rad, greenwich_sidereal_time_rad);
+  }
+}
+
+bool IgrfModel::ReadCoefficientFile(const std::string& coefficient_file_path) {
+  std::ifstream file(coefficient_file_path);
+  if (!file.is_open()) return false;
+
+  // Line 1: maximum degree, number of columns, and the valid period
+  std::string line;
+  if (!std::getline(file, line)) return false;
+  int max_degree, number_of_columns;
+  double start_year, end_year;
+  {
+    std::istringstream stream(line);
+    if (!(stream >> max_degree >> number_of_columns >> start_year >> end_year)) return false;
+  }
+  if (max_degree < 1 || max_degree > (int)kMaxDegree || number_of_columns < 2) return false;
+  // The last column is the predictive secular variation
+  const size_t number_of_epochs = (size_t)number_of_columns - 1;
+
+  // Line 2: epochs
+  if (!std::getline(file, line)) return false;
+  std::vector<double> epochs_year(number_of_epochs);
+  {
+    std::istringstream stream(line);
+    std::string label;
+    int n, m;
+    if (!(stream >> label >> n >> m)) return false;
+    for (size_t i = 0; i < number_of_epochs; i++) {
+      if (!(stream >> epochs_year[i])) return false;
+    }
+  }
+
+  // Coefficients: g or h, degree, order, values at each epoch, and the secular variation
+  // values[i][m][n] is a coefficient at the i-th epoch with the layout of Segment. The last one is the secular variation.
+  typedef std::array<std::array<double, kMaxDegree + 1>, kMaxDegree + 1> CoefficientTable;
+  CoefficientTable zero_table;
+  for (auto& row : zero_table) row.fill(0.0);
+  std::vector<CoefficientTable> values(number_of_columns, zero_table);
+  size_t degree = 0;
+  while (std::getline(file, line)) {
+    std::istringstream stream(line);
+    std::string label;
+    int n, m;
+    if (!(stream >> label >> n >> m)) continue;
+    if (n < 1 || n > max_degree || m < 0 || m > n) return false;
+    if (label == "h" && m == 0) return false;
+    if (label != "g" && label != "h") return false;
+
+    for (auto& value : values) {
+      double coefficient;
+      if (!(stream >> coefficient)) return false;
+      if (label == "g") {
+        value[m][n] = coefficient;
+      } else {
+        value[n][m - 1] = coefficient;
+      }
+      if (coefficient != 0.0 && (size_t)n > degree) degree = (size_t)n;
+    }
+  }
+  if (degree == 0) return false;
+  degree_ = degree;
+
+  // Schmidt quasi-normalization factors as same as tcoef in library/external/igrf
+  double factors[kMaxDegree + 1][kMaxDegree + 1];
+  for (size_t n = 0; n <= kMaxDegree; n++) {
+    factors[0][n] = 1.0;
+    double factor = sqrt(2.0);
+    for (size_t m = 1; m <= n; m++) {
+      factor /= sqrt((double)((n + m) * (n - m + 1)));
+      factors[m][n] = factor;
+      factors[n][m - 1] = factor;
+    }
+  }
+
+  segments_.resize(number_of_epochs);
+  for (size_t i = 0; i < number_of_epochs; i++) {
+    Segment& segment = segments_[i];
+    segment.epoch_year = epochs_year[i];
+    const bool is_last = (i == number_of_epochs - 1);
+    const double duration_year = is_last ? 1.0 : epochs_year[i + 1] - epochs_year[i];
+    if (duration_year <= 0.0) return false;
+    for (size_t m = 0; m <= kMaxDegree; m++) {
+      for (size_t n = 0; n <= kMaxDegree; n++) {
+        const double base = values[i][m][n];
+        const double rate = is_last ? values[i + 1][m][n] : (values[i + 1][m][n] - base) / duration_year;
+        segment.base[m][n] = base * factors[m][n];
+        segment.secular_variation[m][n] = rate * factors[m][n];
+      }
+    }
+    segment.base[0][0] = 0.0;
+    segment.secular_variation[0][0] = 0.0;
+  }
+  return true;
+}
+
+void IgrfModel::CalcCoefficients(const double decimal_year, double coefficients[kMaxDegree + 1][kMaxDegree + 1]) const {
+  if (segments_.empty()) {
+    for (size_t m = 0; m <= kMaxDegree; m++) {
+      for (size_t n = 0; n <= kMaxDegree; n++) coefficients[m][n] = 0.0;
+    }
+    return;
+  }
+
+  // Select the latest epoch before the time. The first epoch is used for the time before it.
+  size_t segment_id = 0;
+  while (segment_id + 1 < segments_.size() && segments_[segment_id + 1].epoch_year <= decimal_year) segment_id++;
+  const Segment& segment = segments_[segment_id];
+
+  // Only the coefficients up to the maximum degree are used in the calculation
+  const double elapsed_year = decimal_year - segment.epoch_year;
+  for (size_t m = 0; m <= degree_; m++) {
+    for (size_t n = 0; n <= degree_; n++) {
+      coefficients[m][n] = segment.base[m][n] + segment.secular_variation[m][n] * elapsed_year;
+    }
+  }
+}
+
+void IgrfModel::CalcMagneticField_ned_nT(const double coefficients[kMaxDegree + 1][kMaxDegree + 1], const double latitude_rad,
+                                         const double longitude_rad, const double altitude_m, double magnetic_field_ned_nT[3],
+                                         double& colatitude_rad) const {
+  const size_t degree = degree_;
+
+  // Geodetic to geocentric as same as mfldg in library/external/igrf
+  const double polar_radius_km = kEquatorRadius_km * (1.0 - 1.0 / kInverseFlattening);
+  const double equator_radius2 = kEquatorRadius_km * kEquatorRadius_km;
+  const double polar_radius2 = polar_radius_km * polar_radius_km;
+  const double altitude_km = altitude_m / 1000.0;
+  const double sin_latitude = sin(latitude_rad);
+  const double sin_latitude2 = sin_latitude * sin_latitude;
+  const double cos_latitude2 = 1.0 - sin_latitude2;
+  const double curvature_radius2 = equator_radius2 * cos_latitude2 + polar_radius2 * sin_latitude2;
+  const double curvature_radius_km = sqrt(curvature_radius2);
+  const double radius_base2 = (equator_radius2 * equator_radius2 * cos_latitude2 + polar_radius2 * polar_radius2 * sin_latitude2) / curvature_radius2;
+  const double radius_km = sqrt(radius_base2 + 2.0 * altitude_km * curvature_radius_km + altitude_km * altitude_km);
+  const double cos_theta = std::min(1.0, std::max(-1.0, sin_latitude * (altitude_km + polar_radius2 / curvature_radius_km) / radius_km));
+  // At the poles, the field is evaluated at the colatitude of kMinimumSinTheta on the meridian to avoid the division by zero for the east component
+  const double sin_theta = std::max(sqrt(std::max(0.0, 1.0 - cos_theta * cos_theta)), kMinimumSinTheta);
+  const double cos_phi = cos(longitude_rad);
+  const double sin_phi = sin(longitude_rad);
+  colatitude_rad = acos(cos_theta);
+
+  // Work variables
+  double radius_ratio[kMaxDegree + 1];
+  // Associated Legendre functions P(n, m) without the normalization and their derivatives with respect to the colatitude at [m][n]
+  double legendre[kMaxDegree + 2][kMaxDegree + 1];
+  double legendre_derivative[kMaxDegree + 1][kMaxDegree + 1];
+  double cos_m_phi[kMaxDegree + 1];
+  double sin_m_phi[kMaxDegree + 1];
+
+  const double t = kReferenceRadius_km / radius_km;
+  radius_ratio[0] = t * t;
+  for (size_t n = 0; n < degree; n++) radius_ratio[n + 1] = radius_ratio[n] * t;
+
+  // The legacy fcalc increases the order m with a division by sin(theta) at each step, and the rounding errors are amplified
+  // near the poles. Here the degree n is increased for each order m, which is stable at any colatitude.
+  for (size_t m = 0; m <= degree + 1; m++) {
+    for (size_t n = 0; n <= degree; n++) legendre[m][n] = 0.0;
+  }
+  legendre[0][0] = 1.0;
+  for (size_t m = 0; m <= degree; m++) {
+    if (m > 0) legendre[m][m] = legendre[m - 1][m - 1] * (2 * m - 1) * sin_theta;
+    if (m < degree) legendre[m][m + 1] = legendre[m][m] * (2 * m + 1) * cos_theta;
+    for (size_t n = m + 2; n <= degree; n++) {
+      legendre[m][n] = (legendre[m][n - 1] * cos_theta * (2 * n - 1) - legendre[m][n - 2] * (n + m - 1)) / (n - m);
+    }
+  }
+  for (size_t n = 0; n <= degree; n++) {
+    legendre_derivative[0][n] = -legendre[1][n];
+    for (size_t m = 1; m <= n; m++) {
+      legendre_derivative[m][n] = 0.5 * (legendre[m - 1][n] * (n + m) * (n - m + 1) - legendre[m + 1][n]);
+    }
+  }
+
+  cos_m_phi[0] = 1.0;
+  sin_m_phi[0] = 0.0;
+  for (size_t m = 0; m < degree; m++) {
+    cos_m_phi[m + 1] = cos_m_phi[m] * cos_phi - sin_m_phi[m] * sin_phi;
+    sin_m_phi[m + 1] = sin_m_phi[m] * cos_phi + cos_m_phi[m] * sin_phi;
+  }
+
+  double x = 0.0, y = 0.0, z = 0.0;
+  for (size_t n = 1; n <= degree; n++) {
+    double tx = coefficients[0][n] * legendre_derivative[0][n];
+    double ty = 0.0;
+    double tz = coefficients[0][n] * legendre[0][n];
+    for (size_t m = 1; m <= n; m++) {
+      const double g = coefficients[m][n];
+      const double h = coefficients[n][m - 1];
+      tx += (g * cos_m_phi[m] + h * sin_m_phi[m]) * legendre_derivative[m][n];
+      ty += (g * sin_m_phi[m] - h * cos_m_phi[m]) * legendre[m][n] * m;
+      tz += (g * cos_m_phi[m] + h * sin_m_phi[m]) * legendre[m][n];
+    }
+    x += radius_ratio[n] * tx;
+    y += radius_ratio[n] * ty;
+    z -= radius_ratio[n] * tz * (n + 1);
+  }
+  y /= sin_theta;
+
+  magnetic_field_ned_nT[0] = x;
+  magnetic_field_ned_nT[1] = y;
+  magnetic_field_ned_nT[2] = z;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file igrf_model.hpp
+ * @brief Reentrant IGRF (International Geomagnetic Reference Field) model
+ */
+
+#ifndef S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_HPP_
+#define S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "library/math/vector.hpp"
+
+/**
+ * @class IgrfModel
+ * @brief Reentrant IGRF model
+ * @note The coefficient file (e.g., igrf13.coef) is read once in the constructor, and the object is immutable after that.
+ *       All calculation functions are const and use only local variables, so an object can be shared by multiple threads.
+ *       The coefficients and the coordinates are the same as library/external/igrf (https://www.gsj.jp/data/openfile/no0423/index.html),
+ *       but the epochs for the interpolation are selected at every call instead of only at the first call.
+ */
+class IgrfModel {
+ public:
+  static const size_t kMaxDegree = 19;  //!< Maximum degree of the coefficients which can be handled
+
+  /**
+   * @fn IgrfModel
+   * @brief Constructor
+   * @param [in] coefficient_file_path: Path to the IGRF coefficient file
+   */
+  explicit IgrfModel(const std::string& coefficient_file_path);
+
+  /**
+   * @fn GetSharedModel
+   * @brief Return the model shared in the process for the coefficient file
+   * @note The coefficient file is read only at the first call for each path. This function is thread-safe.
+   * @param [in] coefficient_file_path: Path to the IGRF coefficient file
+   */
+  static std::shared_ptr<const IgrfModel> GetSharedModel(const std::string& coefficient_file_path);
+
+  /**
+   * @fn CalcMagneticField_ned_nT
+   * @brief Calculate the magnetic field in the local North-East-Down frame
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] latitude_rad: Geodetic latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   * @param [in] altitude_m: Altitude from the WGS84 ellipsoid [m]
+   * @param [out] colatitude_rad: Geocentric colatitude [rad]
+   * @return Magnetic field vector in the NED frame (the down direction is to the geocenter) [nT]
+   */
+  libra::Vector<3> CalcMagneticField_ned_nT(const double decimal_year, const double latitude_rad, const double longitude_rad,
+                                            const double altitude_m, double* colatitude_rad = nullptr) const;
+  /**
+   * @fn CalcMagneticField_i_nT
+   * @brief Calculate the magnetic field in the inertial frame
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] greenwich_sidereal_time_rad: Greenwich mean sidereal time [rad]
+   * @param [in] latitude_rad: Geodetic latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   * @param [in] altitude_m: Altitude from the WGS84 ellipsoid [m]
+   * @return Magnetic field vector in the inertial frame [nT]
+   */
+  libra::Vector<3> CalcMagneticField_i_nT(const double decimal_year, const double greenwich_sidereal_time_rad, const double latitude_rad,
+                                          const double longitude_rad, const double altitude_m) const;
+  /**
+   * @fn CalcMagneticField_i_nT
+   * @brief Calculate the magnetic field in the inertial frame at multiple positions at the same time
+   * @note The coefficients are interpolated in time only once for all positions
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] greenwich_sidereal_time_rad: Greenwich mean sidereal time [rad]
+   * @param [in] number_of_positions: Number of positions
+   * @param [in] latitude_rad: Geodetic latitude of the positions [rad]
+   * @param [in] longitude_rad: Longitude of the positions [rad]
+   * @param [in] altitude_m: Altitude of the positions from the WGS84 ellipsoid [m]
+   * @param [out] magnetic_field_i_nT: Magnetic field vectors in the inertial frame (x, y, z for each position) [nT]
+   */
+  void CalcMagneticField_i_nT(const double decimal_year, const double greenwich_sidereal_time_rad, const size_t number_of_positions,
+                              const double* latitude_rad, const double* longitude_rad, const double* altitude_m, double* magnetic_field_i_nT) const;
+
+  // Getters
+  /**
+   * @fn IsLoaded
+   * @brief Return true when the coefficient file is read successfully
+   */
+  inline bool IsLoaded() const { return is_loaded_; }
+  /**
+   * @fn GetDegree
+   * @brief Return maximum degree of the coefficients
+   */
+  inline size_t GetDegree() const { return degree_; }
+
+ private:
+  /**
+   * @struct Segment
+   * @brief Coefficients to calculate the Schmidt quasi-normalized coefficients with linear time interpolation
+   * @note The layout is the same as library/external/igrf: coefficients[m][n] is g(n, m) and coefficients[n][m - 1] is h(n, m)
+   */
+  struct Segment {
+    double epoch_year;                                         //!< Epoch of the base coefficients [year]
+    double base[kMaxDegree + 1][kMaxDegree + 1];               //!< Coefficients at the epoch [nT]
+    double secular_variation[kMaxDegree + 1][kMaxDegree + 1];  //!< Time derivatives of the coefficients [nT/year]
+  };
+
+  bool is_loaded_ = false;         //!< Flag to show the coefficient file is read
+  size_t degree_ = 0;              //!< Maximum degree of the coefficients
+  std::vector<Segment> segments_;  //!< Coefficients for each epoch. The last segment uses the predictive secular variation.
+
+  /**
+   * @fn ReadCoefficientFile
+   * @brief Read the coefficient file
+   * @param [in] coefficient_file_path: Path to the IGRF coefficient file
+   * @return True when the file is read successfully
+   */
+  bool ReadCoefficientFile(const std::string& coefficient_file_path);
+  /**
+   * @fn CalcCoefficients
+   * @brief Calculate the coefficients at the time
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [out] coefficients: Coefficients at the time
+   */
+  void CalcCoefficients(const double decimal_year, double coefficients[kMaxDegree + 1][kMaxDegree + 1]) const;
+  /**
+   * @fn CalcMagneticField_ned_nT
+   * @brief Calculate the magnetic field in the local North-East-Down frame with the given coefficients
+   * @param [in] coefficients: Coefficients at the time
+   * @param [in] latitude_rad: Geodetic latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   * @param [in] altitude_m: Altitude from the WGS84 ellipsoid [m]
+   * @param [out] magnetic_field_ned_nT: Magnetic field vector in the NED frame [nT]
+   * @param [out] colatitude_rad: Geocentric colatitude [rad]
+   */
+  void CalcMagneticField_ned_nT(const double coefficients[kMaxDegree + 1][kMaxDegree + 1], const double latitude_rad, const double longitude_rad,
+                                const double altitude_m, double magnetic_field_ned_nT[3], double& colatitude_rad) const;
+};
+
+#endif  // S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_HPP_
@@ -0,0 +1,103 @@
+/**
+ * @file test_igrf_model.cpp
+ * @brief Test codes for IgrfModel class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "igrf_model.hpp"
+#include "library/external/igrf/igrf.h"
+
+static const std::string kCoefficientFilePath = CORE_DIR_FROM_EXE + std::string("/src/library/external/igrf/igrf13.coef");
+
+/**
+ * @brief Test that the model gives the same results with the legacy IGRF functions
+ */
+TEST(IgrfModel, CompareWithLegacyFunctions) {
+  IgrfModel igrf_model(kCoefficientFilePath);
+  ASSERT_TRUE(igrf_model.IsLoaded());
+  EXPECT_EQ(13, igrf_model.GetDegree());
+
+  // The legacy functions select the epoch at the first call only
+  // The positions are apart from the poles since the legacy functions lose the accuracy near the poles
+  const double decimal_year = 2023.5;
+  const double greenwich_sidereal_time_rad = 1.2;
+  set_file_path(kCoefficientFilePath.c_str());
+
+  const size_t kNumberOfPositions = 5;
+  const double latitude_rad[kNumberOfPositions] = {0.0, 0.6, -1.2, 1.1, -0.3};
+  const double longitude_rad[kNumberOfPositions] = {0.0, 2.5, -1.0, 0.3, -3.0};
+  const double altitude_m[kNumberOfPositions] = {0.0, 400.0e3, 800.0e3, 20000.0e3, 36000.0e3};
+  for (size_t i = 0; i < kNumberOfPositions; i++) {
+    double legacy_magnetic_field_i_nT[3];
+    IgrfCalc(decimal_year, latitude_rad[i], longitude_rad[i], altitude_m[i], greenwich_sidereal_time_rad, legacy_magnetic_field_i_nT);
+    const libra::Vector<3> magnetic_field_i_nT =
+        igrf_model.CalcMagneticField_i_nT(decimal_year, greenwich_sidereal_time_rad, latitude_rad[i], longitude_rad[i], altitude_m[i]);
+
+    const double accuracy_nT = 1e-9 * magnetic_field_i_nT.CalcNorm();
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_NEAR(legacy_magnetic_field_i_nT[axis], magnetic_field_i_nT[axis], accuracy_nT);
+    }
+  }
+}
+
+/**
+ * @brief Test that the magnetic field is continuous near the poles
+ */
+TEST(IgrfModel, NearPoles) {
+  IgrfModel igrf_model(kCoefficientFilePath);
+  ASSERT_TRUE(igrf_model.IsLoaded());
+
+  const double decimal_year = 2023.5;
+  const double altitude_m = 300.0e3;
+  for (double latitude_rad : {1.5, -1.5, 1.5707, -1.5707}) {
+    const libra::Vector<3> magnetic_field_ned_nT = igrf_model.CalcMagneticField_ned_nT(decimal_year, latitude_rad, 0.4, altitude_m);
+    const libra::Vector<3> shifted_magnetic_field_ned_nT = igrf_model.CalcMagneticField_ned_nT(decimal_year, latitude_rad + 1e-12, 0.4, altitude_m);
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_NEAR(magnetic_field_ned_nT[axis], shifted_magnetic_field_ned_nT[axis], 1e-3);
+    }
+  }
+
+  // Exactly at the poles, the field is the limit along the meridian
+  const double half_pi_rad = 2.0 * atan(1.0);
+  for (double latitude_rad : {half_pi_rad, -half_pi_rad}) {
+    const libra::Vector<3> magnetic_field_ned_nT = igrf_model.CalcMagneticField_ned_nT(decimal_year, latitude_rad, 0.4, altitude_m);
+    const double near_latitude_rad = latitude_rad > 0.0 ? latitude_rad - 1e-9 : latitude_rad + 1e-9;
+    const libra::Vector<3> near_magnetic_field_ned_nT = igrf_model.CalcMagneticField_ned_nT(decimal_year, near_latitude_rad, 0.4, altitude_m);
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_TRUE(std::isfinite(magnetic_field_ned_nT[axis]));
+      EXPECT_NEAR(near_magnetic_field_ned_nT[axis], magnetic_field_ned_nT[axis], 1e-2);
+    }
+  }
+}
+
+/**
+ * @brief Test that the batch calculation gives the same results with the calculation for each position
+ */
+TEST(IgrfModel, Batch) {
+  std::shared_ptr<const IgrfModel> igrf_model = IgrfModel::GetSharedModel(kCoefficientFilePath);
+  ASSERT_TRUE(igrf_model->IsLoaded());
+  EXPECT_EQ(igrf_model, IgrfModel::GetSharedModel(kCoefficientFilePath));
+
+  const double decimal_year = 2012.3;
+  const double greenwich_sidereal_time_rad = -0.7;
+  const size_t kNumberOfPositions = 3;
+  const double latitude_rad[kNumberOfPositions] = {0.2, -0.9, 1.3};
+  const double longitude_rad[kNumberOfPositions] = {-2.0, 1.1, 3.1};
+  const double altitude_m[kNumberOfPositions] = {500.0e3, 0.0, 1500.0e3};
+
+  double magnetic_field_i_nT[3 * kNumberOfPositions];
+  igrf_model->CalcMagneticField_i_nT(decimal_year, greenwich_sidereal_time_rad, kNumberOfPositions, latitude_rad, longitude_rad, altitude_m,
+                                     magnetic_field_i_nT);
+  for (size_t i = 0; i < kNumberOfPositions; i++) {
+    const libra::Vector<3> expected_i_nT =
+        igrf_model->CalcMagneticField_i_nT(decimal_year, greenwich_sidereal_time_rad, latitude_rad[i], longitude_rad[i], altitude_m[i]);
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_DOUBLE_EQ(expected_i_nT[axis], magnetic_field_i_nT[3 * i + axis]);
+    }
+  }
+
+  IgrfModel missing_model("not_existing_file.coef");
+  EXPECT_FALSE(missing_model.IsLoaded());
+}
@@ -0,0 +1,102 @@
+/**
+ * @file benchmark_gravity_potential.cpp
+ * @brief Benchmark of GravityPotential for various degrees
+ * @note Usage: benchmark_gravity_potential [number_of_evaluations_at_degree_10]
+ *       All instruction sets supported by the running CPU are measured.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gravity_potential.hpp"
+
+/**
+ * @fn MakeCoefficients
+ * @brief Make coefficients which have the same order of magnitude as normalized geopotential coefficients
+ */
+std::vector<std::vector<double>> MakeCoefficients(const size_t degree, const double phase) {
+  std::vector<std::vector<double>> coefficients(degree + 1, std::vector<double>(degree + 1, 0.0));
+  for (size_t n = 2; n <= degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      coefficients[n][m] = 1.0e-6 * sin((double)(n * 31 + m * 17) + phase) / (double)n;
+    }
+  }
+  return coefficients;
+}
+
+int main(int argc, char* argv[]) {
+  size_t number_of_evaluations_at_degree_10 = 200000;
+  if (argc > 1) number_of_evaluations_at_degree_10 = std::strtoul(argv[1], nullptr, 10);
+  const std::vector<size_t> degrees = {2, 5, 10, 20, 50, 100, 150, 200, 250, 300, 360};
+
+  const std::vector<std::pair<GravityPotentialSimdLevel, std::string>> simd_levels = {
+      {GravityPotentialSimdLevel::kScalar, "Scalar"}, {GravityPotentialSimdLevel::kAvx2, "AVX2"}, {GravityPotentialSimdLevel::kAvx512, "AVX-512"}};
+
+  for (const auto& simd_level : simd_levels) {
+    if ((int)simd_level.first > (int)DetectGravityPotentialSimdLevel()) continue;
+    std::cout << "Instruction set: " << simd_level.second << std::endl;
+    std::cout << std::setw(8) << "degree" << std::setw(14) << "evaluations" << std::setw(20) << "acceleration[us]" << std::setw(20)
+              << "partial[us]" << std::setw(20) << "batch[us]" << std::endl;
+
+    double checksum = 0.0;
+    for (auto degree : degrees) {
+      GravityPotential gravity_potential(degree, MakeCoefficients(degree, 0.0), MakeCoefficients(degree, 1.0));
+      gravity_potential.SetSimdLevel(simd_level.first);
+      // Keep the total amount of calculation almost constant
+      size_t number_of_evaluations = number_of_evaluations_at_degree_10 * 100 / (degree * degree);
+      if (number_of_evaluations < 10) number_of_evaluations = 10;
+
+      libra::Vector<3> position_xcxf_m;
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < number_of_evaluations; i++) {
+        const double angle_rad = 1.0e-3 * (double)i;
+        position_xcxf_m[0] = 6878137.0 * cos(angle_rad);
+        position_xcxf_m[1] = 6878137.0 * sin(angle_rad) * 0.7;
+        position_xcxf_m[2] = 6878137.0 * sin(angle_rad) * 0.7;
+        checksum += gravity_potential.CalcAcceleration_xcxf_m_s2(position_xcxf_m)[0];
+      }
+      auto end = std::chrono::steady_clock::now();
+      const double acceleration_time_us = std::chrono::duration<double, std::micro>(end - start).count() / (double)number_of_evaluations;
+
+      start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < number_of_evaluations; i++) {
+        const double angle_rad = 1.0e-3 * (double)i;
+        position_xcxf_m[0] = 6878137.0 * cos(angle_rad);
+        position_xcxf_m[1] = 6878137.0 * sin(angle_rad) * 0.7;
+        position_xcxf_m[2] = 6878137.0 * sin(angle_rad) * 0.7;
+        checksum += gravity_potential.CalcPartialDerivative_xcxf_s2(position_xcxf_m)[0][0];
+      }
+      end = std::chrono::steady_clock::now();
+      const double partial_time_us = std::chrono::duration<double, std::micro>(end - start).count() / (double)number_of_evaluations;
+
+      // Batch calculation of the same positions
+      std::vector<double> position_x_m(number_of_evaluations), position_y_m(number_of_evaluations), position_z_m(number_of_evaluations);
+      std::vector<double> acceleration_x_m_s2(number_of_evaluations), acceleration_y_m_s2(number_of_evaluations),
+          acceleration_z_m_s2(number_of_evaluations);
+      for (size_t i = 0; i < number_of_evaluations; i++) {
+        const double angle_rad = 1.0e-3 * (double)i;
+        position_x_m[i] = 6878137.0 * cos(angle_rad);
+        position_y_m[i] = 6878137.0 * sin(angle_rad) * 0.7;
+        position_z_m[i] = 6878137.0 * sin(angle_rad) * 0.7;
+      }
+      start = std::chrono::steady_clock::now();
+      gravity_potential.CalcAcceleration_xcxf_m_s2(number_of_evaluations, position_x_m.data(), position_y_m.data(), position_z_m.data(),
+                                                   acceleration_x_m_s2.data(), acceleration_y_m_s2.data(), acceleration_z_m_s2.data());
+      end = std::chrono::steady_clock::now();
+      const double batch_time_us = std::chrono::duration<double, std::micro>(end - start).count() / (double)number_of_evaluations;
+      for (size_t i = 0; i < number_of_evaluations; i++) checksum += acceleration_x_m_s2[i];
+
+      std::cout << std::setw(8) << degree << std::setw(14) << number_of_evaluations << std::setw(20) << acceleration_time_us << std::setw(20)
+                << partial_time_us << std::setw(20) << batch_time_us << std::endl;
+    }
+    std::cout << "checksum: " << checksum << std::endl;
+  }
+
+  return 0;
+}
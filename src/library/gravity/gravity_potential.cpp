@@ -5,273 +5,458 @@
 
 #include "gravity_potential.hpp"
 
-#include <chrono>
+#include <algorithm>
 #include <cmath>
-#include <fstream>
-#include <iostream>
+
+/**
+ * @fn CalcTriangularIndex
+ * @brief Return index of (n, m) in the triangular layout
+ */
+static inline size_t CalcTriangularIndex(const size_t n, const size_t m) { return n * (n + 1) / 2 + m; }
+
+/**
+ * @fn CalcTriangularSize
+ * @brief Return number of elements in the triangular layout up to the degree
+ */
+static inline size_t CalcTriangularSize(const size_t degree) { return (degree + 1) * (degree + 2) / 2; }
 
 GravityPotential::GravityPotential(const size_t degree, const std::vector<std::vector<double>> cosine_coefficients,
                                    const std::vector<std::vector<double>> sine_coefficients, const double gravity_constants_m3_s2,
                                    const double center_body_radius_m)
-    : degree_(degree),
-      c_(cosine_coefficients),
-      s_(sine_coefficients),
-      gravity_constants_m3_s2_(gravity_constants_m3_s2),
-      center_body_radius_m_(center_body_radius_m) {
+    : degree_(degree), gravity_constants_m3_s2_(gravity_constants_m3_s2), center_body_radius_m_(center_body_radius_m) {
   // degree
   if (degree_ <= 1) {  // TODO: Consider this assertion is needed
     degree_ = 0;
+    return;
   }
-  // coefficients
-  // TODO Check size
-}
 
-libra::Vector<3> GravityPotential::CalcAcceleration_xcxf_m_s2(const libra::Vector<3> &position_xcxf_m) {
-  libra::Vector<3> acceleration_xcxf_m_s2(0.0);
-  if (degree_ <= 0) return acceleration_xcxf_m_s2;  // TODO: Consider this assertion is needed
-
-  xcxf_x_m_ = position_xcxf_m[0];
-  xcxf_y_m_ = position_xcxf_m[1];
-  xcxf_z_m_ = position_xcxf_m[2];
-  radius_m_ = position_xcxf_m.CalcNorm();
+  // Coefficients
+  const size_t size = CalcTriangularSize(degree_);
+  c_.assign(size, 0.0);
+  s_.assign(size, 0.0);
+  for (size_t n = 0; n <= degree_ && n < cosine_coefficients.size() && n < sine_coefficients.size(); n++) {
+    for (size_t m = 0; m <= n && m < cosine_coefficients[n].size() && m < sine_coefficients[n].size(); m++) {
+      c_[CalcTriangularIndex(n, m)] = cosine_coefficients[n][m];
+      s_[CalcTriangularIndex(n, m)] = sine_coefficients[n][m];
+    }
+  }
 
-  // Calc V and W
-  const size_t degree_vw = degree_ + 1;
-  std::vector<std::vector<double>> v(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  std::vector<std::vector<double>> w(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  // n = m = 0
-  v[0][0] = center_body_radius_m_ / radius_m_;
-  w[0][0] = 0.0;
-  m_ = 0;
-
-  while (m_ < degree_vw) {
-    for (n_ = m_ + 1; n_ <= degree_vw; n_++) {
-      if (n_ <= m_ + 1) {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], 0.0, 0.0);
+  // V/W recursion (The partial derivative requires V and W up to degree_ + 2)
+  const size_t degree_vw = degree_ + 2;
+  const size_t size_vw = CalcTriangularSize(degree_vw);
+  vw_diagonal_.assign(size_vw, 0.0);
+  vw_previous_.assign(size_vw, 0.0);
+  vw_previous2_.assign(size_vw, 0.0);
+  for (size_t n = 1; n <= degree_vw; n++) {
+    const double n_d = (double)n;
+    if (n == 1) {
+      vw_diagonal_[CalcTriangularIndex(n, n)] = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
+    } else {
+      vw_diagonal_[CalcTriangularIndex(n, n)] = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+    }
+    for (size_t m = 0; m < n; m++) {
+      const double m_d = (double)m;
+      const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
+      const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
+      const double c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+      double c2_normalize;
+      if (n <= 1) {
+        c2_normalize = 1.0;
       } else {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], v[n_ - 2][m_], w[n_ - 2][m_]);
+        c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
       }
+      vw_previous_[CalcTriangularIndex(n, m)] = c_normalize * c1;
+      vw_previous2_[CalcTriangularIndex(n, m)] = c_normalize * c2 * c2_normalize;
     }
-    // next step
-    m_++;
-    n_ = m_;
-    v_w_nn_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_ - 1], w[n_ - 1][m_ - 1]);
   }
 
-  // Calc Acceleration
-  for (n_ = 0; n_ <= degree_; n_++)  // this loop can integrate with previous loop
-  {
-    m_ = 0;
-    const double n_d = (double)n_;
+  // Acceleration
+  acceleration_xy_plus_.assign(size, 0.0);
+  acceleration_xy_minus_.assign(size, 0.0);
+  acceleration_z_.assign(size, 0.0);
+  for (size_t n = 0; n <= degree_; n++) {
+    const double n_d = (double)n;
     const double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
-    const double normalize_xy = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
-    // m_==0
-    acceleration_xcxf_m_s2[0] += -c_[n_][0] * v[n_ + 1][1] * normalize_xy;
-    acceleration_xcxf_m_s2[1] += -c_[n_][0] * w[n_ + 1][1] * normalize_xy;
-    acceleration_xcxf_m_s2[2] += (n_ + 1.0) * (-c_[n_][0] * v[n_ + 1][0] - s_[n_][0] * w[n_ + 1][0]) * normalize;
-    for (m_ = 1; m_ <= n_; m_++) {
-      const double m_d = (double)m_;
+    // m = 0
+    acceleration_xy_plus_[CalcTriangularIndex(n, 0)] = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+    acceleration_z_[CalcTriangularIndex(n, 0)] = (n_d + 1.0) * normalize;
+    for (size_t m = 1; m <= n; m++) {
+      const double m_d = (double)m;
       const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
       const double normalize_xy1 = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
       double normalize_xy2;
-      if (m_ == 1) {
+      if (m == 1) {
         normalize_xy2 = normalize * sqrt(factorial) * sqrt(2.0);
       } else {
         normalize_xy2 = normalize * sqrt(factorial);
       }
       const double normalize_z = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
-
-      acceleration_xcxf_m_s2[0] += 0.5 * (normalize_xy1 * (-c_[n_][m_] * v[n_ + 1][m_ + 1] - s_[n_][m_] * w[n_ + 1][m_ + 1]) +
-                                          normalize_xy2 * (c_[n_][m_] * v[n_ + 1][m_ - 1] + s_[n_][m_] * w[n_ + 1][m_ - 1]));
-      acceleration_xcxf_m_s2[1] += 0.5 * (normalize_xy1 * (-c_[n_][m_] * w[n_ + 1][m_ + 1] + s_[n_][m_] * v[n_ + 1][m_ + 1]) +
-                                          normalize_xy2 * (-c_[n_][m_] * w[n_ + 1][m_ - 1] + s_[n_][m_] * v[n_ + 1][m_ - 1]));
-      acceleration_xcxf_m_s2[2] += (n_d - m_d + 1.0) * (-c_[n_][m_] * v[n_ + 1][m_] - s_[n_][m_] * w[n_ + 1][m_]) * normalize_z;
+      // The common coefficient 0.5 is included
+      acceleration_xy_plus_[CalcTriangularIndex(n, m)] = 0.5 * normalize_xy1;
+      acceleration_xy_minus_[CalcTriangularIndex(n, m)] = 0.5 * normalize_xy2;
+      acceleration_z_[CalcTriangularIndex(n, m)] = (n_d - m_d + 1.0) * normalize_z;
     }
   }
-  acceleration_xcxf_m_s2 *= gravity_constants_m3_s2_ / pow(center_body_radius_m_, 2.0);
 
-  return acceleration_xcxf_m_s2;
-}
+  // Partial derivative
+  partial_xy_plus2_.assign(size, 0.0);
+  partial_xy_zero_.assign(size, 0.0);
+  partial_xy_minus2_.assign(size, 0.0);
+  partial_z_plus1_.assign(size, 0.0);
+  partial_z_minus1_.assign(size, 0.0);
+  partial_zz_.assign(size, 0.0);
+  for (size_t n = 0; n <= degree_; n++) {
+    const double n_d = (double)n;
+    const double normalize_cn0_v20 = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 5.0));
 
-libra::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m) {
-  libra::Matrix<3, 3> partial_derivative(0.0);
-  if (degree_ <= 0) return partial_derivative;
+    for (size_t m = 0; m <= n; m++) {
+      const double m_d = (double)m;
+      const size_t index = CalcTriangularIndex(n, m);
 
-  xcxf_x_m_ = position_xcxf_m[0];
-  xcxf_y_m_ = position_xcxf_m[1];
-  xcxf_z_m_ = position_xcxf_m[2];
-  radius_m_ = position_xcxf_m.CalcNorm();
+      // dx/dx, dx/dy, dy/dy (The common coefficients 0.5 or 0.25 are included)
+      if (m == 0) {
+        const double normalize_cn0_v22 = normalize_cn0_v20 * sqrt((n_d + 1.0) * (n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) / 2.0);
+        partial_xy_plus2_[index] = 0.5 * normalize_cn0_v22;
+        partial_xy_zero_[index] = 0.5 * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20;
+      } else if (m == 1) {
+        const double normalize_cn1_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / (n_d * (n_d + 1.0)));
+        const double normalize_cn1_v23 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) * (n_d + 5.0));
+        partial_xy_plus2_[index] = 0.25 * normalize_cn1_v23;
+        partial_xy_zero_[index] = 0.25 * n_d * (n_d + 1.0) * normalize_cn1_v21;
+      } else {
+        const double factor_m2 = (m == 2) ? 2.0 : 1.0;
+        const double normalize_cnm_v2p2 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
+        const double normalize_cnm_v2m2 =
+            normalize_cn0_v20 * sqrt(factor_m2 / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0)));
+        const double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
+        partial_xy_plus2_[index] = 0.25 * normalize_cnm_v2p2;
+        partial_xy_zero_[index] = 0.25 * 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
+        partial_xy_minus2_[index] = 0.25 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0) * normalize_cnm_v2m2;
+      }
 
-  // Calc V and W
-  const size_t degree_vw = degree_ + 2;
-  std::vector<std::vector<double>> v(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  std::vector<std::vector<double>> w(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  // n = m = 0
-  v[0][0] = center_body_radius_m_ / radius_m_;
-  w[0][0] = 0.0;
-  m_ = 0;
-  while (m_ < degree_vw) {
-    for (n_ = m_ + 1; n_ <= degree_vw; n_++) {
-      if (n_ <= m_ + 1) {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], 0.0, 0.0);
+      // dx/dz, dy/dz (The common coefficient 0.5 is included)
+      if (m == 0) {
+        const double normalize_cn0_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / 2.0);
+        partial_z_plus1_[index] = (n_d + 1.0) * normalize_cn0_v21;
       } else {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], v[n_ - 2][m_], w[n_ - 2][m_]);
+        const double factor_m1 = (m == 1) ? 2.0 : 1.0;
+        const double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
+        const double normalize_cnm_v2m1 =
+            normalize_cn0_v20 * sqrt(factor_m1 * (n_d + m_d + 1.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0)));
+        partial_z_plus1_[index] = 0.5 * (n_d - m_d + 1.0) * normalize_cnm_v2p1;
+        partial_z_minus1_[index] = 0.5 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * normalize_cnm_v2m1;
       }
+
+      // dz/dz
+      const double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
+      partial_zz_[index] = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
     }
-    // next step
-    m_++;
-    n_ = m_;
-    v_w_nn_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_ - 1], w[n_ - 1][m_ - 1]);
   }
+}
 
-  // Calc partial derivatives
-  for (n_ = 0; n_ <= degree_; n_++)  // this loop can integrate with previous loop
-  {
-    const double n_d = (double)n_;
+libra::Vector<3> GravityPotential::CalcAcceleration_xcxf_m_s2(const libra::Vector<3> &position_xcxf_m) const {
+  libra::Vector<3> acceleration_xcxf_m_s2(0.0);
+  if (degree_ <= 0) return acceleration_xcxf_m_s2;  // TODO: Consider this assertion is needed
 
-    // C_n_0 * V_n+2_m
-    const double normalize_cn0_v20 = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 5.0));
-    const double normalize_cn0_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / 2.0);
-    const double normalize_cn0_v22 = normalize_cn0_v20 * sqrt((n_d + 1.0) * (n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) / 2.0);
+  // Work tables are allocated only when the thread uses a larger degree than before
+  thread_local std::vector<double> v, w;
+  const size_t degree_vw = degree_ + 1;
+  if (v.size() < CalcTriangularSize(degree_vw)) {
+    v.resize(CalcTriangularSize(degree_vw));
+    w.resize(CalcTriangularSize(degree_vw));
+  }
+  CalcVw(position_xcxf_m, degree_vw, v.data(), w.data());
 
-    for (m_ = 0; m_ <= n_; m_++) {
-      const double m_d = (double)m_;
+  // Calc Acceleration
+  double acceleration[3] = {0.0, 0.0, 0.0};
+  for (size_t n = 0; n <= degree_; n++) {
+    const size_t index_n = CalcTriangularIndex(n, 0);
+    const double *v_n1 = &v[CalcTriangularIndex(n + 1, 0)];  // V_n+1,m = v_n1[m]
+    const double *w_n1 = &w[CalcTriangularIndex(n + 1, 0)];  // W_n+1,m = w_n1[m]
+
+    // m = 0
+    const double c_n0 = c_[index_n];
+    const double s_n0 = s_[index_n];
+    acceleration[0] += -c_n0 * v_n1[1] * acceleration_xy_plus_[index_n];
+    acceleration[1] += -c_n0 * w_n1[1] * acceleration_xy_plus_[index_n];
+    acceleration[2] += (-c_n0 * v_n1[0] - s_n0 * w_n1[0]) * acceleration_z_[index_n];
+    // m >= 1
+    AccelerationRow row;
+    row.c = &c_[index_n];
+    row.s = &s_[index_n];
+    row.xy_plus = &acceleration_xy_plus_[index_n];
+    row.xy_minus = &acceleration_xy_minus_[index_n];
+    row.z = &acceleration_z_[index_n];
+    row.v = v_n1;
+    row.w = w_n1;
+    AccumulateAccelerationRow(simd_level_, row, n, acceleration);
+  }
+  for (size_t i = 0; i < 3; i++) acceleration_xcxf_m_s2[i] = acceleration[i];
+  acceleration_xcxf_m_s2 *= gravity_constants_m3_s2_ / (center_body_radius_m_ * center_body_radius_m_);
 
-      // dx/dx, dx/dy, dy/dy
-      if (m_ == 0) {
-        partial_derivative[0][0] +=
-            0.5 * (c_[n_][0] * v[n_ + 2][2] * normalize_cn0_v22 - c_[n_][0] * v[n_ + 2][0] * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
-        partial_derivative[1][1] +=
-            0.5 * (-c_[n_][0] * v[n_ + 2][2] * normalize_cn0_v22 - c_[n_][0] * v[n_ + 2][0] * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
+  return acceleration_xcxf_m_s2;
+}
 
-        partial_derivative[0][1] += 0.5 * (c_[n_][0] * w[n_ + 2][2] * normalize_cn0_v22);
-      } else if (m_ == 1) {
-        const double normalize_cn1_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / (n_d * (n_d + 1.0)));
-        const double normalize_cn1_v21_with_coeff = n_d * (n_d + 1.0) * normalize_cn1_v21;
-        const double normalize_cn1_v23 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) * (n_d + 5.0));
+void GravityPotential::CalcAcceleration_xcxf_m_s2(const size_t number_of_positions, const double *position_x_xcxf_m,
+                                                  const double *position_y_xcxf_m, const double *position_z_xcxf_m,
+                                                  double *acceleration_x_xcxf_m_s2, double *acceleration_y_xcxf_m_s2,
+                                                  double *acceleration_z_xcxf_m_s2) const {
+  if (degree_ <= 0) {
+    std::fill(acceleration_x_xcxf_m_s2, acceleration_x_xcxf_m_s2 + number_of_positions, 0.0);
+    std::fill(acceleration_y_xcxf_m_s2, acceleration_y_xcxf_m_s2 + number_of_positions, 0.0);
+    std::fill(acceleration_z_xcxf_m_s2, acceleration_z_xcxf_m_s2 + number_of_positions, 0.0);
+    return;
+  }
 
-        partial_derivative[0][0] += 0.25 * ((c_[n_][1] * v[n_ + 2][3] + s_[n_][1] * w[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (3.0 * c_[n_][1] * v[n_ + 2][1] + s_[n_][1] * w[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][1] * v[n_ + 2][3] - s_[n_][1] * w[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (c_[n_][1] * v[n_ + 2][1] + 3.0 * s_[n_][1] * w[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
-
-        partial_derivative[0][1] += 0.25 * ((c_[n_][1] * w[n_ + 2][3] - s_[n_][1] * v[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (c_[n_][1] * w[n_ + 2][1] + s_[n_][1] * v[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
-      } else if (m_ == 2) {
-        double normalize_cnm_v2p2 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
-        double normalize_cnm_v2m2 = normalize_cn0_v20 * sqrt(2.0 / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0)));
-        double normalize_cnm_v2m2_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0) * normalize_cnm_v2m2;
-        double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
-        double normalize_cnm_v20_with_coeff = 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
-
-        partial_derivative[0][0] += 0.25 * ((c_[n_][m_] * v[n_ + 2][m_ + 2] + s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff +
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][m_] * v[n_ + 2][m_ + 2] - s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff -
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[0][1] += 0.25 * ((c_[n_][m_] * w[n_ + 2][m_ + 2] - s_[n_][m_] * v[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 +
-                                            (-c_[n_][m_] * w[n_ + 2][m_ - 2] + s_[n_][m_] * v[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-      } else {
-        double normalize_cnm_v2p2 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
-        double normalize_cnm_v2m2 = normalize_cn0_v20 * sqrt(1.0 / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0)));
-        double normalize_cnm_v2m2_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0) * normalize_cnm_v2m2;
-        double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
-        double normalize_cnm_v20_with_coeff = 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
-
-        partial_derivative[0][0] += 0.25 * ((c_[n_][m_] * v[n_ + 2][m_ + 2] + s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff +
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][m_] * v[n_ + 2][m_ + 2] - s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff -
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[0][1] += 0.25 * ((c_[n_][m_] * w[n_ + 2][m_ + 2] - s_[n_][m_] * v[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 +
-                                            (-c_[n_][m_] * w[n_ + 2][m_ - 2] + s_[n_][m_] * v[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
+  // Work tables are allocated only when the thread uses a larger degree than before
+  thread_local std::vector<double> v, w;
+  const size_t degree_vw = degree_ + 1;
+  if (v.size() < CalcTriangularSize(degree_vw) * kBatchSize) {
+    v.resize(CalcTriangularSize(degree_vw) * kBatchSize);
+    w.resize(CalcTriangularSize(degree_vw) * kBatchSize);
+  }
+  const double coefficient = gravity_constants_m3_s2_ / (center_body_radius_m_ * center_body_radius_m_);
+
+  for (size_t offset = 0; offset < number_of_positions; offset += kBatchSize) {
+    // The last group is filled with the last position
+    const size_t batch_size = (number_of_positions - offset < kBatchSize) ? number_of_positions - offset : kBatchSize;
+    double position_x_m[kBatchSize], position_y_m[kBatchSize], position_z_m[kBatchSize];
+    for (size_t k = 0; k < kBatchSize; k++) {
+      const size_t position_id = offset + std::min(k, batch_size - 1);
+      position_x_m[k] = position_x_xcxf_m[position_id];
+      position_y_m[k] = position_y_xcxf_m[position_id];
+      position_z_m[k] = position_z_xcxf_m[position_id];
+    }
+    CalcVwBatch(position_x_m, position_y_m, position_z_m, degree_vw, v.data(), w.data());
+
+    // Calc Acceleration
+    double acceleration_x[kBatchSize] = {}, acceleration_y[kBatchSize] = {}, acceleration_z[kBatchSize] = {};
+    for (size_t n = 0; n <= degree_; n++) {
+      const size_t index_n = CalcTriangularIndex(n, 0);
+      const double *v_n1 = &v[CalcTriangularIndex(n + 1, 0) * kBatchSize];  // V_n+1,m of k-th position = v_n1[m * kBatchSize + k]
+      const double *w_n1 = &w[CalcTriangularIndex(n + 1, 0) * kBatchSize];  // W_n+1,m of k-th position = w_n1[m * kBatchSize + k]
+
+      // m = 0
+      const double c_n0 = c_[index_n];
+      const double s_n0 = s_[index_n];
+      const double xy_plus_n0 = acceleration_xy_plus_[index_n];
+      const double z_n0 = acceleration_z_[index_n];
+      for (size_t k = 0; k < kBatchSize; k++) {
+        acceleration_x[k] += -c_n0 * v_n1[kBatchSize + k] * xy_plus_n0;
+        acceleration_y[k] += -c_n0 * w_n1[kBatchSize + k] * xy_plus_n0;
+        acceleration_z[k] += (-c_n0 * v_n1[k] - s_n0 * w_n1[k]) * z_n0;
       }
-      // dx/dz, dy/dz
-      if (m_ == 0) {
-        partial_derivative[0][2] += (n_d + 1.0) * (c_[n_][0] * v[n_ + 2][1] * normalize_cn0_v21);
-        partial_derivative[1][2] += (n_d + 1.0) * (c_[n_][0] * w[n_ + 2][1] * normalize_cn0_v21);
-      } else if (m_ == 1) {
-        double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
-        double normalize_cnm_v2p1_with_coeff = (n_d - m_d + 1.0) * normalize_cnm_v2p1;
-        double normalize_cnm_v2m1 = normalize_cn0_v20 * sqrt(2.0 * (n_d + m_d + 1.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0)));
-        double normalize_cnm_v2m1_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * normalize_cnm_v2m1;
-
-        partial_derivative[0][2] += 0.5 * ((+c_[n_][m_] * v[n_ + 2][m_ + 1] + s_[n_][m_] * w[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (-c_[n_][m_] * v[n_ + 2][m_ - 1] - s_[n_][m_] * w[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
-        partial_derivative[1][2] += 0.5 * ((+c_[n_][m_] * w[n_ + 2][m_ + 1] - s_[n_][m_] * v[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (+c_[n_][m_] * w[n_ + 2][m_ - 1] - s_[n_][m_] * v[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
-      } else {
-        double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
-        double normalize_cnm_v2p1_with_coeff = (n_d - m_d + 1.0) * normalize_cnm_v2p1;
-        double normalize_cnm_v2m1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0)));
-        double normalize_cnm_v2m1_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * normalize_cnm_v2m1;
-
-        partial_derivative[0][2] += 0.5 * ((+c_[n_][m_] * v[n_ + 2][m_ + 1] + s_[n_][m_] * w[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (-c_[n_][m_] * v[n_ + 2][m_ - 1] - s_[n_][m_] * w[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
-        partial_derivative[1][2] += 0.5 * ((+c_[n_][m_] * w[n_ + 2][m_ + 1] - s_[n_][m_] * v[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (+c_[n_][m_] * w[n_ + 2][m_ - 1] - s_[n_][m_] * v[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
+      // m >= 1
+      for (size_t m = 1; m <= n; m++) {
+        const size_t index = index_n + m;
+        const double c_nm = c_[index];
+        const double s_nm = s_[index];
+        const double xy_plus = acceleration_xy_plus_[index];
+        const double xy_minus = acceleration_xy_minus_[index];
+        const double z_nm = acceleration_z_[index];
+        const double *v_plus = v_n1 + (m + 1) * kBatchSize;
+        const double *w_plus = w_n1 + (m + 1) * kBatchSize;
+        const double *v_zero = v_n1 + m * kBatchSize;
+        const double *w_zero = w_n1 + m * kBatchSize;
+        const double *v_minus = v_n1 + (m - 1) * kBatchSize;
+        const double *w_minus = w_n1 + (m - 1) * kBatchSize;
+        for (size_t k = 0; k < kBatchSize; k++) {
+          acceleration_x[k] += xy_plus * (-c_nm * v_plus[k] - s_nm * w_plus[k]) + xy_minus * (c_nm * v_minus[k] + s_nm * w_minus[k]);
+          acceleration_y[k] += xy_plus * (-c_nm * w_plus[k] + s_nm * v_plus[k]) + xy_minus * (-c_nm * w_minus[k] + s_nm * v_minus[k]);
+          acceleration_z[k] += (-c_nm * v_zero[k] - s_nm * w_zero[k]) * z_nm;
+        }
       }
-      // dz/dz
-      double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
-      double normalize_cnm_v20_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
-      partial_derivative[2][2] += (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff;
     }
+    for (size_t k = 0; k < batch_size; k++) {
+      acceleration_x_xcxf_m_s2[offset + k] = acceleration_x[k] * coefficient;
+      acceleration_y_xcxf_m_s2[offset + k] = acceleration_y[k] * coefficient;
+      acceleration_z_xcxf_m_s2[offset + k] = acceleration_z[k] * coefficient;
+    }
+  }
+}
+
+libra::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m) const {
+  libra::Matrix<3, 3> partial_derivative(0.0);
+  if (degree_ <= 0) return partial_derivative;
+
+  // Work tables are allocated only when the thread uses a larger degree than before
+  thread_local std::vector<double> v, w;
+  const size_t degree_vw = degree_ + 2;
+  if (v.size() < CalcTriangularSize(degree_vw)) {
+    v.resize(CalcTriangularSize(degree_vw));
+    w.resize(CalcTriangularSize(degree_vw));
+  }
+  CalcVw(position_xcxf_m, degree_vw, v.data(), w.data());
+
+  // Calc partial derivatives
+  // xx, xy, xz, yy, yz, zz
+  double partial[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  for (size_t n = 0; n <= degree_; n++) {
+    const size_t index_n = CalcTriangularIndex(n, 0);
+    const double *v_n2 = &v[CalcTriangularIndex(n + 2, 0)];  // V_n+2,m = v_n2[m]
+    const double *w_n2 = &w[CalcTriangularIndex(n + 2, 0)];  // W_n+2,m = w_n2[m]
+
+    // m = 0
+    const double c_n0 = c_[index_n];
+    const double s_n0 = s_[index_n];
+    partial[0] += c_n0 * v_n2[2] * partial_xy_plus2_[index_n] - c_n0 * v_n2[0] * partial_xy_zero_[index_n];
+    partial[3] += -c_n0 * v_n2[2] * partial_xy_plus2_[index_n] - c_n0 * v_n2[0] * partial_xy_zero_[index_n];
+    partial[1] += c_n0 * w_n2[2] * partial_xy_plus2_[index_n];
+    partial[2] += c_n0 * v_n2[1] * partial_z_plus1_[index_n];
+    partial[4] += c_n0 * w_n2[1] * partial_z_plus1_[index_n];
+    partial[5] += (c_n0 * v_n2[0] + s_n0 * w_n2[0]) * partial_zz_[index_n];
+    if (n == 0) continue;
+
+    // m = 1
+    const size_t index = index_n + 1;
+    const double c_n1 = c_[index];
+    const double s_n1 = s_[index];
+    const double xy_plus2 = partial_xy_plus2_[index];
+    const double xy_zero = partial_xy_zero_[index];
+    const double z_plus1 = partial_z_plus1_[index];
+    const double z_minus1 = partial_z_minus1_[index];
+    partial[0] += (c_n1 * v_n2[3] + s_n1 * w_n2[3]) * xy_plus2 - (3.0 * c_n1 * v_n2[1] + s_n1 * w_n2[1]) * xy_zero;
+    partial[3] += (-c_n1 * v_n2[3] - s_n1 * w_n2[3]) * xy_plus2 - (c_n1 * v_n2[1] + 3.0 * s_n1 * w_n2[1]) * xy_zero;
+    partial[1] += (c_n1 * w_n2[3] - s_n1 * v_n2[3]) * xy_plus2 - (c_n1 * w_n2[1] + s_n1 * v_n2[1]) * xy_zero;
+    partial[2] += (c_n1 * v_n2[2] + s_n1 * w_n2[2]) * z_plus1 + (-c_n1 * v_n2[0] - s_n1 * w_n2[0]) * z_minus1;
+    partial[4] += (c_n1 * w_n2[2] - s_n1 * v_n2[2]) * z_plus1 + (c_n1 * w_n2[0] - s_n1 * v_n2[0]) * z_minus1;
+    partial[5] += (c_n1 * v_n2[1] + s_n1 * w_n2[1]) * partial_zz_[index];
+
+    // m >= 2
+    PartialDerivativeRow row;
+    row.c = &c_[index_n];
+    row.s = &s_[index_n];
+    row.xy_plus2 = &partial_xy_plus2_[index_n];
+    row.xy_zero = &partial_xy_zero_[index_n];
+    row.xy_minus2 = &partial_xy_minus2_[index_n];
+    row.z_plus1 = &partial_z_plus1_[index_n];
+    row.z_minus1 = &partial_z_minus1_[index_n];
+    row.zz = &partial_zz_[index_n];
+    row.v = v_n2;
+    row.w = w_n2;
+    AccumulatePartialDerivativeRow(simd_level_, row, n, partial);
   }
+  const double xx = partial[0], xy = partial[1], xz = partial[2], yy = partial[3], yz = partial[4], zz = partial[5];
+
   // Symmetry property
-  partial_derivative[1][0] = partial_derivative[0][1];
-  partial_derivative[2][0] = partial_derivative[0][2];
-  partial_derivative[2][1] = partial_derivative[1][2];
+  partial_derivative[0][0] = xx;
+  partial_derivative[0][1] = xy;
+  partial_derivative[0][2] = xz;
+  partial_derivative[1][0] = xy;
+  partial_derivative[1][1] = yy;
+  partial_derivative[1][2] = yz;
+  partial_derivative[2][0] = xz;
+  partial_derivative[2][1] = yz;
+  partial_derivative[2][2] = zz;
 
   // Multiply common coefficients
-  partial_derivative *= gravity_constants_m3_s2_ / pow(center_body_radius_m_, 3.0);
+  partial_derivative *= gravity_constants_m3_s2_ / (center_body_radius_m_ * center_body_radius_m_ * center_body_radius_m_);
 
   return partial_derivative;
 }
 
-void GravityPotential::v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev) {
-  if (n_ != m_) return;
-
-  const double n_d = (double)n_;
-
-  const double tmp = center_body_radius_m_ / pow(radius_m_, 2.0);
-  const double x_tmp = xcxf_x_m_ * tmp;
-  const double y_tmp = xcxf_y_m_ * tmp;
-  double c_normalize;
-  if (n_ == 1) {
-    c_normalize = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
+void GravityPotential::SetSimdLevel(const GravityPotentialSimdLevel simd_level) {
+  const GravityPotentialSimdLevel supported_level = DetectGravityPotentialSimdLevel();
+  if ((int)simd_level > (int)supported_level) {
+    simd_level_ = supported_level;
   } else {
-    c_normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+    simd_level_ = simd_level;
   }
-
-  *v_nn = c_normalize * (x_tmp * v_prev - y_tmp * w_prev);
-  *w_nn = c_normalize * (x_tmp * w_prev + y_tmp * v_prev);
-  return;
 }
 
-void GravityPotential::v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2,
-                                     const double w_prev2) {
-  if (n_ == m_) return;
-
-  const double m_d = (double)m_;
-  const double n_d = (double)n_;
-
-  const double tmp = center_body_radius_m_ / pow(radius_m_, 2.0);
-  const double z_tmp = xcxf_z_m_ * tmp;
+void GravityPotential::CalcVw(const libra::Vector<3> &position_xcxf_m, const size_t degree_vw, double *v, double *w) const {
+  const double radius_m = position_xcxf_m.CalcNorm();
+  const double tmp = center_body_radius_m_ / (radius_m * radius_m);
+  const double x_tmp = position_xcxf_m[0] * tmp;
+  const double y_tmp = position_xcxf_m[1] * tmp;
+  const double z_tmp = position_xcxf_m[2] * tmp;
   const double re_tmp = center_body_radius_m_ * tmp;
-  const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
-  const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
-  double c_normalize, c2_normalize;
 
-  c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
-  if (n_ <= 1) {
-    c2_normalize = 1.0;
-  } else {
-    c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+  // n = m = 0
+  v[0] = center_body_radius_m_ / radius_m;
+  w[0] = 0.0;
+  for (size_t m = 0; m <= degree_vw; m++) {
+    const size_t index_mm = CalcTriangularIndex(m, m);
+    // n = m
+    if (m > 0) {
+      const size_t index_prev = CalcTriangularIndex(m - 1, m - 1);
+      const double c_normalize = vw_diagonal_[index_mm];
+      v[index_mm] = c_normalize * (x_tmp * v[index_prev] - y_tmp * w[index_prev]);
+      w[index_mm] = c_normalize * (x_tmp * w[index_prev] + y_tmp * v[index_prev]);
+    }
+    // n = m + 1
+    if (m + 1 > degree_vw) break;
+    size_t index = CalcTriangularIndex(m + 1, m);
+    v[index] = vw_previous_[index] * z_tmp * v[index_mm];
+    w[index] = vw_previous_[index] * z_tmp * w[index_mm];
+    // n > m + 1
+    size_t index_prev = index_mm;
+    for (size_t n = m + 2; n <= degree_vw; n++) {
+      const size_t index_prev2 = index_prev;
+      index_prev = index;
+      index = CalcTriangularIndex(n, m);
+      v[index] = vw_previous_[index] * z_tmp * v[index_prev] - vw_previous2_[index] * re_tmp * v[index_prev2];
+      w[index] = vw_previous_[index] * z_tmp * w[index_prev] - vw_previous2_[index] * re_tmp * w[index_prev2];
+    }
   }
+}
 
-  *v_nm = c_normalize * (c1 * z_tmp * v_prev - c2 * c2_normalize * re_tmp * v_prev2);
-  *w_nm = c_normalize * (c1 * z_tmp * w_prev - c2 * c2_normalize * re_tmp * w_prev2);
-  return;
+void GravityPotential::CalcVwBatch(const double *position_x_xcxf_m, const double *position_y_xcxf_m, const double *position_z_xcxf_m,
+                                   const size_t degree_vw, double *v, double *w) const {
+  double x_tmp[kBatchSize], y_tmp[kBatchSize], z_tmp[kBatchSize], re_tmp[kBatchSize];
+  for (size_t k = 0; k < kBatchSize; k++) {
+    const double radius_m =
+        sqrt(position_x_xcxf_m[k] * position_x_xcxf_m[k] + position_y_xcxf_m[k] * position_y_xcxf_m[k] + position_z_xcxf_m[k] * position_z_xcxf_m[k]);
+    const double tmp = center_body_radius_m_ / (radius_m * radius_m);
+    x_tmp[k] = position_x_xcxf_m[k] * tmp;
+    y_tmp[k] = position_y_xcxf_m[k] * tmp;
+    z_tmp[k] = position_z_xcxf_m[k] * tmp;
+    re_tmp[k] = center_body_radius_m_ * tmp;
+    // n = m = 0
+    v[k] = center_body_radius_m_ / radius_m;
+    w[k] = 0.0;
+  }
+
+  for (size_t m = 0; m <= degree_vw; m++) {
+    const size_t index_mm = CalcTriangularIndex(m, m);
+    double *v_mm = v + index_mm * kBatchSize;
+    double *w_mm = w + index_mm * kBatchSize;
+    // n = m
+    if (m > 0) {
+      const double c_normalize = vw_diagonal_[index_mm];
+      const double *v_prev = v + CalcTriangularIndex(m - 1, m - 1) * kBatchSize;
+      const double *w_prev = w + CalcTriangularIndex(m - 1, m - 1) * kBatchSize;
+      for (size_t k = 0; k < kBatchSize; k++) {
+        v_mm[k] = c_normalize * (x_tmp[k] * v_prev[k] - y_tmp[k] * w_prev[k]);
+        w_mm[k] = c_normalize * (x_tmp[k] * w_prev[k] + y_tmp[k] * v_prev[k]);
+      }
+    }
+    // n = m + 1
+    if (m + 1 > degree_vw) break;
+    size_t index = CalcTriangularIndex(m + 1, m);
+    const double c_previous = vw_previous_[index];
+    for (size_t k = 0; k < kBatchSize; k++) {
+      v[index * kBatchSize + k] = c_previous * z_tmp[k] * v_mm[k];
+      w[index * kBatchSize + k] = c_previous * z_tmp[k] * w_mm[k];
+    }
+    // n > m + 1
+    size_t index_prev = index_mm;
+    for (size_t n = m + 2; n <= degree_vw; n++) {
+      const size_t index_prev2 = index_prev;
+      index_prev = index;
+      index = CalcTriangularIndex(n, m);
+      const double c1 = vw_previous_[index];
+      const double c2 = vw_previous2_[index];
+      double *v_n = v + index * kBatchSize;
+      double *w_n = w + index * kBatchSize;
+      const double *v_prev = v + index_prev * kBatchSize;
+      const double *w_prev = w + index_prev * kBatchSize;
+      const double *v_prev2 = v + index_prev2 * kBatchSize;
+      const double *w_prev2 = w + index_prev2 * kBatchSize;
+      for (size_t k = 0; k < kBatchSize; k++) {
+        v_n[k] = c1 * z_tmp[k] * v_prev[k] - c2 * re_tmp[k] * v_prev2[k];
+        w_n[k] = c1 * z_tmp[k] * w_prev[k] - c2 * re_tmp[k] * w_prev2[k];
+      }
+    }
+  }
 }
@@ -11,10 +11,15 @@
 
 #include "../math/matrix.hpp"
 #include "../math/vector.hpp"
+#include "gravity_potential_simd.hpp"
 
 /**
  * @class GravityPotential
  * @brief Class to calculate gravity potential
+ * @note Coefficients and all normalization factors are stored in flat triangular arrays (index = n * (n + 1) / 2 + m) in the constructor.
+ *       The calculation functions do not modify the instance, and the V/W work tables are prepared for each thread,
+ *       so the functions do not allocate heap memory after the first call and can be called from multiple threads.
+ *       The accumulation over the order m uses the AVX2 or AVX-512 kernel when the running CPU supports it.
  */
 class GravityPotential {
  public:
@@ -46,7 +51,23 @@ class GravityPotential {
    * @param [in] position_xcxf_m: Position of the spacecraft in the XCXF frame [m]
    * @return Acceleration in XCXF frame [m/s2]
    */
-  libra::Vector<3> CalcAcceleration_xcxf_m_s2(const libra::Vector<3> &position_xcxf_m);
+  libra::Vector<3> CalcAcceleration_xcxf_m_s2(const libra::Vector<3> &position_xcxf_m) const;
+  /**
+   * @fn CalcAcceleration_xcxf_m_s2
+   * @brief Calculate the high-order earth gravity in the XCXF frame for multiple positions at once
+   * @note Positions and accelerations are given as structure of arrays. The positions are evaluated in groups of kBatchSize,
+   *       so the coefficients and normalization factors are loaded once for each group, and the calculation is vectorized over the group.
+   * @param [in] number_of_positions: Number of positions
+   * @param [in] position_x_xcxf_m: X components of the positions in the XCXF frame [m]
+   * @param [in] position_y_xcxf_m: Y components of the positions in the XCXF frame [m]
+   * @param [in] position_z_xcxf_m: Z components of the positions in the XCXF frame [m]
+   * @param [out] acceleration_x_xcxf_m_s2: X components of the accelerations in the XCXF frame [m/s2]
+   * @param [out] acceleration_y_xcxf_m_s2: Y components of the accelerations in the XCXF frame [m/s2]
+   * @param [out] acceleration_z_xcxf_m_s2: Z components of the accelerations in the XCXF frame [m/s2]
+   */
+  void CalcAcceleration_xcxf_m_s2(const size_t number_of_positions, const double *position_x_xcxf_m, const double *position_y_xcxf_m,
+                                  const double *position_z_xcxf_m, double *acceleration_x_xcxf_m_s2, double *acceleration_y_xcxf_m_s2,
+                                  double *acceleration_z_xcxf_m_s2) const;
 
   /**
    * @fn CalcAcceleration_xcxf_m_s2
@@ -54,33 +75,72 @@ class GravityPotential {
    * @param [in] position_xcxf_m: Position of the spacecraft in the XCXF frame [m]
    * @return Partial derivative of acceleration in XCXF frame [-/s2]
    */
-  libra::Matrix<3, 3> CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m);
+  libra::Matrix<3, 3> CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m) const;
+
+  /**
+   * @fn SetSimdLevel
+   * @brief Set instruction set for the accumulation
+   * @note The level is limited to the best instruction set supported by the running CPU
+   * @param [in] simd_level: Instruction set
+   */
+  void SetSimdLevel(const GravityPotentialSimdLevel simd_level);
+  /**
+   * @fn GetSimdLevel
+   * @brief Return instruction set for the accumulation
+   */
+  inline GravityPotentialSimdLevel GetSimdLevel() const { return simd_level_; }
 
  private:
-  size_t degree_ = 0;                   //!< Maximum degree
-  size_t n_ = 0, m_ = 0;                //!< Degree and order (FIXME: follow naming rule)
-  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
-  std::vector<std::vector<double>> s_;  //!< Sine coefficients
-  double gravity_constants_m3_s2_;      //!< Gravity constant of the center body [m3/s2]
-  double center_body_radius_m_;         //!< Radius of the center body [m]
+  static const size_t kBatchSize = 4;  //!< Number of positions evaluated together in the batch calculation
+
+  size_t degree_ = 0;                                                         //!< Maximum degree
+  double gravity_constants_m3_s2_;                                            //!< Gravity constant of the center body [m3/s2]
+  double center_body_radius_m_;                                               //!< Radius of the center body [m]
+  GravityPotentialSimdLevel simd_level_ = DetectGravityPotentialSimdLevel();  //!< Instruction set for the accumulation
+
+  // Coefficients in the triangular layout (n <= degree_)
+  std::vector<double> c_;  //!< Cosine coefficients
+  std::vector<double> s_;  //!< Sine coefficients
+
+  // Normalization factors of the V/W recursion in the triangular layout (n <= degree_ + 2)
+  std::vector<double> vw_diagonal_;   //!< Factor for V_nn and W_nn from V_n-1,n-1 and W_n-1,n-1
+  std::vector<double> vw_previous_;   //!< Factor for V_nm and W_nm from V_n-1,m and W_n-1,m (n != m)
+  std::vector<double> vw_previous2_;  //!< Factor for V_nm and W_nm from V_n-2,m and W_n-2,m (n != m)
 
-  // calculation
-  double radius_m_ = 0.0;                                    //!< Radius [m]
-  double xcxf_x_m_ = 0.0, xcxf_y_m_ = 0.0, xcxf_z_m_ = 0.0;  //!< Spacecraft position in XCXF frame [m]
+  // Normalization factors of the acceleration in the triangular layout (n <= degree_)
+  std::vector<double> acceleration_xy_plus_;   //!< Factor for V_n+1,m+1 and W_n+1,m+1
+  std::vector<double> acceleration_xy_minus_;  //!< Factor for V_n+1,m-1 and W_n+1,m-1 (m > 0)
+  std::vector<double> acceleration_z_;         //!< Factor for V_n+1,m and W_n+1,m including the coefficient (n - m + 1)
+
+  // Normalization factors of the partial derivative in the triangular layout (n <= degree_)
+  std::vector<double> partial_xy_plus2_;   //!< Factor for V_n+2,m+2 and W_n+2,m+2
+  std::vector<double> partial_xy_zero_;    //!< Factor for V_n+2,m and W_n+2,m in the dx/dx and dy/dy terms
+  std::vector<double> partial_xy_minus2_;  //!< Factor for V_n+2,m-2 and W_n+2,m-2 (m >= 2)
+  std::vector<double> partial_z_plus1_;    //!< Factor for V_n+2,m+1 and W_n+2,m+1
+  std::vector<double> partial_z_minus1_;   //!< Factor for V_n+2,m-1 and W_n+2,m-1 (m > 0)
+  std::vector<double> partial_zz_;         //!< Factor for V_n+2,m and W_n+2,m in the dz/dz term
 
   /**
-   * @fn v_w_nn_update
-   * @brief Calculate V and W function for n = m
-   * @note FIXME: fix function name
+   * @fn CalcVw
+   * @brief Calculate V and W functions up to the degree
+   * @param [in] position_xcxf_m: Position of the spacecraft in the XCXF frame [m]
+   * @param [in] degree_vw: Maximum degree of V and W
+   * @param [out] v: V function in the triangular layout
+   * @param [out] w: W function in the triangular layout
    */
-  void v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev);
-
+  void CalcVw(const libra::Vector<3> &position_xcxf_m, const size_t degree_vw, double *v, double *w) const;
   /**
-   * @fn v_w_nm_update
-   * @brief Calculate V and W function for n not equal m
-   * @note FIXME: fix function name
+   * @fn CalcVwBatch
+   * @brief Calculate V and W functions up to the degree for kBatchSize positions
+   * @param [in] position_x_xcxf_m: X components of the positions in the XCXF frame [m]
+   * @param [in] position_y_xcxf_m: Y components of the positions in the XCXF frame [m]
+   * @param [in] position_z_xcxf_m: Z components of the positions in the XCXF frame [m]
+   * @param [in] degree_vw: Maximum degree of V and W
+   * @param [out] v: V function in the triangular layout. The value of k-th position is stored at v[index * kBatchSize + k].
+   * @param [out] w: W function in the triangular layout. The value of k-th position is stored at w[index * kBatchSize + k].
    */
-  void v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2, const double w_prev2);
+  void CalcVwBatch(const double *position_x_xcxf_m, const double *position_y_xcxf_m, const double *position_z_xcxf_m, const size_t degree_vw,
+                   double *v, double *w) const;
 };
 
 #endif  // S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
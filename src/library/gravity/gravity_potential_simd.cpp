@@ -0,0 +1,339 @@
+/**
+ * @file gravity_potential_simd.cpp
+ * @brief SIMD kernels to accumulate spherical harmonics terms of GravityPotential
+ * @note The AVX2 and AVX-512 kernels are compiled with the target attribute, so the other code does not require the instruction sets.
+ *       The kernel is selected at runtime by DetectGravityPotentialSimdLevel.
+ */
+
+#include "gravity_potential_simd.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define S2E_GRAVITY_POTENTIAL_X86_SIMD
+#include <immintrin.h>
+#endif
+
+// Scalar kernels
+static void AccumulateAccelerationRowScalar(const AccelerationRow &row, const size_t degree, double acceleration[3]) {
+  double x = 0.0, y = 0.0, z = 0.0;
+  for (size_t m = 1; m <= degree; m++) {
+    const double c = row.c[m];
+    const double s = row.s[m];
+    x += row.xy_plus[m] * (-c * row.v[m + 1] - s * row.w[m + 1]) + row.xy_minus[m] * (c * row.v[m - 1] + s * row.w[m - 1]);
+    y += row.xy_plus[m] * (-c * row.w[m + 1] + s * row.v[m + 1]) + row.xy_minus[m] * (-c * row.w[m - 1] + s * row.v[m - 1]);
+    z += (-c * row.v[m] - s * row.w[m]) * row.z[m];
+  }
+  acceleration[0] += x;
+  acceleration[1] += y;
+  acceleration[2] += z;
+}
+
+static void AccumulatePartialDerivativeRowScalar(const PartialDerivativeRow &row, const size_t degree, double partial_derivative[6]) {
+  double xx = 0.0, xy = 0.0, xz = 0.0, yy = 0.0, yz = 0.0, zz = 0.0;
+  for (size_t m = 2; m <= degree; m++) {
+    const double c = row.c[m];
+    const double s = row.s[m];
+    const double plus2_v = c * row.v[m + 2] + s * row.w[m + 2];
+    const double zero_v = c * row.v[m] + s * row.w[m];
+    const double minus2_v = c * row.v[m - 2] + s * row.w[m - 2];
+    xx += plus2_v * row.xy_plus2[m] - zero_v * row.xy_zero[m] + minus2_v * row.xy_minus2[m];
+    yy += -plus2_v * row.xy_plus2[m] - zero_v * row.xy_zero[m] - minus2_v * row.xy_minus2[m];
+    xy += (c * row.w[m + 2] - s * row.v[m + 2]) * row.xy_plus2[m] + (-c * row.w[m - 2] + s * row.v[m - 2]) * row.xy_minus2[m];
+    xz += (c * row.v[m + 1] + s * row.w[m + 1]) * row.z_plus1[m] + (-c * row.v[m - 1] - s * row.w[m - 1]) * row.z_minus1[m];
+    yz += (c * row.w[m + 1] - s * row.v[m + 1]) * row.z_plus1[m] + (c * row.w[m - 1] - s * row.v[m - 1]) * row.z_minus1[m];
+    zz += zero_v * row.zz[m];
+  }
+  partial_derivative[0] += xx;
+  partial_derivative[1] += xy;
+  partial_derivative[2] += xz;
+  partial_derivative[3] += yy;
+  partial_derivative[4] += yz;
+  partial_derivative[5] += zz;
+}
+
+#ifdef S2E_GRAVITY_POTENTIAL_X86_SIMD
+// AVX2 kernels
+__attribute__((target("avx2,fma"))) static inline double ReduceAddAvx2(const __m256d value) {
+  const __m128d low = _mm256_castpd256_pd128(value);
+  const __m128d high = _mm256_extractf128_pd(value, 1);
+  const __m128d sum = _mm_add_pd(low, high);
+  return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+__attribute__((target("avx2,fma"))) static void AccumulateAccelerationRowAvx2(const AccelerationRow &row, const size_t degree,
+                                                                              double acceleration[3]) {
+  __m256d x = _mm256_setzero_pd(), y = _mm256_setzero_pd(), z = _mm256_setzero_pd();
+  size_t m = 1;
+  for (; m + 3 <= degree; m += 4) {
+    const __m256d c = _mm256_loadu_pd(row.c + m);
+    const __m256d s = _mm256_loadu_pd(row.s + m);
+    const __m256d v_plus = _mm256_loadu_pd(row.v + m + 1);
+    const __m256d w_plus = _mm256_loadu_pd(row.w + m + 1);
+    const __m256d v_minus = _mm256_loadu_pd(row.v + m - 1);
+    const __m256d w_minus = _mm256_loadu_pd(row.w + m - 1);
+    const __m256d v_zero = _mm256_loadu_pd(row.v + m);
+    const __m256d w_zero = _mm256_loadu_pd(row.w + m);
+    const __m256d xy_plus = _mm256_loadu_pd(row.xy_plus + m);
+    const __m256d xy_minus = _mm256_loadu_pd(row.xy_minus + m);
+
+    // x += xy_plus * (-c * v_plus - s * w_plus) + xy_minus * (c * v_minus + s * w_minus)
+    const __m256d x_plus = _mm256_fmadd_pd(c, v_plus, _mm256_mul_pd(s, w_plus));
+    const __m256d x_minus = _mm256_fmadd_pd(c, v_minus, _mm256_mul_pd(s, w_minus));
+    x = _mm256_fnmadd_pd(xy_plus, x_plus, x);
+    x = _mm256_fmadd_pd(xy_minus, x_minus, x);
+    // y += xy_plus * (-c * w_plus + s * v_plus) + xy_minus * (-c * w_minus + s * v_minus)
+    const __m256d y_plus = _mm256_fmsub_pd(s, v_plus, _mm256_mul_pd(c, w_plus));
+    const __m256d y_minus = _mm256_fmsub_pd(s, v_minus, _mm256_mul_pd(c, w_minus));
+    y = _mm256_fmadd_pd(xy_plus, y_plus, y);
+    y = _mm256_fmadd_pd(xy_minus, y_minus, y);
+    // z += (-c * v_zero - s * w_zero) * z_factor
+    const __m256d z_zero = _mm256_fmadd_pd(c, v_zero, _mm256_mul_pd(s, w_zero));
+    z = _mm256_fnmadd_pd(z_zero, _mm256_loadu_pd(row.z + m), z);
+  }
+  acceleration[0] += ReduceAddAvx2(x);
+  acceleration[1] += ReduceAddAvx2(y);
+  acceleration[2] += ReduceAddAvx2(z);
+
+  // Remaining orders
+  if (m <= degree) {
+    AccelerationRow tail = row;
+    tail.c += m - 1;
+    tail.s += m - 1;
+    tail.xy_plus += m - 1;
+    tail.xy_minus += m - 1;
+    tail.z += m - 1;
+    tail.v += m - 1;
+    tail.w += m - 1;
+    AccumulateAccelerationRowScalar(tail, degree - m + 1, acceleration);
+  }
+}
+
+__attribute__((target("avx2,fma"))) static void AccumulatePartialDerivativeRowAvx2(const PartialDerivativeRow &row, const size_t degree,
+                                                                                   double partial_derivative[6]) {
+  __m256d xx = _mm256_setzero_pd(), xy = _mm256_setzero_pd(), xz = _mm256_setzero_pd();
+  __m256d yy = _mm256_setzero_pd(), yz = _mm256_setzero_pd(), zz = _mm256_setzero_pd();
+  size_t m = 2;
+  for (; m + 3 <= degree; m += 4) {
+    const __m256d c = _mm256_loadu_pd(row.c + m);
+    const __m256d s = _mm256_loadu_pd(row.s + m);
+    const __m256d v_plus2 = _mm256_loadu_pd(row.v + m + 2);
+    const __m256d w_plus2 = _mm256_loadu_pd(row.w + m + 2);
+    const __m256d v_plus1 = _mm256_loadu_pd(row.v + m + 1);
+    const __m256d w_plus1 = _mm256_loadu_pd(row.w + m + 1);
+    const __m256d v_zero = _mm256_loadu_pd(row.v + m);
+    const __m256d w_zero = _mm256_loadu_pd(row.w + m);
+    const __m256d v_minus1 = _mm256_loadu_pd(row.v + m - 1);
+    const __m256d w_minus1 = _mm256_loadu_pd(row.w + m - 1);
+    const __m256d v_minus2 = _mm256_loadu_pd(row.v + m - 2);
+    const __m256d w_minus2 = _mm256_loadu_pd(row.w + m - 2);
+    const __m256d xy_plus2 = _mm256_loadu_pd(row.xy_plus2 + m);
+    const __m256d xy_zero = _mm256_loadu_pd(row.xy_zero + m);
+    const __m256d xy_minus2 = _mm256_loadu_pd(row.xy_minus2 + m);
+    const __m256d z_plus1 = _mm256_loadu_pd(row.z_plus1 + m);
+    const __m256d z_minus1 = _mm256_loadu_pd(row.z_minus1 + m);
+
+    const __m256d plus2_v = _mm256_fmadd_pd(c, v_plus2, _mm256_mul_pd(s, w_plus2));
+    const __m256d zero_v = _mm256_fmadd_pd(c, v_zero, _mm256_mul_pd(s, w_zero));
+    const __m256d minus2_v = _mm256_fmadd_pd(c, v_minus2, _mm256_mul_pd(s, w_minus2));
+    const __m256d plus2_term = _mm256_mul_pd(plus2_v, xy_plus2);
+    const __m256d zero_term = _mm256_mul_pd(zero_v, xy_zero);
+    const __m256d minus2_term = _mm256_mul_pd(minus2_v, xy_minus2);
+    // xx += plus2_term - zero_term + minus2_term, yy += -plus2_term - zero_term - minus2_term
+    xx = _mm256_add_pd(xx, _mm256_add_pd(_mm256_sub_pd(plus2_term, zero_term), minus2_term));
+    yy = _mm256_sub_pd(yy, _mm256_add_pd(_mm256_add_pd(plus2_term, zero_term), minus2_term));
+    // xy += (c * w_plus2 - s * v_plus2) * xy_plus2 + (-c * w_minus2 + s * v_minus2) * xy_minus2
+    xy = _mm256_fmadd_pd(_mm256_fmsub_pd(c, w_plus2, _mm256_mul_pd(s, v_plus2)), xy_plus2, xy);
+    xy = _mm256_fmadd_pd(_mm256_fmsub_pd(s, v_minus2, _mm256_mul_pd(c, w_minus2)), xy_minus2, xy);
+    // xz += (c * v_plus1 + s * w_plus1) * z_plus1 - (c * v_minus1 + s * w_minus1) * z_minus1
+    xz = _mm256_fmadd_pd(_mm256_fmadd_pd(c, v_plus1, _mm256_mul_pd(s, w_plus1)), z_plus1, xz);
+    xz = _mm256_fnmadd_pd(_mm256_fmadd_pd(c, v_minus1, _mm256_mul_pd(s, w_minus1)), z_minus1, xz);
+    // yz += (c * w_plus1 - s * v_plus1) * z_plus1 + (c * w_minus1 - s * v_minus1) * z_minus1
+    yz = _mm256_fmadd_pd(_mm256_fmsub_pd(c, w_plus1, _mm256_mul_pd(s, v_plus1)), z_plus1, yz);
+    yz = _mm256_fmadd_pd(_mm256_fmsub_pd(c, w_minus1, _mm256_mul_pd(s, v_minus1)), z_minus1, yz);
+    // zz += zero_v * zz_factor
+    zz = _mm256_fmadd_pd(zero_v, _mm256_loadu_pd(row.zz + m), zz);
+  }
+  partial_derivative[0] += ReduceAddAvx2(xx);
+  partial_derivative[1] += ReduceAddAvx2(xy);
+  partial_derivative[2] += ReduceAddAvx2(xz);
+  partial_derivative[3] += ReduceAddAvx2(yy);
+  partial_derivative[4] += ReduceAddAvx2(yz);
+  partial_derivative[5] += ReduceAddAvx2(zz);
+
+  // Remaining orders
+  if (m <= degree) {
+    PartialDerivativeRow tail = row;
+    tail.c += m - 2;
+    tail.s += m - 2;
+    tail.xy_plus2 += m - 2;
+    tail.xy_zero += m - 2;
+    tail.xy_minus2 += m - 2;
+    tail.z_plus1 += m - 2;
+    tail.z_minus1 += m - 2;
+    tail.zz += m - 2;
+    tail.v += m - 2;
+    tail.w += m - 2;
+    AccumulatePartialDerivativeRowScalar(tail, degree - m + 2, partial_derivative);
+  }
+}
+
+// AVX-512 kernels
+__attribute__((target("avx512f"))) static inline double ReduceAddAvx512(const __m512d value) {
+  // _mm512_reduce_add_pd is not used since it causes a false -Wuninitialized warning in some GCC versions
+  double lanes[8];
+  _mm512_storeu_pd(lanes, value);
+  return ((lanes[0] + lanes[4]) + (lanes[2] + lanes[6])) + ((lanes[1] + lanes[5]) + (lanes[3] + lanes[7]));
+}
+
+__attribute__((target("avx512f"))) static void AccumulateAccelerationRowAvx512(const AccelerationRow &row, const size_t degree,
+                                                                               double acceleration[3]) {
+  __m512d x = _mm512_setzero_pd(), y = _mm512_setzero_pd(), z = _mm512_setzero_pd();
+  size_t m = 1;
+  for (; m + 7 <= degree; m += 8) {
+    const __m512d c = _mm512_loadu_pd(row.c + m);
+    const __m512d s = _mm512_loadu_pd(row.s + m);
+    const __m512d v_plus = _mm512_loadu_pd(row.v + m + 1);
+    const __m512d w_plus = _mm512_loadu_pd(row.w + m + 1);
+    const __m512d v_minus = _mm512_loadu_pd(row.v + m - 1);
+    const __m512d w_minus = _mm512_loadu_pd(row.w + m - 1);
+    const __m512d v_zero = _mm512_loadu_pd(row.v + m);
+    const __m512d w_zero = _mm512_loadu_pd(row.w + m);
+    const __m512d xy_plus = _mm512_loadu_pd(row.xy_plus + m);
+    const __m512d xy_minus = _mm512_loadu_pd(row.xy_minus + m);
+
+    const __m512d x_plus = _mm512_fmadd_pd(c, v_plus, _mm512_mul_pd(s, w_plus));
+    const __m512d x_minus = _mm512_fmadd_pd(c, v_minus, _mm512_mul_pd(s, w_minus));
+    x = _mm512_fnmadd_pd(xy_plus, x_plus, x);
+    x = _mm512_fmadd_pd(xy_minus, x_minus, x);
+    const __m512d y_plus = _mm512_fmsub_pd(s, v_plus, _mm512_mul_pd(c, w_plus));
+    const __m512d y_minus = _mm512_fmsub_pd(s, v_minus, _mm512_mul_pd(c, w_minus));
+    y = _mm512_fmadd_pd(xy_plus, y_plus, y);
+    y = _mm512_fmadd_pd(xy_minus, y_minus, y);
+    const __m512d z_zero = _mm512_fmadd_pd(c, v_zero, _mm512_mul_pd(s, w_zero));
+    z = _mm512_fnmadd_pd(z_zero, _mm512_loadu_pd(row.z + m), z);
+  }
+  acceleration[0] += ReduceAddAvx512(x);
+  acceleration[1] += ReduceAddAvx512(y);
+  acceleration[2] += ReduceAddAvx512(z);
+
+  // Remaining orders
+  if (m <= degree) {
+    AccelerationRow tail = row;
+    tail.c += m - 1;
+    tail.s += m - 1;
+    tail.xy_plus += m - 1;
+    tail.xy_minus += m - 1;
+    tail.z += m - 1;
+    tail.v += m - 1;
+    tail.w += m - 1;
+    AccumulateAccelerationRowScalar(tail, degree - m + 1, acceleration);
+  }
+}
+
+__attribute__((target("avx512f"))) static void AccumulatePartialDerivativeRowAvx512(const PartialDerivativeRow &row, const size_t degree,
+                                                                                    double partial_derivative[6]) {
+  __m512d xx = _mm512_setzero_pd(), xy = _mm512_setzero_pd(), xz = _mm512_setzero_pd();
+  __m512d yy = _mm512_setzero_pd(), yz = _mm512_setzero_pd(), zz = _mm512_setzero_pd();
+  size_t m = 2;
+  for (; m + 7 <= degree; m += 8) {
+    const __m512d c = _mm512_loadu_pd(row.c + m);
+    const __m512d s = _mm512_loadu_pd(row.s + m);
+    const __m512d v_plus2 = _mm512_loadu_pd(row.v + m + 2);
+    const __m512d w_plus2 = _mm512_loadu_pd(row.w + m + 2);
+    const __m512d v_plus1 = _mm512_loadu_pd(row.v + m + 1);
+    const __m512d w_plus1 = _mm512_loadu_pd(row.w + m + 1);
+    const __m512d v_zero = _mm512_loadu_pd(row.v + m);
+    const __m512d w_zero = _mm512_loadu_pd(row.w + m);
+    const __m512d v_minus1 = _mm512_loadu_pd(row.v + m - 1);
+    const __m512d w_minus1 = _mm512_loadu_pd(row.w + m - 1);
+    const __m512d v_minus2 = _mm512_loadu_pd(row.v + m - 2);
+    const __m512d w_minus2 = _mm512_loadu_pd(row.w + m - 2);
+    const __m512d xy_plus2 = _mm512_loadu_pd(row.xy_plus2 + m);
+    const __m512d xy_zero = _mm512_loadu_pd(row.xy_zero + m);
+    const __m512d xy_minus2 = _mm512_loadu_pd(row.xy_minus2 + m);
+    const __m512d z_plus1 = _mm512_loadu_pd(row.z_plus1 + m);
+    const __m512d z_minus1 = _mm512_loadu_pd(row.z_minus1 + m);
+
+    const __m512d plus2_v = _mm512_fmadd_pd(c, v_plus2, _mm512_mul_pd(s, w_plus2));
+    const __m512d zero_v = _mm512_fmadd_pd(c, v_zero, _mm512_mul_pd(s, w_zero));
+    const __m512d minus2_v = _mm512_fmadd_pd(c, v_minus2, _mm512_mul_pd(s, w_minus2));
+    const __m512d plus2_term = _mm512_mul_pd(plus2_v, xy_plus2);
+    const __m512d zero_term = _mm512_mul_pd(zero_v, xy_zero);
+    const __m512d minus2_term = _mm512_mul_pd(minus2_v, xy_minus2);
+    xx = _mm512_add_pd(xx, _mm512_add_pd(_mm512_sub_pd(plus2_term, zero_term), minus2_term));
+    yy = _mm512_sub_pd(yy, _mm512_add_pd(_mm512_add_pd(plus2_term, zero_term), minus2_term));
+    xy = _mm512_fmadd_pd(_mm512_fmsub_pd(c, w_plus2, _mm512_mul_pd(s, v_plus2)), xy_plus2, xy);
+    xy = _mm512_fmadd_pd(_mm512_fmsub_pd(s, v_minus2, _mm512_mul_pd(c, w_minus2)), xy_minus2, xy);
+    xz = _mm512_fmadd_pd(_mm512_fmadd_pd(c, v_plus1, _mm512_mul_pd(s, w_plus1)), z_plus1, xz);
+    xz = _mm512_fnmadd_pd(_mm512_fmadd_pd(c, v_minus1, _mm512_mul_pd(s, w_minus1)), z_minus1, xz);
+    yz = _mm512_fmadd_pd(_mm512_fmsub_pd(c, w_plus1, _mm512_mul_pd(s, v_plus1)), z_plus1, yz);
+    yz = _mm512_fmadd_pd(_mm512_fmsub_pd(c, w_minus1, _mm512_mul_pd(s, v_minus1)), z_minus1, yz);
+    zz = _mm512_fmadd_pd(zero_v, _mm512_loadu_pd(row.zz + m), zz);
+  }
+  partial_derivative[0] += ReduceAddAvx512(xx);
+  partial_derivative[1] += ReduceAddAvx512(xy);
+  partial_derivative[2] += ReduceAddAvx512(xz);
+  partial_derivative[3] += ReduceAddAvx512(yy);
+  partial_derivative[4] += ReduceAddAvx512(yz);
+  partial_derivative[5] += ReduceAddAvx512(zz);
+
+  // Remaining orders
+  if (m <= degree) {
+    PartialDerivativeRow tail = row;
+    tail.c += m - 2;
+    tail.s += m - 2;
+    tail.xy_plus2 += m - 2;
+    tail.xy_zero += m - 2;
+    tail.xy_minus2 += m - 2;
+    tail.z_plus1 += m - 2;
+    tail.z_minus1 += m - 2;
+    tail.zz += m - 2;
+    tail.v += m - 2;
+    tail.w += m - 2;
+    AccumulatePartialDerivativeRowScalar(tail, degree - m + 2, partial_derivative);
+  }
+}
+#endif  // S2E_GRAVITY_POTENTIAL_X86_SIMD
+
+GravityPotentialSimdLevel DetectGravityPotentialSimdLevel() {
+  // The CPU features are checked only once
+  static const GravityPotentialSimdLevel simd_level = []() {
+#ifdef S2E_GRAVITY_POTENTIAL_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return GravityPotentialSimdLevel::kAvx512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return GravityPotentialSimdLevel::kAvx2;
+#endif
+    return GravityPotentialSimdLevel::kScalar;
+  }();
+  return simd_level;
+}
+
+void AccumulateAccelerationRow(const GravityPotentialSimdLevel simd_level, const AccelerationRow &row, const size_t degree, double acceleration[3]) {
+#ifdef S2E_GRAVITY_POTENTIAL_X86_SIMD
+  if (simd_level == GravityPotentialSimdLevel::kAvx512) {
+    AccumulateAccelerationRowAvx512(row, degree, acceleration);
+    return;
+  } else if (simd_level == GravityPotentialSimdLevel::kAvx2) {
+    AccumulateAccelerationRowAvx2(row, degree, acceleration);
+    return;
+  }
+#else
+  (void)simd_level;
+#endif
+  AccumulateAccelerationRowScalar(row, degree, acceleration);
+}
+
+void AccumulatePartialDerivativeRow(const GravityPotentialSimdLevel simd_level, const PartialDerivativeRow &row, const size_t degree,
+                                    double partial_derivative[6]) {
+#ifdef S2E_GRAVITY_POTENTIAL_X86_SIMD
+  if (simd_level == GravityPotentialSimdLevel::kAvx512) {
+    AccumulatePartialDerivativeRowAvx512(row, degree, partial_derivative);
+    return;
+  } else if (simd_level == GravityPotentialSimdLevel::kAvx2) {
+    AccumulatePartialDerivativeRowAvx2(row, degree, partial_derivative);
+    return;
+  }
+#else
+  (void)simd_level;
+#endif
+  AccumulatePartialDerivativeRowScalar(row, degree, partial_derivative);
+}
@@ -0,0 +1,82 @@
+/**
+ * @file gravity_potential_simd.hpp
+ * @brief SIMD kernels to accumulate spherical harmonics terms of GravityPotential
+ */
+
+#ifndef S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_SIMD_HPP_
+#define S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_SIMD_HPP_
+
+#include <cstddef>
+
+/**
+ * @enum GravityPotentialSimdLevel
+ * @brief Instruction set used to accumulate the spherical harmonics terms
+ */
+enum class GravityPotentialSimdLevel {
+  kScalar,  //!< Scalar code (fallback)
+  kAvx2,    //!< AVX2 and FMA
+  kAvx512,  //!< AVX-512F
+};
+
+/**
+ * @struct AccelerationRow
+ * @brief Input of the acceleration accumulation for one degree n
+ * @note All pointers point the element of order m = 0, so the element of order m is accessed as pointer[m].
+ */
+struct AccelerationRow {
+  const double *c;         //!< Cosine coefficients C_n,m
+  const double *s;         //!< Sine coefficients S_n,m
+  const double *xy_plus;   //!< Normalization factor for V_n+1,m+1 and W_n+1,m+1
+  const double *xy_minus;  //!< Normalization factor for V_n+1,m-1 and W_n+1,m-1
+  const double *z;         //!< Normalization factor for V_n+1,m and W_n+1,m
+  const double *v;         //!< V_n+1,m
+  const double *w;         //!< W_n+1,m
+};
+
+/**
+ * @struct PartialDerivativeRow
+ * @brief Input of the partial derivative accumulation for one degree n
+ * @note All pointers point the element of order m = 0, so the element of order m is accessed as pointer[m].
+ */
+struct PartialDerivativeRow {
+  const double *c;          //!< Cosine coefficients C_n,m
+  const double *s;          //!< Sine coefficients S_n,m
+  const double *xy_plus2;   //!< Normalization factor for V_n+2,m+2 and W_n+2,m+2
+  const double *xy_zero;    //!< Normalization factor for V_n+2,m and W_n+2,m in the dx/dx and dy/dy terms
+  const double *xy_minus2;  //!< Normalization factor for V_n+2,m-2 and W_n+2,m-2
+  const double *z_plus1;    //!< Normalization factor for V_n+2,m+1 and W_n+2,m+1
+  const double *z_minus1;   //!< Normalization factor for V_n+2,m-1 and W_n+2,m-1
+  const double *zz;         //!< Normalization factor for V_n+2,m and W_n+2,m in the dz/dz term
+  const double *v;          //!< V_n+2,m
+  const double *w;          //!< W_n+2,m
+};
+
+/**
+ * @fn DetectGravityPotentialSimdLevel
+ * @brief Return the best instruction set supported by the running CPU
+ * @note Only the scalar code is available for compilers other than GCC and Clang on x86
+ */
+GravityPotentialSimdLevel DetectGravityPotentialSimdLevel();
+
+/**
+ * @fn AccumulateAccelerationRow
+ * @brief Add the acceleration terms of order m = 1 to degree n
+ * @param [in] simd_level: Instruction set to use. It must be supported by the running CPU.
+ * @param [in] row: Input of the degree n
+ * @param [in] degree: Degree n
+ * @param [in/out] acceleration: Accumulated acceleration (x, y, z)
+ */
+void AccumulateAccelerationRow(const GravityPotentialSimdLevel simd_level, const AccelerationRow &row, const size_t degree, double acceleration[3]);
+
+/**
+ * @fn AccumulatePartialDerivativeRow
+ * @brief Add the partial derivative terms of order m = 2 to degree n
+ * @param [in] simd_level: Instruction set to use. It must be supported by the running CPU.
+ * @param [in] row: Input of the degree n
+ * @param [in] degree: Degree n
+ * @param [in/out] partial_derivative: Accumulated partial derivative (xx, xy, xz, yy, yz, zz)
+ */
+void AccumulatePartialDerivativeRow(const GravityPotentialSimdLevel simd_level, const PartialDerivativeRow &row, const size_t degree,
+                                    double partial_derivative[6]);
+
+#endif  // S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_SIMD_HPP_
@@ -4,6 +4,9 @@
  */
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <thread>
+
 #include "gravity_potential.hpp"
 
 /**
@@ -153,3 +156,168 @@ TEST(GravityPotential, PartialDerivative2) {
     }
   }
 }
+
+/**
+ * @brief Test that one instance can be used from multiple threads with different degrees of work tables
+ */
+TEST(GravityPotential, MultiThread) {
+  const size_t degree = 30;
+
+  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
+  std::vector<std::vector<double>> s_;  //!< Sine coefficients
+
+  // Unit coefficients
+  c_.assign(degree + 1, std::vector<double>(degree + 1, 1.0e-3));
+  s_.assign(degree + 1, std::vector<double>(degree + 1, 1.0e-3));
+
+  const GravityPotential gravity_potential_(degree, c_, s_, 1.0, 1.0);
+  const GravityPotential gravity_potential_low_degree_(5, c_, s_, 1.0, 1.0);
+
+  const size_t kPositionNum = 100;
+  std::vector<libra::Vector<3>> positions_xcxf_m(kPositionNum);
+  for (size_t i = 0; i < kPositionNum; i++) {
+    positions_xcxf_m[i][0] = 1.5 * cos(0.1 * i);
+    positions_xcxf_m[i][1] = 1.5 * sin(0.1 * i);
+    positions_xcxf_m[i][2] = 0.3 * cos(0.05 * i);
+  }
+
+  // Reference values calculated in this thread
+  std::vector<libra::Vector<3>> expected_acceleration_xcxf_m_s2(kPositionNum);
+  std::vector<libra::Matrix<3, 3>> expected_partial_derivative_xcxf_s2(kPositionNum);
+  for (size_t i = 0; i < kPositionNum; i++) {
+    expected_acceleration_xcxf_m_s2[i] = gravity_potential_.CalcAcceleration_xcxf_m_s2(positions_xcxf_m[i]);
+    expected_partial_derivative_xcxf_s2[i] = gravity_potential_.CalcPartialDerivative_xcxf_s2(positions_xcxf_m[i]);
+  }
+
+  // Calculate the same values in parallel threads
+  const size_t kThreadNum = 4;
+  std::vector<std::vector<libra::Vector<3>>> acceleration_xcxf_m_s2(kThreadNum, std::vector<libra::Vector<3>>(kPositionNum));
+  std::vector<std::vector<libra::Matrix<3, 3>>> partial_derivative_xcxf_s2(kThreadNum, std::vector<libra::Matrix<3, 3>>(kPositionNum));
+  std::vector<std::thread> threads;
+  for (size_t thread_id = 0; thread_id < kThreadNum; thread_id++) {
+    threads.push_back(std::thread([&, thread_id]() {
+      for (size_t i = 0; i < kPositionNum; i++) {
+        // Calculation with a lower degree instance must not affect the results
+        gravity_potential_low_degree_.CalcAcceleration_xcxf_m_s2(positions_xcxf_m[i]);
+        acceleration_xcxf_m_s2[thread_id][i] = gravity_potential_.CalcAcceleration_xcxf_m_s2(positions_xcxf_m[i]);
+        partial_derivative_xcxf_s2[thread_id][i] = gravity_potential_.CalcPartialDerivative_xcxf_s2(positions_xcxf_m[i]);
+      }
+    }));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t thread_id = 0; thread_id < kThreadNum; thread_id++) {
+    for (size_t i = 0; i < kPositionNum; i++) {
+      for (size_t j = 0; j < 3; j++) {
+        EXPECT_DOUBLE_EQ(expected_acceleration_xcxf_m_s2[i][j], acceleration_xcxf_m_s2[thread_id][i][j]);
+        for (size_t k = 0; k < 3; k++) {
+          EXPECT_DOUBLE_EQ(expected_partial_derivative_xcxf_s2[i][j][k], partial_derivative_xcxf_s2[thread_id][i][j][k]);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test that the SIMD kernels give the same results as the scalar kernel within the rounding error
+ */
+TEST(GravityPotential, SimdLevel) {
+  const size_t degree = 50;
+
+  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
+  std::vector<std::vector<double>> s_;  //!< Sine coefficients
+
+  // Coefficients which are different for each degree and order
+  c_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  s_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  for (size_t n = 0; n <= degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      c_[n][m] = 1.0e-3 * cos(0.7 * n + 1.3 * m);
+      s_[n][m] = (m == 0) ? 0.0 : 1.0e-3 * sin(0.3 * n + 0.9 * m);
+    }
+  }
+
+  GravityPotential scalar_gravity_potential_(degree, c_, s_, 1.0, 1.0);
+  scalar_gravity_potential_.SetSimdLevel(GravityPotentialSimdLevel::kScalar);
+  EXPECT_EQ(GravityPotentialSimdLevel::kScalar, scalar_gravity_potential_.GetSimdLevel());
+
+  const GravityPotentialSimdLevel simd_levels[] = {GravityPotentialSimdLevel::kAvx2, GravityPotentialSimdLevel::kAvx512};
+  for (const auto simd_level : simd_levels) {
+    GravityPotential gravity_potential_(degree, c_, s_, 1.0, 1.0);
+    gravity_potential_.SetSimdLevel(simd_level);
+    // Unsupported instruction sets are limited to the supported one
+    EXPECT_LE((int)gravity_potential_.GetSimdLevel(), (int)DetectGravityPotentialSimdLevel());
+
+    for (size_t i = 0; i < 20; i++) {
+      libra::Vector<3> position_xcxf_m;
+      position_xcxf_m[0] = 1.2 * cos(0.3 * i);
+      position_xcxf_m[1] = 1.2 * sin(0.3 * i);
+      position_xcxf_m[2] = 0.5 * cos(0.2 * i);
+
+      const libra::Vector<3> expected_acceleration = scalar_gravity_potential_.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+      const libra::Vector<3> acceleration = gravity_potential_.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+      const double accuracy_acceleration = 1.0e-12 * expected_acceleration.CalcNorm();
+      for (size_t j = 0; j < 3; j++) {
+        EXPECT_NEAR(expected_acceleration[j], acceleration[j], accuracy_acceleration);
+      }
+
+      const libra::Matrix<3, 3> expected_partial_derivative = scalar_gravity_potential_.CalcPartialDerivative_xcxf_s2(position_xcxf_m);
+      const libra::Matrix<3, 3> partial_derivative = gravity_potential_.CalcPartialDerivative_xcxf_s2(position_xcxf_m);
+      double max_partial_derivative = 0.0;
+      for (size_t j = 0; j < 3; j++) {
+        for (size_t k = 0; k < 3; k++) max_partial_derivative = std::max(max_partial_derivative, fabs(expected_partial_derivative[j][k]));
+      }
+      for (size_t j = 0; j < 3; j++) {
+        for (size_t k = 0; k < 3; k++) {
+          EXPECT_NEAR(expected_partial_derivative[j][k], partial_derivative[j][k], 1.0e-12 * max_partial_derivative);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test that the batch calculation gives the same results as the calculation for each position
+ */
+TEST(GravityPotential, AccelerationBatch) {
+  const size_t degree = 20;
+
+  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
+  std::vector<std::vector<double>> s_;  //!< Sine coefficients
+
+  c_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  s_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  for (size_t n = 0; n <= degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      c_[n][m] = 1.0e-3 * cos(0.7 * n + 1.3 * m);
+      s_[n][m] = (m == 0) ? 0.0 : 1.0e-3 * sin(0.3 * n + 0.9 * m);
+    }
+  }
+  const GravityPotential gravity_potential_(degree, c_, s_, 1.0, 1.0);
+
+  // The number of positions is not a multiple of the batch size
+  const size_t kPositionNum = 11;
+  std::vector<double> position_x_xcxf_m(kPositionNum), position_y_xcxf_m(kPositionNum), position_z_xcxf_m(kPositionNum);
+  for (size_t i = 0; i < kPositionNum; i++) {
+    position_x_xcxf_m[i] = 1.2 * cos(0.4 * i);
+    position_y_xcxf_m[i] = 1.2 * sin(0.4 * i);
+    position_z_xcxf_m[i] = 0.6 * cos(0.3 * i);
+  }
+  std::vector<double> acceleration_x_xcxf_m_s2(kPositionNum), acceleration_y_xcxf_m_s2(kPositionNum), acceleration_z_xcxf_m_s2(kPositionNum);
+  gravity_potential_.CalcAcceleration_xcxf_m_s2(kPositionNum, position_x_xcxf_m.data(), position_y_xcxf_m.data(), position_z_xcxf_m.data(),
+                                                acceleration_x_xcxf_m_s2.data(), acceleration_y_xcxf_m_s2.data(), acceleration_z_xcxf_m_s2.data());
+
+  for (size_t i = 0; i < kPositionNum; i++) {
+    libra::Vector<3> position_xcxf_m;
+    position_xcxf_m[0] = position_x_xcxf_m[i];
+    position_xcxf_m[1] = position_y_xcxf_m[i];
+    position_xcxf_m[2] = position_z_xcxf_m[i];
+    const libra::Vector<3> expected_acceleration = gravity_potential_.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+    const double accuracy = 1.0e-12 * expected_acceleration.CalcNorm();
+    EXPECT_NEAR(expected_acceleration[0], acceleration_x_xcxf_m_s2[i], accuracy);
+    EXPECT_NEAR(expected_acceleration[1], acceleration_y_xcxf_m_s2[i], accuracy);
+    EXPECT_NEAR(expected_acceleration[2], acceleration_z_xcxf_m_s2[i], accuracy);
+  }
+}
@@ -20,17 +20,21 @@ IniAccess::IniAccess(const std::string file_path) : file_path_(file_path) {
   strncpy(file_path_char_, file_path_.c_str(), kMaxCharLength);
 }
 #else
-IniAccess::IniAccess(const std::string file_path) : file_path_(file_path), ini_reader_(file_path) {
+IniAccess::IniAccess(const std::string file_path) : file_path_(file_path) {
   strncpy(file_path_char_, file_path_.c_str(), kMaxCharLength);
 
   std::string ext = ".ini";
   if (file_path_.size() < 4 || !std::equal(std::rbegin(ext), std::rend(ext), std::rbegin(file_path_))) {
     // this is not ini file(csv)
+    static const std::shared_ptr<const IniDatabase> kEmptyDatabase = std::make_shared<const IniDatabase>("");
+    database_ = kEmptyDatabase;
     return;
   }
-  if (ini_reader_.ParseError() != 0) {
+  // The file is parsed only at the first access in the process
+  database_ = IniDatabase::GetDatabase(file_path_);
+  if (database_->GetParseError() != 0) {
     std::cerr << "Error reading INI file : " << file_path_ << std::endl;
-    std::cerr << "\t error code: " << ini_reader_.ParseError() << std::endl;
+    std::cerr << "\t error code: " << database_->GetParseError() << std::endl;
     throw std::runtime_error("Error reading INI file");
   }
 }
@@ -39,9 +43,8 @@ IniAccess::IniAccess(const std::string file_path) : file_path_(file_path), ini_r
 std::vector<unsigned char> IniAccess::ReadVectorUnsignedChar(const char* section_name, const char* key_name, const size_t num) {
   std::vector<unsigned char> data;
   for (size_t i = 0; i < num; i++) {
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << "(" << i << ")";
-    data.push_back((unsigned char)ReadInt(section_name, edited_key_name.str().c_str()));
+    const std::string edited_key_name = key_name + ("(" + std::to_string(i) + ")");
+    data.push_back((unsigned char)ReadInt(section_name, edited_key_name.c_str()));
   }
   return data;
 }
@@ -60,7 +63,7 @@ double IniAccess::ReadDouble(const char* section_name, const char* key_name) {
   return temp;
 #else
   UNUSED(text_buffer_);
-  return ini_reader_.GetReal(section_name, key_name, 0);
+  return database_->Find(section_name, key_name).real;
 #endif
 }
 
@@ -72,16 +75,15 @@ int IniAccess::ReadInt(const char* section_name, const char* key_name) {
 
   return temp;
 #else
-  return (int)ini_reader_.GetInteger(section_name, key_name, 0);
+  return (int)database_->Find(section_name, key_name).integer;
 #endif
 }
 
 std::vector<int> IniAccess::ReadVectorInt(const char* section_name, const char* key_name, const size_t num) {
   std::vector<int> data;
   for (size_t i = 0; i < num; i++) {
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << "(" << i << ")";
-    data.push_back(ReadInt(section_name, edited_key_name.str().c_str()));
+    const std::string edited_key_name = key_name + ("(" + std::to_string(i) + ")");
+    data.push_back(ReadInt(section_name, edited_key_name.c_str()));
   }
   return data;
 }
@@ -96,24 +98,22 @@ bool IniAccess::ReadBoolean(const char* section_name, const char* key_name) {
   }
   return false;
 #else
-  return ini_reader_.GetBoolean(section_name, key_name, false);
+  return database_->Find(section_name, key_name).boolean;
 #endif
 }
 
 void IniAccess::ReadDoubleArray(const char* section_name, const char* key_name, const int id, const int num, double* data) {
   for (int i = 0; i < num; i++) {
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << id << "(" << i << ")";
-    data[i] = ReadDouble(section_name, edited_key_name.str().c_str());
+    const std::string edited_key_name = key_name + (std::to_string(id) + "(" + std::to_string(i) + ")");
+    data[i] = ReadDouble(section_name, edited_key_name.c_str());
   }
 }
 
 std::vector<double> IniAccess::ReadVectorDouble(const char* section_name, const char* key_name, const size_t num) {
   std::vector<double> data;
   for (size_t i = 0; i < num; i++) {
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << "(" << i << ")";
-    data.push_back(ReadDouble(section_name, edited_key_name.str().c_str()));
+    const std::string edited_key_name = key_name + ("(" + std::to_string(i) + ")");
+    data.push_back(ReadDouble(section_name, edited_key_name.c_str()));
   }
   return data;
 }
@@ -123,16 +123,14 @@ void IniAccess::ReadQuaternion(const char* section_name, const char* key_name, l
   double norm = 0.0;
 
   for (int i = 0; i < 4; i++) {  // Read Quaternion as new format
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << "_(" << i << ")";
-    temp[i] = ReadDouble(section_name, edited_key_name.str().c_str());
+    const std::string edited_key_name = key_name + ("_(" + std::to_string(i) + ")");
+    temp[i] = ReadDouble(section_name, edited_key_name.c_str());
     norm += temp[i] * temp[i];
   }
   if (norm == 0.0) {  // If it is not new format, try to read old format
     for (int i = 0; i < 4; i++) {
-      std::stringstream edited_key_name;
-      edited_key_name << key_name << "(" << i << ")";
-      data[i] = ReadDouble(section_name, edited_key_name.str().c_str());
+      const std::string edited_key_name = key_name + ("(" + std::to_string(i) + ")");
+      data[i] = ReadDouble(section_name, edited_key_name.c_str());
     }
   } else {
     data[0] = temp[0];
@@ -152,14 +150,11 @@ void IniAccess::ReadChar(const char* section_name, const char* key_name, const i
 }
 
 std::string IniAccess::ReadString(const char* section_name, const char* key_name) {
-  std::string value;
 #ifdef WIN32
+  std::string value;
   char temp[kMaxCharLength];
   ReadChar(section_name, key_name, kMaxCharLength, temp);
   value = std::string(temp);
-#else
-  value = ini_reader_.GetString(section_name, key_name, "NULL");
-#endif
   // Special characters
   // INI_FILE_DIR
   std::string ini_path = INI_FILE_DIR_FROM_EXE;
@@ -172,14 +167,17 @@ std::string IniAccess::ReadString(const char* section_name, const char* key_name
   value = std::regex_replace(value, std::regex("CORE_DIR_FROM_EXE"), s2e_core_path);
 
   return value;
+#else
+  // The special characters are replaced at the parsing
+  return database_->Find(section_name, key_name).value;
+#endif
 }
 
 std::vector<std::string> IniAccess::ReadVectorString(const char* section_name, const char* key_name, const size_t num) {
   std::vector<std::string> data;
   for (size_t i = 0; i < num; i++) {
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << "(" << i << ")";
-    data.push_back(ReadString(section_name, edited_key_name.str().c_str()));
+    const std::string edited_key_name = key_name + ("(" + std::to_string(i) + ")");
+    data.push_back(ReadString(section_name, edited_key_name.c_str()));
   }
   return data;
 }
@@ -196,9 +194,8 @@ std::vector<std::string> IniAccess::ReadStrVector(const char* section_name, cons
   std::string temp;
   unsigned int i = 0;
   while (true) {
-    std::stringstream c_name;
-    c_name << key_name << "(" << i << ")";
-    temp = ReadString(section_name, c_name.str().c_str());
+    const std::string edited_key_name = key_name + ("(" + std::to_string(i) + ")");
+    temp = ReadString(section_name, edited_key_name.c_str());
 #ifdef WIN32
     if (temp.c_str()[0] == NULL) {
 #else
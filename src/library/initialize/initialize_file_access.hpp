@@ -16,17 +16,18 @@
 #include <tchar.h>
 #define NOMINMAX
 #include <windows.h>
-#else
-#include <library/external/inih/cpp/INIReader.h>
 #endif
 
 #include <fstream>
 #include <library/math/quaternion.hpp>
 #include <library/math/vector.hpp>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "initialize_file_database.hpp"
+
 /**
  * @class IniAccess
  * @brief Class to read and get parameters for the `ini` format file
@@ -203,16 +204,15 @@ class IniAccess {
   char file_path_char_[kMaxCharLength];  //!< File path in char
   char text_buffer_[kMaxCharLength];     //!< buffer
 #ifndef WIN32
-  INIReader ini_reader_;  //!< ini ini_reader_
+  std::shared_ptr<const IniDatabase> database_;  //!< Parsed values of the file shared in the process
 #endif
 };
 
 template <size_t NumElement>
 void IniAccess::ReadVector(const char* section_name, const char* key_name, libra::Vector<NumElement>& data) {
   for (size_t i = 0; i < NumElement; i++) {
-    std::stringstream c_name;
-    c_name << key_name << "(" << i << ")";
-    data[i] = ReadDouble(section_name, c_name.str().c_str());
+    const std::string edited_key_name = key_name + ("(" + std::to_string(i) + ")");
+    data[i] = ReadDouble(section_name, edited_key_name.c_str());
   }
 }
 
@@ -0,0 +1,227 @@
+/**
+ * @file initialize_file_database.cpp
+ * @brief Process-wide database of parsed `ini` format files
+ */
+
+#include "initialize_file_database.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "library/external/inih/ini.h"
+#include "library/utilities/file_utility.hpp"
+
+static const char kSnapshotMagic[8] = {'S', '2', 'E', 'I', 'N', 'I', '\0', '\0'};
+static const uint32_t kSnapshotVersion = 1;
+
+static std::mutex database_mutex;                                                   //!< Mutex for the databases
+static std::map<std::string, std::shared_ptr<const IniDatabase>> database_registry;  //!< Databases with the file path as the key
+
+/**
+ * @fn ToLower
+ * @brief Convert the string to lower case in place
+ */
+static void ToLower(std::string& text) {
+  std::transform(text.begin(), text.end(), text.begin(), [](char c) { return static_cast<char>(std::tolower(c)); });
+}
+
+/**
+ * @fn ReplaceAll
+ * @brief Replace all occurrences of the keyword in the text
+ */
+static void ReplaceAll(std::string& text, const std::string& keyword, const std::string& replacement) {
+  size_t position = 0;
+  while ((position = text.find(keyword, position)) != std::string::npos) {
+    text.replace(position, keyword.size(), replacement);
+    position += replacement.size();
+  }
+}
+
+// Binary I/O for the snapshot file
+template <typename T>
+static void WriteValue(std::ofstream& file, const T& value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+static void WriteString(std::ofstream& file, const std::string& text) {
+  WriteValue(file, (uint32_t)text.size());
+  file.write(text.data(), text.size());
+}
+template <typename T>
+static bool ReadValue(std::ifstream& file, T& value) {
+  return (bool)file.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+static bool ReadString(std::ifstream& file, std::string& text) {
+  uint32_t size;
+  if (!ReadValue(file, size)) return false;
+  text.resize(size);
+  return (bool)file.read(&text[0], size);
+}
+
+IniDatabase::IniDatabase(const std::string& file_path) : file_path_(file_path) {
+  GetFileStatus(file_path_, file_size_B_, file_modified_time_);
+
+  // Duplicate keys are joined with a new line in the same way as INIReader
+  std::unordered_map<std::string, std::string> raw_values;
+  parse_error_ = ini_parse(file_path_.c_str(), ValueHandler, &raw_values);
+
+  entries_.reserve(raw_values.size());
+  for (const auto& raw_value : raw_values) {
+    SetEntry(raw_value.first, raw_value.second);
+  }
+}
+
+std::shared_ptr<const IniDatabase> IniDatabase::GetDatabase(const std::string& file_path) {
+  uint64_t file_size_B = 0;
+  int64_t file_modified_time = 0;
+  GetFileStatus(file_path, file_size_B, file_modified_time);
+
+  std::lock_guard<std::mutex> lock(database_mutex);
+  auto found = database_registry.find(file_path);
+  if (found != database_registry.end() && found->second->file_size_B_ == file_size_B && found->second->file_modified_time_ == file_modified_time) {
+    return found->second;
+  }
+  std::shared_ptr<const IniDatabase> database = std::make_shared<const IniDatabase>(file_path);
+  database_registry[file_path] = database;
+  return database;
+}
+
+bool IniDatabase::SaveSnapshot(const std::string& snapshot_file_path) {
+  // The snapshot is replaced atomically, so that the other runs never load the partially written file
+  const bool is_saved = ReplaceFileAtomically(snapshot_file_path, [](std::ofstream& file) {
+    std::lock_guard<std::mutex> lock(database_mutex);
+    file.write(kSnapshotMagic, sizeof(kSnapshotMagic));
+    WriteValue(file, kSnapshotVersion);
+    // The path keywords are replaced at the parsing, so the snapshot is valid only for the same build settings
+    WriteString(file, INI_FILE_DIR_FROM_EXE);
+    WriteString(file, EXT_LIB_DIR_FROM_EXE);
+    WriteString(file, CORE_DIR_FROM_EXE);
+    WriteValue(file, (uint32_t)database_registry.size());
+    for (const auto& registered : database_registry) {
+      const IniDatabase& database = *registered.second;
+      WriteString(file, database.file_path_);
+      WriteValue(file, database.file_size_B_);
+      WriteValue(file, database.file_modified_time_);
+      WriteValue(file, (int32_t)database.parse_error_);
+      WriteValue(file, (uint32_t)database.entries_.size());
+      for (const auto& entry : database.entries_) {
+        WriteString(file, entry.first);
+        WriteString(file, entry.second.value);
+        WriteValue(file, entry.second.real);
+        WriteValue(file, (int64_t)entry.second.integer);
+        WriteValue(file, (uint8_t)entry.second.boolean);
+      }
+    }
+  });
+  if (!is_saved) {
+    std::cerr << "[Warning] IniDatabase: Failed to save the snapshot file: " << snapshot_file_path << std::endl;
+  }
+  return is_saved;
+}
+
+size_t IniDatabase::LoadSnapshot(const std::string& snapshot_file_path) {
+  std::ifstream file(snapshot_file_path, std::ios::binary);
+  if (!file.is_open()) return 0;
+
+  char magic[sizeof(kSnapshotMagic)];
+  uint32_t version;
+  std::string ini_file_dir, ext_lib_dir, core_dir;
+  if (!file.read(magic, sizeof(magic)) || memcmp(magic, kSnapshotMagic, sizeof(magic)) != 0 || !ReadValue(file, version) ||
+      version != kSnapshotVersion || !ReadString(file, ini_file_dir) || !ReadString(file, ext_lib_dir) || !ReadString(file, core_dir) ||
+      ini_file_dir != INI_FILE_DIR_FROM_EXE || ext_lib_dir != EXT_LIB_DIR_FROM_EXE || core_dir != CORE_DIR_FROM_EXE) {
+    std::cerr << "[Warning] IniDatabase: The snapshot file is not compatible and ignored: " << snapshot_file_path << std::endl;
+    return 0;
+  }
+
+  uint32_t number_of_databases;
+  if (!ReadValue(file, number_of_databases)) return 0;
+  std::vector<std::shared_ptr<IniDatabase>> databases;
+  for (uint32_t i = 0; i < number_of_databases; i++) {
+    std::shared_ptr<IniDatabase> database(new IniDatabase());
+    int32_t parse_error;
+    uint32_t number_of_entries;
+    if (!ReadString(file, database->file_path_) || !ReadValue(file, database->file_size_B_) || !ReadValue(file, database->file_modified_time_) ||
+        !ReadValue(file, parse_error) || !ReadValue(file, number_of_entries)) {
+      std::cerr << "[Warning] IniDatabase: The snapshot file is broken and ignored: " << snapshot_file_path << std::endl;
+      return 0;
+    }
+    database->parse_error_ = parse_error;
+    database->entries_.reserve(number_of_entries);
+    for (uint32_t j = 0; j < number_of_entries; j++) {
+      std::string key;
+      Entry entry;
+      int64_t integer;
+      uint8_t boolean;
+      if (!ReadString(file, key) || !ReadString(file, entry.value) || !ReadValue(file, entry.real) || !ReadValue(file, integer) ||
+          !ReadValue(file, boolean)) {
+        std::cerr << "[Warning] IniDatabase: The snapshot file is broken and ignored: " << snapshot_file_path << std::endl;
+        return 0;
+      }
+      entry.integer = (long)integer;
+      entry.boolean = boolean != 0;
+      database->entries_.emplace(std::move(key), std::move(entry));
+    }
+    databases.push_back(database);
+  }
+
+  // Register only the databases whose files are not changed after the snapshot
+  size_t number_of_loaded_databases = 0;
+  std::lock_guard<std::mutex> lock(database_mutex);
+  for (const auto& database : databases) {
+    uint64_t file_size_B = 0;
+    int64_t file_modified_time = 0;
+    if (!GetFileStatus(database->file_path_, file_size_B, file_modified_time)) continue;
+    if (file_size_B != database->file_size_B_ || file_modified_time != database->file_modified_time_) continue;
+    database_registry[database->file_path_] = database;
+    number_of_loaded_databases++;
+  }
+  return number_of_loaded_databases;
+}
+
+const IniDatabase::Entry& IniDatabase::Find(const char* section_name, const char* key_name) const {
+  static const Entry kDefaultEntry = {"NULL", 0.0, 0, false};
+  thread_local std::string key;
+  key.assign(section_name);
+  key.push_back('=');
+  key.append(key_name);
+  ToLower(key);
+  const auto found = entries_.find(key);
+  return found == entries_.end() ? kDefaultEntry : found->second;
+}
+
+void IniDatabase::SetEntry(const std::string& key, const std::string& raw_value) {
+  Entry entry;
+  const char* value = raw_value.c_str();
+  char* end;
+  const double real = strtod(value, &end);
+  entry.real = end > value ? real : 0.0;
+  const long integer = strtol(value, &end, 0);
+  entry.integer = end > value ? integer : 0;
+
+  std::string lower_value = raw_value;
+  ToLower(lower_value);
+  entry.boolean = lower_value == "true" || lower_value == "yes" || lower_value == "on" || lower_value == "1";
+
+  entry.value = raw_value.empty() ? "NULL" : raw_value;
+  ReplaceAll(entry.value, "INI_FILE_DIR_FROM_EXE", INI_FILE_DIR_FROM_EXE);
+  ReplaceAll(entry.value, "EXT_LIB_DIR_FROM_EXE", EXT_LIB_DIR_FROM_EXE);
+  ReplaceAll(entry.value, "CORE_DIR_FROM_EXE", CORE_DIR_FROM_EXE);
+
+  entries_[key] = std::move(entry);
+}
+
+int IniDatabase::ValueHandler(void* user, const char* section, const char* name, const char* value) {
+  std::unordered_map<std::string, std::string>& raw_values = *static_cast<std::unordered_map<std::string, std::string>*>(user);
+  std::string key = std::string(section) + "=" + name;
+  ToLower(key);
+  std::string& raw_value = raw_values[key];
+  if (raw_value.size() > 0) raw_value += "\n";
+  raw_value += value ? value : "";
+  return 1;
+}
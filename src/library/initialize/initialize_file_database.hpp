@@ -0,0 +1,111 @@
+/**
+ * @file initialize_file_database.hpp
+ * @brief Process-wide database of parsed `ini` format files
+ */
+
+#ifndef S2E_LIBRARY_INITIALIZE_INITIALIZE_FILE_DATABASE_HPP_
+#define S2E_LIBRARY_INITIALIZE_INITIALIZE_FILE_DATABASE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @class IniDatabase
+ * @brief Typed key/value store of an `ini` format file
+ * @note Each file is parsed only once in the process, and the values are converted to the number, the boolean and the string
+ *       (with the special path keywords replaced) at the parsing. The database is immutable after the construction.
+ *       The parsed databases can be saved to a snapshot file and loaded in the later processes without parsing the files.
+ */
+class IniDatabase {
+ public:
+  /**
+   * @struct Entry
+   * @brief Value of a key
+   * @note The conversion rules are the same as INIReader
+   */
+  struct Entry {
+    std::string value;     //!< Value with the special path keywords replaced. "NULL" for empty values.
+    double real = 0.0;     //!< Value as a real number (0 when the value is not a number)
+    long integer = 0;      //!< Value as an integer (0 when the value is not a number)
+    bool boolean = false;  //!< Value as a boolean (false when the value is not a boolean)
+  };
+
+  /**
+   * @fn IniDatabase
+   * @brief Constructor to parse the file
+   * @param [in] file_path: Path to the `ini` format file
+   */
+  explicit IniDatabase(const std::string& file_path);
+
+  /**
+   * @fn GetDatabase
+   * @brief Return the database of the file shared in the process
+   * @note The file is parsed again when the size or the modification time of the file is changed. This function is thread-safe.
+   * @param [in] file_path: Path to the `ini` format file
+   */
+  static std::shared_ptr<const IniDatabase> GetDatabase(const std::string& file_path);
+  /**
+   * @fn SaveSnapshot
+   * @brief Save all databases in the process to a snapshot file
+   * @note The snapshot is written into the temporary file "<snapshot_file_path>.tmp" first, and the file is renamed to the snapshot file.
+   * @param [in] snapshot_file_path: Path to the snapshot file
+   * @return True when the snapshot is saved
+   */
+  static bool SaveSnapshot(const std::string& snapshot_file_path);
+  /**
+   * @fn LoadSnapshot
+   * @brief Load databases from a snapshot file
+   * @note The loaded databases are used only when the size and the modification time of the original files are not changed.
+   * @param [in] snapshot_file_path: Path to the snapshot file
+   * @return Number of the loaded databases
+   */
+  static size_t LoadSnapshot(const std::string& snapshot_file_path);
+
+  /**
+   * @fn Find
+   * @brief Return the entry of the key. An entry with the default values is returned when the key is not found.
+   * @note Section and key names are case-insensitive as same as INIReader
+   * @param [in] section_name: Section name
+   * @param [in] key_name: Key name
+   */
+  const Entry& Find(const char* section_name, const char* key_name) const;
+
+  // Getters
+  /**
+   * @fn GetParseError
+   * @brief Return the result of ini_parse, i.e., 0 on success, line number of the first error, -1 on file open error
+   */
+  inline int GetParseError() const { return parse_error_; }
+  /**
+   * @fn GetNumberOfEntries
+   * @brief Return number of the keys
+   */
+  inline size_t GetNumberOfEntries() const { return entries_.size(); }
+
+ private:
+  std::string file_path_;                           //!< Path to the file
+  uint64_t file_size_B_ = 0;                        //!< Size of the file at the parsing [Byte]
+  int64_t file_modified_time_ = 0;                  //!< Modification time of the file at the parsing [ns]
+  int parse_error_ = 0;                             //!< Result of ini_parse
+  std::unordered_map<std::string, Entry> entries_;  //!< Entries with the key "section=key" in lower case
+
+  /**
+   * @fn IniDatabase
+   * @brief Constructor for a database loaded from a snapshot
+   */
+  IniDatabase() {}
+  /**
+   * @fn SetEntry
+   * @brief Set the entry with the raw value and convert it to the typed values
+   */
+  void SetEntry(const std::string& key, const std::string& raw_value);
+  /**
+   * @fn ValueHandler
+   * @brief Handler called from ini_parse for each value
+   */
+  static int ValueHandler(void* user, const char* section, const char* name, const char* value);
+};
+
+#endif  // S2E_LIBRARY_INITIALIZE_INITIALIZE_FILE_DATABASE_HPP_
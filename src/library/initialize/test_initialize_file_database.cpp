@@ -0,0 +1,108 @@
+/**
+ * @file test_initialize_file_database.cpp
+ * @brief Test codes for IniDatabase class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "initialize_file_access.hpp"
+#include "initialize_file_database.hpp"
+
+class IniDatabaseTest : public ::testing::Test {
+ protected:
+  const std::string file_path_ = "test_initialize_file_database.ini";
+  const std::string snapshot_file_path_ = "test_initialize_file_database.snapshot";
+
+  void SetUp() override {
+    std::ofstream file(file_path_);
+    file << "[Section]" << std::endl;
+    file << "real = 1.5e3" << std::endl;
+    file << "integer = 0x10" << std::endl;
+    file << "Boolean = Yes" << std::endl;
+    file << "path = CORE_DIR_FROM_EXE/data" << std::endl;
+    file << "empty =" << std::endl;
+    file << "vector(0) = 1.0" << std::endl;
+    file << "vector(1) = -2.0" << std::endl;
+    file << "vector(2) = 3.0" << std::endl;
+  }
+  void TearDown() override {
+    std::remove(file_path_.c_str());
+    std::remove(snapshot_file_path_.c_str());
+  }
+};
+
+/**
+ * @brief Test the typed values and the default values
+ */
+TEST_F(IniDatabaseTest, TypedValues) {
+  IniDatabase database(file_path_);
+  ASSERT_EQ(0, database.GetParseError());
+  EXPECT_EQ(8, database.GetNumberOfEntries());
+
+  EXPECT_DOUBLE_EQ(1.5e3, database.Find("Section", "real").real);
+  EXPECT_EQ(1, database.Find("Section", "real").integer);
+  EXPECT_EQ(16, database.Find("section", "INTEGER").integer);
+  EXPECT_TRUE(database.Find("SECTION", "boolean").boolean);
+  EXPECT_EQ(std::string(CORE_DIR_FROM_EXE) + "/data", database.Find("Section", "path").value);
+  EXPECT_EQ("NULL", database.Find("Section", "empty").value);
+  EXPECT_EQ(0.0, database.Find("Section", "empty").real);
+
+  const IniDatabase::Entry& missing_entry = database.Find("Section", "missing");
+  EXPECT_EQ("NULL", missing_entry.value);
+  EXPECT_EQ(0.0, missing_entry.real);
+  EXPECT_EQ(0, missing_entry.integer);
+  EXPECT_FALSE(missing_entry.boolean);
+
+  IniDatabase missing_database("not_existing_file.ini");
+  EXPECT_EQ(-1, missing_database.GetParseError());
+}
+
+/**
+ * @brief Test that the database is shared and parsed again when the file is changed
+ */
+TEST_F(IniDatabaseTest, SharedDatabase) {
+  std::shared_ptr<const IniDatabase> database = IniDatabase::GetDatabase(file_path_);
+  EXPECT_EQ(database, IniDatabase::GetDatabase(file_path_));
+
+  IniAccess ini_file(file_path_);
+  EXPECT_DOUBLE_EQ(1.5e3, ini_file.ReadDouble("Section", "real"));
+  libra::Vector<3> vector;
+  ini_file.ReadVector("Section", "vector", vector);
+  EXPECT_DOUBLE_EQ(-2.0, vector[1]);
+
+  {
+    std::ofstream file(file_path_, std::ios::app);
+    file << "added = 7" << std::endl;
+  }
+  std::shared_ptr<const IniDatabase> updated_database = IniDatabase::GetDatabase(file_path_);
+  EXPECT_NE(database, updated_database);
+  EXPECT_EQ(7, updated_database->Find("Section", "added").integer);
+  EXPECT_EQ(0, database->Find("Section", "added").integer);
+}
+
+/**
+ * @brief Test saving and loading the snapshot
+ */
+TEST_F(IniDatabaseTest, Snapshot) {
+  std::shared_ptr<const IniDatabase> database = IniDatabase::GetDatabase(file_path_);
+  ASSERT_TRUE(IniDatabase::SaveSnapshot(snapshot_file_path_));
+  EXPECT_LE(1, IniDatabase::LoadSnapshot(snapshot_file_path_));
+
+  std::shared_ptr<const IniDatabase> loaded_database = IniDatabase::GetDatabase(file_path_);
+  EXPECT_NE(database, loaded_database);
+  EXPECT_EQ(database->GetNumberOfEntries(), loaded_database->GetNumberOfEntries());
+  EXPECT_DOUBLE_EQ(1.5e3, loaded_database->Find("Section", "real").real);
+  EXPECT_EQ(16, loaded_database->Find("Section", "integer").integer);
+  EXPECT_TRUE(loaded_database->Find("Section", "boolean").boolean);
+  EXPECT_EQ(database->Find("Section", "path").value, loaded_database->Find("Section", "path").value);
+
+  // The existing snapshot is replaced and the temporary file is not left
+  ASSERT_TRUE(IniDatabase::SaveSnapshot(snapshot_file_path_));
+  EXPECT_FALSE(std::ifstream(snapshot_file_path_ + ".tmp").is_open());
+  EXPECT_LE(1, IniDatabase::LoadSnapshot(snapshot_file_path_));
+
+  EXPECT_EQ(0, IniDatabase::LoadSnapshot("not_existing_file.snapshot"));
+}
@@ -0,0 +1,164 @@
+/**
+ * @file async_log_sink.cpp
+ * @brief Log sink to write records in a background thread through a bounded ring buffer
+ */
+
+#include "async_log_sink.hpp"
+
+#include <iostream>
+#include <limits>
+
+#include "binary_log_sink.hpp"
+
+AsyncLogSink::AsyncLogSink(ILogSink *output_sink, const size_t buffer_size, const AsyncLogOverflowPolicy overflow_policy)
+    : output_sink_(output_sink), overflow_policy_(overflow_policy) {
+  // At least two buffers are required to fill a record while the writer thread writes another one
+  size_t ring_size = buffer_size;
+  if (ring_size < 2) ring_size = 2;
+  ring_.resize(ring_size);
+
+  writer_thread_ = std::thread(&AsyncLogSink::WriterLoop, this);
+}
+
+AsyncLogSink::~AsyncLogSink() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stop_requested_ = true;
+  }
+  record_ready_.notify_one();
+  writer_thread_.join();
+
+  if (number_of_dropped_records_ > 0) {
+    std::cerr << "[WARNING] async log: " << number_of_dropped_records_ << " records are dropped since the log buffer was full" << std::endl;
+  }
+  delete output_sink_;
+}
+
+void AsyncLogSink::WriteHeaders(const std::vector<ILoggable *> &log_list, const bool add_newline) {
+  if (is_schema_written_) return;
+  for (auto itr = log_list.begin(); itr != log_list.end(); ++itr) {
+    if (!((*itr)->is_log_enabled_)) continue;
+    const size_t first_column = header_buffer_.size();
+    SplitLogHeader((*itr)->GetLogHeader(), header_buffer_);
+    (*itr)->AppendLogFormat(format_buffer_);
+    // Keep the formats aligned with the columns even if the loggable writes a column without the log utility functions
+    format_buffer_.resize(header_buffer_.size());
+
+    // The text formatted in the writer thread should be the same as GetLogValue, e.g., for the CSV file
+    std::vector<double> values;
+    (*itr)->AppendLogValue(values);
+    std::string text;
+    for (size_t i = 0; i < values.size() && first_column + i < format_buffer_.size(); i++) {
+      text += FormatLogValue(values[i], format_buffer_[first_column + i]);
+    }
+    if (text != (*itr)->GetLogValue() && first_column < header_buffer_.size()) {
+      std::cerr << "[WARNING] async log: the formatted values differ from GetLogValue from the column " << header_buffer_[first_column] << std::endl;
+    }
+  }
+  if (add_newline) WriteSchema(header_buffer_);
+}
+
+void AsyncLogSink::WriteValues(const std::vector<ILoggable *> &log_list, const bool add_newline) {
+  if (!is_schema_written_) return;
+  if (!is_record_started_) {
+    is_record_dropped_ = !AcquireBuffer();
+    is_record_started_ = true;
+  }
+
+  // The buffer at head is not accessed by the writer thread until it is committed
+  if (!is_record_dropped_) {
+    Record &record = ring_[head_];
+    for (auto itr = log_list.begin(); itr != log_list.end(); ++itr) {
+      if (!((*itr)->is_log_enabled_)) continue;
+      (*itr)->AppendLogValue(record.values);
+    }
+  }
+  if (!add_newline) return;
+
+  if (!is_record_dropped_) CommitBuffer();
+  is_record_started_ = false;
+}
+
+void AsyncLogSink::WriteSchema(const std::vector<std::string> &column_names) {
+  if (is_schema_written_) return;
+  // The formats collected in WriteHeaders are valid only for the same columns
+  if (format_buffer_.size() == column_names.size()) output_sink_->SetColumnFormats(format_buffer_);
+  output_sink_->WriteSchema(column_names);
+  number_of_columns_ = column_names.size();
+  for (auto itr = ring_.begin(); itr != ring_.end(); ++itr) {
+    itr->values.reserve(number_of_columns_);
+  }
+  is_schema_written_ = true;
+}
+
+void AsyncLogSink::WriteRecord(const double *values, const size_t size) {
+  if (!is_schema_written_ || is_record_started_) return;
+  if (!AcquireBuffer()) return;
+  ring_[head_].values.assign(values, values + size);
+  CommitBuffer();
+}
+
+void AsyncLogSink::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  buffer_released_.wait(lock, [this] { return count_ == 0; });
+}
+
+size_t AsyncLogSink::GetNumberOfDroppedRecords() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return number_of_dropped_records_;
+}
+
+size_t AsyncLogSink::GetNumberOfBlockedRecords() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return number_of_blocked_records_;
+}
+
+bool AsyncLogSink::AcquireBuffer() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (count_ < ring_.size()) return true;
+
+  if (overflow_policy_ == AsyncLogOverflowPolicy::kDrop) {
+    number_of_dropped_records_++;
+    return false;
+  }
+  number_of_blocked_records_++;
+  buffer_released_.wait(lock, [this] { return count_ < ring_.size(); });
+  return true;
+}
+
+void AsyncLogSink::CommitBuffer() {
+  // Keep the fixed record width even if a loggable changes its output size
+  std::vector<double> &values = ring_[head_].values;
+  if (values.size() != number_of_columns_) {
+    values.resize(number_of_columns_, std::numeric_limits<double>::quiet_NaN());
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    head_ = (head_ + 1) % ring_.size();
+    count_++;
+  }
+  record_ready_.notify_one();
+}
+
+void AsyncLogSink::WriterLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    record_ready_.wait(lock, [this] { return count_ > 0 || is_stop_requested_; });
+    if (count_ == 0 && is_stop_requested_) break;
+
+    // Write all waiting records without holding the lock
+    const size_t start = tail_;
+    const size_t number_of_records = count_;
+    lock.unlock();
+    for (size_t i = 0; i < number_of_records; i++) {
+      Record &record = ring_[(start + i) % ring_.size()];
+      output_sink_->WriteRecord(record.values.data(), record.values.size());
+      record.values.clear();
+    }
+    lock.lock();
+
+    tail_ = (start + number_of_records) % ring_.size();
+    count_ -= number_of_records;
+    buffer_released_.notify_all();
+  }
+}
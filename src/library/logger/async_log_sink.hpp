@@ -0,0 +1,149 @@
+/**
+ * @file async_log_sink.hpp
+ * @brief Log sink to write records in a background thread through a bounded ring buffer
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_ASYNC_LOG_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_ASYNC_LOG_SINK_HPP_
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "log_sink.hpp"
+
+/**
+ * @enum AsyncLogOverflowPolicy
+ * @brief Behavior when all record buffers in the ring are waiting for the writer thread
+ */
+enum class AsyncLogOverflowPolicy {
+  kBlock,  //!< Wait until the writer thread releases a buffer
+  kDrop,   //!< Discard the record
+};
+
+/**
+ * @class AsyncLogSink
+ * @brief Log sink to write records in a background thread through a bounded ring buffer
+ * @note The simulation thread only copies raw values (AppendLogValue of ILoggable) into a preallocated record buffer.
+ *       The writer thread formats and writes the records with the output sink, so the simulation thread does not wait for the file system.
+ *       The column formats (AppendLogFormat of ILoggable) are given to the output sink with the schema, so that a text format sink (e.g., CSV)
+ *       keeps the precision of each loggable and the non-numeric columns such as UTC string.
+ *       The remaining records are written and the output file is closed in the destructor.
+ */
+class AsyncLogSink : public ILogSink {
+ public:
+  /**
+   * @fn AsyncLogSink
+   * @brief Constructor
+   * @param [in] output_sink: Sink to write records in the writer thread. The ownership is moved to this class.
+   * @param [in] buffer_size: Number of record buffers in the ring
+   * @param [in] overflow_policy: Behavior when the ring is full
+   */
+  AsyncLogSink(ILogSink *output_sink, const size_t buffer_size, const AsyncLogOverflowPolicy overflow_policy = AsyncLogOverflowPolicy::kBlock);
+  /**
+   * @fn ~AsyncLogSink
+   * @brief Destructor: Write all remaining records and close the output sink
+   */
+  ~AsyncLogSink();
+
+  // Override ILogSink
+  /**
+   * @fn IsOpened
+   * @brief Override IsOpened function of ILogSink
+   */
+  inline bool IsOpened() const override { return output_sink_->IsOpened(); }
+  /**
+   * @fn WriteHeaders
+   * @brief Override WriteHeaders function of ILogSink
+   * @note The schema is written synchronously, and the column formats are collected from the loggables
+   */
+  void WriteHeaders(const std::vector<ILoggable *> &log_list, const bool add_newline) override;
+  /**
+   * @fn WriteValues
+   * @brief Override WriteValues function of ILogSink
+   * @note Values are copied into the ring and the record is passed to the writer thread when add_newline = true
+   */
+  void WriteValues(const std::vector<ILoggable *> &log_list, const bool add_newline) override;
+  /**
+   * @fn WriteSchema
+   * @brief Override WriteSchema function of ILogSink
+   */
+  void WriteSchema(const std::vector<std::string> &column_names) override;
+  /**
+   * @fn WriteRecord
+   * @brief Override WriteRecord function of ILogSink
+   */
+  void WriteRecord(const double *values, const size_t size) override;
+
+  /**
+   * @fn Flush
+   * @brief Wait until the writer thread writes all passed records
+   */
+  void Flush();
+
+  // Getter
+  /**
+   * @fn GetNumberOfDroppedRecords
+   * @brief Return number of records discarded by the kDrop policy
+   */
+  size_t GetNumberOfDroppedRecords();
+  /**
+   * @fn GetNumberOfBlockedRecords
+   * @brief Return number of records which waited for the writer thread by the kBlock policy
+   */
+  size_t GetNumberOfBlockedRecords();
+
+ private:
+  /**
+   * @struct Record
+   * @brief Buffer of a record in the ring
+   */
+  struct Record {
+    std::vector<double> values;  //!< Values copied by AppendLogValue or WriteRecord
+  };
+
+  ILogSink *output_sink_;                         //!< Sink to write records in the writer thread
+  const AsyncLogOverflowPolicy overflow_policy_;  //!< Behavior when the ring is full
+  std::vector<std::string> header_buffer_;        //!< Column names collected until the end of the header line
+  std::vector<LogColumnFormat> format_buffer_;    //!< Column formats collected until the end of the header line
+  size_t number_of_columns_ = 0;                  //!< Number of columns in the schema
+  bool is_schema_written_ = false;                //!< Is the schema written?
+
+  // Ring buffer
+  std::vector<Record> ring_;              //!< Preallocated record buffers
+  size_t head_ = 0;                       //!< Index of the buffer filled by the simulation thread
+  size_t tail_ = 0;                       //!< Index of the oldest buffer waiting for the writer thread
+  size_t count_ = 0;                      //!< Number of buffers waiting for the writer thread
+  bool is_record_started_ = false;        //!< Is the buffer at head acquired for the current record?
+  bool is_record_dropped_ = false;        //!< Is the current record discarded?
+  size_t number_of_dropped_records_ = 0;  //!< Number of records discarded by the kDrop policy
+  size_t number_of_blocked_records_ = 0;  //!< Number of records which waited for the writer thread
+
+  // Writer thread
+  std::thread writer_thread_;                //!< Writer thread
+  std::mutex mutex_;                         //!< Mutex for the ring indices and counters
+  std::condition_variable record_ready_;     //!< Notified when a record is passed to the writer thread
+  std::condition_variable buffer_released_;  //!< Notified when the writer thread releases buffers
+  bool is_stop_requested_ = false;           //!< Stop request for the writer thread
+
+  /**
+   * @fn AcquireBuffer
+   * @brief Acquire the buffer at head for a new record according to the overflow policy
+   * @return False when the record is discarded
+   */
+  bool AcquireBuffer();
+  /**
+   * @fn CommitBuffer
+   * @brief Pass the buffer at head to the writer thread
+   */
+  void CommitBuffer();
+  /**
+   * @fn WriterLoop
+   * @brief Main loop of the writer thread
+   */
+  void WriterLoop();
+};
+
+#endif  // S2E_LIBRARY_LOGGER_ASYNC_LOG_SINK_HPP_
@@ -0,0 +1,138 @@
+/**
+ * @file benchmark_log_sink.cpp
+ * @brief Throughput benchmark to compare CsvLogSink, BinaryLogSink, and AsyncLogSink
+ * @note Usage: benchmark_log_sink [number_of_records]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "async_log_sink.hpp"
+#include "binary_log_sink.hpp"
+#include "csv_log_sink.hpp"
+
+/**
+ * @class BenchmarkLoggable
+ * @brief Loggable which has typical outputs of orbit and attitude
+ */
+class BenchmarkLoggable : public ILoggable {
+ public:
+  BenchmarkLoggable(const std::string name) : name_(name) {}
+
+  std::string GetLogHeader() const override {
+    std::string str_tmp = "";
+    str_tmp += WriteVector(name_ + "_position", "i", "m", 3);
+    str_tmp += WriteVector(name_ + "_velocity", "i", "m/s", 3);
+    str_tmp += WriteQuaternion(name_ + "_quaternion", "i2b");
+    str_tmp += WriteVector(name_ + "_angular_velocity", "b", "rad/s", 3);
+    str_tmp += WriteScalar(name_ + "_energy", "J");
+    return str_tmp;
+  }
+  std::string GetLogValue() const override {
+    std::string str_tmp = "";
+    str_tmp += WriteVector(position_i_m_, 16);
+    str_tmp += WriteVector(velocity_i_m_s_, 10);
+    str_tmp += WriteQuaternion(quaternion_i2b_);
+    str_tmp += WriteVector(angular_velocity_b_rad_s_);
+    str_tmp += WriteScalar(energy_J_);
+    return str_tmp;
+  }
+  void AppendLogValue(std::vector<double>& values) const override {
+    AppendVector(values, position_i_m_);
+    AppendVector(values, velocity_i_m_s_);
+    AppendQuaternion(values, quaternion_i2b_);
+    AppendVector(values, angular_velocity_b_rad_s_);
+    AppendScalar(values, energy_J_);
+  }
+
+  void Update(const double time_s) {
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m_[i] = 6878137.0 * (i + 1) + time_s * 1.2345678;
+      velocity_i_m_s_[i] = 7612.0 / (i + 1) - time_s * 0.0012345;
+      angular_velocity_b_rad_s_[i] = 0.001 * (i + 1) + time_s * 1.0e-7;
+    }
+    quaternion_i2b_[0] = 0.1 + time_s * 1.0e-8;
+    energy_J_ = 0.5 + time_s * 1.0e-3;
+  }
+
+ private:
+  std::string name_;
+  libra::Vector<3> position_i_m_{0.0};
+  libra::Vector<3> velocity_i_m_s_{0.0};
+  libra::Quaternion quaternion_i2b_{0.0, 0.0, 0.0, 1.0};
+  libra::Vector<3> angular_velocity_b_rad_s_{0.0};
+  double energy_J_ = 0.0;
+};
+
+/**
+ * @fn RunBenchmark
+ * @brief Write records with the sink and return the elapsed time
+ */
+double RunBenchmark(ILogSink& sink, std::vector<BenchmarkLoggable>& loggables, const size_t number_of_records) {
+  std::vector<ILoggable*> log_list;
+  for (auto& loggable : loggables) log_list.push_back(&loggable);
+
+  sink.WriteHeaders(log_list, true);
+  auto start = std::chrono::steady_clock::now();
+  for (size_t record = 0; record < number_of_records; record++) {
+    for (auto& loggable : loggables) loggable.Update((double)record * 0.1);
+    sink.WriteValues(log_list, true);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+/**
+ * @fn GetFileSize
+ * @brief Return file size [Byte]
+ */
+double GetFileSize(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::in | std::ios::binary | std::ios::ate);
+  return (double)file.tellg();
+}
+
+int main(int argc, char* argv[]) {
+  size_t number_of_records = 100000;
+  if (argc > 1) number_of_records = std::strtoul(argv[1], nullptr, 10);
+  const size_t kNumberOfLoggables = 20;
+
+  std::vector<BenchmarkLoggable> loggables;
+  for (size_t i = 0; i < kNumberOfLoggables; i++) loggables.push_back(BenchmarkLoggable("object" + std::to_string(i)));
+
+  const std::string csv_file_path = "benchmark_log_sink.csv";
+  const std::string binary_file_path = "benchmark_log_sink.bin";
+  const std::string async_file_path = "benchmark_log_sink_async.csv";
+  double csv_time_s, binary_time_s, async_time_s;
+  {
+    CsvLogSink csv_sink(csv_file_path);
+    csv_time_s = RunBenchmark(csv_sink, loggables, number_of_records);
+  }
+  {
+    BinaryLogSink binary_sink(binary_file_path);
+    binary_time_s = RunBenchmark(binary_sink, loggables, number_of_records);
+  }
+  {
+    // Only the time spent in the simulation thread is measured. The remaining records are written at the destruction.
+    AsyncLogSink async_sink(new CsvLogSink(async_file_path), 1024, AsyncLogOverflowPolicy::kBlock);
+    async_time_s = RunBenchmark(async_sink, loggables, number_of_records);
+  }
+  const double csv_size_MB = GetFileSize(csv_file_path) / 1.0e6;
+  const double binary_size_MB = GetFileSize(binary_file_path) / 1.0e6;
+  std::remove(csv_file_path.c_str());
+  std::remove(binary_file_path.c_str());
+  std::remove(async_file_path.c_str());
+
+  std::cout << "Records: " << number_of_records << ", columns: " << kNumberOfLoggables * 14 << std::endl;
+  std::cout << "CSV    : " << csv_time_s << " s, " << number_of_records / csv_time_s << " records/s, " << csv_size_MB << " MB" << std::endl;
+  std::cout << "Binary : " << binary_time_s << " s, " << number_of_records / binary_time_s << " records/s, " << binary_size_MB << " MB" << std::endl;
+  std::cout << "Async  : " << async_time_s << " s in the simulation thread, " << number_of_records / async_time_s << " records/s" << std::endl;
+  std::cout << "Speed up (Binary): " << csv_time_s / binary_time_s << std::endl;
+  std::cout << "Speed up (Async) : " << csv_time_s / async_time_s << std::endl;
+
+  return 0;
+}
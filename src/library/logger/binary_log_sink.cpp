@@ -0,0 +1,88 @@
+/**
+ * @file binary_log_sink.cpp
+ * @brief Log sink to write typed binary file with fixed-width double columns
+ */
+
+#include "binary_log_sink.hpp"
+
+#include <iostream>
+#include <limits>
+
+const char BinaryLogSink::kMagic[8] = {'S', '2', 'E', 'B', 'L', 'O', 'G', '\0'};
+const uint32_t BinaryLogSink::kFormatVersion = 1;
+const size_t BinaryLogSink::kWriteBufferSize_B = 1 << 20;
+
+BinaryLogSink::BinaryLogSink(const std::string &file_path) {
+  write_buffer_.resize(kWriteBufferSize_B);
+  binary_file_.rdbuf()->pubsetbuf(write_buffer_.data(), write_buffer_.size());
+  binary_file_.open(file_path, std::ios::out | std::ios::binary);
+  is_file_opened_ = binary_file_.is_open();
+  if (!is_file_opened_) std::cerr << "Error opening log file: " << file_path << std::endl;
+}
+
+BinaryLogSink::~BinaryLogSink() {
+  if (is_file_opened_) {
+    binary_file_.close();
+  }
+}
+
+void BinaryLogSink::WriteHeaders(const std::vector<ILoggable *> &log_list, const bool add_newline) {
+  if (!is_file_opened_ || is_schema_written_) return;
+  for (auto itr = log_list.begin(); itr != log_list.end(); ++itr) {
+    if (!((*itr)->is_log_enabled_)) continue;
+    SplitLogHeader((*itr)->GetLogHeader(), header_buffer_);
+  }
+  if (add_newline) WriteSchema(header_buffer_);
+}
+
+void BinaryLogSink::WriteValues(const std::vector<ILoggable *> &log_list, const bool add_newline) {
+  if (!is_file_opened_ || !is_schema_written_) return;
+  for (auto itr = log_list.begin(); itr != log_list.end(); ++itr) {
+    if (!((*itr)->is_log_enabled_)) continue;
+    (*itr)->AppendLogValue(record_);
+  }
+  if (!add_newline) return;
+
+  // Keep the fixed record width even if a loggable changes its output size
+  if (record_.size() != column_names_.size()) {
+    if (!is_size_mismatch_warned_) {
+      std::cerr << "[WARNING] binary log: number of values " << record_.size() << " does not match number of columns " << column_names_.size()
+                << std::endl;
+      is_size_mismatch_warned_ = true;
+    }
+    record_.resize(column_names_.size(), std::numeric_limits<double>::quiet_NaN());
+  }
+  WriteRecord(record_.data(), record_.size());
+  record_.clear();
+}
+
+void BinaryLogSink::WriteSchema(const std::vector<std::string> &column_names) {
+  if (!is_file_opened_ || is_schema_written_) return;
+  column_names_ = column_names;
+  binary_file_.write(kMagic, sizeof(kMagic));
+  WriteUint32(kFormatVersion);
+  WriteUint32((uint32_t)column_names_.size());
+  for (auto itr = column_names_.begin(); itr != column_names_.end(); ++itr) {
+    WriteUint32((uint32_t)itr->size());
+    binary_file_.write(itr->data(), itr->size());
+  }
+  record_.reserve(column_names_.size());
+  is_schema_written_ = true;
+}
+
+void BinaryLogSink::WriteRecord(const double *values, const size_t size) {
+  if (!is_file_opened_ || !is_schema_written_) return;
+  binary_file_.write(reinterpret_cast<const char *>(values), size * sizeof(double));
+}
+
+void BinaryLogSink::WriteUint32(const uint32_t value) { binary_file_.write(reinterpret_cast<const char *>(&value), sizeof(value)); }
+
+void SplitLogHeader(const std::string &header, std::vector<std::string> &column_names) {
+  size_t start = 0;
+  while (start < header.size()) {
+    size_t end = header.find(',', start);
+    if (end == std::string::npos) end = header.size();
+    column_names.push_back(header.substr(start, end - start));
+    start = end + 1;
+  }
+}
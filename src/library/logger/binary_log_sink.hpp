@@ -0,0 +1,110 @@
+/**
+ * @file binary_log_sink.hpp
+ * @brief Log sink to write typed binary file with fixed-width double columns
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_BINARY_LOG_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_BINARY_LOG_SINK_HPP_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "log_sink.hpp"
+
+/**
+ * @class BinaryLogSink
+ * @brief Log sink to write typed binary file with fixed-width double columns
+ * @note File layout (all integers are uint32, doubles are IEEE754 binary64, both in host byte order, i.e. little-endian on x86 and ARM)
+ *         magic "S2EBLOG" + '\0' (8 bytes)
+ *         format version
+ *         number of columns N
+ *         N x (length of column name, column name without terminator)
+ *         records: N x double per log output timing until the end of file
+ *       The schema is taken from GetLogHeader only once. Values are taken from AppendLogValue of ILoggable, so the text formatting is
+ *       skipped for the loggables which override it. Columns which cannot be expressed as double (e.g., UTC string) are stored as NaN.
+ *       Use scripts/Plot/convert_binary_log_to_csv.py to export the file as CSV.
+ */
+class BinaryLogSink : public ILogSink {
+ public:
+  static const char kMagic[8];             //!< Magic number at the top of the file
+  static const uint32_t kFormatVersion;    //!< Version of the file format
+  static const size_t kWriteBufferSize_B;  //!< Size of the file stream buffer [Byte]
+
+  /**
+   * @fn BinaryLogSink
+   * @brief Constructor
+   * @param [in] file_path: Path to the output binary file
+   */
+  BinaryLogSink(const std::string &file_path);
+  /**
+   * @fn ~BinaryLogSink
+   * @brief Destructor
+   */
+  ~BinaryLogSink();
+
+  // Override ILogSink
+  /**
+   * @fn IsOpened
+   * @brief Override IsOpened function of ILogSink
+   */
+  inline bool IsOpened() const override { return is_file_opened_; }
+  /**
+   * @fn WriteHeaders
+   * @brief Override WriteHeaders function of ILogSink
+   * @note The schema is fixed at the first call with add_newline = true. Later calls are ignored.
+   */
+  void WriteHeaders(const std::vector<ILoggable *> &log_list, const bool add_newline) override;
+  /**
+   * @fn WriteValues
+   * @brief Override WriteValues function of ILogSink
+   * @note A record is written when add_newline = true
+   */
+  void WriteValues(const std::vector<ILoggable *> &log_list, const bool add_newline) override;
+  /**
+   * @fn WriteSchema
+   * @brief Override WriteSchema function of ILogSink
+   * @note The schema is written only once. Later calls are ignored.
+   */
+  void WriteSchema(const std::vector<std::string> &column_names) override;
+  /**
+   * @fn WriteRecord
+   * @brief Override WriteRecord function of ILogSink
+   */
+  void WriteRecord(const double *values, const size_t size) override;
+
+  // Getter
+  /**
+   * @fn GetColumnNames
+   * @brief Return column names of the schema
+   */
+  inline const std::vector<std::string> &GetColumnNames() const { return column_names_; }
+
+ private:
+  std::ofstream binary_file_;               //!< Binary file stream
+  std::vector<char> write_buffer_;          //!< Buffer for the file stream
+  bool is_file_opened_;                     //!< Is the binary file opened?
+  bool is_schema_written_ = false;          //!< Is the schema written?
+  bool is_size_mismatch_warned_ = false;    //!< Is the warning for record size mismatch already shown?
+  std::vector<std::string> header_buffer_;  //!< Column names collected until the end of the header line
+  std::vector<std::string> column_names_;   //!< Column names of the schema
+  std::vector<double> record_;              //!< Buffer for one record
+
+  /**
+   * @fn WriteUint32
+   * @brief Write uint32 value into the file
+   * @param [in] value: Target value
+   */
+  void WriteUint32(const uint32_t value);
+};
+
+/**
+ * @fn SplitLogHeader
+ * @brief Split CSV style header string into column names
+ * @param [in] header: Header string like "a[m],b[m],"
+ * @param [out] column_names: Column names are appended to this list
+ */
+void SplitLogHeader(const std::string &header, std::vector<std::string> &column_names);
+
+#endif  // S2E_LIBRARY_LOGGER_BINARY_LOG_SINK_HPP_
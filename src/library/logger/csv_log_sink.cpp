@@ -0,0 +1,65 @@
+/**
+ * @file csv_log_sink.cpp
+ * @brief Log sink to write CSV text file
+ */
+
+#include "csv_log_sink.hpp"
+
+#include <cstdio>
+#include <iostream>
+
+const int CsvLogSink::kRecordPrecision = 16;
+
+CsvLogSink::CsvLogSink(const std::string &file_path) {
+  csv_file_.open(file_path);
+  is_file_opened_ = csv_file_.is_open();
+  if (!is_file_opened_) std::cerr << "Error opening log file: " << file_path << std::endl;
+}
+
+CsvLogSink::~CsvLogSink() {
+  if (is_file_opened_) {
+    csv_file_.close();
+  }
+}
+
+void CsvLogSink::WriteHeaders(const std::vector<ILoggable *> &log_list, const bool add_newline) {
+  if (!is_file_opened_) return;
+  for (auto itr = log_list.begin(); itr != log_list.end(); ++itr) {
+    if (!((*itr)->is_log_enabled_)) continue;
+    csv_file_ << (*itr)->GetLogHeader();
+  }
+  if (add_newline) csv_file_ << "\n";
+}
+
+void CsvLogSink::WriteValues(const std::vector<ILoggable *> &log_list, const bool add_newline) {
+  if (!is_file_opened_) return;
+  for (auto itr = log_list.begin(); itr != log_list.end(); ++itr) {
+    if (!((*itr)->is_log_enabled_)) continue;
+    csv_file_ << (*itr)->GetLogValue();
+  }
+  if (add_newline) csv_file_ << "\n";
+}
+
+void CsvLogSink::WriteSchema(const std::vector<std::string> &column_names) {
+  if (!is_file_opened_) return;
+  for (auto itr = column_names.begin(); itr != column_names.end(); ++itr) {
+    csv_file_ << *itr << ",";
+  }
+  csv_file_ << "\n";
+}
+
+void CsvLogSink::WriteRecord(const double *values, const size_t size) {
+  if (!is_file_opened_) return;
+  char buffer[64];
+  for (size_t i = 0; i < size; i++) {
+    if (i < column_formats_.size()) {
+      csv_file_ << FormatLogValue(values[i], column_formats_[i]);
+    } else {
+      const int length = snprintf(buffer, sizeof(buffer), "%.*g,", kRecordPrecision, values[i]);
+      csv_file_.write(buffer, length);
+    }
+  }
+  csv_file_ << "\n";
+}
+
+void CsvLogSink::SetColumnFormats(const std::vector<LogColumnFormat> &column_formats) { column_formats_ = column_formats; }
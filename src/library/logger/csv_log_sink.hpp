@@ -0,0 +1,74 @@
+/**
+ * @file csv_log_sink.hpp
+ * @brief Log sink to write CSV text file
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_CSV_LOG_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_CSV_LOG_SINK_HPP_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "log_sink.hpp"
+
+/**
+ * @class CsvLogSink
+ * @brief Log sink to write CSV text file
+ */
+class CsvLogSink : public ILogSink {
+ public:
+  /**
+   * @fn CsvLogSink
+   * @brief Constructor
+   * @param [in] file_path: Path to the output CSV file
+   */
+  CsvLogSink(const std::string &file_path);
+  /**
+   * @fn ~CsvLogSink
+   * @brief Destructor
+   */
+  ~CsvLogSink();
+
+  // Override ILogSink
+  /**
+   * @fn IsOpened
+   * @brief Override IsOpened function of ILogSink
+   */
+  inline bool IsOpened() const override { return is_file_opened_; }
+  /**
+   * @fn WriteHeaders
+   * @brief Override WriteHeaders function of ILogSink
+   */
+  void WriteHeaders(const std::vector<ILoggable *> &log_list, const bool add_newline) override;
+  /**
+   * @fn WriteValues
+   * @brief Override WriteValues function of ILogSink
+   */
+  void WriteValues(const std::vector<ILoggable *> &log_list, const bool add_newline) override;
+  /**
+   * @fn WriteSchema
+   * @brief Override WriteSchema function of ILogSink
+   */
+  void WriteSchema(const std::vector<std::string> &column_names) override;
+  /**
+   * @fn WriteRecord
+   * @brief Override WriteRecord function of ILogSink
+   * @note Values are formatted with the column formats. Without them, values are formatted with kRecordPrecision digits.
+   */
+  void WriteRecord(const double *values, const size_t size) override;
+  /**
+   * @fn SetColumnFormats
+   * @brief Override SetColumnFormats function of ILogSink
+   */
+  void SetColumnFormats(const std::vector<LogColumnFormat> &column_formats) override;
+
+  static const int kRecordPrecision;  //!< Number of significant digits for WriteRecord
+
+ private:
+  std::ofstream csv_file_;                       //!< CSV file stream
+  bool is_file_opened_;                          //!< Is the CSV file opened?
+  std::vector<LogColumnFormat> column_formats_;  //!< Formats of the columns for WriteRecord
+};
+
+#endif  // S2E_LIBRARY_LOGGER_CSV_LOG_SINK_HPP_
@@ -12,8 +12,10 @@ Logger* InitLog(std::string file_name) {
 
   std::string log_file_path = ini_file.ReadString("SIMULATION_SETTINGS", "log_file_save_directory");
   bool log_ini = ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files");
+  LogFileFormat log_file_format = ConvertLogFileFormat(ini_file.ReadString("SIMULATION_SETTINGS", "log_file_format"));
 
-  Logger* log = new Logger("default.csv", log_file_path, file_name, log_ini, true);
+  Logger* log = new Logger("default" + GetLogFileExtension(log_file_format), log_file_path, file_name, log_ini, true, log_file_format);
+  InitLogAsyncMode(log, file_name);
 
   return log;
 }
@@ -28,3 +30,15 @@ Logger* InitMonteCarloLog(std::string file_name, bool enable) {
 
   return log;
 }
+
+void InitLogAsyncMode(Logger* logger, std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "SIMULATION_SETTINGS";
+
+  if (!ini_file.ReadEnable(section, "log_async_mode")) return;
+  int buffer_size = ini_file.ReadInt(section, "log_async_buffer_size");
+  if (buffer_size < 0) buffer_size = 0;
+  AsyncLogOverflowPolicy overflow_policy = ConvertAsyncLogOverflowPolicy(ini_file.ReadString(section, "log_async_overflow_policy"));
+
+  logger->EnableAsyncMode((size_t)buffer_size, overflow_policy);
+}
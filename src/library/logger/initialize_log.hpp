@@ -23,4 +23,12 @@ Logger* InitLog(std::string file_name);
  */
 Logger* InitMonteCarloLog(std::string file_name, bool enable);
 
+/**
+ * @fn InitLogAsyncMode
+ * @brief Enable asynchronous log output of the logger when it is selected in the initialize file
+ * @param [in] logger: Target logger
+ * @param [in] file_name: File name of the initialize file
+ */
+void InitLogAsyncMode(Logger* logger, std::string file_name);
+
 #endif  // S2E_LIBRARY_LOGGER_INITIALIZE_LOG_HPP_
@@ -0,0 +1,71 @@
+/**
+ * @file log_sink.hpp
+ * @brief Interface class for log output destinations
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_LOG_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_LOG_SINK_HPP_
+
+#include <string>
+#include <vector>
+
+#include "loggable.hpp"
+
+/**
+ * @class ILogSink
+ * @brief Interface class for log output destinations
+ * @note Logger owns one sink and forwards the log list to it at every log output timing
+ */
+class ILogSink {
+ public:
+  /**
+   * @fn ~ILogSink
+   * @brief Destructor
+   */
+  virtual ~ILogSink() {}
+
+  /**
+   * @fn IsOpened
+   * @brief Return true when the output file is opened
+   */
+  virtual bool IsOpened() const = 0;
+
+  /**
+   * @fn WriteHeaders
+   * @brief Write headers of all enabled loggables in the log list
+   * @param [in] log_list: Log list
+   * @param [in] add_newline: Finish the current line (record) or not
+   */
+  virtual void WriteHeaders(const std::vector<ILoggable *> &log_list, const bool add_newline) = 0;
+  /**
+   * @fn WriteValues
+   * @brief Write values of all enabled loggables in the log list
+   * @param [in] log_list: Log list
+   * @param [in] add_newline: Finish the current line (record) or not
+   */
+  virtual void WriteValues(const std::vector<ILoggable *> &log_list, const bool add_newline) = 0;
+
+  /**
+   * @fn WriteSchema
+   * @brief Write column names of the following records
+   * @param [in] column_names: Column names
+   */
+  virtual void WriteSchema(const std::vector<std::string> &column_names) = 0;
+  /**
+   * @fn WriteRecord
+   * @brief Write one record which is already converted to double values
+   * @param [in] values: Values of the record
+   * @param [in] size: Number of values. This must match the number of columns in the schema.
+   */
+  virtual void WriteRecord(const double *values, const size_t size) = 0;
+
+  /**
+   * @fn SetColumnFormats
+   * @brief Set text formats of the columns to format the values of the following records
+   * @note This is called just before WriteSchema by the sinks which pass the values of AppendLogValue to a text format sink
+   * @param [in] column_formats: Formats of the columns
+   */
+  virtual void SetColumnFormats(const std::vector<LogColumnFormat> &column_formats) { static_cast<void>(column_formats); }
+};
+
+#endif  // S2E_LIBRARY_LOGGER_LOG_SINK_HPP_
@@ -6,11 +6,59 @@
 #ifndef S2E_LIBRARY_LOGGER_LOG_UTILITY_HPP_
 #define S2E_LIBRARY_LOGGER_LOG_UTILITY_HPP_
 
+#include <cmath>
+#include <cstdio>
+#include <functional>
 #include <iomanip>
 #include <library/math/matrix_vector.hpp>
 #include <library/math/quaternion.hpp>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @enum LogValueType
+ * @brief Type of a log column to format the value as text
+ */
+enum class LogValueType {
+  kReal,     //!< Real number written with the precision
+  kInteger,  //!< Integer written with all digits
+  kString,   //!< Non-numeric text converted from the value
+};
+
+/**
+ * @struct LogColumnFormat
+ * @brief Text format of a log column for the text log sinks which format the values of AppendLogValue
+ */
+struct LogColumnFormat {
+  LogValueType type = LogValueType::kReal;                    //!< Type of the value
+  int precision = 6;                                          //!< Number of significant digits for kReal
+  std::function<std::string(const double)> string_converter;  //!< Function to convert the value to the text for kString without the comma
+};
+
+/**
+ * @var log_column_format_recorder
+ * @brief Output list of the formats used by the log value writing functions below. The formats are not recorded when it is nullptr.
+ * @note This is set only while ILoggable::AppendLogFormat calls GetLogValue
+ */
+inline thread_local std::vector<LogColumnFormat>* log_column_format_recorder = nullptr;
+
+/**
+ * @fn RecordLogColumnFormat
+ * @brief Append the format of the written columns to log_column_format_recorder when it is set
+ * @param [in] type: Type of the values
+ * @param [in] precision: precision for the value (number of digit)
+ * @param [in] number_of_columns: Number of the written columns
+ */
+inline void RecordLogColumnFormat(const LogValueType type, const int precision, const size_t number_of_columns);
+/**
+ * @fn FormatLogValue
+ * @brief Write a value given by AppendLogValue with the column format in the same way as the log value writing functions
+ * @param [in] value: Value of the column
+ * @param [in] format: Format of the column
+ */
+inline std::string FormatLogValue(const double value, const LogColumnFormat& format);
 
 /**
  * @fn WriteScalar
@@ -79,11 +127,64 @@ inline std::string WriteQuaternion(const libra::Quaternion quaternion, const int
  */
 inline std::string WriteQuaternion(const std::string name, const std::string frame);
 
+/**
+ * @fn AppendScalar
+ * @brief Append scalar value for binary log output
+ * @param [out] values: Output value list
+ * @param [in] scalar: scalar value
+ */
+template <typename T>
+inline void AppendScalar(std::vector<double>& values, const T scalar);
+/**
+ * @fn AppendVector
+ * @brief Append Vector value for binary log output
+ * @param [out] values: Output value list
+ * @param [in] vector: vector value
+ */
+template <size_t NUM>
+inline void AppendVector(std::vector<double>& values, const libra::Vector<NUM, double>& vector);
+/**
+ * @fn AppendMatrix
+ * @brief Append Matrix value for binary log output
+ * @param [out] values: Output value list
+ * @param [in] matrix: matrix value
+ */
+template <size_t ROW, size_t COLUMN>
+inline void AppendMatrix(std::vector<double>& values, const libra::Matrix<ROW, COLUMN, double>& matrix);
+/**
+ * @fn AppendQuaternion
+ * @brief Append quaternion value for binary log output
+ * @param [out] values: Output value list
+ * @param [in] quaternion: Quaternion
+ */
+inline void AppendQuaternion(std::vector<double>& values, const libra::Quaternion& quaternion);
+
 //
 // Libraries for log writing
 //
+void RecordLogColumnFormat(const LogValueType type, const int precision, const size_t number_of_columns) {
+  if (log_column_format_recorder == nullptr) return;
+  LogColumnFormat format;
+  format.type = type;
+  format.precision = precision;
+  log_column_format_recorder->insert(log_column_format_recorder->end(), number_of_columns, format);
+}
+
+std::string FormatLogValue(const double value, const LogColumnFormat& format) {
+  if (format.type == LogValueType::kString && format.string_converter) return format.string_converter(value) + ",";
+  char buffer[64];
+  if (format.type == LogValueType::kInteger && std::isfinite(value)) {
+    snprintf(buffer, sizeof(buffer), "%lld,", (long long)value);
+  } else {
+    // Same as the stream output with std::setprecision
+    snprintf(buffer, sizeof(buffer), "%.*g,", format.precision, value);
+  }
+  return buffer;
+}
+
 template <typename T>
 std::string WriteScalar(const T scalar, const int precision) {
+  RecordLogColumnFormat(std::is_integral_v<T> ? LogValueType::kInteger : LogValueType::kReal, precision, 1);
   std::stringstream str_tmp;
   str_tmp << std::setprecision(precision) << scalar << ",";
   return str_tmp.str();
@@ -92,6 +193,7 @@ std::string WriteScalar(const std::string name, const std::string unit) { return
 
 template <size_t NUM>
 std::string WriteVector(const libra::Vector<NUM, double> vector, const int precision) {
+  RecordLogColumnFormat(LogValueType::kReal, precision, NUM);
   std::stringstream str_tmp;
 
   for (size_t n = 0; n < NUM; n++) {
@@ -116,6 +218,7 @@ std::string WriteVector(const std::string name, const std::string frame, const s
 
 template <size_t ROW, size_t COLUMN>
 std::string WriteMatrix(const libra::Matrix<ROW, COLUMN, double> matrix, const int precision) {
+  RecordLogColumnFormat(LogValueType::kReal, precision, ROW * COLUMN);
   std::stringstream str_tmp;
 
   for (size_t n = 0; n < ROW; n++) {
@@ -139,6 +242,7 @@ std::string WriteMatrix(const std::string name, const std::string frame, const s
 }
 
 std::string WriteQuaternion(const libra::Quaternion quaternion, const int precision) {
+  RecordLogColumnFormat(LogValueType::kReal, precision, 4);
   std::stringstream str_tmp;
 
   for (size_t i = 0; i < 4; i++) {
@@ -156,4 +260,31 @@ std::string WriteQuaternion(const std::string name, const std::string frame) {
   return str_tmp.str();
 }
 
+template <typename T>
+void AppendScalar(std::vector<double>& values, const T scalar) {
+  values.push_back(static_cast<double>(scalar));
+}
+
+template <size_t NUM>
+void AppendVector(std::vector<double>& values, const libra::Vector<NUM, double>& vector) {
+  for (size_t n = 0; n < NUM; n++) {
+    values.push_back(vector[n]);
+  }
+}
+
+template <size_t ROW, size_t COLUMN>
+void AppendMatrix(std::vector<double>& values, const libra::Matrix<ROW, COLUMN, double>& matrix) {
+  for (size_t n = 0; n < ROW; n++) {
+    for (size_t m = 0; m < COLUMN; m++) {
+      values.push_back(matrix[n][m]);
+    }
+  }
+}
+
+void AppendQuaternion(std::vector<double>& values, const libra::Quaternion& quaternion) {
+  for (size_t i = 0; i < 4; i++) {
+    values.push_back(quaternion[i]);
+  }
+}
+
 #endif  // S2E_LIBRARY_LOGGER_LOG_UTILITY_HPP_
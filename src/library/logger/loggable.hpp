@@ -6,7 +6,10 @@
 #ifndef S2E_LIBRARY_LOGGER_LOGGABLE_HPP_
 #define S2E_LIBRARY_LOGGER_LOGGABLE_HPP_
 
+#include <cstdlib>
+#include <limits>
 #include <string>
+#include <vector>
 
 #include "log_utility.hpp"  // This is not necessary but include here for convenience
 
@@ -31,6 +34,43 @@ class ILoggable {
    */
   virtual std::string GetLogValue() const = 0;
 
+  /**
+   * @fn AppendLogValue
+   * @brief Append values as double for binary log output
+   * @note The default implementation parses the string of GetLogValue, and non-numeric values are appended as NaN.
+   *       Override this to skip the text formatting. The number of appended values must match the number of columns in GetLogHeader.
+   * @param [out] values: The output values are appended to this list
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const {
+    const std::string log_value = GetLogValue();
+    size_t start = 0;
+    while (start < log_value.size()) {
+      size_t end = log_value.find(',', start);
+      if (end == std::string::npos) end = log_value.size();
+      const std::string field = log_value.substr(start, end - start);
+      char* parse_end = nullptr;
+      double value = std::strtod(field.c_str(), &parse_end);
+      if (field.empty() || *parse_end != '\0') value = std::numeric_limits<double>::quiet_NaN();
+      values.push_back(value);
+      start = end + 1;
+    }
+  }
+
+  /**
+   * @fn AppendLogFormat
+   * @brief Append text formats of the columns to format the values of AppendLogValue in the same way as GetLogValue
+   * @note The default implementation records the formats used by the log utility functions (WriteScalar, WriteVector, etc.) in GetLogValue.
+   *       GetLogValue must call them in the order of the columns, e.g., in separate statements instead of a chain of `+`,
+   *       since the evaluation order of the operands is unspecified. Override this when GetLogValue writes a column without them,
+   *       such as a non-numeric text.
+   * @param [out] formats: The formats are appended to this list
+   */
+  virtual void AppendLogFormat(std::vector<LogColumnFormat>& formats) const {
+    log_column_format_recorder = &formats;
+    GetLogValue();
+    log_column_format_recorder = nullptr;
+  }
+
   bool is_log_enabled_ = true;  //!< Log enable flag
 };
 
@@ -6,6 +6,7 @@
 #include "logger.hpp"
 
 #include <ctime>
+#include <iostream>
 #include <sstream>
 #ifdef _WIN32
 #include <direct.h>
@@ -13,12 +14,16 @@
 #include <sys/stat.h>
 #endif
 
+#include "binary_log_sink.hpp"
+#include "csv_log_sink.hpp"
+
 std::vector<ILoggable *> log_list_;
 bool Logger::is_directory_created_ = false;
+std::mutex Logger::directory_mutex_;
 
 Logger::Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool is_ini_save_enabled,
-               const bool is_enabled)
-    : is_enabled_(is_enabled), is_ini_save_enabled_(is_ini_save_enabled) {
+               const bool is_enabled, const LogFileFormat file_format)
+    : file_format_(file_format), is_enabled_(is_enabled), is_ini_save_enabled_(is_ini_save_enabled) {
   is_file_opened_ = false;
   if (is_enabled_ == false) return;
 
@@ -30,52 +35,47 @@ Logger::Logger(const std::string &file_name, const std::string &data_path, const
   strftime(start_time_c, 64, "%y%m%d_%H%M%S", now);
 
   // Create directory
-  if (is_ini_save_enabled_ == true || is_directory_created_ == false) {
-    directory_path_ = CreateDirectory(data_path, start_time_c);
-  } else {
-    directory_path_ = data_path;
+  // The check and the creation are done under the lock since loggers of Monte-Carlo cases can be constructed in parallel
+  {
+    std::lock_guard<std::mutex> lock(directory_mutex_);
+    if (is_ini_save_enabled_ == true || is_directory_created_ == false) {
+      directory_path_ = CreateDirectory(data_path, start_time_c);
+    } else {
+      directory_path_ = data_path;
+    }
   }
   // Create File
   std::stringstream file_path;
   file_path << directory_path_ << start_time_c << "_" << file_name;
   if (is_enabled_) {
-    csv_file_.open(file_path.str());
-    is_file_opened_ = csv_file_.is_open();
-    if (!is_file_opened_) std::cerr << "Error opening log file: " << file_path.str() << std::endl;
+    if (file_format_ == LogFileFormat::kBinary) {
+      log_sink_.reset(new BinaryLogSink(file_path.str()));
+    } else {
+      log_sink_.reset(new CsvLogSink(file_path.str()));
+    }
+    is_file_opened_ = log_sink_->IsOpened();
   }
 
   // Copy SimBase.ini
   CopyFileToLogDirectory(ini_file_name);
 }
 
-Logger::~Logger(void) {
-  if (is_file_opened_) {
-    csv_file_.close();
-  }
-}
+Logger::~Logger(void) {}
 
 void Logger::WriteHeaders(const bool add_newline) {
-  for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
-    if (!((*itr)->is_log_enabled_)) continue;
-    Write((*itr)->GetLogHeader());
-  }
-  if (add_newline) WriteNewLine();
+  if (!is_enabled_ || !is_file_opened_) return;
+  log_sink_->WriteHeaders(log_list_, add_newline);
 }
 
 void Logger::WriteValues(const bool add_newline) {
-  for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
-    if (!((*itr)->is_log_enabled_)) continue;
-    Write((*itr)->GetLogValue());
-  }
-  if (add_newline) WriteNewLine();
+  if (!is_enabled_ || !is_file_opened_) return;
+  log_sink_->WriteValues(log_list_, add_newline);
 }
 
-void Logger::WriteNewLine() { Write("\n"); }
-
-void Logger::Write(const std::string log, const bool flag) {
-  if (flag && is_enabled_) {
-    csv_file_ << log;
-  }
+void Logger::EnableAsyncMode(const size_t buffer_size, const AsyncLogOverflowPolicy overflow_policy) {
+  if (log_sink_ == nullptr || is_async_mode_) return;
+  log_sink_.reset(new AsyncLogSink(log_sink_.release(), buffer_size, overflow_policy));
+  is_async_mode_ = true;
 }
 
 void Logger::AddLogList(ILoggable *loggable) { log_list_.push_back(loggable); }
@@ -129,3 +129,26 @@ std::string Logger::GetFileName(const std::string &path) {
 
   return path;
 }
+
+LogFileFormat ConvertLogFileFormat(const std::string format) {
+  if (format == "BINARY") {
+    return LogFileFormat::kBinary;
+  }
+  // if format is not BINARY, set CSV
+  return LogFileFormat::kCsv;
+}
+
+std::string GetLogFileExtension(const LogFileFormat format) {
+  if (format == LogFileFormat::kBinary) {
+    return ".bin";
+  }
+  return ".csv";
+}
+
+AsyncLogOverflowPolicy ConvertAsyncLogOverflowPolicy(const std::string policy) {
+  if (policy == "DROP") {
+    return AsyncLogOverflowPolicy::kDrop;
+  }
+  // if policy is not DROP, set BLOCK
+  return AsyncLogOverflowPolicy::kBlock;
+}
@@ -9,11 +9,24 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "async_log_sink.hpp"
+#include "log_sink.hpp"
 #include "loggable.hpp"
 
+/**
+ * @enum LogFileFormat
+ * @brief Format of the log output file
+ */
+enum class LogFileFormat {
+  kCsv,     //!< CSV text file
+  kBinary,  //!< Typed binary file with fixed-width double columns
+};
+
 /**
  * @class Logger
  * @brief Class to manage log output file
@@ -28,9 +41,10 @@ class Logger {
    * @param [in] ini_file_name: Initialize file name
    * @param [in] is_ini_save_enabled: Enable flag to save ini files
    * @param [in] is_enabled: Enable flag for logging
+   * @param [in] file_format: Format of the log output file
    */
   Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool is_ini_save_enabled,
-         const bool is_enabled = true);
+         const bool is_enabled = true, const LogFileFormat file_format = LogFileFormat::kCsv);
   /**
    * @fn ~Logger
    * @brief Destructor
@@ -67,6 +81,14 @@ class Logger {
    * @brief Set enable flag of the log
    */
   inline void Enable(const bool enable) { is_enabled_ = enable; }
+  /**
+   * @fn EnableAsyncMode
+   * @brief Write the log file in a background thread
+   * @note Call this before WriteHeaders. In the CSV format, the text of each loggable is passed to the writer thread as it is.
+   * @param [in] buffer_size: Number of record buffers in the ring
+   * @param [in] overflow_policy: Behavior when all record buffers are waiting for the writer thread
+   */
+  void EnableAsyncMode(const size_t buffer_size, const AsyncLogOverflowPolicy overflow_policy);
   /**
    * @fn CopyFileToLogDirectory
    * @brief Copy a file (e.g., ini file) into the log directory
@@ -85,31 +107,30 @@ class Logger {
    * @brief Return the path to the directory for log files
    */
   inline std::string GetLogPath() const { return directory_path_; }
+  /**
+   * @fn GetFileFormat
+   * @brief Return format of the log output file
+   */
+  inline LogFileFormat GetFileFormat() const { return file_format_; }
+  /**
+   * @fn IsAsyncMode
+   * @brief Return true when the log file is written in a background thread
+   */
+  inline bool IsAsyncMode() const { return is_async_mode_; }
 
  private:
-  std::ofstream csv_file_;             //!< CSV file stream
-  bool is_enabled_;                    //!< Enable flag for logging
-  bool is_file_opened_;                //!< Is the CSV file opened?
-  static bool is_directory_created_;   //!< Is the log output directory is created in the scenario
-  std::vector<ILoggable *> log_list_;  //!< Log list
+  std::unique_ptr<ILogSink> log_sink_;  //!< Log output destination
+  LogFileFormat file_format_;           //!< Format of the log output file
+  bool is_async_mode_ = false;          //!< Is the log file written in a background thread?
+  bool is_enabled_;                     //!< Enable flag for logging
+  bool is_file_opened_;                 //!< Is the log file opened?
+  static bool is_directory_created_;    //!< Is the log output directory is created in the scenario
+  static std::mutex directory_mutex_;   //!< Mutex for the creation of the log output directory
+  std::vector<ILoggable *> log_list_;   //!< Log list
 
   bool is_ini_save_enabled_;    //!< Enable flag to save ini files
   std::string directory_path_;  //!< Path to the directory for log files
 
-  /**
-   * @fn Write
-   * @brief Write string to the log
-   * @param [in] log: Write target
-   * @param [in] flag: Enable flag to write
-   */
-  void Write(const std::string log, const bool flag = true);
-
-  /**
-   * @fn WriteNewline
-   * @brief Write newline
-   */
-  void WriteNewLine();
-
   /**
    * @fn CreateDirectory
    * @brief Create a directory to store the log files
@@ -128,4 +149,28 @@ class Logger {
   std::string GetFileName(const std::string &path);
 };
 
+/**
+ * @fn ConvertLogFileFormat
+ * @brief Convert string to LogFileFormat
+ * @param [in] format: Format name (CSV or BINARY)
+ * @return Log file format. CSV is selected for unknown names.
+ */
+LogFileFormat ConvertLogFileFormat(const std::string format);
+
+/**
+ * @fn GetLogFileExtension
+ * @brief Return file extension for the log file format
+ * @param [in] format: Log file format
+ * @return File extension including the dot
+ */
+std::string GetLogFileExtension(const LogFileFormat format);
+
+/**
+ * @fn ConvertAsyncLogOverflowPolicy
+ * @brief Convert string to AsyncLogOverflowPolicy
+ * @param [in] policy: Policy name (BLOCK or DROP)
+ * @return Overflow policy. BLOCK is selected for unknown names.
+ */
+AsyncLogOverflowPolicy ConvertAsyncLogOverflowPolicy(const std::string policy);
+
 #endif  // S2E_LIBRARY_LOGGER_LOGGER_HPP_
@@ -0,0 +1,214 @@
+/**
+ * @file test_async_log_sink.cpp
+ * @brief Test codes for AsyncLogSink class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <library/utilities/macros.hpp>
+
+#include "async_log_sink.hpp"
+#include "csv_log_sink.hpp"
+
+/**
+ * @class RecordingSink
+ * @brief Output sink for the test which stores the written records in memory
+ */
+class RecordingSink : public ILogSink {
+ public:
+  RecordingSink(std::vector<std::vector<double>>& records, std::vector<std::string>& column_names, const int write_delay_ms = 0)
+      : records_(records), column_names_(column_names), write_delay_ms_(write_delay_ms) {}
+
+  bool IsOpened() const override { return true; }
+  void WriteHeaders(const std::vector<ILoggable*>& log_list, const bool add_newline) override {
+    UNUSED(log_list);
+    UNUSED(add_newline);
+  }
+  void WriteValues(const std::vector<ILoggable*>& log_list, const bool add_newline) override {
+    UNUSED(log_list);
+    UNUSED(add_newline);
+  }
+  void WriteSchema(const std::vector<std::string>& column_names) override { column_names_ = column_names; }
+  void WriteRecord(const double* values, const size_t size) override {
+    if (write_delay_ms_ > 0) std::this_thread::sleep_for(std::chrono::milliseconds(write_delay_ms_));
+    records_.push_back(std::vector<double>(values, values + size));
+  }
+
+ private:
+  std::vector<std::vector<double>>& records_;
+  std::vector<std::string>& column_names_;
+  int write_delay_ms_;
+};
+
+/**
+ * @class CounterLoggable
+ * @brief Loggable class for the test
+ */
+class CounterLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const override { return WriteScalar("counter", "-") + WriteVector("value", "i", "m", 3); }
+  std::string GetLogValue() const override {
+    number_of_text_outputs_++;
+    // The columns are written in order for the format recording of AppendLogFormat
+    std::string str_tmp = WriteScalar(counter_);
+    str_tmp += WriteVector(value_i_m_);
+    return str_tmp;
+  }
+  void AppendLogValue(std::vector<double>& values) const override {
+    AppendScalar(values, counter_);
+    AppendVector(values, value_i_m_);
+  }
+
+  size_t counter_ = 0;
+  libra::Vector<3> value_i_m_{0.0};
+  mutable size_t number_of_text_outputs_ = 0;
+};
+
+/**
+ * @class TimeStringLoggable
+ * @brief Loggable class for the test which has a non-numeric column and a non-default precision
+ */
+class TimeStringLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const override { return WriteScalar("time_string", "UTC") + WriteScalar("elapsed_time", "s"); }
+  std::string GetLogValue() const override { return WriteTimeString((double)counter_) + "," + WriteScalar(elapsed_time_s_, 10); }
+  void AppendLogValue(std::vector<double>& values) const override {
+    AppendScalar(values, counter_);
+    AppendScalar(values, elapsed_time_s_);
+  }
+  void AppendLogFormat(std::vector<LogColumnFormat>& formats) const override {
+    LogColumnFormat time_string_format;
+    time_string_format.type = LogValueType::kString;
+    time_string_format.string_converter = WriteTimeString;
+    formats.push_back(time_string_format);
+    LogColumnFormat elapsed_time_format;
+    elapsed_time_format.precision = 10;
+    formats.push_back(elapsed_time_format);
+  }
+
+  static std::string WriteTimeString(const double counter) { return "2020/01/01 00:00:" + std::to_string((size_t)counter); }
+
+  size_t counter_ = 0;
+  double elapsed_time_s_ = 0.0;
+};
+
+/**
+ * @fn ReadFile
+ * @brief Read whole text of the file for the test
+ */
+std::string ReadFile(const std::string& file_path) {
+  std::ifstream file(file_path);
+  std::stringstream text;
+  text << file.rdbuf();
+  return text.str();
+}
+
+/**
+ * @brief Test that all records are written in order with the kBlock policy
+ */
+TEST(AsyncLogSink, BlockPolicy) {
+  std::vector<std::vector<double>> records;
+  std::vector<std::string> column_names;
+  CounterLoggable loggable;
+  std::vector<ILoggable*> log_list = {&loggable};
+
+  const size_t kRecordNum = 1000;
+  size_t number_of_blocked_records;
+  {
+    AsyncLogSink sink(new RecordingSink(records, column_names), 4, AsyncLogOverflowPolicy::kBlock);
+    sink.WriteHeaders(log_list, true);
+    for (size_t i = 0; i < kRecordNum; i++) {
+      loggable.counter_ = i;
+      loggable.value_i_m_[0] = (double)i * 0.5;
+      sink.WriteValues(log_list, true);
+    }
+    sink.Flush();
+    EXPECT_EQ(kRecordNum, records.size());
+    EXPECT_EQ(0, sink.GetNumberOfDroppedRecords());
+    number_of_blocked_records = sink.GetNumberOfBlockedRecords();
+  }
+  EXPECT_LE(number_of_blocked_records, kRecordNum);
+
+  ASSERT_EQ(4, column_names.size());
+  EXPECT_EQ("counter[-]", column_names[0]);
+  ASSERT_EQ(kRecordNum, records.size());
+  for (size_t i = 0; i < kRecordNum; i++) {
+    ASSERT_EQ(4, records[i].size());
+    EXPECT_DOUBLE_EQ((double)i, records[i][0]);
+    EXPECT_DOUBLE_EQ((double)i * 0.5, records[i][1]);
+  }
+}
+
+/**
+ * @brief Test that the ring memory is bounded with the kDrop policy
+ */
+TEST(AsyncLogSink, DropPolicy) {
+  std::vector<std::vector<double>> records;
+  std::vector<std::string> column_names;
+  CounterLoggable loggable;
+  std::vector<ILoggable*> log_list = {&loggable};
+
+  const size_t kRecordNum = 100;
+  size_t number_of_dropped_records;
+  {
+    AsyncLogSink sink(new RecordingSink(records, column_names, 1), 2, AsyncLogOverflowPolicy::kDrop);
+    sink.WriteHeaders(log_list, true);
+    for (size_t i = 0; i < kRecordNum; i++) {
+      loggable.counter_ = i;
+      sink.WriteValues(log_list, true);
+    }
+    number_of_dropped_records = sink.GetNumberOfDroppedRecords();
+  }
+
+  // All records which are not dropped are written at the destruction
+  EXPECT_GT(number_of_dropped_records, 0);
+  EXPECT_EQ(kRecordNum, records.size() + number_of_dropped_records);
+  for (size_t i = 1; i < records.size(); i++) {
+    EXPECT_LT(records[i - 1][0], records[i][0]);
+  }
+}
+
+/**
+ * @brief Test that the CSV file written in the async mode is the same as the file written synchronously
+ */
+TEST(AsyncLogSink, CsvText) {
+  const std::string sync_file_path = "test_async_log_sink_sync.csv";
+  const std::string async_file_path = "test_async_log_sink_async.csv";
+  TimeStringLoggable time_string_loggable;
+  CounterLoggable counter_loggable;
+  std::vector<ILoggable*> log_list = {&time_string_loggable, &counter_loggable};
+
+  const size_t kRecordNum = 100;
+  {
+    CsvLogSink sync_sink(sync_file_path);
+    AsyncLogSink async_sink(new CsvLogSink(async_file_path), 2, AsyncLogOverflowPolicy::kBlock);
+    sync_sink.WriteHeaders(log_list, true);
+    async_sink.WriteHeaders(log_list, true);
+    // The async sink calls GetLogValue only in WriteHeaders to collect and check the column formats
+    const size_t number_of_header_text_outputs = counter_loggable.number_of_text_outputs_;
+    for (size_t i = 0; i < kRecordNum; i++) {
+      time_string_loggable.counter_ = i;
+      time_string_loggable.elapsed_time_s_ = (double)i / 3.0;
+      // The integer larger than the default precision is written with all digits
+      counter_loggable.counter_ = 1234567 + i;
+      counter_loggable.value_i_m_[2] = (double)i * 0.25;
+      sync_sink.WriteValues(log_list, true);
+      async_sink.WriteValues(log_list, true);
+    }
+    EXPECT_EQ(number_of_header_text_outputs + kRecordNum, counter_loggable.number_of_text_outputs_);
+  }
+
+  const std::string sync_text = ReadFile(sync_file_path);
+  const std::string async_text = ReadFile(async_file_path);
+  EXPECT_NE(std::string::npos, async_text.find("2020/01/01 00:00:99,"));
+  EXPECT_EQ(std::string::npos, async_text.find("nan"));
+  EXPECT_EQ(sync_text, async_text);
+
+  std::remove(sync_file_path.c_str());
+  std::remove(async_file_path.c_str());
+}
@@ -0,0 +1,137 @@
+/**
+ * @file test_binary_log_sink.cpp
+ * @brief Test codes for BinaryLogSink class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "binary_log_sink.hpp"
+
+/**
+ * @class TestLoggable
+ * @brief Loggable class for the test with typed output
+ */
+class TestLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const override { return WriteVector("position", "i", "m", 3) + WriteScalar("flag"); }
+  std::string GetLogValue() const override { return WriteVector(position_i_m_) + WriteScalar(flag_); }
+  void AppendLogValue(std::vector<double>& values) const override {
+    AppendVector(values, position_i_m_);
+    AppendScalar(values, flag_);
+  }
+
+  libra::Vector<3> position_i_m_{0.0};
+  bool flag_ = false;
+};
+
+/**
+ * @class TestTextLoggable
+ * @brief Loggable class for the test without typed output
+ */
+class TestTextLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const override { return WriteScalar("value", "-") + WriteScalar("time", "UTC"); }
+  std::string GetLogValue() const override { return WriteScalar(value_) + "2020/01/01 00:00:00.000,"; }
+
+  double value_ = 0.0;
+};
+
+/**
+ * @brief Read uint32 value from the file
+ */
+uint32_t ReadUint32(std::ifstream& file) {
+  uint32_t value = 0;
+  file.read(reinterpret_cast<char*>(&value), sizeof(value));
+  return value;
+}
+
+/**
+ * @brief Test for default AppendLogValue which parses the text output
+ */
+TEST(BinaryLogSink, DefaultAppendLogValue) {
+  TestTextLoggable loggable;
+  loggable.value_ = 1.5;
+
+  std::vector<double> values;
+  loggable.AppendLogValue(values);
+
+  ASSERT_EQ(2, values.size());
+  EXPECT_DOUBLE_EQ(1.5, values[0]);
+  EXPECT_TRUE(std::isnan(values[1]));
+}
+
+/**
+ * @brief Test for SplitLogHeader function
+ */
+TEST(BinaryLogSink, SplitLogHeader) {
+  std::vector<std::string> column_names;
+  SplitLogHeader("a[m],b[m],c,", column_names);
+
+  ASSERT_EQ(3, column_names.size());
+  EXPECT_EQ("a[m]", column_names[0]);
+  EXPECT_EQ("b[m]", column_names[1]);
+  EXPECT_EQ("c", column_names[2]);
+}
+
+/**
+ * @brief Test for written schema and records
+ */
+TEST(BinaryLogSink, WriteAndRead) {
+  const std::string file_path = "test_binary_log_sink.bin";
+  TestLoggable loggable;
+  TestTextLoggable text_loggable;
+  std::vector<ILoggable*> log_list = {&loggable, &text_loggable};
+
+  const size_t kRecordNum = 10;
+  {
+    BinaryLogSink sink(file_path);
+    ASSERT_TRUE(sink.IsOpened());
+    sink.WriteHeaders(log_list, true);
+    for (size_t i = 0; i < kRecordNum; i++) {
+      loggable.position_i_m_[0] = (double)i;
+      loggable.position_i_m_[1] = (double)i * 2.0;
+      loggable.position_i_m_[2] = (double)i * 3.0;
+      loggable.flag_ = (i % 2 == 0);
+      text_loggable.value_ = (double)i * 0.5;
+      sink.WriteValues(log_list, true);
+    }
+  }
+
+  std::ifstream file(file_path, std::ios::in | std::ios::binary);
+  ASSERT_TRUE(file.is_open());
+  char magic[8];
+  file.read(magic, sizeof(magic));
+  EXPECT_EQ(0, std::memcmp(magic, BinaryLogSink::kMagic, sizeof(magic)));
+  EXPECT_EQ(BinaryLogSink::kFormatVersion, ReadUint32(file));
+
+  const std::vector<std::string> expected_names = {"position_i_x[m]", "position_i_y[m]", "position_i_z[m]", "flag", "value[-]", "time[UTC]"};
+  const uint32_t column_num = ReadUint32(file);
+  ASSERT_EQ(expected_names.size(), column_num);
+  for (size_t i = 0; i < column_num; i++) {
+    const uint32_t length = ReadUint32(file);
+    std::string name(length, '\0');
+    file.read(&name[0], length);
+    EXPECT_EQ(expected_names[i], name);
+  }
+
+  std::vector<double> record(column_num);
+  for (size_t i = 0; i < kRecordNum; i++) {
+    file.read(reinterpret_cast<char*>(record.data()), column_num * sizeof(double));
+    ASSERT_TRUE(file.good());
+    EXPECT_DOUBLE_EQ((double)i, record[0]);
+    EXPECT_DOUBLE_EQ((double)i * 2.0, record[1]);
+    EXPECT_DOUBLE_EQ((double)i * 3.0, record[2]);
+    EXPECT_DOUBLE_EQ((i % 2 == 0) ? 1.0 : 0.0, record[3]);
+    EXPECT_DOUBLE_EQ((double)i * 0.5, record[4]);
+    EXPECT_TRUE(std::isnan(record[5]));
+  }
+  file.read(reinterpret_cast<char*>(record.data()), sizeof(double));
+  EXPECT_TRUE(file.eof());
+  file.close();
+
+  std::remove(file_path.c_str());
+}
@@ -5,87 +5,124 @@
 
 #include "interpolation.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace libra {
 
+Interpolation::Interpolation(const std::vector<double>& independent_variables, const std::vector<double>& dependent_variables) {
+  degree_ = independent_variables.size();
+  if (degree_ < 2) {
+    std::cout << "[WARNINGS] Interpolation degree is smaller than 2" << std::endl;
+  }
+
+  // Two copies of the window
+  independent_variables_ = independent_variables;
+  independent_variables_.insert(independent_variables_.end(), independent_variables.begin(), independent_variables.end());
+  dependent_variables_ = dependent_variables;
+  dependent_variables_.resize(degree_, 0.0);
+  dependent_variables_.resize(2 * degree_);
+  std::copy(dependent_variables_.begin(), dependent_variables_.begin() + degree_, dependent_variables_.begin() + degree_);
+}
+
 double Interpolation::CalcPolynomial(const double x) const {
-  // Search nearest point
-  size_t nearest_x_id = FindNearestPoint(x);
-
-  // Neville's algorithm
-  double y_output = dependent_variables_[nearest_x_id];
-  std::vector<double> down_diff = dependent_variables_;
-  std::vector<double> up_diff = dependent_variables_;
-  size_t d_idx = 1;
-  for (size_t m = 1; m < degree_; m++) {
-    // Calculate C and D
-    for (size_t i = 0; i < degree_ - m; i++) {
-      double denominator = independent_variables_[i] - independent_variables_[i + m];
-      double down_minus_up = down_diff[i + 1] - up_diff[i];
-      up_diff[i] = (independent_variables_[i + m] - x) * down_minus_up / denominator;
-      down_diff[i] = (independent_variables_[i] - x) * down_minus_up / denominator;
-    }
+  const std::vector<double>& weights = GetPolynomialWeights();
 
-    // Upstream first calculation
-    double dy;
-    if (nearest_x_id >= m) {
-      dy = up_diff[nearest_x_id - d_idx];
-      d_idx++;
-    } else {
-      dy = down_diff[0];
-    }
-    y_output += dy;
+  // Second form of the barycentric formula
+  double numerator = 0.0;
+  double denominator = 0.0;
+  for (size_t i = 0; i < degree_; i++) {
+    const double difference = x - GetIndependentVariable(i);
+    if (difference == 0.0) return GetDependentVariable(i);
+    const double term = weights[i] / difference;
+    numerator += term * GetDependentVariable(i);
+    denominator += term;
   }
-
-  return y_output;
+  return numerator / denominator;
 }
 
 double Interpolation::CalcTrigonometric(const double x, const double period) const {
-  double y_output = 0.0;
-  size_t end_id = degree_;
-  size_t start_id = 0;
+  size_t start_id, end_id;
+  const std::vector<double>& weights = GetTrigonometricWeights(x, period, start_id, end_id);
 
-  // Modify to odd number degrees
-  // TODO: implement more efficient method
-  if (degree_ % 2 == 0) {
-    size_t nearest_point = FindNearestPoint(x);
-    // Remove the farthest point
-    if (nearest_point * 2 < degree_) {
-      end_id--;
-    } else {
-      start_id++;
+  // First form of the barycentric formula: l(x) * w_i / d(x, x_i), where l(x) is the product of d(x, x_j) for all nodes
+  double node_polynomial = 1.0;
+  double weighted_sum = 0.0;
+  for (size_t i = start_id; i < end_id; i++) {
+    const double difference = sin(period * (x - GetIndependentVariable(i)) / 2.0);
+    if (difference == 0.0) return GetDependentVariable(i);
+    node_polynomial *= difference;
+    weighted_sum += weights[i] / difference * GetDependentVariable(i);
+  }
+  return node_polynomial * weighted_sum;
+}
+
+void Interpolation::CalcPolynomialCoefficients(const double x, std::vector<double>& coefficients) const {
+  const std::vector<double>& weights = GetPolynomialWeights();
+  coefficients.assign(degree_, 0.0);
+
+  double denominator = 0.0;
+  for (size_t i = 0; i < degree_; i++) {
+    const double difference = x - GetIndependentVariable(i);
+    if (difference == 0.0) {
+      // x is on the node
+      coefficients.assign(degree_, 0.0);
+      coefficients[i] = 1.0;
+      return;
     }
+    coefficients[i] = weights[i] / difference;
+    denominator += coefficients[i];
   }
+  for (size_t i = 0; i < degree_; i++) coefficients[i] /= denominator;
+}
 
-  for (size_t i = start_id; i < end_id; ++i) {
-    double t_k = 1.0;
-    for (size_t j = start_id; j < end_id; ++j) {
-      if (i == j) continue;
-      t_k *= sin(period * (x - independent_variables_[j]) / 2.0) / sin(period * (independent_variables_[i] - independent_variables_[j]) / 2.0);
+void Interpolation::CalcTrigonometricCoefficients(const double x, const double period, std::vector<double>& coefficients) const {
+  size_t start_id, end_id;
+  const std::vector<double>& weights = GetTrigonometricWeights(x, period, start_id, end_id);
+  coefficients.assign(degree_, 0.0);
+
+  double node_polynomial = 1.0;
+  for (size_t i = start_id; i < end_id; i++) {
+    const double difference = sin(period * (x - GetIndependentVariable(i)) / 2.0);
+    if (difference == 0.0) {
+      // x is on the node
+      coefficients.assign(degree_, 0.0);
+      coefficients[i] = 1.0;
+      return;
     }
-    y_output += t_k * dependent_variables_[i];
+    coefficients[i] = weights[i] / difference;
+    node_polynomial *= difference;
   }
+  for (size_t i = start_id; i < end_id; i++) coefficients[i] *= node_polynomial;
+}
 
+double Interpolation::CalcWeightedSum(const std::vector<double>& coefficients) const {
+  double y_output = 0.0;
+  for (size_t i = 0; i < degree_; i++) {
+    y_output += coefficients[i] * GetDependentVariable(i);
+  }
   return y_output;
 }
 
 bool Interpolation::PushAndPopData(const double independent_variable, const double dependent_variable) {
-  if (independent_variable <= independent_variables_.back()) {
+  if (degree_ == 0 || independent_variable <= GetIndependentVariable(degree_ - 1)) {
     return false;
   }
-  independent_variables_.erase(independent_variables_.begin());
-  independent_variables_.push_back(independent_variable);
-  dependent_variables_.erase(dependent_variables_.begin());
-  dependent_variables_.push_back(dependent_variable);
+  // Overwrite the oldest data in both copies and move the head
+  independent_variables_[head_] = independent_variable;
+  independent_variables_[head_ + degree_] = independent_variable;
+  dependent_variables_[head_] = dependent_variable;
+  dependent_variables_[head_ + degree_] = dependent_variable;
+  head_ = (head_ + 1) % degree_;
+  InvalidateWeights();
   return true;
 }
 
 size_t Interpolation::FindNearestPoint(const double x) const {
   size_t output = 0;
-  double difference1 = fabs(x - independent_variables_[0]);
+  double difference1 = fabs(x - GetIndependentVariable(0));
   for (size_t i = 0; i < degree_; i++) {
-    double difference2 = fabs(x - independent_variables_[i]);
+    double difference2 = fabs(x - GetIndependentVariable(i));
     if (difference2 < difference1) {
       difference1 = difference2;
       output = i;
@@ -94,4 +131,58 @@ size_t Interpolation::FindNearestPoint(const double x) const {
   return output;
 }
 
+const std::vector<double>& Interpolation::GetPolynomialWeights() const {
+  if (polynomial_weights_.is_valid) return polynomial_weights_.weights;
+
+  polynomial_weights_.weights.assign(degree_, 0.0);
+  for (size_t i = 0; i < degree_; i++) {
+    double product = 1.0;
+    for (size_t j = 0; j < degree_; j++) {
+      if (i == j) continue;
+      product *= GetIndependentVariable(i) - GetIndependentVariable(j);
+    }
+    polynomial_weights_.weights[i] = 1.0 / product;
+  }
+  polynomial_weights_.is_valid = true;
+  return polynomial_weights_.weights;
+}
+
+const std::vector<double>& Interpolation::GetTrigonometricWeights(const double x, const double period, size_t& start_id, size_t& end_id) const {
+  // Modify to odd number degrees by removing the farthest point
+  start_id = 0;
+  end_id = degree_;
+  size_t cache_id = 0;
+  if (degree_ % 2 == 0) {
+    size_t nearest_point = FindNearestPoint(x);
+    if (nearest_point * 2 < degree_) {
+      end_id--;
+    } else {
+      start_id++;
+      cache_id = 1;
+    }
+  }
+
+  BarycentricWeights& cache = trigonometric_weights_[cache_id];
+  if (cache.is_valid && cache.period == period) return cache.weights;
+
+  cache.weights.assign(degree_, 0.0);
+  for (size_t i = start_id; i < end_id; i++) {
+    double product = 1.0;
+    for (size_t j = start_id; j < end_id; j++) {
+      if (i == j) continue;
+      product *= sin(period * (GetIndependentVariable(i) - GetIndependentVariable(j)) / 2.0);
+    }
+    cache.weights[i] = 1.0 / product;
+  }
+  cache.period = period;
+  cache.is_valid = true;
+  return cache.weights;
+}
+
+void Interpolation::InvalidateWeights() {
+  polynomial_weights_.is_valid = false;
+  trigonometric_weights_[0].is_valid = false;
+  trigonometric_weights_[1].is_valid = false;
+}
+
 }  // namespace libra
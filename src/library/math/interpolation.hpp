@@ -14,6 +14,9 @@ namespace libra {
 /**
  * @class Interpolation
  * @brief Class for interpolation calculation
+ * @details The data are stored in a fixed capacity circular window. The buffer holds two copies of the window, so the window is always
+ *          contiguous and PushAndPopData is O(1). The barycentric weights of the nodes are calculated at the first evaluation after the
+ *          window changes, and the following evaluations cost O(n).
  */
 class Interpolation {
  public:
@@ -24,18 +27,12 @@ class Interpolation {
    * @param[in] independent_variables: Set of independent variables
    * @param[in] dependent_variables: Set of independent variables
    */
-  inline Interpolation(std::vector<double> independent_variables, std::vector<double> dependent_variables)
-      : independent_variables_(independent_variables), dependent_variables_(dependent_variables) {
-    degree_ = independent_variables_.size();
-    if (degree_ < 2) {
-      std::cout << "[WARNINGS] Interpolation degree is smaller than 2" << std::endl;
-    }
-  }
+  Interpolation(const std::vector<double>& independent_variables, const std::vector<double>& dependent_variables);
 
   /**
    * @fn CalcPolynomial
-   * @brief Calculate polynomial interpolation with Neville's algorithm
-   * @note Ref: Numerical Recipes in C, Section. 3.1
+   * @brief Calculate polynomial interpolation with the barycentric Lagrange formula
+   * @note Ref: J.-P. Berrut and L. N. Trefethen, "Barycentric Lagrange Interpolation", SIAM Review, 46(3), 2004
    * @param [in] x: Target independent variable
    * @return Interpolated value at x
    */
@@ -50,6 +47,33 @@ class Interpolation {
    */
   double CalcTrigonometric(const double x, const double period = 1.0) const;
 
+  /**
+   * @fn CalcPolynomialCoefficients
+   * @brief Calculate the coefficients of the polynomial interpolation, which are the values of the Lagrange basis polynomials at x
+   * @note The coefficients can be shared with other data which have the same independent variables
+   * @param [in] x: Target independent variable
+   * @param [out] coefficients: Coefficients for the dependent variables from the oldest data
+   */
+  void CalcPolynomialCoefficients(const double x, std::vector<double>& coefficients) const;
+
+  /**
+   * @fn CalcTrigonometricCoefficients
+   * @brief Calculate the coefficients of the trigonometric interpolation
+   * @note The coefficients can be shared with other data which have the same independent variables
+   * @param [in] x: Target independent variable
+   * @param [in] period: Characteristic period
+   * @param [out] coefficients: Coefficients for the dependent variables from the oldest data
+   */
+  void CalcTrigonometricCoefficients(const double x, const double period, std::vector<double>& coefficients) const;
+
+  /**
+   * @fn CalcWeightedSum
+   * @brief Calculate the interpolated value with the given coefficients
+   * @param [in] coefficients: Coefficients for the dependent variables from the oldest data
+   * @return Sum of the dependent variables weighted by the coefficients
+   */
+  double CalcWeightedSum(const std::vector<double>& coefficients) const;
+
   /**
    * @fn PushAndPopData
    * @brief Push new data to the tail and erase the head data
@@ -69,17 +93,35 @@ class Interpolation {
    * @fn GetIndependentVariables
    * @return List of independent variables
    */
-  inline std::vector<double> GetIndependentVariables() const { return independent_variables_; }
+  inline std::vector<double> GetIndependentVariables() const {
+    return std::vector<double>(independent_variables_.begin() + head_, independent_variables_.begin() + head_ + degree_);
+  }
   /**
    * @fn GetDependentVariables
    * @return List of dependent variables
    */
-  inline std::vector<double> GetDependentVariables() const { return dependent_variables_; }
+  inline std::vector<double> GetDependentVariables() const {
+    return std::vector<double>(dependent_variables_.begin() + head_, dependent_variables_.begin() + head_ + degree_);
+  }
 
  private:
-  std::vector<double> independent_variables_{0.0};  //!< List of independent variable
-  std::vector<double> dependent_variables_{0.0};    //!< List of dependent variable
-  size_t degree_;                                   //!< Degree of interpolation
+  /**
+   * @struct BarycentricWeights
+   * @brief Cache of the barycentric weights for a set of nodes
+   */
+  struct BarycentricWeights {
+    bool is_valid = false;        //!< The weights correspond to the current window
+    double period = 0.0;          //!< Characteristic period used for the trigonometric weights
+    std::vector<double> weights;  //!< Barycentric weights of the nodes
+  };
+
+  std::vector<double> independent_variables_;  //!< Two copies of the window of independent variables
+  std::vector<double> dependent_variables_;    //!< Two copies of the window of dependent variables
+  size_t head_ = 0;                            //!< Index of the oldest data in the buffers
+  size_t degree_;                              //!< Degree of interpolation
+
+  mutable BarycentricWeights polynomial_weights_;        //!< Weights for the polynomial interpolation
+  mutable BarycentricWeights trigonometric_weights_[2];  //!< Weights for the trigonometric interpolation without the last or the first node
 
   /**
    * @fn FindNearestPoint
@@ -88,6 +130,37 @@ class Interpolation {
    * @return Index of the nearest independent variables
    */
   size_t FindNearestPoint(const double x) const;
+  /**
+   * @fn GetPolynomialWeights
+   * @brief Return the barycentric weights for the polynomial interpolation. The weights are calculated in O(n^2) when the window changes.
+   */
+  const std::vector<double>& GetPolynomialWeights() const;
+  /**
+   * @fn GetTrigonometricWeights
+   * @brief Return the barycentric weights for the trigonometric interpolation. The weights are calculated in O(n^2) when the window or the
+   *        period changes.
+   * @param [in] x: Target independent variable
+   * @param [in] period: Characteristic period
+   * @param [out] start_id: Index of the first node
+   * @param [out] end_id: Index after the last node
+   * @return Weights for the nodes from start_id to end_id
+   */
+  const std::vector<double>& GetTrigonometricWeights(const double x, const double period, size_t& start_id, size_t& end_id) const;
+  /**
+   * @fn InvalidateWeights
+   * @brief Invalidate all cached barycentric weights
+   */
+  void InvalidateWeights();
+  /**
+   * @fn GetIndependentVariable
+   * @brief Return i-th independent variable from the oldest data
+   */
+  inline double GetIndependentVariable(const size_t i) const { return independent_variables_[head_ + i]; }
+  /**
+   * @fn GetDependentVariable
+   * @brief Return i-th dependent variable from the oldest data
+   */
+  inline double GetDependentVariable(const size_t i) const { return dependent_variables_[head_ + i]; }
 };
 
 }  // namespace libra
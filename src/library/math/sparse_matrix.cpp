@@ -0,0 +1,133 @@
+/**
+ * @file sparse_matrix.cpp
+ * @brief Sparse matrix in the compressed sparse row (CSR) format and its linear solver
+ */
+
+#include "sparse_matrix.hpp"
+
+#include <cmath>
+
+namespace libra {
+
+SparseMatrix::SparseMatrix(const std::vector<std::vector<double>>& dense_matrix, const bool has_diagonal) {
+  column_number_ = dense_matrix.empty() ? 0 : dense_matrix[0].size();
+  row_offsets_.reserve(dense_matrix.size() + 1);
+  row_offsets_.push_back(0);
+  for (size_t row = 0; row < dense_matrix.size(); row++) {
+    for (size_t column = 0; column < dense_matrix[row].size(); column++) {
+      if (dense_matrix[row][column] != 0.0 || (has_diagonal && row == column)) {
+        column_indices_.push_back(column);
+        values_.push_back(dense_matrix[row][column]);
+      }
+    }
+    row_offsets_.push_back(values_.size());
+  }
+}
+
+void SparseMatrix::Multiply(const std::vector<double>& x, std::vector<double>& y) const {
+  const size_t row_number = GetRowNumber();
+  for (size_t row = 0; row < row_number; row++) {
+    double sum = 0.0;
+    for (size_t index = row_offsets_[row]; index < row_offsets_[row + 1]; index++) {
+      sum += values_[index] * x[column_indices_[index]];
+    }
+    y[row] = sum;
+  }
+}
+
+size_t SparseMatrix::FindIndex(const size_t row, const size_t column) const {
+  if (row >= GetRowNumber()) return values_.size();
+  for (size_t index = row_offsets_[row]; index < row_offsets_[row + 1]; index++) {
+    if (column_indices_[index] == column) return index;
+  }
+  return values_.size();
+}
+
+static double CalcInnerProduct(const std::vector<double>& a, const std::vector<double>& b) {
+  double sum = 0.0;
+  for (size_t i = 0; i < a.size(); i++) sum += a[i] * b[i];
+  return sum;
+}
+
+BiCgStabSolver::BiCgStabSolver(const size_t size, const double tolerance, const size_t max_iteration)
+    : tolerance_(tolerance), max_iteration_(max_iteration) {
+  Resize(size);
+}
+
+bool BiCgStabSolver::Solve(const SparseMatrix& a, const std::vector<double>& b, std::vector<double>& x) {
+  const size_t size = b.size();
+  if (r_.size() != size) Resize(size);
+  iteration_number_ = 0;
+
+  const std::vector<size_t>& row_offsets = a.GetRowOffsets();
+  const std::vector<size_t>& column_indices = a.GetColumnIndices();
+  const std::vector<double>& values = a.GetValues();
+  for (size_t row = 0; row < size; row++) {
+    inverse_diagonal_[row] = 1.0;
+    for (size_t index = row_offsets[row]; index < row_offsets[row + 1]; index++) {
+      if (column_indices[index] == row && values[index] != 0.0) inverse_diagonal_[row] = 1.0 / values[index];
+    }
+  }
+
+  const double b_norm = std::sqrt(CalcInnerProduct(b, b));
+  if (b_norm == 0.0) {
+    x.assign(size, 0.0);
+    return true;
+  }
+  const double threshold = tolerance_ * b_norm;
+
+  a.Multiply(x, r_);
+  for (size_t i = 0; i < size; i++) {
+    r_[i] = b[i] - r_[i];
+    r_hat_[i] = r_[i];
+    p_[i] = 0.0;
+    v_[i] = 0.0;
+  }
+  if (std::sqrt(CalcInnerProduct(r_, r_)) <= threshold) return true;
+
+  double rho = 1.0, alpha = 1.0, omega = 1.0;
+  for (iteration_number_ = 1; iteration_number_ <= max_iteration_; iteration_number_++) {
+    const double rho_next = CalcInnerProduct(r_hat_, r_);
+    if (rho_next == 0.0) return false;
+    const double beta = (rho_next / rho) * (alpha / omega);
+    for (size_t i = 0; i < size; i++) {
+      p_[i] = r_[i] + beta * (p_[i] - omega * v_[i]);
+      y_[i] = inverse_diagonal_[i] * p_[i];
+    }
+    a.Multiply(y_, v_);
+    alpha = rho_next / CalcInnerProduct(r_hat_, v_);
+    for (size_t i = 0; i < size; i++) s_[i] = r_[i] - alpha * v_[i];
+    if (std::sqrt(CalcInnerProduct(s_, s_)) <= threshold) {
+      for (size_t i = 0; i < size; i++) x[i] += alpha * y_[i];
+      return true;
+    }
+
+    for (size_t i = 0; i < size; i++) z_[i] = inverse_diagonal_[i] * s_[i];
+    a.Multiply(z_, t_);
+    const double t_norm2 = CalcInnerProduct(t_, t_);
+    omega = t_norm2 > 0.0 ? CalcInnerProduct(t_, s_) / t_norm2 : 0.0;
+    for (size_t i = 0; i < size; i++) {
+      x[i] += alpha * y_[i] + omega * z_[i];
+      r_[i] = s_[i] - omega * t_[i];
+    }
+    if (std::sqrt(CalcInnerProduct(r_, r_)) <= threshold) return true;
+    if (omega == 0.0) return false;
+    rho = rho_next;
+  }
+  iteration_number_ = max_iteration_;
+  return false;
+}
+
+void BiCgStabSolver::Resize(const size_t size) {
+  inverse_diagonal_.assign(size, 1.0);
+  r_.assign(size, 0.0);
+  r_hat_.assign(size, 0.0);
+  p_.assign(size, 0.0);
+  v_.assign(size, 0.0);
+  s_.assign(size, 0.0);
+  t_.assign(size, 0.0);
+  y_.assign(size, 0.0);
+  z_.assign(size, 0.0);
+}
+
+}  // namespace libra
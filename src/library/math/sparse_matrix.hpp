@@ -0,0 +1,152 @@
+/**
+ * @file sparse_matrix.hpp
+ * @brief Sparse matrix in the compressed sparse row (CSR) format and its linear solver
+ */
+
+#ifndef S2E_LIBRARY_MATH_SPARSE_MATRIX_HPP_
+#define S2E_LIBRARY_MATH_SPARSE_MATRIX_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace libra {
+
+/**
+ * @class SparseMatrix
+ * @brief Square or rectangular sparse matrix in the compressed sparse row (CSR) format
+ * @note The sparsity pattern is fixed at the construction. The values of the non-zero elements can be updated in place.
+ */
+class SparseMatrix {
+ public:
+  /**
+   * @fn SparseMatrix
+   * @brief Default constructor for an empty matrix
+   */
+  SparseMatrix() {}
+  /**
+   * @fn SparseMatrix
+   * @brief Constructor from a dense matrix
+   * @note The column indices of each row are sorted in ascending order.
+   * @param [in] dense_matrix: Dense matrix. All rows must have the same size.
+   * @param [in] has_diagonal: Keep the diagonal elements in the sparsity pattern even when the values are zero
+   */
+  explicit SparseMatrix(const std::vector<std::vector<double>>& dense_matrix, const bool has_diagonal = false);
+
+  /**
+   * @fn Multiply
+   * @brief Calculate y = A x
+   * @param [in] x: Vector with the size of the column number
+   * @param [out] y: Vector with the size of the row number
+   */
+  void Multiply(const std::vector<double>& x, std::vector<double>& y) const;
+  /**
+   * @fn FindIndex
+   * @brief Return the index of the element in the value array
+   * @param [in] row: Row index
+   * @param [in] column: Column index
+   * @return Index of the element, or the number of the non-zero elements when the element is not in the sparsity pattern
+   */
+  size_t FindIndex(const size_t row, const size_t column) const;
+
+  // Getters
+  /**
+   * @fn GetRowNumber
+   * @brief Return the number of rows
+   */
+  inline size_t GetRowNumber() const { return row_offsets_.empty() ? 0 : row_offsets_.size() - 1; }
+  /**
+   * @fn GetColumnNumber
+   * @brief Return the number of columns
+   */
+  inline size_t GetColumnNumber() const { return column_number_; }
+  /**
+   * @fn GetNonZeroNumber
+   * @brief Return the number of the elements in the sparsity pattern
+   */
+  inline size_t GetNonZeroNumber() const { return values_.size(); }
+  /**
+   * @fn GetRowOffsets
+   * @brief Return the offsets of each row in the value array. The size is the row number + 1.
+   */
+  inline const std::vector<size_t>& GetRowOffsets() const { return row_offsets_; }
+  /**
+   * @fn GetColumnIndices
+   * @brief Return the column indices of the non-zero elements
+   */
+  inline const std::vector<size_t>& GetColumnIndices() const { return column_indices_; }
+  /**
+   * @fn GetValues
+   * @brief Return the values of the non-zero elements
+   */
+  inline const std::vector<double>& GetValues() const { return values_; }
+  /**
+   * @fn GetValues
+   * @brief Return the values of the non-zero elements to update them in place
+   */
+  inline std::vector<double>& GetValues() { return values_; }
+
+ private:
+  size_t column_number_ = 0;            //!< Number of columns
+  std::vector<size_t> row_offsets_;     //!< Offsets of each row in the value array
+  std::vector<size_t> column_indices_;  //!< Column indices of the non-zero elements
+  std::vector<double> values_;          //!< Values of the non-zero elements
+};
+
+/**
+ * @class BiCgStabSolver
+ * @brief Linear solver for A x = b with the sparse matrix by the Jacobi preconditioned BiCGSTAB method
+ * @note The work vectors are allocated at the construction and reused for every solution.
+ *       Ref: H. A. van der Vorst, Bi-CGSTAB: A Fast and Smoothly Converging Variant of Bi-CG for the Solution of Nonsymmetric Linear Systems, 1992
+ */
+class BiCgStabSolver {
+ public:
+  /**
+   * @fn BiCgStabSolver
+   * @brief Constructor
+   * @param [in] size: Size of the linear system
+   * @param [in] tolerance: Convergence tolerance of the residual norm relative to the norm of b
+   * @param [in] max_iteration: Maximum number of the iterations
+   */
+  BiCgStabSolver(const size_t size = 0, const double tolerance = 1e-12, const size_t max_iteration = 1000);
+
+  /**
+   * @fn Solve
+   * @brief Solve A x = b
+   * @param [in] a: Square sparse matrix with non-zero diagonal elements
+   * @param [in] b: Right hand side vector
+   * @param [in/out] x: Initial guess as the input and the solution as the output
+   * @return True when the solution converged
+   */
+  bool Solve(const SparseMatrix& a, const std::vector<double>& b, std::vector<double>& x);
+
+  // Getters
+  /**
+   * @fn GetIterationNumber
+   * @brief Return the number of the iterations in the last solution
+   */
+  inline size_t GetIterationNumber() const { return iteration_number_; }
+
+ private:
+  double tolerance_;                      //!< Convergence tolerance of the relative residual norm
+  size_t max_iteration_;                  //!< Maximum number of the iterations
+  size_t iteration_number_ = 0;           //!< Number of the iterations in the last solution
+  std::vector<double> inverse_diagonal_;  //!< Jacobi preconditioner
+  std::vector<double> r_;                 //!< Residual
+  std::vector<double> r_hat_;             //!< Shadow residual
+  std::vector<double> p_;                 //!< Search direction
+  std::vector<double> v_;                 //!< A * preconditioned p
+  std::vector<double> s_;                 //!< Intermediate residual
+  std::vector<double> t_;                 //!< A * preconditioned s
+  std::vector<double> y_;                 //!< Preconditioned p
+  std::vector<double> z_;                 //!< Preconditioned s
+
+  /**
+   * @fn Resize
+   * @brief Resize the work vectors
+   */
+  void Resize(const size_t size);
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_MATH_SPARSE_MATRIX_HPP_
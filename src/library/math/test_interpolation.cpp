@@ -117,3 +117,48 @@ TEST(Interpolation, PushAndPop) {
   ret = interpolation.PushAndPopData(1.0, 10.0);
   EXPECT_FALSE(ret);
 }
+
+/**
+ * @brief Test for interpolation after the window wraps around
+ */
+TEST(Interpolation, PushAndPopWrapAround) {
+  std::vector<double> x{0.0, 1.0, 2.0, 3.0, 4.0};
+  std::vector<double> y{0.0, 1.0, 4.0, 9.0, 16.0};
+  libra::Interpolation interpolation(x, y);
+
+  EXPECT_DOUBLE_EQ(pow(2.4, 2.0), interpolation.CalcPolynomial(2.4));
+  for (size_t i = 5; i < 13; i++) {
+    const double xx = (double)i;
+    EXPECT_TRUE(interpolation.PushAndPopData(xx, xx * xx));
+    for (size_t j = 0; j < x.size(); j++) {
+      EXPECT_DOUBLE_EQ(xx - 4.0 + j, interpolation.GetIndependentVariables()[j]);
+    }
+    EXPECT_NEAR(pow(xx - 1.6, 2.0), interpolation.CalcPolynomial(xx - 1.6), 1e-12);
+  }
+}
+
+/**
+ * @brief Test for the coefficients shared with the data which have the same independent variables
+ */
+TEST(Interpolation, SharedCoefficients) {
+  std::vector<double> x{0.0, 0.3 * libra::pi_2, 0.6 * libra::pi_2, 0.9 * libra::pi_2, 1.2 * libra::pi_2, 1.5 * libra::pi_2};
+  std::vector<double> y_cos;
+  std::vector<double> y_sin;
+  for (size_t i = 0; i < x.size(); i++) {
+    y_cos.push_back(cos(x[i]));
+    y_sin.push_back(sin(x[i]));
+  }
+  libra::Interpolation interpolation_cos(x, y_cos);
+  libra::Interpolation interpolation_sin(x, y_sin);
+
+  std::vector<double> coefficients;
+  for (double xx : {0.1 * libra::pi_2, 0.6 * libra::pi_2, 1.4 * libra::pi_2}) {
+    interpolation_cos.CalcPolynomialCoefficients(xx, coefficients);
+    EXPECT_NEAR(interpolation_cos.CalcPolynomial(xx), interpolation_cos.CalcWeightedSum(coefficients), 1e-15);
+    EXPECT_NEAR(interpolation_sin.CalcPolynomial(xx), interpolation_sin.CalcWeightedSum(coefficients), 1e-15);
+
+    interpolation_cos.CalcTrigonometricCoefficients(xx, 1.0, coefficients);
+    EXPECT_NEAR(interpolation_cos.CalcTrigonometric(xx), interpolation_cos.CalcWeightedSum(coefficients), 1e-15);
+    EXPECT_NEAR(interpolation_sin.CalcTrigonometric(xx), interpolation_sin.CalcWeightedSum(coefficients), 1e-15);
+  }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file test_sparse_matrix.cpp
+ * @brief Test codes for SparseMatrix class and BiCgStabSolver class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "sparse_matrix.hpp"
+
+/**
+ * @brief Test construction from a dense matrix and multiplication
+ */
+TEST(SparseMatrix, ConstructorAndMultiply) {
+  const std::vector<std::vector<double>> dense_matrix = {{0.0, 2.0, 0.0}, {1.0, 0.0, 3.0}, {0.0, 0.0, 4.0}};
+  libra::SparseMatrix sparse_matrix(dense_matrix);
+  EXPECT_EQ(3, sparse_matrix.GetRowNumber());
+  EXPECT_EQ(3, sparse_matrix.GetColumnNumber());
+  EXPECT_EQ(4, sparse_matrix.GetNonZeroNumber());
+  EXPECT_EQ(sparse_matrix.GetNonZeroNumber(), sparse_matrix.FindIndex(0, 0));
+  EXPECT_DOUBLE_EQ(3.0, sparse_matrix.GetValues()[sparse_matrix.FindIndex(1, 2)]);
+
+  libra::SparseMatrix sparse_matrix_with_diagonal(dense_matrix, true);
+  EXPECT_EQ(6, sparse_matrix_with_diagonal.GetNonZeroNumber());
+  EXPECT_DOUBLE_EQ(0.0, sparse_matrix_with_diagonal.GetValues()[sparse_matrix_with_diagonal.FindIndex(0, 0)]);
+
+  const std::vector<double> x = {1.0, -2.0, 0.5};
+  std::vector<double> y(3);
+  sparse_matrix_with_diagonal.Multiply(x, y);
+  EXPECT_DOUBLE_EQ(-4.0, y[0]);
+  EXPECT_DOUBLE_EQ(2.5, y[1]);
+  EXPECT_DOUBLE_EQ(2.0, y[2]);
+}
+
+/**
+ * @brief Test solution of a nonsymmetric diagonally dominant system
+ */
+TEST(BiCgStabSolver, Solve) {
+  const size_t size = 50;
+  std::vector<std::vector<double>> dense_matrix(size, std::vector<double>(size, 0.0));
+  std::vector<double> expected_x(size);
+  for (size_t i = 0; i < size; i++) {
+    dense_matrix[i][i] = 4.0 + 0.1 * i;
+    if (i > 0) dense_matrix[i][i - 1] = -1.5;
+    if (i + 1 < size) dense_matrix[i][i + 1] = -0.5;
+    if (i + 7 < size) dense_matrix[i][i + 7] = -1.0;
+    expected_x[i] = std::sin(0.3 * i);
+  }
+  libra::SparseMatrix sparse_matrix(dense_matrix);
+  std::vector<double> b(size);
+  sparse_matrix.Multiply(expected_x, b);
+
+  libra::BiCgStabSolver solver(size, 1e-13);
+  std::vector<double> x(size, 0.0);
+  ASSERT_TRUE(solver.Solve(sparse_matrix, b, x));
+  EXPECT_LT(0, solver.GetIterationNumber());
+  for (size_t i = 0; i < size; i++) {
+    EXPECT_NEAR(expected_x[i], x[i], 1e-10);
+  }
+
+  // Zero right hand side
+  std::vector<double> zero_b(size, 0.0);
+  ASSERT_TRUE(solver.Solve(sparse_matrix, zero_b, x));
+  EXPECT_DOUBLE_EQ(0.0, x[0]);
+}
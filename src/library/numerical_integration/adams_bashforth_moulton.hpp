@@ -0,0 +1,133 @@
+/**
+ * @file adams_bashforth_moulton.hpp
+ * @brief Class for 8th order Adams-Bashforth-Moulton predictor-corrector method
+ * @note Ref: Montenbruck and Gill, Satellite Orbits, 4.2 Multistep Methods
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_HPP_
+
+#include <array>
+
+#include "runge_kutta_4.hpp"
+
+namespace libra::numerical_integration {
+
+/**
+ * @brief Coefficients of 8th order Adams-Bashforth predictor for f(n), f(n-1), ..., f(n-7)
+ */
+inline constexpr std::array<double, 8> kAdamsBashforth8Coefficients = {434241.0 / 120960.0,  -1152169.0 / 120960.0, 2183877.0 / 120960.0,
+                                                                       -2664477.0 / 120960.0, 2102243.0 / 120960.0,  -1041723.0 / 120960.0,
+                                                                       295767.0 / 120960.0,   -36799.0 / 120960.0};
+/**
+ * @brief Coefficients of 8th order Adams-Moulton corrector for f(n+1), f(n), ..., f(n-6)
+ */
+inline constexpr std::array<double, 8> kAdamsMoulton8Coefficients = {36799.0 / 120960.0, 139849.0 / 120960.0, -121797.0 / 120960.0,
+                                                                     123133.0 / 120960.0, -88547.0 / 120960.0, 41499.0 / 120960.0,
+                                                                     -11351.0 / 120960.0, 1375.0 / 120960.0};
+
+/**
+ * @fn CalcAdamsMoulton8InterpolationPolynomials
+ * @brief Calculate the polynomials for the interpolation with the corrector nodes
+ * @details The j-th polynomial w_j(sigma) is the integral of the Lagrange basis polynomial of the node (1 - j) from 0 to sigma, and the state is
+ *          interpolated as x(t(n) + sigma * h) = x(n) + h * sum(w_j(sigma) * f(n + 1 - j)). w_j(1) agrees with the corrector coefficients.
+ * @return Coefficients of sigma^k (k = 0, ..., 8) for each polynomial
+ */
+constexpr std::array<std::array<double, 9>, 8> CalcAdamsMoulton8InterpolationPolynomials() {
+  std::array<std::array<double, 9>, 8> polynomials{};
+  for (size_t j = 0; j < 8; j++) {
+    // Lagrange basis polynomial
+    std::array<double, 9> basis{};
+    basis[0] = 1.0;
+    double denominator = 1.0;
+    for (size_t m = 0; m < 8; m++) {
+      if (m == j) continue;
+      const double node = 1.0 - (double)m;
+      for (size_t k = 8; k > 0; k--) basis[k] = basis[k - 1] - node * basis[k];
+      basis[0] = -node * basis[0];
+      denominator *= (1.0 - (double)j) - node;
+    }
+    // Integration from 0
+    for (size_t k = 0; k < 8; k++) polynomials[j][k + 1] = basis[k] / (double)(k + 1) / denominator;
+  }
+  return polynomials;
+}
+
+/**
+ * @brief Interpolation polynomials with the nodes of 8th order Adams-Moulton corrector
+ */
+inline constexpr std::array<std::array<double, 9>, 8> kAdamsMoulton8InterpolationPolynomials = CalcAdamsMoulton8InterpolationPolynomials();
+
+/**
+ * @class AdamsBashforthMoulton
+ * @brief Class for 8th order Adams-Bashforth-Moulton predictor-corrector method with fixed step width
+ * @details Each step consists of the Adams-Bashforth prediction, the evaluation of the derivative, the Adams-Moulton correction, and the
+ *          evaluation of the derivative at the corrected state (PECE). The derivative function is called only twice per step while the
+ *          classical Runge-Kutta method calls it four times. The history of the derivatives is started with RK4 after SetState, and the
+ *          predictor-corrector is used after seven start up steps. Each start up step is divided into RK4 sub steps.
+ *          The dense output uses the polynomial of the corrector, and the cubic Hermite interpolation is used in the start up steps.
+ * @note The step width should not be changed after the start up since the history of the derivatives assumes the fixed step width.
+ */
+template <size_t N>
+class AdamsBashforthMoulton : public NumericalIntegrator<N> {
+ public:
+  /**
+   * @fn AdamsBashforthMoulton
+   * @brief Constructor
+   * @param [in] step_width: Step width
+   * @param [in] ode: Ordinary differential equation
+   */
+  AdamsBashforthMoulton(const double step_width, const InterfaceOde<N>& ode);
+
+  /**
+   * @fn Integrate
+   * @brief Update the state vector with the numerical integration
+   */
+  void Integrate() override;
+  /**
+   * @fn SetState
+   * @brief Set state information and clear the history of the derivatives
+   */
+  void SetState(const double independent_variable, const Vector<N>& state) override;
+  /**
+   * @fn CalcInterpolationState
+   * @brief Calculate interpolation state
+   * @param [in] sigma: Sigma value (0 < sigma < 1) for interpolation
+   * @return : interpolated state x(t0 + sigma * h)
+   */
+  Vector<N> CalcInterpolationState(const double sigma) const override;
+
+  /**
+   * @fn IsStartUp
+   * @brief Return true when the history of the derivatives is not enough for the predictor-corrector and RK4 is used
+   */
+  inline bool IsStartUp() const { return number_of_derivatives_ < kNumberOfSteps; }
+
+ private:
+  static constexpr size_t kNumberOfSteps = 8;            //!< Number of the derivatives used in the predictor
+  static constexpr size_t kNumberOfStartUpSubSteps = 8;  //!< Number of RK4 sub steps in a start up step
+
+  RungeKutta4<N> starter_;                                    //!< Integrator for the start up steps
+  std::array<Vector<N>, kNumberOfSteps> derivative_history_;  //!< Ring buffer of the derivatives at the latest nodes
+  size_t latest_index_ = 0;                                   //!< Index of the derivative at the current node in the ring buffer
+  size_t number_of_derivatives_ = 0;                          //!< Number of the available derivatives in the ring buffer
+
+  /**
+   * @fn GetDerivative
+   * @brief Return the derivative at the j-th previous node from the current node
+   */
+  inline const Vector<N>& GetDerivative(const size_t j) const {
+    return derivative_history_[(latest_index_ + kNumberOfSteps - j) % kNumberOfSteps];
+  }
+  /**
+   * @fn PushDerivative
+   * @brief Calculate the derivative at the current node and add it to the history
+   */
+  void PushDerivative();
+};
+
+}  // namespace libra::numerical_integration
+
+#include "adams_bashforth_moulton_implementation.hpp"
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_HPP_
@@ -0,0 +1,102 @@
+/**
+ * @file adams_bashforth_moulton_implementation.hpp
+ * @brief Implementation of 8th order Adams-Bashforth-Moulton predictor-corrector method
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_IMPLEMENTATION_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_IMPLEMENTATION_HPP_
+
+#include "adams_bashforth_moulton.hpp"
+
+namespace libra::numerical_integration {
+
+template <size_t N>
+AdamsBashforthMoulton<N>::AdamsBashforthMoulton(const double step_width, const InterfaceOde<N>& ode)
+    : NumericalIntegrator<N>(step_width, ode), starter_(step_width, ode) {}
+
+template <size_t N>
+void AdamsBashforthMoulton<N>::Integrate() {
+  if (number_of_derivatives_ == 0) PushDerivative();
+
+  this->previous_independent_variable_ = this->current_independent_variable_;
+  this->previous_state_ = this->current_state_;
+  const double step_width = this->step_width_;
+
+  if (IsStartUp()) {
+    // RK4 with the sub steps to keep the start up error comparable with the truncation error of the predictor-corrector
+    starter_.SetState(this->current_independent_variable_, this->current_state_);
+    starter_.SetStepWidth(step_width / (double)kNumberOfStartUpSubSteps);
+    for (size_t i = 0; i < kNumberOfStartUpSubSteps; i++) starter_.Integrate();
+    this->current_state_ = starter_.GetState();
+  } else {
+    // Prediction
+    Vector<N> predicted_state = this->current_state_;
+    for (size_t j = 0; j < kNumberOfSteps; j++) {
+      const Vector<N>& derivative = GetDerivative(j);
+      for (size_t n = 0; n < N; n++) predicted_state[n] += step_width * kAdamsBashforth8Coefficients[j] * derivative[n];
+    }
+    const Vector<N> predicted_derivative = this->ode_.DerivativeFunction(this->current_independent_variable_ + step_width, predicted_state);
+
+    // Correction
+    for (size_t n = 0; n < N; n++) this->current_state_[n] += step_width * kAdamsMoulton8Coefficients[0] * predicted_derivative[n];
+    for (size_t j = 1; j < kNumberOfSteps; j++) {
+      const Vector<N>& derivative = GetDerivative(j - 1);
+      for (size_t n = 0; n < N; n++) this->current_state_[n] += step_width * kAdamsMoulton8Coefficients[j] * derivative[n];
+    }
+  }
+  this->current_independent_variable_ += step_width;
+
+  // Evaluation at the new node
+  PushDerivative();
+}
+
+template <size_t N>
+void AdamsBashforthMoulton<N>::SetState(const double independent_variable, const Vector<N>& state) {
+  NumericalIntegrator<N>::SetState(independent_variable, state);
+  number_of_derivatives_ = 0;
+}
+
+template <size_t N>
+Vector<N> AdamsBashforthMoulton<N>::CalcInterpolationState(const double sigma) const {
+  if (number_of_derivatives_ < 2) return this->current_state_;
+
+  const double step_width = this->current_independent_variable_ - this->previous_independent_variable_;
+  Vector<N> interpolation_state = this->previous_state_;
+  if (number_of_derivatives_ < kNumberOfSteps) {
+    // Cubic Hermite interpolation in the start up steps
+    const double sigma2 = sigma * sigma;
+    const double sigma3 = sigma2 * sigma;
+    const double state_coefficient = 3.0 * sigma2 - 2.0 * sigma3;
+    const double previous_derivative_coefficient = step_width * (sigma3 - 2.0 * sigma2 + sigma);
+    const double current_derivative_coefficient = step_width * (sigma3 - sigma2);
+    const Vector<N>& previous_derivative = GetDerivative(1);
+    const Vector<N>& current_derivative = GetDerivative(0);
+    for (size_t n = 0; n < N; n++) {
+      interpolation_state[n] += state_coefficient * (this->current_state_[n] - this->previous_state_[n]) +
+                                previous_derivative_coefficient * previous_derivative[n] + current_derivative_coefficient * current_derivative[n];
+    }
+    return interpolation_state;
+  }
+
+  // Integration of the corrector polynomial
+  for (size_t j = 0; j < kNumberOfSteps; j++) {
+    double weight = 0.0;
+    for (size_t k = kAdamsMoulton8InterpolationPolynomials[j].size() - 1; k > 0; k--) {
+      weight = (weight + kAdamsMoulton8InterpolationPolynomials[j][k]) * sigma;
+    }
+    const Vector<N>& derivative = GetDerivative(j);
+    for (size_t n = 0; n < N; n++) interpolation_state[n] += step_width * weight * derivative[n];
+  }
+  return interpolation_state;
+}
+
+template <size_t N>
+void AdamsBashforthMoulton<N>::PushDerivative() {
+  if (number_of_derivatives_ > 0) latest_index_ = (latest_index_ + 1) % kNumberOfSteps;
+  derivative_history_[latest_index_] = this->ode_.DerivativeFunction(this->current_independent_variable_, this->current_state_);
+  if (number_of_derivatives_ < kNumberOfSteps) number_of_derivatives_++;
+}
+
+}  // namespace libra::numerical_integration
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_IMPLEMENTATION_HPP_
@@ -0,0 +1,73 @@
+/**
+ * @file benchmark_runge_kutta.cpp
+ * @brief Benchmark of the integration step of Runge-Kutta methods
+ * @note Usage: benchmark_runge_kutta [number_of_steps]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "numerical_integrator_manager.hpp"
+
+/**
+ * @class TwoBodyOrbitOde
+ * @brief Three dimensional two-body problem as a light-weight right hand side
+ */
+class TwoBodyOrbitOde : public libra::numerical_integration::InterfaceOde<6> {
+ public:
+  libra::Vector<6> DerivativeFunction(const double time_s, const libra::Vector<6>& state) const override {
+    (void)time_s;
+    libra::Vector<6> output;
+    const double radius_m = sqrt(state[0] * state[0] + state[1] * state[1] + state[2] * state[2]);
+    const double coefficient = -kGravityConstant_m3_s2 / (radius_m * radius_m * radius_m);
+    for (size_t i = 0; i < 3; i++) {
+      output[i] = state[i + 3];
+      output[i + 3] = coefficient * state[i];
+    }
+    return output;
+  }
+
+ private:
+  static constexpr double kGravityConstant_m3_s2 = 3.986004418e14;
+};
+
+int main(int argc, char* argv[]) {
+  size_t number_of_steps = 2000000;
+  if (argc > 1) number_of_steps = std::strtoul(argv[1], nullptr, 10);
+
+  using libra::numerical_integration::NumericalIntegrationMethod;
+  const std::vector<std::pair<NumericalIntegrationMethod, std::string>> methods = {
+      {NumericalIntegrationMethod::kRk4, "RK4"}, {NumericalIntegrationMethod::kRkf, "RKF45"}, {NumericalIntegrationMethod::kDp5, "DP5"}};
+
+  TwoBodyOrbitOde ode;
+  libra::Vector<6> initial_state(0.0);
+  initial_state[0] = 6878137.0;
+  initial_state[4] = 7612.6;
+  initial_state[5] = 10.0;
+
+  std::cout << std::setw(8) << "method" << std::setw(14) << "steps" << std::setw(16) << "step[ns]" << std::setw(24) << "final x[m]" << std::endl;
+  for (const auto& method : methods) {
+    libra::numerical_integration::NumericalIntegratorManager<6> manager(1.0, ode, method.first);
+    auto integrator = manager.GetIntegrator();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < number_of_steps; i++) {
+      // Restart periodically to keep the state in a realistic range
+      if (i % 10000 == 0) integrator->SetState(0.0, initial_state);
+      integrator->Integrate();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const double step_time_ns = std::chrono::duration<double, std::nano>(end - start).count() / (double)number_of_steps;
+
+    std::cout << std::setw(8) << method.second << std::setw(14) << number_of_steps << std::setw(16) << std::fixed << std::setprecision(1)
+              << step_time_ns << std::setw(24) << std::setprecision(9) << integrator->GetState()[0] << std::endl;
+  }
+  return 0;
+}
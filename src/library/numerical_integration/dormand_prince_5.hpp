@@ -13,12 +13,28 @@
 
 namespace libra::numerical_integration {
 
+/**
+ * @brief Butcher tableau of p=5th/q=4th order Dormand and Prince (7-stage)
+ */
+inline constexpr EmbeddedButcherTableau<7> kDormandPrince5Tableau = {
+    {5,
+     {0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0},
+     {5179.0 / 57600.0, 0.0, 7571.0 / 16695.0, 393.0 / 640.0, -92097.0 / 339200.0, 187.0 / 2100.0, 1.0 / 40.0},
+     {{{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {1.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {3.0 / 40.0, 9.0 / 40.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0, 0.0, 0.0, 0.0, 0.0},
+       {19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0, 0.0, 0.0, 0.0},
+       {9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0, 0.0, 0.0},
+       {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0}}}},
+    {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0}};
+
 /**
  * @class DormandPrince5
  * @brief Class for 5th order Dormand and Prince method
  */
 template <size_t N>
-class DormandPrince5 : public EmbeddedRungeKutta<N> {
+class DormandPrince5 : public EmbeddedRungeKutta<N, kDormandPrince5Tableau> {
  public:
   /**
    * @fn DormandPrince5
@@ -43,7 +59,7 @@ class DormandPrince5 : public EmbeddedRungeKutta<N> {
    * @param [in] sigma: Sigma value (0 < sigma < 1) for interpolation
    * @return : weights for interpolation
    */
-  std::vector<double> CalcInterpolationWeights(const double sigma) const;
+  std::array<double, 7> CalcInterpolationWeights(const double sigma) const;
 };
 
 }  // namespace libra::numerical_integration
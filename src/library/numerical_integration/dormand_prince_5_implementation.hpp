@@ -14,66 +14,8 @@
 namespace libra::numerical_integration {
 
 template <size_t N>
-DormandPrince5<N>::DormandPrince5(const double step_width, const InterfaceOde<N>& ode) : EmbeddedRungeKutta<N>(step_width, ode) {
-  // p=5th/q=4th order 5th order Dormand and Prince (7-stage)
-  this->number_of_stages_ = 7;
-  this->approximation_order_ = 5;
-  this->nodes_.assign(this->number_of_stages_, 0.0);
-  this->weights_.assign(this->number_of_stages_, 0.0);
-  this->higher_order_weights_.assign(this->number_of_stages_, 0.0);
-  this->rk_matrix_.assign(this->number_of_stages_, std::vector<double>(this->number_of_stages_, 0.0));
-
-  this->nodes_[0] = 0.0;
-  this->nodes_[1] = 1.0 / 5.0;
-  this->nodes_[2] = 3.0 / 10.0;
-  this->nodes_[3] = 4.0 / 5.0;
-  this->nodes_[4] = 8.0 / 9.0;
-  this->nodes_[5] = 1.0;
-  this->nodes_[6] = 1.0;
-
-  this->weights_[0] = 5179.0 / 57600.0;
-  this->weights_[1] = 0.0;
-  this->weights_[2] = 7571.0 / 16695.0;
-  this->weights_[3] = 393.0 / 640.0;
-  this->weights_[4] = -92097.0 / 339200.0;
-  this->weights_[5] = 187.0 / 2100.0;
-  this->weights_[6] = 1.0 / 40.0;
-
-  this->higher_order_weights_[0] = 35.0 / 384.0;
-  this->higher_order_weights_[1] = 0.0;
-  this->higher_order_weights_[2] = 500.0 / 1113.0;
-  this->higher_order_weights_[3] = 125.0 / 192.0;
-  this->higher_order_weights_[4] = -2187.0 / 6784.0;
-  this->higher_order_weights_[5] = 11.0 / 84.0;
-  this->higher_order_weights_[6] = 0.0;
-
-  this->rk_matrix_[1][0] = 1.0 / 5.0;
-
-  this->rk_matrix_[2][0] = 3.0 / 40.0;
-  this->rk_matrix_[2][1] = 9.0 / 40.0;
-
-  this->rk_matrix_[3][0] = 44.0 / 45.0;
-  this->rk_matrix_[3][1] = -56.0 / 15.0;
-  this->rk_matrix_[3][2] = 32.0 / 9.0;
-
-  this->rk_matrix_[4][0] = 19372.0 / 6561.0;
-  this->rk_matrix_[4][1] = -25360.0 / 2187.0;
-  this->rk_matrix_[4][2] = 64448.0 / 6561.0;
-  this->rk_matrix_[4][3] = -212.0 / 729.0;
-
-  this->rk_matrix_[5][0] = 9017.0 / 3168.0;
-  this->rk_matrix_[5][1] = -355.0 / 33.0;
-  this->rk_matrix_[5][2] = 46732.0 / 5247.0;
-  this->rk_matrix_[5][3] = 49.0 / 176.0;
-  this->rk_matrix_[5][4] = -5103.0 / 18656.0;
-
-  this->rk_matrix_[6][0] = 35.0 / 384.0;
-  this->rk_matrix_[6][1] = 0.0;
-  this->rk_matrix_[6][2] = 500.0 / 1113.0;
-  this->rk_matrix_[6][3] = 125.0 / 192.0;
-  this->rk_matrix_[6][4] = -2187.0 / 6784.0;
-  this->rk_matrix_[6][5] = 11.0 / 84.0;
-
+DormandPrince5<N>::DormandPrince5(const double step_width, const InterfaceOde<N>& ode)
+    : EmbeddedRungeKutta<N, kDormandPrince5Tableau>(step_width, ode) {
   // Interpolation coefficients
   libra::Vector<5> coefficients_temp;
   coefficients_temp[0] = 11282082432.0;
@@ -118,33 +60,30 @@ DormandPrince5<N>::DormandPrince5(const double step_width, const InterfaceOde<N>
   coefficients_temp[4] = 106151040.0;
   coefficients_temp = 11.0 / 2467955532.0 * coefficients_temp;
   coefficients_.push_back(coefficients_temp);
-
-  this->CalcSlope();
 }
 
 template <size_t N>
 Vector<N> DormandPrince5<N>::CalcInterpolationState(const double sigma) const {
-  std::vector<double> interpolation_weights = CalcInterpolationWeights(sigma);
+  std::array<double, 7> interpolation_weights = CalcInterpolationWeights(sigma);
 
   Vector<N> interpolation_state = this->previous_state_;
-  for (size_t i = 0; i < this->number_of_stages_; i++) {
-    interpolation_state = interpolation_state + (sigma * this->step_width_ * interpolation_weights[i]) * this->slope_[i];
+  for (size_t i = 0; i < this->kNumberOfStages; i++) {
+    interpolation_state += (sigma * this->step_width_ * interpolation_weights[i]) * this->slope_[i];
   }
 
   return interpolation_state;
 }
 
 template <size_t N>
-std::vector<double> DormandPrince5<N>::CalcInterpolationWeights(const double sigma) const {
-  std::vector<double> interpolation_weights;
-  interpolation_weights.assign(this->number_of_stages_, 0.0);
+std::array<double, 7> DormandPrince5<N>::CalcInterpolationWeights(const double sigma) const {
+  std::array<double, 7> interpolation_weights = {};
 
-  for (size_t stage = 0; stage < this->number_of_stages_ - 1; stage++) {
+  for (size_t stage = 0; stage < this->kNumberOfStages - 1; stage++) {
     for (size_t j = 0; j < 5; j++) {
       interpolation_weights[stage] += pow(sigma, j) * coefficients_[stage][j];
     }
   }
-  interpolation_weights[this->number_of_stages_ - 1] =
+  interpolation_weights[this->kNumberOfStages - 1] =
       sigma * (1.0 - sigma) * (8293050.0 * pow(sigma, 2.0) - 82437520.0 * sigma + 44764047.0) / 29380423.0;
   return interpolation_weights;
 }
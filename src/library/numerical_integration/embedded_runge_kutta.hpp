@@ -10,19 +10,30 @@
 
 namespace libra::numerical_integration {
 
+/**
+ * @struct EmbeddedButcherTableau
+ * @brief Coefficients of embedded Runge-Kutta method
+ */
+template <size_t S>
+struct EmbeddedButcherTableau : public ButcherTableau<S> {
+  std::array<double, S> higher_order_weights;  //!< Weights vector for higher order approximation
+};
+
 /**
  * @class EmbeddedRungeKutta
  * @brief Class for Embedded Runge-Kutta method
+ * @tparam N: Dimension of the state vector
+ * @tparam kTableau: Embedded Butcher tableau
  */
-template <size_t N>
-class EmbeddedRungeKutta : public RungeKutta<N> {
+template <size_t N, const auto& kTableau>
+class EmbeddedRungeKutta : public RungeKutta<N, kTableau> {
  public:
   /**
    * @fn EmbeddedRungeKutta
    * @brief Constructor
    * @param [in] step_width: Step width
    */
-  EmbeddedRungeKutta(const double step_width, const InterfaceOde<N>& ode) : RungeKutta<N>(step_width, ode) {}
+  EmbeddedRungeKutta(const double step_width, const InterfaceOde<N>& ode) : RungeKutta<N, kTableau>(step_width, ode) {}
 
   /**
    * @fn Integrate
@@ -37,6 +48,18 @@ class EmbeddedRungeKutta : public RungeKutta<N> {
    */
   void ControlStepWidth(const double error_tolerance);
 
+  /**
+   * @fn RetryStep
+   * @brief Discard the latest step to integrate again from the previous state with another step width
+   * @note Use this function when the local truncation error of the latest step is larger than the tolerance
+   * @param[in] step_width: Step width for the retry
+   */
+  inline void RetryStep(const double step_width) {
+    this->current_independent_variable_ = this->previous_independent_variable_;
+    this->current_state_ = this->previous_state_;
+    this->step_width_ = step_width;
+  }
+
   /**
    * @fn GetLocalTruncationError
    * @return Norm of estimated local truncation error
@@ -44,11 +67,8 @@ class EmbeddedRungeKutta : public RungeKutta<N> {
   inline double GetLocalTruncationError() const { return local_truncation_error_; }
 
  protected:
-  // Parameters should be defined by child class
-  std::vector<double> higher_order_weights_;  //!< Weights vector for higher order approximation
-
   // Error
-  double local_truncation_error_;  //!< Norm of estimated local truncation error
+  double local_truncation_error_ = 0.0;  //!< Norm of estimated local truncation error
 };
 
 }  // namespace libra::numerical_integration
@@ -9,30 +9,32 @@
 
 namespace libra::numerical_integration {
 
-template <size_t N>
-void EmbeddedRungeKutta<N>::Integrate() {
+template <size_t N, const auto& kTableau>
+void EmbeddedRungeKutta<N, kTableau>::Integrate() {
   this->CalcSlope();
 
+  constexpr size_t kNumberOfStages = RungeKutta<N, kTableau>::kNumberOfStages;
+  this->previous_independent_variable_ = this->current_independent_variable_;
   this->previous_state_ = this->current_state_;
-  Vector<N> lower_current_state = this->current_state_;   //!< eta in the equation
-  Vector<N> higher_current_state = this->current_state_;  //!< eta_hat in the equation
-  for (size_t i = 0; i < this->number_of_stages_; i++) {
-    lower_current_state = lower_current_state + this->weights_[i] * this->step_width_ * this->slope_[i];
-    higher_current_state = higher_current_state + higher_order_weights_[i] * this->step_width_ * this->slope_[i];
+  Vector<N> truncation_error;
+  for (size_t n = 0; n < N; n++) {
+    double lower_current_state = this->current_state_[n];   //!< eta in the equation
+    double higher_current_state = this->current_state_[n];  //!< eta_hat in the equation
+    this->AddSlopes(kTableau.weights, n, lower_current_state, std::make_index_sequence<kNumberOfStages>{});
+    this->AddSlopes(kTableau.higher_order_weights, n, higher_current_state, std::make_index_sequence<kNumberOfStages>{});
+
+    // Error evaluation
+    truncation_error[n] = lower_current_state - higher_current_state;
+    // State update
+    this->current_state_[n] = higher_current_state;
   }
-
-  // Error evaluation
-  Vector<N> truncation_error = lower_current_state - higher_current_state;
   local_truncation_error_ = truncation_error.CalcNorm();
-
-  // State update
-  this->current_state_ = higher_current_state;
   this->current_independent_variable_ += this->step_width_;
 }
 
-template <size_t N>
-void EmbeddedRungeKutta<N>::ControlStepWidth(const double error_tolerance) {
-  double updated_step_width = pow(error_tolerance / local_truncation_error_, 1.0 / ((double)(this->approximation_order_ + 1))) * this->step_width_;
+template <size_t N, const auto& kTableau>
+void EmbeddedRungeKutta<N, kTableau>::ControlStepWidth(const double error_tolerance) {
+  double updated_step_width = pow(error_tolerance / local_truncation_error_, 1.0 / ((double)(this->kApproximationOrder + 1))) * this->step_width_;
   if (updated_step_width <= 0.0) return;  // TODO: Error handling
   this->step_width_ = updated_step_width;
 }
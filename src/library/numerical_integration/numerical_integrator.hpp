@@ -27,7 +27,12 @@ class NumericalIntegrator {
    * @param [in] ode: Ordinary differential equation
    */
   inline NumericalIntegrator(const double step_width, const InterfaceOde<N>& ode)
-      : step_width_(step_width), ode_(ode), current_independent_variable_(0.0), current_state_(0.0), previous_state_(0.0) {}
+      : step_width_(step_width),
+        ode_(ode),
+        current_independent_variable_(0.0),
+        current_state_(0.0),
+        previous_independent_variable_(0.0),
+        previous_state_(0.0) {}
   /**
    * @fn ~NumericalIntegrator
    * @brief Destructor
@@ -44,12 +49,29 @@ class NumericalIntegrator {
    * @fn SetState
    * @brief Set state information
    */
-  inline void SetState(const double independent_variable, const Vector<N>& state) {
+  inline virtual void SetState(const double independent_variable, const Vector<N>& state) {
     current_independent_variable_ = independent_variable;
     current_state_ = state;
+    previous_independent_variable_ = independent_variable;
     previous_state_ = state;
   }
 
+  /**
+   * @fn SetStepWidth
+   * @brief Set step width for the next integration
+   */
+  inline void SetStepWidth(const double step_width) { step_width_ = step_width; }
+  /**
+   * @fn GetStepWidth
+   * @brief Return step width for the next integration
+   */
+  inline double GetStepWidth() const { return step_width_; }
+  /**
+   * @fn GetIndependentVariable
+   * @brief Return current independent variable
+   */
+  inline double GetIndependentVariable() const { return current_independent_variable_; }
+
   /**
    * @fn GetState
    * @brief Return current state vector
@@ -69,10 +91,11 @@ class NumericalIntegrator {
   double step_width_;  //!< Step width. The unit is depending on the independent variable
 
   // States
-  const InterfaceOde<N>& ode_;           //!< Ordinary differential equation
-  double current_independent_variable_;  //!< Latest value of independent variable
-  Vector<N> current_state_;              //!< Latest state vector
-  Vector<N> previous_state_;             //!< Previous state vector
+  const InterfaceOde<N>& ode_;            //!< Ordinary differential equation
+  double current_independent_variable_;   //!< Latest value of independent variable
+  Vector<N> current_state_;               //!< Latest state vector
+  double previous_independent_variable_;  //!< Independent variable at the beginning of the latest step
+  Vector<N> previous_state_;              //!< Previous state vector
 };
 
 }  // namespace libra::numerical_integration
@@ -8,9 +8,11 @@
 
 #include <memory>
 
+#include "adams_bashforth_moulton.hpp"
 #include "dormand_prince_5.hpp"
 #include "runge_kutta_4.hpp"
 #include "runge_kutta_fehlberg.hpp"
+#include "runge_kutta_fehlberg_78.hpp"
 
 namespace libra::numerical_integration {
 
@@ -22,6 +24,8 @@ enum class NumericalIntegrationMethod {
   kRk4 = 0,  //!< 4th order Runge-Kutta
   kRkf,      //!< Runge-Kutta-Fehlberg
   kDp5,      //!< 5th order Dormand and Prince
+  kRkf78,    //!< 7th/8th order Runge-Kutta-Fehlberg with dense output
+  kAbm,      //!< 8th order Adams-Bashforth-Moulton predictor-corrector
 };
 
 /**
@@ -48,6 +52,12 @@ class NumericalIntegratorManager {
       case NumericalIntegrationMethod::kDp5:
         integrator_ = std::make_shared<DormandPrince5<N>>(step_width, ode);
         break;
+      case NumericalIntegrationMethod::kRkf78:
+        integrator_ = std::make_shared<RungeKuttaFehlberg78<N>>(step_width, ode);
+        break;
+      case NumericalIntegrationMethod::kAbm:
+        integrator_ = std::make_shared<AdamsBashforthMoulton<N>>(step_width, ode);
+        break;
       default:
         integrator_ = std::make_shared<RungeKutta4<N>>(step_width, ode);
         break;
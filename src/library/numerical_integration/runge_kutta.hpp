@@ -7,15 +7,35 @@
 #ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_HPP_
 #define S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_HPP_
 
+#include <array>
+#include <utility>
+
 #include "numerical_integrator.hpp"
 
 namespace libra::numerical_integration {
 
+/**
+ * @struct ButcherTableau
+ * @brief Coefficients of explicit Runge-Kutta method
+ * @note Define the tableau as an inline constexpr variable to use it as a template argument of RungeKutta
+ */
+template <size_t S>
+struct ButcherTableau {
+  size_t approximation_order;                      //!< Order of approximation (p in the equation)
+  std::array<double, S> nodes;                     //!< Nodes vector (c vector in the equation)
+  std::array<double, S> weights;                   //!< Weights vector (b vector in the equation)
+  std::array<std::array<double, S>, S> rk_matrix;  //!< Runge-Kutta matrix (a matrix in the equation). Only the lower triangle is used.
+};
+
 /**
  * @class RungeKutta
  * @brief Base Class for General Runge-Kutta method
+ * @details The coefficients are given as a constexpr tableau at compile time. The stage loops are unrolled at compile time, the terms with
+ *          zero coefficients are removed, and the state is updated element by element without temporary vectors.
+ * @tparam N: Dimension of the state vector
+ * @tparam kTableau: Butcher tableau (ButcherTableau or the derived one with static storage duration)
  */
-template <size_t N>
+template <size_t N, const auto& kTableau>
 class RungeKutta : public NumericalIntegrator<N> {
  public:
   /**
@@ -24,7 +44,7 @@ class RungeKutta : public NumericalIntegrator<N> {
    * @param [in] step_width_s: Step width
    * @param [in] ode: Ordinary differential equation
    */
-  inline RungeKutta(const double step_width, const InterfaceOde<N>& ode) : NumericalIntegrator<N>(step_width, ode) {}
+  inline RungeKutta(const double step_width, const InterfaceOde<N>& ode) : NumericalIntegrator<N>(step_width, ode) { CalcSlope(); }
   /**
    * @fn ~RungeKutta
    * @brief Destructor
@@ -39,20 +59,46 @@ class RungeKutta : public NumericalIntegrator<N> {
 
  protected:
   // Settings
-  size_t number_of_stages_;     //!< Number of stage for integration (s in the equation)
-  size_t approximation_order_;  //!< Order of approximation (p in the equation)
+  static constexpr size_t kNumberOfStages = kTableau.nodes.size();             //!< Number of stage for integration (s in the equation)
+  static constexpr size_t kApproximationOrder = kTableau.approximation_order;  //!< Order of approximation (p in the equation)
 
-  // Coefficients should be defined by child class
-  std::vector<double> nodes_;                   //!< Nodes vector for general RK (c vector in the equation)
-  std::vector<double> weights_;                 //!< Weights vector for general RK (b vector in the equation)
-  std::vector<std::vector<double>> rk_matrix_;  //!< Runge-Kutta matrix for general RK (a matrix in the equation)
-  std::vector<Vector<N>> slope_;                //!< Slope vector for general RK (k vector in the equation)
+  std::array<Vector<N>, kNumberOfStages> slope_;  //!< Slope vector for general RK (k vector in the equation)
 
   /**
    * @fn CalcSlope
    * @brief Calc slope vector (k in the RK equation)
    */
-  void CalcSlope();
+  inline void CalcSlope() { CalcStages(std::make_index_sequence<kNumberOfStages>{}); }
+
+  /**
+   * @fn AddSlopes
+   * @brief Add the weighted sum of the slopes for an element of the state vector
+   * @note The coefficients should be a part of the constexpr tableau so that the compiler can fold the coefficients and remove the zero terms
+   * @param [in] coefficients: Coefficients for each slope
+   * @param [in] element: Index of the element of the state vector
+   * @param [in/out] value: Value of the element
+   */
+  template <size_t... J>
+  inline void AddSlopes(const std::array<double, kNumberOfStages>& coefficients, const size_t element, double& value,
+                        std::index_sequence<J...>) const {
+    ((coefficients[J] != 0.0 ? (void)(value += coefficients[J] * this->step_width_ * slope_[J][element]) : (void)0), ...);
+  }
+
+ private:
+  /**
+   * @fn CalcStages
+   * @brief Calc slope vector of all stages in order
+   */
+  template <size_t... I>
+  inline void CalcStages(std::index_sequence<I...>) {
+    (CalcStage<I>(), ...);
+  }
+  /**
+   * @fn CalcStage
+   * @brief Calc slope vector of a stage
+   */
+  template <size_t I>
+  void CalcStage();
 };
 
 }  // namespace libra::numerical_integration
@@ -10,12 +10,27 @@
 
 namespace libra::numerical_integration {
 
+/**
+ * @brief Butcher tableau of p=4th/q=5th order Runge-Kutta-Fehlberg (6-stage)
+ */
+inline constexpr EmbeddedButcherTableau<6> kRungeKuttaFehlbergTableau = {
+    {4,
+     {0.0, 1.0 / 4.0, 3.0 / 8.0, 12.0 / 13.0, 1.0, 1.0 / 2.0},
+     {25.0 / 216.0, 0.0, 1408.0 / 2565.0, 2197.0 / 4104.0, -1.0 / 5.0, 0.0},
+     {{{0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {1.0 / 4.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {3.0 / 32.0, 9.0 / 32.0, 0.0, 0.0, 0.0, 0.0},
+       {1932.0 / 2197.0, -7200.0 / 2197.0, 7296.0 / 2197.0, 0.0, 0.0, 0.0},
+       {439.0 / 216.0, -8.0, 3680.0 / 513.0, -845.0 / 4104.0, 0.0, 0.0},
+       {-8.0 / 27.0, 2.0, -3544.0 / 2565.0, 1859.0 / 4104.0, -11.0 / 40.0, 0.0}}}},
+    {16.0 / 135.0, 0.0, 6656.0 / 12825.0, 28561.0 / 56430.0, -9.0 / 50.0, 2.0 / 55.0}};
+
 /**
  * @class RungeKuttaFehlberg
  * @brief Class for Classical Runge-Kutta-Fehlberg method
  */
 template <size_t N>
-class RungeKuttaFehlberg : public EmbeddedRungeKutta<N> {
+class RungeKuttaFehlberg : public EmbeddedRungeKutta<N, kRungeKuttaFehlbergTableau> {
  public:
   /**
    * @fn RungeKuttaFehlberg
@@ -38,7 +53,7 @@ class RungeKuttaFehlberg : public EmbeddedRungeKutta<N> {
    * @param [in] sigma: Sigma value (0 < sigma < 1) for interpolation
    * @return : weights for interpolation
    */
-  std::vector<double> CalcInterpolationWeights(const double sigma) const;
+  std::array<double, 7> CalcInterpolationWeights(const double sigma) const;
 };
 
 }  // namespace libra::numerical_integration
@@ -0,0 +1,100 @@
+/**
+ * @file runge_kutta_fehlberg_78.hpp
+ * @brief Class for 7th/8th order Runge-Kutta-Fehlberg method with dense output
+ * @note Ref: E. Fehlberg, "Classical fifth-, sixth-, seventh-, and eighth-order Runge-Kutta formulas with stepsize control", NASA TR R-287, 1968
+ *            Montenbruck and Gill, Satellite Orbits, 4.1.3 Runge-Kutta-Fehlberg Methods and 4.1.4 Continuous Methods
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_FEHLBERG_78_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_FEHLBERG_78_HPP_
+
+#include "embedded_runge_kutta.hpp"
+
+namespace libra::numerical_integration {
+
+/**
+ * @brief Butcher tableau of p=7th/q=8th order Runge-Kutta-Fehlberg (13-stage)
+ */
+inline constexpr EmbeddedButcherTableau<13> kRungeKuttaFehlberg78Tableau = {
+    {7,
+     {0.0, 2.0 / 27.0, 1.0 / 9.0, 1.0 / 6.0, 5.0 / 12.0, 1.0 / 2.0, 5.0 / 6.0, 1.0 / 6.0, 2.0 / 3.0, 1.0 / 3.0, 1.0, 0.0, 1.0},
+     {41.0 / 840.0, 0.0, 0.0, 0.0, 0.0, 34.0 / 105.0, 9.0 / 35.0, 9.0 / 35.0, 9.0 / 280.0, 9.0 / 280.0, 41.0 / 840.0, 0.0, 0.0},
+     {{{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {2.0 / 27.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {1.0 / 36.0, 1.0 / 12.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {1.0 / 24.0, 0.0, 1.0 / 8.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {5.0 / 12.0, 0.0, -25.0 / 16.0, 25.0 / 16.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {1.0 / 20.0, 0.0, 0.0, 1.0 / 4.0, 1.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {-25.0 / 108.0, 0.0, 0.0, 125.0 / 108.0, -65.0 / 27.0, 125.0 / 54.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {31.0 / 300.0, 0.0, 0.0, 0.0, 61.0 / 225.0, -2.0 / 9.0, 13.0 / 900.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {2.0, 0.0, 0.0, -53.0 / 6.0, 704.0 / 45.0, -107.0 / 9.0, 67.0 / 90.0, 3.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {-91.0 / 108.0, 0.0, 0.0, 23.0 / 108.0, -976.0 / 135.0, 311.0 / 54.0, -19.0 / 60.0, 17.0 / 6.0, -1.0 / 12.0, 0.0, 0.0, 0.0, 0.0},
+       {2383.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -301.0 / 82.0, 2133.0 / 4100.0, 45.0 / 82.0, 45.0 / 164.0, 18.0 / 41.0, 0.0, 0.0,
+        0.0},
+       {3.0 / 205.0, 0.0, 0.0, 0.0, 0.0, -6.0 / 41.0, -3.0 / 205.0, -3.0 / 41.0, 3.0 / 41.0, 6.0 / 41.0, 0.0, 0.0, 0.0},
+       {-1777.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -289.0 / 82.0, 2193.0 / 4100.0, 51.0 / 82.0, 33.0 / 164.0, 12.0 / 41.0, 0.0, 1.0,
+        0.0}}}},
+    {0.0, 0.0, 0.0, 0.0, 0.0, 34.0 / 105.0, 9.0 / 35.0, 9.0 / 35.0, 9.0 / 280.0, 9.0 / 280.0, 0.0, 41.0 / 840.0, 41.0 / 840.0}};
+
+/**
+ * @class RungeKuttaFehlberg78
+ * @brief Class for 7th/8th order Runge-Kutta-Fehlberg method with dense output
+ * @details The state is propagated with the 8th order solution and the error is estimated with the 7th order one.
+ *          The dense output is the quintic Hermite interpolation with the states and the derivatives at the beginning and the end of the latest
+ *          step and at the beginning of the step before it. The interpolation error is O(h^6), which is small enough for the large steps of
+ *          smooth problems. Only the cubic Hermite interpolation is available for the first step after SetState.
+ */
+template <size_t N>
+class RungeKuttaFehlberg78 : public EmbeddedRungeKutta<N, kRungeKuttaFehlberg78Tableau> {
+ public:
+  /**
+   * @fn RungeKuttaFehlberg78
+   * @brief Constructor
+   * @param [in] step_width: Step width
+   * @param [in] ode: Ordinary differential equation
+   */
+  RungeKuttaFehlberg78(const double step_width, const InterfaceOde<N>& ode);
+
+  /**
+   * @fn Integrate
+   * @brief Update the state vector with the numerical integration and keep the information for the interpolation
+   */
+  void Integrate() override;
+  /**
+   * @fn SetState
+   * @brief Set state information and clear the information for the interpolation
+   */
+  void SetState(const double independent_variable, const Vector<N>& state) override;
+  /**
+   * @fn CalcInterpolationState
+   * @brief Calculate interpolation state
+   * @param [in] sigma: Sigma value (0 < sigma < 1) for interpolation
+   * @return : interpolated state x(t0 + sigma * h)
+   */
+  Vector<N> CalcInterpolationState(const double sigma) const override;
+
+ private:
+  bool is_integrated_ = false;               //!< The latest step is available for the interpolation
+  bool is_older_node_available_ = false;     //!< The beginning of the step before the latest step is available for the interpolation
+  double older_independent_variable_ = 0.0;  //!< Independent variable at the beginning of the step before the latest step
+  Vector<N> older_state_;                    //!< State at the beginning of the step before the latest step
+  Vector<N> older_derivative_;               //!< Derivative at the beginning of the step before the latest step
+
+  // Interpolation polynomial of the latest step, which is calculated at the first interpolation after the step
+  mutable bool is_interpolation_prepared_ = false;               //!< Flag for the interpolation polynomial
+  mutable size_t number_of_interpolation_points_;                //!< Number of the points with multiplicity (4 or 6)
+  mutable std::array<double, 6> interpolation_points_;           //!< Independent variables of the points from the latest step beginning
+  mutable std::array<Vector<N>, 6> interpolation_coefficients_;  //!< Coefficients of the Newton form (divided differences)
+
+  /**
+   * @fn PrepareInterpolation
+   * @brief Calculate the coefficients of the Hermite interpolation polynomial of the latest step
+   */
+  void PrepareInterpolation() const;
+};
+
+}  // namespace libra::numerical_integration
+
+#include "runge_kutta_fehlberg_78_implementation.hpp"
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_FEHLBERG_78_HPP_
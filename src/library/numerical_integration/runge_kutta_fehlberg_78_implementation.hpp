@@ -0,0 +1,103 @@
+/**
+ * @file runge_kutta_fehlberg_78_implementation.hpp
+ * @brief Implementation of 7th/8th order Runge-Kutta-Fehlberg method with dense output
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_FEHLBERG_78_IMPLEMENTATION_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_FEHLBERG_78_IMPLEMENTATION_HPP_
+
+#include "runge_kutta_fehlberg_78.hpp"
+
+namespace libra::numerical_integration {
+
+template <size_t N>
+RungeKuttaFehlberg78<N>::RungeKuttaFehlberg78(const double step_width, const InterfaceOde<N>& ode)
+    : EmbeddedRungeKutta<N, kRungeKuttaFehlberg78Tableau>(step_width, ode) {}
+
+template <size_t N>
+void RungeKuttaFehlberg78<N>::Integrate() {
+  // When the integration continues from the end of the latest step, the beginning of the latest step becomes the older node.
+  // When the latest step is retried, the older node is kept as it is.
+  if (is_integrated_ && this->current_independent_variable_ != this->previous_independent_variable_) {
+    older_independent_variable_ = this->previous_independent_variable_;
+    older_state_ = this->previous_state_;
+    older_derivative_ = this->slope_[0];
+    is_older_node_available_ = true;
+  }
+
+  EmbeddedRungeKutta<N, kRungeKuttaFehlberg78Tableau>::Integrate();
+  is_integrated_ = true;
+  is_interpolation_prepared_ = false;
+}
+
+template <size_t N>
+void RungeKuttaFehlberg78<N>::SetState(const double independent_variable, const Vector<N>& state) {
+  EmbeddedRungeKutta<N, kRungeKuttaFehlberg78Tableau>::SetState(independent_variable, state);
+  is_integrated_ = false;
+  is_older_node_available_ = false;
+  is_interpolation_prepared_ = false;
+}
+
+template <size_t N>
+Vector<N> RungeKuttaFehlberg78<N>::CalcInterpolationState(const double sigma) const {
+  if (!is_integrated_) return this->current_state_;
+  if (!is_interpolation_prepared_) PrepareInterpolation();
+
+  // Horner's method for the Newton form
+  const double target = sigma * (this->current_independent_variable_ - this->previous_independent_variable_);
+  Vector<N> interpolation_state = interpolation_coefficients_[number_of_interpolation_points_ - 1];
+  for (size_t i = number_of_interpolation_points_ - 1; i > 0; i--) {
+    const double factor = target - interpolation_points_[i - 1];
+    for (size_t n = 0; n < N; n++) {
+      interpolation_state[n] = interpolation_state[n] * factor + interpolation_coefficients_[i - 1][n];
+    }
+  }
+  return interpolation_state;
+}
+
+template <size_t N>
+void RungeKuttaFehlberg78<N>::PrepareInterpolation() const {
+  const Vector<N> current_derivative = this->ode_.DerivativeFunction(this->current_independent_variable_, this->current_state_);
+
+  // Nodes of the Hermite interpolation. Each node is used twice for the state and the derivative.
+  // The independent variable is measured from the beginning of the latest step to keep the precision.
+  const Vector<N>* states[3];
+  const Vector<N>* derivatives[3];
+  size_t number_of_nodes = 0;
+  if (is_older_node_available_) {
+    interpolation_points_[0] = interpolation_points_[1] = older_independent_variable_ - this->previous_independent_variable_;
+    states[0] = &older_state_;
+    derivatives[0] = &older_derivative_;
+    number_of_nodes++;
+  }
+  interpolation_points_[2 * number_of_nodes] = interpolation_points_[2 * number_of_nodes + 1] = 0.0;
+  states[number_of_nodes] = &this->previous_state_;
+  derivatives[number_of_nodes] = &this->slope_[0];
+  number_of_nodes++;
+  interpolation_points_[2 * number_of_nodes] = interpolation_points_[2 * number_of_nodes + 1] =
+      this->current_independent_variable_ - this->previous_independent_variable_;
+  states[number_of_nodes] = &this->current_state_;
+  derivatives[number_of_nodes] = &current_derivative;
+  number_of_nodes++;
+  number_of_interpolation_points_ = 2 * number_of_nodes;
+
+  // Divided differences with the repeated nodes
+  for (size_t i = 0; i < number_of_interpolation_points_; i++) interpolation_coefficients_[i] = *states[i / 2];
+  for (size_t order = 1; order < number_of_interpolation_points_; order++) {
+    for (size_t i = number_of_interpolation_points_ - 1; i >= order; i--) {
+      if (order == 1 && i % 2 == 1) {
+        interpolation_coefficients_[i] = *derivatives[i / 2];
+        continue;
+      }
+      const double inverse_interval = 1.0 / (interpolation_points_[i] - interpolation_points_[i - order]);
+      for (size_t n = 0; n < N; n++) {
+        interpolation_coefficients_[i][n] = (interpolation_coefficients_[i][n] - interpolation_coefficients_[i - 1][n]) * inverse_interval;
+      }
+    }
+  }
+  is_interpolation_prepared_ = true;
+}
+
+}  // namespace libra::numerical_integration
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_FEHLBERG_78_IMPLEMENTATION_HPP_
@@ -9,28 +9,30 @@
 
 namespace libra::numerical_integration {
 
-template <size_t N>
-void RungeKutta<N>::Integrate() {
+template <size_t N, const auto& kTableau>
+void RungeKutta<N, kTableau>::Integrate() {
   CalcSlope();
 
+  this->previous_independent_variable_ = this->current_independent_variable_;
   this->previous_state_ = this->current_state_;
-  for (size_t i = 0; i < number_of_stages_; i++) {
-    this->current_state_ = this->current_state_ + weights_[i] * this->step_width_ * slope_[i];
+  for (size_t n = 0; n < N; n++) {
+    AddSlopes(kTableau.weights, n, this->current_state_[n], std::make_index_sequence<kNumberOfStages>{});
   }
   this->current_independent_variable_ += this->step_width_;
 }
 
-template <size_t N>
-void RungeKutta<N>::CalcSlope() {
-  slope_.assign(number_of_stages_, Vector<N>(0.0));
-
-  for (size_t i = 0; i < number_of_stages_; i++) {
+template <size_t N, const auto& kTableau>
+template <size_t I>
+void RungeKutta<N, kTableau>::CalcStage() {
+  const double independent_variable = this->current_independent_variable_ + kTableau.nodes[I] * this->step_width_;
+  if constexpr (I == 0) {
+    slope_[I] = this->ode_.DerivativeFunction(independent_variable, this->current_state_);
+  } else {
     Vector<N> state = this->current_state_;
-    for (size_t j = 0; j < i; j++) {
-      state = state + rk_matrix_[i][j] * this->step_width_ * slope_[j];
+    for (size_t n = 0; n < N; n++) {
+      AddSlopes(kTableau.rk_matrix[I], n, state[n], std::make_index_sequence<I>{});
     }
-    double independent_variable = this->current_independent_variable_ + nodes_[i] * this->step_width_;
-    slope_[i] = this->ode_.DerivativeFunction(independent_variable, state);
+    slope_[I] = this->ode_.DerivativeFunction(independent_variable, state);
   }
 }
 
@@ -4,12 +4,15 @@
  */
 #include <gtest/gtest.h>
 
+#include "../math/constants.hpp"
 #include "../orbit/kepler_orbit.hpp"
+#include "adams_bashforth_moulton.hpp"
 #include "dormand_prince_5.hpp"
 #include "numerical_integrator_manager.hpp"
 #include "ode_examples.hpp"
 #include "runge_kutta_4.hpp"
 #include "runge_kutta_fehlberg.hpp"
+#include "runge_kutta_fehlberg_78.hpp"
 
 /**
  * @brief Test for constructor
@@ -698,3 +701,225 @@ TEST(NUMERICAL_INTEGRATION, Interpolation2dTwoBodyOrbitLargeEccentricity) {
   EXPECT_NEAR(kepler.GetVelocity_i_m_s()[0], state_dp5[2], error_tolerance);
   EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state_dp5[3], error_tolerance);
 }
+
+/**
+ * @fn ExpectConsistentTableau
+ * @brief Check the consistency conditions of Butcher tableau (sum of weights = 1, row sum of RK matrix = node)
+ */
+template <size_t S>
+void ExpectConsistentTableau(const libra::numerical_integration::ButcherTableau<S>& tableau) {
+  double sum_of_weights = 0.0;
+  for (size_t i = 0; i < S; i++) {
+    sum_of_weights += tableau.weights[i];
+    double row_sum = 0.0;
+    for (size_t j = 0; j < i; j++) row_sum += tableau.rk_matrix[i][j];
+    EXPECT_NEAR(tableau.nodes[i], row_sum, 1e-14);
+    for (size_t j = i; j < S; j++) EXPECT_DOUBLE_EQ(0.0, tableau.rk_matrix[i][j]);
+  }
+  EXPECT_NEAR(1.0, sum_of_weights, 1e-14);
+}
+
+/**
+ * @brief Test for the consistency of constexpr Butcher tableaux
+ */
+TEST(NUMERICAL_INTEGRATION, ButcherTableau) {
+  using namespace libra::numerical_integration;
+  ExpectConsistentTableau(kRungeKutta4Tableau);
+  ExpectConsistentTableau(kRungeKuttaFehlbergTableau);
+  ExpectConsistentTableau(kDormandPrince5Tableau);
+  ExpectConsistentTableau(kRungeKuttaFehlberg78Tableau);
+
+  double sum_of_higher_order_weights = 0.0;
+  for (auto weight : kRungeKuttaFehlbergTableau.higher_order_weights) sum_of_higher_order_weights += weight;
+  EXPECT_NEAR(1.0, sum_of_higher_order_weights, 1e-14);
+  sum_of_higher_order_weights = 0.0;
+  for (auto weight : kDormandPrince5Tableau.higher_order_weights) sum_of_higher_order_weights += weight;
+  EXPECT_NEAR(1.0, sum_of_higher_order_weights, 1e-14);
+  sum_of_higher_order_weights = 0.0;
+  for (auto weight : kRungeKuttaFehlberg78Tableau.higher_order_weights) sum_of_higher_order_weights += weight;
+  EXPECT_NEAR(1.0, sum_of_higher_order_weights, 1e-14);
+}
+
+/**
+ * @brief Test for integration with 2D two body orbit with high eccentricity by RKF78 with step width control
+ */
+TEST(NUMERICAL_INTEGRATION, Integrate2dTwoBodyOrbitLargeEccentricityRkf78) {
+  libra::numerical_integration::Example2dTwoBodyOrbitOde ode;
+  libra::numerical_integration::RungeKuttaFehlberg78<4> rkf78_ode(0.01, ode);
+
+  libra::Vector<4> initial_state(0.0);
+  const double eccentricity = 0.9;
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+  rkf78_ode.SetState(0.0, initial_state);
+
+  // One orbital period with the step width control
+  const double end_time = 2.0 * libra::pi;
+  const double error_tolerance = 1e-10;
+  size_t step_num = 0;
+  size_t retry_num = 0;
+  while (rkf78_ode.GetIndependentVariable() < end_time) {
+    if (rkf78_ode.GetIndependentVariable() + rkf78_ode.GetStepWidth() > end_time) {
+      rkf78_ode.SetStepWidth(end_time - rkf78_ode.GetIndependentVariable());
+    }
+    rkf78_ode.Integrate();
+    const double error_ratio = rkf78_ode.GetLocalTruncationError() / error_tolerance;
+    const double scale = error_ratio > 0.0 ? 0.9 * pow(error_ratio, -1.0 / 8.0) : 5.0;
+    if (error_ratio > 1.0) {
+      rkf78_ode.RetryStep(rkf78_ode.GetStepWidth() * std::max(scale, 0.2));
+      retry_num++;
+      continue;
+    }
+    rkf78_ode.SetStepWidth(rkf78_ode.GetStepWidth() * std::min(scale, 5.0));
+    step_num++;
+  }
+  EXPECT_GT(retry_num, 0);
+  EXPECT_LT(step_num, 200);
+
+  libra::Vector<4> state = rkf78_ode.GetState();
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_NEAR(initial_state[i], state[i], 1e-6);
+  }
+}
+
+/**
+ * @brief Test for the dense output of RKF78 with 2D two body orbit
+ */
+TEST(NUMERICAL_INTEGRATION, Interpolation2dTwoBodyOrbitRkf78) {
+  double step_width_s = 0.3;
+  libra::numerical_integration::Example2dTwoBodyOrbitOde ode;
+  libra::numerical_integration::RungeKuttaFehlberg78<4> rkf78_ode(step_width_s, ode);
+
+  libra::Vector<4> initial_state(0.0);
+  const double eccentricity = 0.1;
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+  rkf78_ode.SetState(0.0, initial_state);
+
+  libra::Vector<3> initial_position(0.0);
+  libra::Vector<3> initial_velocity(0.0);
+  initial_position[0] = initial_state[0];
+  initial_velocity[1] = initial_state[3];
+  OrbitalElements oe(1.0, 0.0, initial_position, initial_velocity);
+  KeplerOrbit kepler(1.0, oe);
+
+  // The first step uses the cubic Hermite interpolation and the others use the quintic one
+  const size_t step_num = 5;
+  const double error_tolerances[step_num] = {1e-4, 3e-6, 3e-6, 3e-6, 3e-6};
+  for (size_t step = 0; step < step_num; step++) {
+    rkf78_ode.Integrate();
+    for (double sigma = 0.0; sigma <= 1.0; sigma += 0.125) {
+      libra::Vector<4> state = rkf78_ode.CalcInterpolationState(sigma);
+      kepler.CalcOrbit(((double)step + sigma) * step_width_s / (24.0 * 60.0 * 60.0));
+      EXPECT_NEAR(kepler.GetPosition_i_m()[0], state[0], error_tolerances[step]);
+      EXPECT_NEAR(kepler.GetPosition_i_m()[1], state[1], error_tolerances[step]);
+      EXPECT_NEAR(kepler.GetVelocity_i_m_s()[0], state[2], error_tolerances[step]);
+      EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state[3], error_tolerances[step]);
+    }
+  }
+}
+
+/**
+ * @brief Test for the coefficients of Adams-Bashforth-Moulton method
+ */
+TEST(NUMERICAL_INTEGRATION, AdamsBashforthMoultonCoefficients) {
+  using namespace libra::numerical_integration;
+  double sum_of_predictor_coefficients = 0.0;
+  double sum_of_corrector_coefficients = 0.0;
+  for (size_t j = 0; j < 8; j++) {
+    sum_of_predictor_coefficients += kAdamsBashforth8Coefficients[j];
+    sum_of_corrector_coefficients += kAdamsMoulton8Coefficients[j];
+
+    // The interpolation at the end of the step agrees with the corrector
+    double weight = 0.0;
+    for (auto coefficient : kAdamsMoulton8InterpolationPolynomials[j]) weight += coefficient;
+    EXPECT_NEAR(kAdamsMoulton8Coefficients[j], weight, 1e-12);
+  }
+  EXPECT_NEAR(1.0, sum_of_predictor_coefficients, 1e-14);
+  EXPECT_NEAR(1.0, sum_of_corrector_coefficients, 1e-14);
+}
+
+/**
+ * @brief Accuracy comparison between RK4 and ABM for integration with 2D two body orbit with small eccentricity
+ */
+TEST(NUMERICAL_INTEGRATION, Integrate2dTwoBodyOrbitSmallEccentricityAbm) {
+  double step_width_s = 0.1;
+  libra::numerical_integration::Example2dTwoBodyOrbitOde ode;
+  libra::numerical_integration::RungeKutta4<4> rk4_ode(step_width_s, ode);
+  libra::numerical_integration::AdamsBashforthMoulton<4> abm_ode(step_width_s, ode);
+
+  libra::Vector<4> initial_state(0.0);
+  const double eccentricity = 0.1;
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+  rk4_ode.SetState(0.0, initial_state);
+  abm_ode.SetState(0.0, initial_state);
+  EXPECT_TRUE(abm_ode.IsStartUp());
+
+  size_t step_num = 200;
+  for (size_t i = 0; i < step_num; i++) {
+    rk4_ode.Integrate();
+    abm_ode.Integrate();
+    EXPECT_EQ(i < 6, abm_ode.IsStartUp());
+  }
+  libra::Vector<4> state_rk4 = rk4_ode.GetState();
+  libra::Vector<4> state_abm = abm_ode.GetState();
+
+  // Estimation by Kepler Orbit calculation
+  libra::Vector<3> initial_position(0.0);
+  libra::Vector<3> initial_velocity(0.0);
+  initial_position[0] = initial_state[0];
+  initial_velocity[1] = initial_state[3];
+  OrbitalElements oe(1.0, 0.0, initial_position, initial_velocity);
+  KeplerOrbit kepler(1.0, oe);
+  kepler.CalcOrbit((double)(step_num * step_width_s) / (24.0 * 60.0 * 60.0));
+
+  double error_tolerance = 2e-4;
+  EXPECT_NEAR(kepler.GetPosition_i_m()[0], state_rk4[0], error_tolerance);
+  EXPECT_NEAR(kepler.GetPosition_i_m()[1], state_rk4[1], error_tolerance);
+  EXPECT_NEAR(kepler.GetVelocity_i_m_s()[0], state_rk4[2], error_tolerance);
+  EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state_rk4[3], error_tolerance);
+
+  error_tolerance = 2e-6;
+  EXPECT_NEAR(kepler.GetPosition_i_m()[0], state_abm[0], error_tolerance);
+  EXPECT_NEAR(kepler.GetPosition_i_m()[1], state_abm[1], error_tolerance);
+  EXPECT_NEAR(kepler.GetVelocity_i_m_s()[0], state_abm[2], error_tolerance);
+  EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state_abm[3], error_tolerance);
+}
+
+/**
+ * @brief Test for the dense output of ABM with 2D two body orbit
+ */
+TEST(NUMERICAL_INTEGRATION, Interpolation2dTwoBodyOrbitAbm) {
+  double step_width_s = 0.1;
+  libra::numerical_integration::Example2dTwoBodyOrbitOde ode;
+  libra::numerical_integration::AdamsBashforthMoulton<4> abm_ode(step_width_s, ode);
+
+  libra::Vector<4> initial_state(0.0);
+  const double eccentricity = 0.1;
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+  abm_ode.SetState(0.0, initial_state);
+
+  libra::Vector<3> initial_position(0.0);
+  libra::Vector<3> initial_velocity(0.0);
+  initial_position[0] = initial_state[0];
+  initial_velocity[1] = initial_state[3];
+  OrbitalElements oe(1.0, 0.0, initial_position, initial_velocity);
+  KeplerOrbit kepler(1.0, oe);
+
+  // The start up steps use the cubic Hermite interpolation and the others use the corrector polynomial
+  const size_t step_num = 10;
+  for (size_t step = 0; step < step_num; step++) {
+    abm_ode.Integrate();
+    const double error_tolerance = abm_ode.IsStartUp() ? 2e-6 : 5e-8;
+    for (double sigma = 0.0; sigma <= 1.0; sigma += 0.125) {
+      libra::Vector<4> state = abm_ode.CalcInterpolationState(sigma);
+      kepler.CalcOrbit(((double)step + sigma) * step_width_s / (24.0 * 60.0 * 60.0));
+      EXPECT_NEAR(kepler.GetPosition_i_m()[0], state[0], error_tolerance);
+      EXPECT_NEAR(kepler.GetPosition_i_m()[1], state[1], error_tolerance);
+      EXPECT_NEAR(kepler.GetVelocity_i_m_s()[0], state[2], error_tolerance);
+      EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state[3], error_tolerance);
+    }
+  }
+}
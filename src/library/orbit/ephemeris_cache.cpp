@@ -0,0 +1,101 @@
+/**
+ * @file ephemeris_cache.cpp
+ * @brief Cache of ephemeris with cubic Hermite interpolation
+ */
+
+#include "ephemeris_cache.hpp"
+
+#include <cmath>
+
+EphemerisCache::EphemerisCache(const double tolerance, const double maximum_node_interval_s, const double minimum_node_interval_s)
+    : tolerance_(tolerance), maximum_node_interval_s_(maximum_node_interval_s), minimum_node_interval_s_(minimum_node_interval_s) {
+  if (minimum_node_interval_s_ <= 0.0) minimum_node_interval_s_ = 1.0;
+  if (maximum_node_interval_s_ < minimum_node_interval_s_) maximum_node_interval_s_ = minimum_node_interval_s_;
+}
+
+void EphemerisCache::GetState(const double time_s, const StateFunction& state_function, double state[6]) {
+  if (node_interval_s_ <= 0.0) {
+    node_interval_s_ = maximum_node_interval_s_;
+    LoadNodes(time_s, state_function);
+    RefineNodeInterval(time_s, state_function);
+  }
+
+  const double first_node_time_s = (double)node_index_ * node_interval_s_;
+  if (!is_node_loaded_ || time_s < first_node_time_s || time_s > first_node_time_s + node_interval_s_) {
+    LoadNodes(time_s, state_function);
+    // The error changes along the orbit, so the interval is checked again periodically
+    number_of_unchecked_intervals_++;
+    if (number_of_unchecked_intervals_ >= kCheckIntervalCount) RefineNodeInterval(time_s, state_function);
+  }
+  Interpolate(time_s, state);
+}
+
+void EphemerisCache::RefineNodeInterval(const double time_s, const StateFunction& state_function) {
+  // The error of the cubic Hermite interpolation is proportional to the fourth power of the interval and takes its maximum at the middle.
+  // A safety factor is applied since the error changes until the next check.
+  const double kSafetyFactor = 0.5;
+
+  number_of_unchecked_intervals_ = 0;
+  while (node_interval_s_ * 0.5 >= minimum_node_interval_s_ && CalcMiddlePositionError(state_function) > kSafetyFactor * tolerance_) {
+    node_interval_s_ *= 0.5;
+    // The loaded nodes are placed with the previous interval, so they must not be reused
+    is_node_loaded_ = false;
+    LoadNodes(time_s, state_function);
+  }
+}
+
+double EphemerisCache::CalcMiddlePositionError(const StateFunction& state_function) {
+  const double middle_time_s = ((double)node_index_ + 0.5) * node_interval_s_;
+  double exact_state[6], interpolated_state[6];
+  state_function(middle_time_s, exact_state);
+  number_of_state_function_calls_++;
+  Interpolate(middle_time_s, interpolated_state);
+
+  double error = 0.0;
+  for (size_t i = 0; i < 3; i++) {
+    error += (exact_state[i] - interpolated_state[i]) * (exact_state[i] - interpolated_state[i]);
+  }
+  return sqrt(error);
+}
+
+void EphemerisCache::LoadNodes(const double time_s, const StateFunction& state_function) {
+  const long long node_index = (long long)floor(time_s / node_interval_s_);
+  if (is_node_loaded_ && node_index == node_index_ + 1) {
+    // Moving forward, the second node is reused as the first node
+    for (size_t i = 0; i < 6; i++) node_states_[0][i] = node_states_[1][i];
+  } else {
+    state_function((double)node_index * node_interval_s_, node_states_[0]);
+    number_of_state_function_calls_++;
+  }
+  state_function((double)(node_index + 1) * node_interval_s_, node_states_[1]);
+  number_of_state_function_calls_++;
+
+  node_index_ = node_index;
+  is_node_loaded_ = true;
+}
+
+void EphemerisCache::Interpolate(const double time_s, double state[6]) const {
+  const double h = node_interval_s_;
+  const double s = (time_s - (double)node_index_ * h) / h;
+  const double s2 = s * s;
+  const double s3 = s2 * s;
+
+  // Hermite basis functions and their derivatives with respect to s
+  const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+  const double h10 = s3 - 2.0 * s2 + s;
+  const double h01 = -2.0 * s3 + 3.0 * s2;
+  const double h11 = s3 - s2;
+  const double dh00 = 6.0 * s2 - 6.0 * s;
+  const double dh10 = 3.0 * s2 - 4.0 * s + 1.0;
+  const double dh01 = -6.0 * s2 + 6.0 * s;
+  const double dh11 = 3.0 * s2 - 2.0 * s;
+
+  for (size_t i = 0; i < 3; i++) {
+    const double p0 = node_states_[0][i];
+    const double v0 = node_states_[0][i + 3];
+    const double p1 = node_states_[1][i];
+    const double v1 = node_states_[1][i + 3];
+    state[i] = h00 * p0 + h10 * h * v0 + h01 * p1 + h11 * h * v1;
+    state[i + 3] = (dh00 * p0 + dh01 * p1) / h + dh10 * v0 + dh11 * v1;
+  }
+}
@@ -0,0 +1,102 @@
+/**
+ * @file ephemeris_cache.hpp
+ * @brief Cache of ephemeris with cubic Hermite interpolation
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_EPHEMERIS_CACHE_HPP_
+#define S2E_LIBRARY_ORBIT_EPHEMERIS_CACHE_HPP_
+
+#include <cstddef>
+#include <functional>
+
+/**
+ * @class EphemerisCache
+ * @brief Cache of ephemeris with cubic Hermite interpolation
+ * @note The states (position and velocity) are sampled at nodes placed at every node interval, and the state between two nodes is
+ *       interpolated with the cubic Hermite polynomial. The nodes are fetched lazily when the requested time goes out of the current interval.
+ *       The node interval is calibrated at the first request so that the position error at the middle of the interval is smaller than the tolerance,
+ *       and it is halved when the check repeated at every kCheckIntervalCount intervals fails. The velocity is not checked. Its error of the
+ *       cubic Hermite interpolation is about 3 * tolerance / node interval at most, so the bound of the velocity is a heuristic.
+ *       Coordinate and unit of position is defined by users of this class, and the unit of velocity must be [position unit / s].
+ */
+class EphemerisCache {
+ public:
+  /**
+   * @typedef StateFunction
+   * @brief Function to get the exact state. The arguments are time [s] and output state (position and velocity).
+   */
+  typedef std::function<void(const double, double[6])> StateFunction;
+
+  /**
+   * @fn EphemerisCache
+   * @brief Constructor
+   * @param [in] tolerance: Tolerance of the interpolated position
+   * @param [in] maximum_node_interval_s: Maximum interval of the nodes [s]
+   * @param [in] minimum_node_interval_s: Minimum interval of the nodes [s]
+   */
+  EphemerisCache(const double tolerance, const double maximum_node_interval_s = 86400.0, const double minimum_node_interval_s = 1.0);
+
+  /**
+   * @fn GetState
+   * @brief Return the interpolated state
+   * @param [in] time_s: Time [s]
+   * @param [in] state_function: Function to get the exact state at the nodes
+   * @param [out] state: Interpolated position and velocity
+   */
+  void GetState(const double time_s, const StateFunction& state_function, double state[6]);
+
+  // Getters
+  /**
+   * @fn GetNodeInterval_s
+   * @brief Return calibrated interval of the nodes [s]. Zero means that the interval is not calibrated yet.
+   */
+  inline double GetNodeInterval_s() const { return node_interval_s_; }
+  /**
+   * @fn GetNumberOfStateFunctionCalls
+   * @brief Return number of calls of the state function
+   */
+  inline size_t GetNumberOfStateFunctionCalls() const { return number_of_state_function_calls_; }
+
+ private:
+  static const size_t kCheckIntervalCount = 16;  //!< Number of the loaded intervals between the checks of the error
+
+  double tolerance_;                           //!< Tolerance of the interpolated position
+  double maximum_node_interval_s_;             //!< Maximum interval of the nodes [s]
+  double minimum_node_interval_s_;             //!< Minimum interval of the nodes [s]
+  double node_interval_s_ = 0.0;               //!< Calibrated interval of the nodes [s]
+  bool is_node_loaded_ = false;                //!< Flag to show the node states are loaded
+  long long node_index_ = 0;                   //!< Index of the first node. The time of the node is node_index_ * node_interval_s_.
+  double node_states_[2][6];                   //!< States at the first and the second nodes
+  size_t number_of_state_function_calls_ = 0;  //!< Number of calls of the state function
+  size_t number_of_unchecked_intervals_ = 0;   //!< Number of the intervals loaded after the last check of the error
+
+  /**
+   * @fn RefineNodeInterval
+   * @brief Halve the node interval until the error at the middle point of the loaded nodes satisfies the tolerance
+   * @param [in] time_s: Time [s]
+   * @param [in] state_function: Function to get the exact state
+   */
+  void RefineNodeInterval(const double time_s, const StateFunction& state_function);
+  /**
+   * @fn CalcMiddlePositionError
+   * @brief Return the error of the interpolated position at the middle point of the loaded nodes
+   * @param [in] state_function: Function to get the exact state
+   */
+  double CalcMiddlePositionError(const StateFunction& state_function);
+  /**
+   * @fn LoadNodes
+   * @brief Load the node states of the interval including the time
+   * @param [in] time_s: Time [s]
+   * @param [in] state_function: Function to get the exact state
+   */
+  void LoadNodes(const double time_s, const StateFunction& state_function);
+  /**
+   * @fn Interpolate
+   * @brief Interpolate the state between the loaded nodes
+   * @param [in] time_s: Time [s]
+   * @param [out] state: Interpolated position and velocity
+   */
+  void Interpolate(const double time_s, double state[6]) const;
+};
+
+#endif  // S2E_LIBRARY_ORBIT_EPHEMERIS_CACHE_HPP_
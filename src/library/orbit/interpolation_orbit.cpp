@@ -28,9 +28,11 @@ bool InterpolationOrbit::PushAndPopData(const double time, const libra::Vector<3
 }
 
 libra::Vector<3> InterpolationOrbit::CalcPositionWithTrigonometric(const double time, const double period) const {
+  // All axes share the time list, so the coefficients are calculated once
+  interpolation_position_[0].CalcTrigonometricCoefficients(time, period, coefficients_);
   libra::Vector<3> output_position;
   for (size_t axis = 0; axis < 3; axis++) {
-    output_position[axis] = interpolation_position_[axis].CalcTrigonometric(time, period);
+    output_position[axis] = interpolation_position_[axis].CalcWeightedSum(coefficients_);
   }
   return output_position;
 }
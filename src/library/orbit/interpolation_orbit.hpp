@@ -67,6 +67,7 @@ class InterpolationOrbit {
 
  private:
   std::vector<libra::Interpolation> interpolation_position_;  // 3D vector of interpolation
+  mutable std::vector<double> coefficients_;                  //!< Interpolation coefficients shared with all axes
 };
 
 #endif  // S2E_LIBRARY_ORBIT_INTERPOLATION_ORBIT_HPP_
@@ -0,0 +1,119 @@
+/**
+ * @file test_ephemeris_cache.cpp
+ * @brief Test codes for EphemerisCache class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <library/math/constants.hpp>
+
+#include "ephemeris_cache.hpp"
+
+/**
+ * @fn CalcCircularOrbit
+ * @brief Exact state of a circular orbit for the test (radius 3.8e8 m, period 27.3 days)
+ */
+void CalcCircularOrbit(const double time_s, double state[6]) {
+  const double radius_m = 3.8e8;
+  const double angular_velocity_rad_s = 2.0 * libra::pi / (27.3 * 86400.0);
+  const double angle_rad = angular_velocity_rad_s * time_s;
+  state[0] = radius_m * cos(angle_rad);
+  state[1] = radius_m * sin(angle_rad);
+  state[2] = 0.1 * radius_m * sin(angle_rad);
+  state[3] = -radius_m * angular_velocity_rad_s * sin(angle_rad);
+  state[4] = radius_m * angular_velocity_rad_s * cos(angle_rad);
+  state[5] = 0.1 * radius_m * angular_velocity_rad_s * cos(angle_rad);
+}
+
+/**
+ * @brief Test that the interpolated position satisfies the tolerance with few calls of the state function
+ */
+TEST(EphemerisCache, Accuracy) {
+  const double tolerance_m = 1.0;
+  EphemerisCache ephemeris_cache(tolerance_m);
+  EXPECT_DOUBLE_EQ(0.0, ephemeris_cache.GetNodeInterval_s());
+
+  const double start_time_s = 4.5e8;
+  const double step_time_s = 10.0;
+  const size_t kStepNum = 86400;
+  for (size_t i = 0; i < kStepNum; i++) {
+    const double time_s = start_time_s + step_time_s * i;
+    double expected_state[6], state[6];
+    CalcCircularOrbit(time_s, expected_state);
+    ephemeris_cache.GetState(time_s, CalcCircularOrbit, state);
+
+    double error_m = 0.0;
+    for (size_t j = 0; j < 3; j++) error_m += pow(expected_state[j] - state[j], 2.0);
+    EXPECT_LT(sqrt(error_m), tolerance_m);
+    for (size_t j = 3; j < 6; j++) EXPECT_NEAR(expected_state[j], state[j], 1.0e-3);
+  }
+
+  // The nodes are placed at intervals of a few hours
+  EXPECT_GT(ephemeris_cache.GetNodeInterval_s(), 3600.0);
+  EXPECT_LT(ephemeris_cache.GetNumberOfStateFunctionCalls(), kStepNum / 100);
+}
+
+/**
+ * @brief Test that the states at the nodes are exact, and the time can go backward
+ */
+TEST(EphemerisCache, Nodes) {
+  EphemerisCache ephemeris_cache(1.0e-3, 3600.0, 60.0);
+
+  double state[6], expected_state[6];
+  ephemeris_cache.GetState(100.0, CalcCircularOrbit, state);
+  const double node_interval_s = ephemeris_cache.GetNodeInterval_s();
+  EXPECT_GE(node_interval_s, 60.0);
+  EXPECT_LE(node_interval_s, 3600.0);
+
+  // Backward in time
+  const double node_time_s = -3.0 * node_interval_s;
+  ephemeris_cache.GetState(node_time_s, CalcCircularOrbit, state);
+  CalcCircularOrbit(node_time_s, expected_state);
+  for (size_t j = 0; j < 6; j++) EXPECT_NEAR(expected_state[j], state[j], 1.0e-6 * fabs(expected_state[j]) + 1.0e-9);
+  EXPECT_DOUBLE_EQ(node_interval_s, ephemeris_cache.GetNodeInterval_s());
+}
+
+/**
+ * @fn CalcChirpOrbit
+ * @brief Exact state of a circular orbit whose angular velocity triples in 30 days (radius 3.8e8 m, initial period 27.3 days)
+ */
+void CalcChirpOrbit(const double time_s, double state[6]) {
+  const double radius_m = 3.8e8;
+  const double initial_angular_velocity_rad_s = 2.0 * libra::pi / (27.3 * 86400.0);
+  const double angular_acceleration_rad_s2 = 2.0 * initial_angular_velocity_rad_s / (30.0 * 86400.0);
+  const double angle_rad = initial_angular_velocity_rad_s * time_s + 0.5 * angular_acceleration_rad_s2 * time_s * time_s;
+  const double angular_velocity_rad_s = initial_angular_velocity_rad_s + angular_acceleration_rad_s2 * time_s;
+  state[0] = radius_m * cos(angle_rad);
+  state[1] = radius_m * sin(angle_rad);
+  state[2] = 0.0;
+  state[3] = -radius_m * angular_velocity_rad_s * sin(angle_rad);
+  state[4] = radius_m * angular_velocity_rad_s * cos(angle_rad);
+  state[5] = 0.0;
+}
+
+/**
+ * @brief Test that the node interval is shortened when the error grows along the orbit
+ */
+TEST(EphemerisCache, Refinement) {
+  const double tolerance_m = 1.0;
+  EphemerisCache ephemeris_cache(tolerance_m);
+
+  const double step_time_s = 60.0;
+  const size_t kStepNum = 43200;
+  double state[6], expected_state[6];
+  ephemeris_cache.GetState(0.0, CalcChirpOrbit, state);
+  const double calibrated_node_interval_s = ephemeris_cache.GetNodeInterval_s();
+  for (size_t i = 0; i < kStepNum; i++) {
+    const double time_s = step_time_s * i;
+    CalcChirpOrbit(time_s, expected_state);
+    ephemeris_cache.GetState(time_s, CalcChirpOrbit, state);
+
+    double error_m = 0.0;
+    for (size_t j = 0; j < 3; j++) error_m += pow(expected_state[j] - state[j], 2.0);
+    EXPECT_LT(sqrt(error_m), tolerance_m) << "time_s: " << time_s;
+    for (size_t j = 3; j < 6; j++) EXPECT_NEAR(expected_state[j], state[j], 1.0e-3) << "time_s: " << time_s;
+  }
+
+  // The error grows 81 times at the same interval since the angular velocity triples
+  EXPECT_LT(ephemeris_cache.GetNodeInterval_s(), calibrated_node_interval_s);
+}
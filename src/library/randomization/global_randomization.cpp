@@ -5,7 +5,7 @@
 
 #include "global_randomization.hpp"
 
-GlobalRandomization global_randomization;
+thread_local GlobalRandomization global_randomization;
 
 GlobalRandomization::GlobalRandomization() { seed_ = 0xdeadbeef; }
 
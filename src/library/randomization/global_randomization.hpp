@@ -37,6 +37,6 @@ class GlobalRandomization {
   long seed_;                                       //!< Seed of global randomization
 };
 
-extern GlobalRandomization global_randomization;  //!< Global randomization
+extern thread_local GlobalRandomization global_randomization;  //!< Global randomization prepared for each thread
 
 #endif  // S2E_LIBRARY_RANDOMIZATION_GLOBAL_RANDOMIZATION_HPP_
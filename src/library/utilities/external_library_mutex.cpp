@@ -0,0 +1,21 @@
+/**
+ * @file external_library_mutex.cpp
+ * @brief Mutexes to serialize calls of external libraries which are not thread-safe
+ */
+
+#include "external_library_mutex.hpp"
+
+std::mutex& GetExternalLibraryMutex(const ExternalLibrary library) {
+  static std::mutex cspice_mutex;
+  static std::mutex igrf_mutex;
+  static std::mutex nrlmsise00_mutex;
+
+  switch (library) {
+    case ExternalLibrary::kIgrf:
+      return igrf_mutex;
+    case ExternalLibrary::kNrlmsise00:
+      return nrlmsise00_mutex;
+    default:
+      return cspice_mutex;
+  }
+}
@@ -0,0 +1,30 @@
+/**
+ * @file external_library_mutex.hpp
+ * @brief Mutexes to serialize calls of external libraries which are not thread-safe
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_EXTERNAL_LIBRARY_MUTEX_HPP_
+#define S2E_LIBRARY_UTILITIES_EXTERNAL_LIBRARY_MUTEX_HPP_
+
+#include <mutex>
+
+/**
+ * @enum ExternalLibrary
+ * @brief External libraries which have global state
+ */
+enum class ExternalLibrary {
+  kCspice,      //!< CSPICE (kernel pool and error state)
+  kIgrf,        //!< Legacy IGRF functions in library/external/igrf (coefficients and work variables)
+  kNrlmsise00,  //!< NRLMSISE-00 (model state)
+};
+
+/**
+ * @fn GetExternalLibraryMutex
+ * @brief Return the process-wide mutex for the external library
+ * @note Simulation cases executed in parallel threads share the global state of these libraries.
+ *       Each call (or a sequence of calls which depends on the state) must be protected with the mutex.
+ * @param [in] library: Target library
+ */
+std::mutex& GetExternalLibraryMutex(const ExternalLibrary library);
+
+#endif  // S2E_LIBRARY_UTILITIES_EXTERNAL_LIBRARY_MUTEX_HPP_
@@ -0,0 +1,48 @@
+/**
+ * @file file_utility.cpp
+ * @brief Functions for the files shared by the repeated and the parallel runs
+ */
+
+#include "file_utility.hpp"
+
+#include <sys/stat.h>
+
+#include <cstdio>
+
+bool GetFileStatus(const std::string& file_path, uint64_t& file_size_B, int64_t& file_modified_time) {
+  struct stat status;
+  if (stat(file_path.c_str(), &status) != 0) {
+    file_size_B = 0;
+    file_modified_time = 0;
+    return false;
+  }
+  file_size_B = (uint64_t)status.st_size;
+#if defined(WIN32) || defined(__APPLE__)
+  file_modified_time = (int64_t)status.st_mtime * 1000000000;
+#else
+  file_modified_time = (int64_t)status.st_mtim.tv_sec * 1000000000 + status.st_mtim.tv_nsec;
+#endif
+  return true;
+}
+
+bool ReplaceFileAtomically(const std::string& file_path, const std::function<void(std::ofstream&)>& write_function) {
+  const std::string temporary_file_path = file_path + ".tmp";
+  std::ofstream file(temporary_file_path, std::ios::binary);
+  if (!file.is_open()) return false;
+  write_function(file);
+  file.close();
+  if (file.fail()) {
+    std::remove(temporary_file_path.c_str());
+    return false;
+  }
+
+  // rename replaces the existing file on POSIX, but it fails on Windows when the file exists
+  if (std::rename(temporary_file_path.c_str(), file_path.c_str()) != 0) {
+    std::remove(file_path.c_str());
+    if (std::rename(temporary_file_path.c_str(), file_path.c_str()) != 0) {
+      std::remove(temporary_file_path.c_str());
+      return false;
+    }
+  }
+  return true;
+}
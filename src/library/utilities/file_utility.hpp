@@ -0,0 +1,35 @@
+/**
+ * @file file_utility.hpp
+ * @brief Functions for the files shared by the repeated and the parallel runs
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_FILE_UTILITY_HPP_
+#define S2E_LIBRARY_UTILITIES_FILE_UTILITY_HPP_
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+
+/**
+ * @fn GetFileStatus
+ * @brief Get the size and the modification time of the file
+ * @param [in] file_path: Path to the file
+ * @param [out] file_size_B: Size of the file [Byte]. Zero when the file does not exist.
+ * @param [out] file_modified_time: Modification time of the file [ns]. The resolution is a second on Windows and macOS.
+ * @return True when the file exists
+ */
+bool GetFileStatus(const std::string& file_path, uint64_t& file_size_B, int64_t& file_modified_time);
+
+/**
+ * @fn ReplaceFileAtomically
+ * @brief Write a binary file into the temporary file "<file_path>.tmp" and rename it to the file
+ * @note The other runs which read or map the file never see the partially written file. The rename replaces the existing file atomically on
+ *       POSIX, while the existing file is removed before the rename on Windows. The temporary file is removed on any failure.
+ * @param [in] file_path: Path to the file
+ * @param [in] write_function: Function to write the contents into the opened temporary file
+ * @return True when the file is written and replaced
+ */
+bool ReplaceFileAtomically(const std::string& file_path, const std::function<void(std::ofstream&)>& write_function);
+
+#endif  // S2E_LIBRARY_UTILITIES_FILE_UTILITY_HPP_
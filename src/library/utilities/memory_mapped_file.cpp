@@ -0,0 +1,76 @@
+/**
+ * @file memory_mapped_file.cpp
+ * @brief Class to map a read-only file into memory
+ */
+
+#include "memory_mapped_file.hpp"
+
+#include "macros.hpp"
+
+#ifdef WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const uint64_t MemoryMappedFile::kHashSeed = 14695981039346656037ULL;
+
+MemoryMappedFile::MemoryMappedFile(const std::string& file_path, const MemoryAccessPattern access_pattern) {
+#ifdef WIN32
+  UNUSED(access_pattern);
+  std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+  if (!file.is_open()) return;
+  buffer_.resize((size_t)file.tellg());
+  file.seekg(0);
+  file.read(buffer_.data(), buffer_.size());
+  data_ = buffer_.data();
+  size_B_ = buffer_.size();
+  is_opened_ = true;
+#else
+  const int file_descriptor = open(file_path.c_str(), O_RDONLY);
+  if (file_descriptor < 0) return;
+  struct stat file_status;
+  if (fstat(file_descriptor, &file_status) != 0) {
+    close(file_descriptor);
+    return;
+  }
+  size_B_ = (size_t)file_status.st_size;
+  if (size_B_ > 0) {
+    void* mapped_address = mmap(nullptr, size_B_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (mapped_address == MAP_FAILED) {
+      size_B_ = 0;
+      close(file_descriptor);
+      return;
+    }
+    if (access_pattern == MemoryAccessPattern::kSequential) {
+      madvise(mapped_address, size_B_, MADV_SEQUENTIAL);
+    } else if (access_pattern == MemoryAccessPattern::kRandom) {
+      madvise(mapped_address, size_B_, MADV_RANDOM);
+    }
+    data_ = static_cast<const char*>(mapped_address);
+  }
+  // The mapping is kept after the file descriptor is closed
+  close(file_descriptor);
+  is_opened_ = true;
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+#ifndef WIN32
+  if (data_ != nullptr) munmap(const_cast<char*>(data_), size_B_);
+#endif
+}
+
+uint64_t MemoryMappedFile::CalcHash(const void* data, const size_t size_B, const uint64_t seed) {
+  const uint64_t kFnvPrime = 1099511628211ULL;
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  uint64_t hash = seed;
+  for (size_t i = 0; i < size_B; i++) {
+    hash ^= bytes[i];
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
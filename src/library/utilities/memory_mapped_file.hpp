@@ -0,0 +1,92 @@
+/**
+ * @file memory_mapped_file.hpp
+ * @brief Class to map a read-only file into memory
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_MEMORY_MAPPED_FILE_HPP_
+#define S2E_LIBRARY_UTILITIES_MEMORY_MAPPED_FILE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @enum MemoryAccessPattern
+ * @brief Expected access pattern to the mapped data given to the OS as the advice
+ */
+enum class MemoryAccessPattern {
+  kNormal = 0,  //!< No advice. The default read-ahead of the OS is used.
+  kSequential,  //!< Read from the top to the end, e.g. parsing of a text file
+  kRandom,      //!< Read at random positions without read-ahead
+};
+
+/**
+ * @class MemoryMappedFile
+ * @brief Class to map a read-only file into memory
+ * @note The file is mapped with mmap on POSIX systems, and the access pattern is given with madvise. On Windows, the whole file is read into a
+ *       buffer instead. The data is not null-terminated.
+ */
+class MemoryMappedFile {
+ public:
+  static const uint64_t kHashSeed;  //!< Initial value of the hash (offset basis of 64 bit FNV-1a)
+
+  /**
+   * @fn MemoryMappedFile
+   * @brief Constructor
+   * @param [in] file_path: Path to the file
+   * @param [in] access_pattern: Expected access pattern to the mapped data
+   */
+  explicit MemoryMappedFile(const std::string& file_path, const MemoryAccessPattern access_pattern = MemoryAccessPattern::kSequential);
+  /**
+   * @fn ~MemoryMappedFile
+   * @brief Destructor
+   */
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  /**
+   * @fn IsOpened
+   * @brief Return true when the file is mapped
+   */
+  inline bool IsOpened() const { return is_opened_; }
+  /**
+   * @fn GetData
+   * @brief Return top of the mapped data
+   */
+  inline const char* GetData() const { return data_; }
+  /**
+   * @fn GetSize_B
+   * @brief Return size of the mapped data [Byte]
+   */
+  inline size_t GetSize_B() const { return size_B_; }
+
+  /**
+   * @fn CalcHash
+   * @brief Calculate 64 bit FNV-1a hash of the mapped data
+   * @param [in] seed: Initial value of the hash. Hash of the former data can be given to chain multiple data.
+   * @return Hash value
+   */
+  inline uint64_t CalcHash(const uint64_t seed = kHashSeed) const { return CalcHash(data_, size_B_, seed); }
+  /**
+   * @fn CalcHash
+   * @brief Calculate 64 bit FNV-1a hash of the data
+   * @param [in] data: Top of the data
+   * @param [in] size_B: Size of the data [Byte]
+   * @param [in] seed: Initial value of the hash. Hash of the former data can be given to chain multiple data.
+   * @return Hash value
+   */
+  static uint64_t CalcHash(const void* data, const size_t size_B, const uint64_t seed = kHashSeed);
+
+ private:
+  const char* data_ = nullptr;  //!< Top of the mapped data
+  size_t size_B_ = 0;           //!< Size of the mapped data [Byte]
+  bool is_opened_ = false;      //!< Flag to show the file is mapped
+#ifdef WIN32
+  std::vector<char> buffer_;  //!< Buffer to keep the file contents instead of mapping
+#endif
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_MEMORY_MAPPED_FILE_HPP_
@@ -0,0 +1,44 @@
+/**
+ * @file multi_rate_scheduler.cpp
+ * @brief Event-driven scheduler of rate groups with integer tick periods
+ */
+
+#include "multi_rate_scheduler.hpp"
+
+size_t MultiRateScheduler::AddRateGroup(const uint64_t period_ticks, const uint64_t first_tick) {
+  RateGroup rate_group;
+  rate_group.period_ticks = period_ticks > 0 ? period_ticks : 1;
+  rate_group.first_tick = first_tick;
+  rate_group.is_due = false;
+  rate_groups_.push_back(rate_group);
+
+  const size_t group_id = rate_groups_.size() - 1;
+  event_queue_.push(Event(first_tick > current_tick_ ? first_tick : current_tick_ + 1, group_id));
+  return group_id;
+}
+
+void MultiRateScheduler::Reset() {
+  current_tick_ = 0;
+  event_queue_ = std::priority_queue<Event, std::vector<Event>, std::greater<Event>>();
+  due_group_ids_.clear();
+  for (size_t group_id = 0; group_id < rate_groups_.size(); group_id++) {
+    rate_groups_[group_id].is_due = false;
+    event_queue_.push(Event(rate_groups_[group_id].first_tick, group_id));
+  }
+}
+
+void MultiRateScheduler::AdvanceTo(const uint64_t tick) {
+  for (size_t group_id : due_group_ids_) {
+    rate_groups_[group_id].is_due = false;
+  }
+  due_group_ids_.clear();
+  if (tick > current_tick_) current_tick_ = tick;
+
+  while (!event_queue_.empty() && event_queue_.top().first <= current_tick_) {
+    const size_t group_id = event_queue_.top().second;
+    event_queue_.pop();
+    rate_groups_[group_id].is_due = true;
+    due_group_ids_.push_back(group_id);
+    event_queue_.push(Event(current_tick_ + rate_groups_[group_id].period_ticks, group_id));
+  }
+}
@@ -0,0 +1,94 @@
+/**
+ * @file multi_rate_scheduler.hpp
+ * @brief Event-driven scheduler of rate groups with integer tick periods
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_MULTI_RATE_SCHEDULER_HPP_
+#define S2E_LIBRARY_UTILITIES_MULTI_RATE_SCHEDULER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+/**
+ * @class MultiRateScheduler
+ * @brief Event-driven scheduler of rate groups
+ * @note The time is expressed as the number of base ticks, so the periods are exact and free from the accumulation of rounding errors.
+ *       The next events are managed in a priority queue, and the groups due at the same tick are ordered by the group ID.
+ *       Therefore the schedule is deterministic and independent of the registration order of the events in the queue.
+ */
+class MultiRateScheduler {
+ public:
+  /**
+   * @fn MultiRateScheduler
+   * @brief Constructor
+   */
+  MultiRateScheduler() {}
+
+  /**
+   * @fn AddRateGroup
+   * @brief Add a rate group
+   * @param [in] period_ticks: Period of the group in the base ticks (must be larger than 0)
+   * @param [in] first_tick: Tick at which the group is due first time
+   * @return ID of the rate group
+   */
+  size_t AddRateGroup(const uint64_t period_ticks, const uint64_t first_tick);
+  /**
+   * @fn Reset
+   * @brief Reset the current tick to zero and schedule all groups at their first ticks
+   */
+  void Reset();
+  /**
+   * @fn AdvanceTo
+   * @brief Advance the current tick and update the due flags of the rate groups
+   * @note All groups whose next ticks are equal to or earlier than the tick become due. The next tick of a due group is the tick plus its period.
+   * @param [in] tick: New current tick (must not be earlier than the current tick)
+   */
+  void AdvanceTo(const uint64_t tick);
+
+  // Getters
+  /**
+   * @fn GetCurrentTick
+   * @brief Return the current tick
+   */
+  inline uint64_t GetCurrentTick() const { return current_tick_; }
+  /**
+   * @fn GetNextEventTick
+   * @brief Return the earliest tick at which any rate group is due, or UINT64_MAX when no group is registered
+   */
+  inline uint64_t GetNextEventTick() const { return event_queue_.empty() ? UINT64_MAX : event_queue_.top().first; }
+  /**
+   * @fn IsDue
+   * @brief Return true when the rate group is due at the current tick
+   * @param [in] group_id: ID of the rate group
+   */
+  inline bool IsDue(const size_t group_id) const { return rate_groups_[group_id].is_due; }
+  /**
+   * @fn GetPeriod_ticks
+   * @brief Return the period of the rate group in the base ticks
+   * @param [in] group_id: ID of the rate group
+   */
+  inline uint64_t GetPeriod_ticks(const size_t group_id) const { return rate_groups_[group_id].period_ticks; }
+
+ private:
+  /**
+   * @struct RateGroup
+   * @brief Schedule of a rate group
+   */
+  struct RateGroup {
+    uint64_t period_ticks;  //!< Period in the base ticks
+    uint64_t first_tick;    //!< Tick at which the group is due first time
+    bool is_due;            //!< Whether the group is due at the current tick
+  };
+  using Event = std::pair<uint64_t, size_t>;  //!< Pair of the next tick and the group ID
+
+  uint64_t current_tick_ = 0;                                                        //!< Current tick
+  std::vector<RateGroup> rate_groups_;                                               //!< Rate groups indexed by the ID
+  std::priority_queue<Event, std::vector<Event>, std::greater<Event>> event_queue_;  //!< Next events in the ascending order
+  std::vector<size_t> due_group_ids_;                                                //!< IDs of the groups due at the current tick
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_MULTI_RATE_SCHEDULER_HPP_
@@ -0,0 +1,87 @@
+/**
+ * @file real_time_pacer.cpp
+ * @brief Class to pace the simulation with the wall clock time
+ */
+
+#include "real_time_pacer.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <time.h>
+#endif
+
+RealTimePacer::RealTimePacer(const double simulation_speed, const double spin_wait_duration_s) : simulation_speed_(simulation_speed) {
+  spin_wait_duration_ns_ = spin_wait_duration_s > 0.0 ? (int64_t)(spin_wait_duration_s * 1e9) : 0;
+  Reset();
+}
+
+void RealTimePacer::Reset() {
+  start_time_ns_ = GetMonotonicTime_ns();
+  last_on_time_ns_ = start_time_ns_;
+  last_jitter_ns_ = 0;
+  max_jitter_ns_ = 0;
+  total_jitter_ns_ = 0;
+  on_time_count_ = 0;
+  overrun_count_ = 0;
+  max_overrun_ns_ = 0;
+}
+
+double RealTimePacer::WaitUntil(const double simulation_time_s) {
+  const int64_t target_time_ns = start_time_ns_ + (int64_t)std::llround(simulation_time_s / simulation_speed_ * 1e9);
+  int64_t now_ns = GetMonotonicTime_ns();
+  if (now_ns > target_time_ns) {
+    const int64_t overrun_ns = now_ns - target_time_ns;
+    overrun_count_++;
+    if (overrun_ns > max_overrun_ns_) max_overrun_ns_ = overrun_ns;
+    return overrun_ns * 1e-9;
+  }
+
+  if (target_time_ns - now_ns > spin_wait_duration_ns_) {
+    SleepUntil(target_time_ns - spin_wait_duration_ns_);
+  }
+  now_ns = GetMonotonicTime_ns();
+  while (now_ns < target_time_ns) {
+    now_ns = GetMonotonicTime_ns();
+  }
+
+  last_jitter_ns_ = now_ns - target_time_ns;
+  if (last_jitter_ns_ > max_jitter_ns_) max_jitter_ns_ = last_jitter_ns_;
+  total_jitter_ns_ += (double)last_jitter_ns_;
+  on_time_count_++;
+  last_on_time_ns_ = now_ns;
+  return 0.0;
+}
+
+void RealTimePacer::ClearOverrun() { last_on_time_ns_ = GetMonotonicTime_ns(); }
+
+double RealTimePacer::GetSimulationTimeNow_s() const { return (GetMonotonicTime_ns() - start_time_ns_) * 1e-9 * simulation_speed_; }
+
+double RealTimePacer::GetContinuousOverrunDuration_s() const { return (GetMonotonicTime_ns() - last_on_time_ns_) * 1e-9; }
+
+int64_t RealTimePacer::GetMonotonicTime_ns() {
+#if defined(__linux__)
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (int64_t)time.tv_sec * 1000000000 + time.tv_nsec;
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void RealTimePacer::SleepUntil(const int64_t time_ns) {
+#if defined(__linux__)
+  struct timespec time;
+  time.tv_sec = time_ns / 1000000000;
+  time.tv_nsec = time_ns % 1000000000;
+  // Sleep again when interrupted by a signal
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, NULL) == EINTR) {
+  }
+#else
+  const int64_t duration_ns = time_ns - GetMonotonicTime_ns();
+  if (duration_ns > 0) std::this_thread::sleep_for(std::chrono::nanoseconds(duration_ns));
+#endif
+}
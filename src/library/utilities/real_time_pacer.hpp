@@ -0,0 +1,110 @@
+/**
+ * @file real_time_pacer.hpp
+ * @brief Class to pace the simulation with the wall clock time
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_REAL_TIME_PACER_HPP_
+#define S2E_LIBRARY_UTILITIES_REAL_TIME_PACER_HPP_
+
+#include <cstdint>
+
+/**
+ * @class RealTimePacer
+ * @brief Class to pace the simulation with the wall clock time in nanosecond resolution
+ * @note The wake up time of each step is calculated from the reset time and the simulation time, so the errors of the sleep do not accumulate.
+ *       The pacer sleeps until the spin wait duration before the target time by clock_nanosleep with TIMER_ABSTIME on Linux,
+ *       and waits the rest by polling the monotonic clock to reduce the jitter.
+ */
+class RealTimePacer {
+ public:
+  /**
+   * @fn RealTimePacer
+   * @brief Constructor
+   * @param [in] simulation_speed: Speed of the simulation relative to the real time (must be larger than 0)
+   * @param [in] spin_wait_duration_s: Duration of the busy wait before the target time [s]
+   */
+  RealTimePacer(const double simulation_speed, const double spin_wait_duration_s);
+
+  /**
+   * @fn Reset
+   * @brief Set the current wall clock time as the simulation time zero and clear the statistics
+   */
+  void Reset();
+  /**
+   * @fn WaitUntil
+   * @brief Wait until the wall clock time corresponding to the simulation time
+   * @param [in] simulation_time_s: Simulation time from the reset [s]
+   * @return Overrun time [s]. Positive when the wall clock time already passed the target time, otherwise zero.
+   */
+  double WaitUntil(const double simulation_time_s);
+  /**
+   * @fn ClearOverrun
+   * @brief Regard the current time as on time for the continuous overrun duration
+   */
+  void ClearOverrun();
+
+  // Getters
+  /**
+   * @fn GetSimulationTimeNow_s
+   * @brief Return the simulation time corresponding to the current wall clock time [s]
+   */
+  double GetSimulationTimeNow_s() const;
+  /**
+   * @fn GetContinuousOverrunDuration_s
+   * @brief Return the wall clock duration since the last step finished on time [s]
+   */
+  double GetContinuousOverrunDuration_s() const;
+  /**
+   * @fn GetLastJitter_s
+   * @brief Return the difference between the wake up time and the target time of the last step [s]
+   */
+  inline double GetLastJitter_s() const { return last_jitter_ns_ * 1e-9; }
+  /**
+   * @fn GetMaxJitter_s
+   * @brief Return the maximum jitter of the steps on time [s]
+   */
+  inline double GetMaxJitter_s() const { return max_jitter_ns_ * 1e-9; }
+  /**
+   * @fn GetMeanJitter_s
+   * @brief Return the mean jitter of the steps on time [s]
+   */
+  inline double GetMeanJitter_s() const { return on_time_count_ > 0 ? total_jitter_ns_ / on_time_count_ * 1e-9 : 0.0; }
+  /**
+   * @fn GetOverrunCount
+   * @brief Return the number of the steps whose target time already passed at the call of WaitUntil
+   */
+  inline uint64_t GetOverrunCount() const { return overrun_count_; }
+  /**
+   * @fn GetMaxOverrun_s
+   * @brief Return the maximum overrun time [s]
+   */
+  inline double GetMaxOverrun_s() const { return max_overrun_ns_ * 1e-9; }
+
+ private:
+  double simulation_speed_;        //!< Speed of the simulation relative to the real time
+  int64_t spin_wait_duration_ns_;  //!< Duration of the busy wait before the target time [ns]
+  int64_t start_time_ns_;          //!< Monotonic clock time at the reset [ns]
+  int64_t last_on_time_ns_;        //!< Monotonic clock time when the last step finished on time [ns]
+
+  // Statistics
+  int64_t last_jitter_ns_ = 0;  //!< Jitter of the last step [ns]
+  int64_t max_jitter_ns_ = 0;   //!< Maximum jitter [ns]
+  double total_jitter_ns_ = 0;  //!< Sum of the jitter [ns]
+  uint64_t on_time_count_ = 0;  //!< Number of the steps on time
+  uint64_t overrun_count_ = 0;  //!< Number of the overrun steps
+  int64_t max_overrun_ns_ = 0;  //!< Maximum overrun time [ns]
+
+  /**
+   * @fn GetMonotonicTime_ns
+   * @brief Return the time of the monotonic clock [ns]
+   */
+  static int64_t GetMonotonicTime_ns();
+  /**
+   * @fn SleepUntil
+   * @brief Sleep until the monotonic clock time
+   * @param [in] time_ns: Monotonic clock time [ns]
+   */
+  static void SleepUntil(const int64_t time_ns);
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_REAL_TIME_PACER_HPP_
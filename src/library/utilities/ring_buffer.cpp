@@ -44,3 +44,22 @@ int RingBuffer::Read(byte* buffer, const unsigned int offset, const unsigned int
 
   return read_count;
 }
+
+unsigned int RingBuffer::GetStoredSize() const {
+  return (write_pointer_ >= read_pointer_) ? write_pointer_ - read_pointer_ : buffer_size_ - read_pointer_ + write_pointer_;
+}
+
+int RingBuffer::GetWritableRegions(byte* regions[2], unsigned int lengths[2]) {
+  const unsigned int free_size = buffer_size_ - 1 - GetStoredSize();
+  if (free_size == 0) return 0;
+
+  regions[0] = &buffer_[write_pointer_];
+  lengths[0] = std::min(buffer_size_ - write_pointer_, free_size);
+  if (lengths[0] == free_size) return 1;
+
+  regions[1] = &buffer_[0];
+  lengths[1] = free_size - lengths[0];
+  return 2;
+}
+
+void RingBuffer::CommitWrite(const unsigned int data_length) { write_pointer_ = (write_pointer_ + data_length) % buffer_size_; }
@@ -45,6 +45,33 @@ class RingBuffer {
    */
   int Read(byte* buffer, const unsigned int offset, const unsigned int data_length);
 
+  /**
+   * @fn GetStoredSize
+   * @brief Return the number of bytes between the read pointer and the write pointer
+   */
+  unsigned int GetStoredSize() const;
+  /**
+   * @fn GetWritableRegions
+   * @brief Get the free memory regions from the write pointer to just before the read pointer
+   * @note The regions can be filled directly (e.g. by readv) without an intermediate buffer, and the filled length is committed by CommitWrite.
+   *       The free size is one byte smaller than the buffer size to distinguish the full state from the empty state.
+   * @param [out] regions: Start addresses of the regions
+   * @param [out] lengths: Lengths of the regions
+   * @return Number of the regions (0 to 2)
+   */
+  int GetWritableRegions(byte* regions[2], unsigned int lengths[2]);
+  /**
+   * @fn CommitWrite
+   * @brief Advance the write pointer after the regions given by GetWritableRegions are filled
+   * @param [in] data_length: Length of the filled data (must not be larger than the total length of the regions)
+   */
+  void CommitWrite(const unsigned int data_length);
+  /**
+   * @fn Clear
+   * @brief Discard all stored data
+   */
+  inline void Clear() { read_pointer_ = write_pointer_; }
+
  private:
   unsigned int buffer_size_;    //!< Buffer size
   byte* buffer_;                //!< Buffer
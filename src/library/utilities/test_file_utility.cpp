@@ -0,0 +1,70 @@
+/**
+ * @file test_file_utility.cpp
+ * @brief Test codes for the file utility functions with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "file_utility.hpp"
+
+namespace {
+/**
+ * @brief Return the contents of the file, or an empty string when the file does not exist
+ */
+std::string ReadFile(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+}  // namespace
+
+/**
+ * @brief Test the status of the existing and the missing files
+ */
+TEST(FileUtility, GetFileStatus) {
+  const std::string file_path = "test_file_utility_status.txt";
+  {
+    std::ofstream file(file_path, std::ios::binary);
+    file << "0123456789";
+  }
+  uint64_t file_size_B = 0;
+  int64_t file_modified_time = 0;
+  EXPECT_TRUE(GetFileStatus(file_path, file_size_B, file_modified_time));
+  EXPECT_EQ(10u, file_size_B);
+  EXPECT_GT(file_modified_time, 0);
+
+  std::remove(file_path.c_str());
+  EXPECT_FALSE(GetFileStatus(file_path, file_size_B, file_modified_time));
+  EXPECT_EQ(0u, file_size_B);
+  EXPECT_EQ(0, file_modified_time);
+}
+
+/**
+ * @brief Test that the file is created and replaced without the temporary file left
+ */
+TEST(FileUtility, ReplaceFileAtomically) {
+  const std::string file_path = "test_file_utility_replace.bin";
+  EXPECT_TRUE(ReplaceFileAtomically(file_path, [](std::ofstream& file) { file << "first"; }));
+  EXPECT_EQ("first", ReadFile(file_path));
+  EXPECT_FALSE(std::ifstream(file_path + ".tmp").is_open());
+
+  EXPECT_TRUE(ReplaceFileAtomically(file_path, [](std::ofstream& file) { file << "second contents"; }));
+  EXPECT_EQ("second contents", ReadFile(file_path));
+  EXPECT_FALSE(std::ifstream(file_path + ".tmp").is_open());
+
+  // A failed writing keeps the existing file
+  EXPECT_FALSE(ReplaceFileAtomically(file_path, [](std::ofstream& file) {
+    file << "broken";
+    file.setstate(std::ios::failbit);
+  }));
+  EXPECT_EQ("second contents", ReadFile(file_path));
+  EXPECT_FALSE(std::ifstream(file_path + ".tmp").is_open());
+
+  // The temporary file cannot be created in a missing directory
+  EXPECT_FALSE(ReplaceFileAtomically("test_file_utility_missing/file.bin", [](std::ofstream& file) { file << "none"; }));
+
+  std::remove(file_path.c_str());
+}
@@ -0,0 +1,69 @@
+/**
+ * @file test_memory_mapped_file.cpp
+ * @brief Test codes for MemoryMappedFile class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "memory_mapped_file.hpp"
+
+/**
+ * @brief Test that the mapped data is same as the file contents
+ */
+TEST(MemoryMappedFile, Read) {
+  const std::string file_path = "test_memory_mapped_file.txt";
+  const std::string contents = "*  2020  1  1  0  0  0.00000000\nPG01 -15163.034377  -1301.934894  21473.065529    171.736636\n";
+  {
+    std::ofstream file(file_path, std::ios::binary);
+    file << contents;
+  }
+
+  {
+    MemoryMappedFile mapped_file(file_path);
+    ASSERT_TRUE(mapped_file.IsOpened());
+    ASSERT_EQ(contents.size(), mapped_file.GetSize_B());
+    EXPECT_EQ(contents, std::string(mapped_file.GetData(), mapped_file.GetSize_B()));
+    EXPECT_EQ(MemoryMappedFile::CalcHash(contents.data(), contents.size()), mapped_file.CalcHash());
+  }
+  std::remove(file_path.c_str());
+
+  MemoryMappedFile missing_file("not_existing_file.txt");
+  EXPECT_FALSE(missing_file.IsOpened());
+  EXPECT_EQ(0, missing_file.GetSize_B());
+}
+
+/**
+ * @brief Test that the access pattern does not change the mapped data
+ */
+TEST(MemoryMappedFile, AccessPattern) {
+  const std::string file_path = "test_memory_mapped_file_access_pattern.bin";
+  std::string contents;
+  for (int i = 0; i < 100000; i++) contents.push_back((char)(i * 7));
+  {
+    std::ofstream file(file_path, std::ios::binary);
+    file << contents;
+  }
+
+  for (const MemoryAccessPattern access_pattern : {MemoryAccessPattern::kNormal, MemoryAccessPattern::kSequential, MemoryAccessPattern::kRandom}) {
+    MemoryMappedFile mapped_file(file_path, access_pattern);
+    ASSERT_TRUE(mapped_file.IsOpened());
+    ASSERT_EQ(contents.size(), mapped_file.GetSize_B());
+    EXPECT_EQ(contents, std::string(mapped_file.GetData(), mapped_file.GetSize_B()));
+  }
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Test the FNV-1a hash with the reference values and the chain of data
+ */
+TEST(MemoryMappedFile, Hash) {
+  EXPECT_EQ(MemoryMappedFile::kHashSeed, MemoryMappedFile::CalcHash("", 0));
+  EXPECT_EQ(0xaf63dc4c8601ec8cULL, MemoryMappedFile::CalcHash("a", 1));
+  EXPECT_EQ(0x85944171f73967e8ULL, MemoryMappedFile::CalcHash("foobar", 6));
+
+  const uint64_t hash_foo = MemoryMappedFile::CalcHash("foo", 3);
+  EXPECT_EQ(MemoryMappedFile::CalcHash("foobar", 6), MemoryMappedFile::CalcHash("bar", 3, hash_foo));
+}
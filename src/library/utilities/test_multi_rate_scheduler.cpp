@@ -0,0 +1,56 @@
+/**
+ * @file test_multi_rate_scheduler.cpp
+ * @brief Test codes for MultiRateScheduler class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "multi_rate_scheduler.hpp"
+
+/**
+ * @brief Test the due timings when the scheduler advances tick by tick
+ */
+TEST(MultiRateScheduler, AdvanceEveryTick) {
+  MultiRateScheduler scheduler;
+  const size_t every_tick = scheduler.AddRateGroup(1, 0);
+  const size_t every_third_tick = scheduler.AddRateGroup(3, 2);
+  scheduler.Reset();
+  EXPECT_EQ(0, scheduler.GetNextEventTick());
+
+  for (uint64_t tick = 1; tick <= 12; tick++) {
+    scheduler.AdvanceTo(tick);
+    EXPECT_EQ(tick, scheduler.GetCurrentTick());
+    EXPECT_TRUE(scheduler.IsDue(every_tick));
+    EXPECT_EQ(tick % 3 == 2, scheduler.IsDue(every_third_tick));
+  }
+}
+
+/**
+ * @brief Test jumping to the next event and the reset
+ */
+TEST(MultiRateScheduler, JumpToNextEvent) {
+  MultiRateScheduler scheduler;
+  const size_t fast_group = scheduler.AddRateGroup(10, 9);
+  const size_t slow_group = scheduler.AddRateGroup(25, 25);
+  EXPECT_EQ(10, scheduler.GetPeriod_ticks(fast_group));
+  EXPECT_EQ(25, scheduler.GetPeriod_ticks(slow_group));
+
+  const uint64_t expected_ticks[] = {9, 19, 25, 29, 39, 49, 50};
+  for (uint64_t expected_tick : expected_ticks) {
+    const uint64_t next_tick = scheduler.GetNextEventTick();
+    EXPECT_EQ(expected_tick, next_tick);
+    scheduler.AdvanceTo(next_tick);
+    EXPECT_EQ(expected_tick % 10 == 9, scheduler.IsDue(fast_group));
+    EXPECT_EQ(expected_tick % 25 == 0, scheduler.IsDue(slow_group));
+  }
+
+  // Overdue groups become due once and are rescheduled from the current tick
+  scheduler.AdvanceTo(100);
+  EXPECT_TRUE(scheduler.IsDue(fast_group));
+  EXPECT_TRUE(scheduler.IsDue(slow_group));
+  EXPECT_EQ(110, scheduler.GetNextEventTick());
+
+  scheduler.Reset();
+  EXPECT_EQ(0, scheduler.GetCurrentTick());
+  EXPECT_FALSE(scheduler.IsDue(fast_group));
+  EXPECT_EQ(9, scheduler.GetNextEventTick());
+}
@@ -0,0 +1,52 @@
+/**
+ * @file test_real_time_pacer.cpp
+ * @brief Test codes for RealTimePacer class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "real_time_pacer.hpp"
+
+/**
+ * @brief Test that the steps are paced without the accumulation of the sleep errors
+ */
+TEST(RealTimePacer, WaitUntil) {
+  const double step_s = 0.5e-3;
+  const size_t step_number = 20;
+  RealTimePacer pacer(2.0, 1e-4);
+  const auto start_time = std::chrono::steady_clock::now();
+  for (size_t step = 1; step <= step_number; step++) {
+    pacer.WaitUntil(step * step_s);
+  }
+  const double elapsed_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+  // The wall clock time is half of the simulation time with the speed 2
+  EXPECT_LE(step_number * step_s / 2.0, elapsed_time_s);
+  EXPECT_LE(0.0, pacer.GetLastJitter_s());
+  EXPECT_LE(pacer.GetMeanJitter_s(), pacer.GetMaxJitter_s());
+  // The sleep errors are not accumulated, so the total duration is not much longer than the target
+  EXPECT_GT(step_number * step_s / 2.0 + 0.5, elapsed_time_s);
+}
+
+/**
+ * @brief Test the overrun statistics and the reset
+ */
+TEST(RealTimePacer, Overrun) {
+  RealTimePacer pacer(1.0, 0.0);
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  EXPECT_LT(0.0, pacer.WaitUntil(1e-3));
+  EXPECT_EQ(1, pacer.GetOverrunCount());
+  EXPECT_LT(0.0, pacer.GetMaxOverrun_s());
+  EXPECT_LE(4e-3, pacer.GetContinuousOverrunDuration_s());
+  EXPECT_LE(5e-3, pacer.GetSimulationTimeNow_s());
+
+  pacer.ClearOverrun();
+  EXPECT_GT(4e-3, pacer.GetContinuousOverrunDuration_s());
+
+  pacer.Reset();
+  EXPECT_EQ(0, pacer.GetOverrunCount());
+  EXPECT_EQ(0.0, pacer.WaitUntil(1e-3));
+  EXPECT_EQ(0, pacer.GetOverrunCount());
+}
@@ -0,0 +1,82 @@
+/**
+ * @file test_thread_pool.cpp
+ * @brief Test codes for ThreadPool class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+/**
+ * @brief Test that all tasks are executed exactly once in the repeated jobs
+ */
+TEST(ThreadPool, ParallelFor) {
+  ThreadPool thread_pool(4);
+  EXPECT_EQ(4, thread_pool.GetThreadNumber());
+
+  const size_t task_number = 1000;
+  std::vector<int> counts(task_number, 0);
+  for (size_t job = 0; job < 100; job++) {
+    thread_pool.ParallelFor(task_number, [&counts](size_t index) { counts[index]++; });
+  }
+  for (size_t i = 0; i < task_number; i++) {
+    EXPECT_EQ(100, counts[i]);
+  }
+
+  // Jobs with fewer tasks than the threads
+  std::atomic<size_t> sum(0);
+  thread_pool.ParallelFor(0, [&sum](size_t index) { sum += index + 1; });
+  thread_pool.ParallelFor(1, [&sum](size_t index) { sum += index + 1; });
+  thread_pool.ParallelFor(3, [&sum](size_t index) { sum += index + 1; });
+  EXPECT_EQ(7, sum);
+}
+
+/**
+ * @brief Test that unbalanced tasks are stolen by the idle workers
+ */
+TEST(ThreadPool, WorkStealing) {
+  ThreadPool thread_pool(2);
+  std::atomic<size_t> sum(0);
+  // The tasks in the first half are much heavier than the others
+  thread_pool.ParallelFor(64, [&sum](size_t index) {
+    volatile double dummy = 0.0;
+    const size_t loop_number = index < 32 ? 10000 : 10;
+    for (size_t i = 0; i < loop_number; i++) dummy = dummy + 1.0;
+    sum += index;
+  });
+  EXPECT_EQ(64 * 63 / 2, sum);
+}
+
+/**
+ * @brief Test that the exception in a task is thrown again after all tasks finish
+ */
+TEST(ThreadPool, Exception) {
+  ThreadPool thread_pool(3);
+  std::atomic<size_t> count(0);
+  EXPECT_THROW(thread_pool.ParallelFor(30,
+                                       [&count](size_t index) {
+                                         count++;
+                                         if (index == 10) throw std::runtime_error("error");
+                                       }),
+               std::runtime_error);
+  EXPECT_EQ(30, count);
+
+  // The pool is still usable
+  count = 0;
+  thread_pool.ParallelFor(30, [&count](size_t) { count++; });
+  EXPECT_EQ(30, count);
+}
+
+/**
+ * @brief Test the serial execution with a single thread
+ */
+TEST(ThreadPool, SingleThread) {
+  ThreadPool thread_pool(1);
+  EXPECT_EQ(1, thread_pool.GetThreadNumber());
+  std::vector<size_t> order;
+  thread_pool.ParallelFor(5, [&order](size_t index) { order.push_back(index); });
+  EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3, 4}), order);
+}
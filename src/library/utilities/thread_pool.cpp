@@ -0,0 +1,136 @@
+/**
+ * @file thread_pool.cpp
+ * @brief Work-stealing thread pool for parallel loops
+ */
+
+#include "thread_pool.hpp"
+
+ThreadPool::ThreadPool(const size_t thread_number) {
+  size_t number = thread_number;
+  if (number == 0) number = std::thread::hardware_concurrency();
+  if (number == 0) number = 1;
+
+  for (size_t i = 0; i < number; i++) {
+    queues_.push_back(std::make_unique<TaskQueue>());
+  }
+  for (size_t i = 1; i < number; i++) {
+    threads_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopped_ = true;
+  }
+  job_started_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void ThreadPool::ParallelFor(const size_t task_number, const std::function<void(size_t)>& task) {
+  if (task_number == 0) return;
+  if (threads_.empty() || task_number == 1) {
+    for (size_t i = 0; i < task_number; i++) task(i);
+    return;
+  }
+
+  // Assign contiguous blocks of the indices to the workers
+  const size_t worker_number = queues_.size();
+  for (size_t worker_id = 0; worker_id < worker_number; worker_id++) {
+    std::lock_guard<std::mutex> lock(queues_[worker_id]->mutex);
+    for (size_t i = task_number * worker_id / worker_number; i < task_number * (worker_id + 1) / worker_number; i++) {
+      queues_[worker_id]->tasks.push_back(i);
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    remaining_task_number_ = task_number;
+    exception_ = nullptr;
+    job_id_++;
+  }
+  job_started_.notify_all();
+
+  const size_t executed_task_number = ExecuteTasks(0, task);
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    remaining_task_number_ -= executed_task_number;
+    // Wait also for the workers, since they refer to the task function until they find all queues empty
+    job_finished_.wait(lock, [this] { return remaining_task_number_ == 0 && active_worker_number_ == 0; });
+    task_ = nullptr;
+    exception = exception_;
+    exception_ = nullptr;
+  }
+  if (exception) std::rethrow_exception(exception);
+}
+
+void ThreadPool::WorkerLoop(const size_t worker_id) {
+  uint64_t last_job_id = 0;
+  while (true) {
+    const std::function<void(size_t)>* task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      job_started_.wait(lock, [this, last_job_id] { return is_stopped_ || job_id_ != last_job_id; });
+      if (is_stopped_) return;
+      last_job_id = job_id_;
+      task = task_;
+      // The job has already finished
+      if (task == nullptr) continue;
+      active_worker_number_++;
+    }
+
+    const size_t executed_task_number = ExecuteTasks(worker_id, *task);
+
+    bool is_finished;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      remaining_task_number_ -= executed_task_number;
+      active_worker_number_--;
+      is_finished = remaining_task_number_ == 0 && active_worker_number_ == 0;
+    }
+    if (is_finished) job_finished_.notify_one();
+  }
+}
+
+size_t ThreadPool::ExecuteTasks(const size_t worker_id, const std::function<void(size_t)>& task) {
+  size_t executed_task_number = 0;
+  size_t task_index;
+  while (PopTask(worker_id, task_index)) {
+    try {
+      task(task_index);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!exception_) exception_ = std::current_exception();
+    }
+    executed_task_number++;
+  }
+  return executed_task_number;
+}
+
+bool ThreadPool::PopTask(const size_t worker_id, size_t& task_index) {
+  {
+    TaskQueue& own_queue = *queues_[worker_id];
+    std::lock_guard<std::mutex> lock(own_queue.mutex);
+    if (!own_queue.tasks.empty()) {
+      task_index = own_queue.tasks.front();
+      own_queue.tasks.pop_front();
+      return true;
+    }
+  }
+  // Steal from the back of the other queues to keep the contiguous indices on the owner
+  const size_t worker_number = queues_.size();
+  for (size_t offset = 1; offset < worker_number; offset++) {
+    TaskQueue& queue = *queues_[(worker_id + offset) % worker_number];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task_index = queue.tasks.back();
+      queue.tasks.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file thread_pool.hpp
+ * @brief Work-stealing thread pool for parallel loops
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_THREAD_POOL_HPP_
+#define S2E_LIBRARY_UTILITIES_THREAD_POOL_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Work-stealing thread pool for parallel loops
+ * @note Each worker has its own task queue. A worker takes the tasks from the front of its queue,
+ *       and steals the tasks from the back of the other queues when its queue is empty.
+ *       The calling thread also works as a worker, so the pool with N threads creates N - 1 background threads.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @fn ThreadPool
+   * @brief Constructor
+   * @param [in] thread_number: Number of the threads including the calling thread (0 means the number of the hardware threads)
+   */
+  explicit ThreadPool(const size_t thread_number);
+  /**
+   * @fn ~ThreadPool
+   * @brief Destructor
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * @fn ParallelFor
+   * @brief Execute task(index) for all index in [0, task_number) and wait for all of them
+   * @note The return of this function works as a barrier. The first exception thrown by the tasks is thrown again after all tasks finish.
+   *       This function must not be called from the tasks.
+   * @param [in] task_number: Number of the tasks
+   * @param [in] task: Task function
+   */
+  void ParallelFor(const size_t task_number, const std::function<void(size_t)>& task);
+
+  /**
+   * @fn GetThreadNumber
+   * @brief Return the number of the threads including the calling thread
+   */
+  inline size_t GetThreadNumber() const { return queues_.size(); }
+
+ private:
+  /**
+   * @struct TaskQueue
+   * @brief Task queue of a worker
+   */
+  struct TaskQueue {
+    std::mutex mutex;          //!< Mutex for the queue
+    std::deque<size_t> tasks;  //!< Indices of the tasks
+  };
+
+  std::vector<std::unique_ptr<TaskQueue>> queues_;  //!< Task queues of the workers. The first one is for the calling thread.
+  std::vector<std::thread> threads_;                //!< Background threads
+
+  std::mutex mutex_;                                   //!< Mutex for the job state
+  std::condition_variable job_started_;                //!< Notified when a job is started or the pool is stopped
+  std::condition_variable job_finished_;               //!< Notified when all tasks and workers of the job are finished
+  const std::function<void(size_t)>* task_ = nullptr;  //!< Task function of the current job
+  uint64_t job_id_ = 0;                                //!< ID of the current job
+  size_t remaining_task_number_ = 0;                   //!< Number of the tasks not finished in the current job
+  size_t active_worker_number_ = 0;                    //!< Number of the background workers executing the current job
+  std::exception_ptr exception_;                       //!< First exception thrown by the tasks
+  bool is_stopped_ = false;                            //!< Whether the pool is being destroyed
+
+  /**
+   * @fn WorkerLoop
+   * @brief Main loop of the background threads
+   * @param [in] worker_id: ID of the worker
+   */
+  void WorkerLoop(const size_t worker_id);
+  /**
+   * @fn ExecuteTasks
+   * @brief Execute the tasks in the own queue and steal the tasks from the other queues until all queues are empty
+   * @param [in] worker_id: ID of the worker
+   * @param [in] task: Task function
+   * @return Number of the executed tasks
+   */
+  size_t ExecuteTasks(const size_t worker_id, const std::function<void(size_t)>& task);
+  /**
+   * @fn PopTask
+   * @brief Take a task from the front of the own queue or from the back of the other queues
+   * @param [in] worker_id: ID of the worker
+   * @param [out] task_index: Index of the task
+   * @return True when a task is taken
+   */
+  bool PopTask(const size_t worker_id, size_t& task_index);
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_THREAD_POOL_HPP_
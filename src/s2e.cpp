@@ -15,6 +15,7 @@
 #include <string>
 
 // Simulator includes
+#include "library/initialize/initialize_file_database.hpp"
 #include "library/logger/logger.hpp"
 
 // Add custom include files
@@ -50,9 +51,11 @@ int main(int argc, char *argv[])
   std::string ini_path = INI_FILE_DIR_FROM_EXE;
   std::string ini_file = ini_path + "/sample_simulation_base.ini";
 
-  // Parsing arguments:  SatAttSim <data_path> [ini_file]
+  std::string ini_snapshot_file = "";
+
+  // Parsing arguments:  SatAttSim <data_path> [ini_file] [ini_snapshot_file]
   if (argc == 0) {
-    std::cout << "Usage: SatAttSim <data_path> [ini file path]" << std::endl;
+    std::cout << "Usage: SatAttSim <data_path> [ini file path] [ini snapshot file path]" << std::endl;
     return EXIT_FAILURE;
   }
   if (argc > 1) {
@@ -62,16 +65,25 @@ int main(int argc, char *argv[])
   if (argc > 2) {
     ini_file = std::string(argv[2]);
   }
+  if (argc > 3) {
+    ini_snapshot_file = std::string(argv[3]);
+  }
 
   std::cout << "Starting simulation..." << std::endl;
   std::cout << "\tData path: ";
   print_path(data_path);
   std::cout << "\tIni file: ";
   print_path(ini_file);
+  if (!ini_snapshot_file.empty()) {
+    // Parsed ini files in the snapshot are reused when the files are not changed
+    size_t loaded_file_number = IniDatabase::LoadSnapshot(ini_snapshot_file);
+    std::cout << "\tIni snapshot: " << loaded_file_number << " files loaded from " << ini_snapshot_file << std::endl;
+  }
 
   auto simulation_case = SampleCase(ini_file);
   simulation_case.Initialize();
   simulation_case.Main();
+  if (!ini_snapshot_file.empty()) IniDatabase::SaveSnapshot(ini_snapshot_file);
 
   end = system_clock::now();
   double time = static_cast<double>(duration_cast<microseconds>(end - start).count() / 1000000.0);
@@ -7,6 +7,7 @@
 
 #include <library/initialize/initialize_file_access.hpp>
 #include <library/logger/initialize_log.hpp>
+#include <simulation/spacecraft/spacecraft.hpp>
 #include <string>
 
 SimulationCase::SimulationCase(const std::string initialize_base_file) {
@@ -24,19 +25,24 @@ SimulationCase::SimulationCase(const std::string initialize_base_file, const Mon
     simulation_configuration_.main_logger_ = InitLog(initialize_base_file);
   } else {
     // Monte Carlo Simulation is enabled
-    std::string log_file_name = "default" + std::to_string(monte_carlo_simulator.GetNumberOfExecutionsDone()) + ".csv";
-
     IniAccess ini_file(initialize_base_file);
     bool save_ini_files = ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files");
+    LogFileFormat log_file_format = ConvertLogFileFormat(ini_file.ReadString("SIMULATION_SETTINGS", "log_file_format"));
+
+    std::string log_file_name = "default" + std::to_string(monte_carlo_simulator.GetNumberOfExecutionsDone()) + GetLogFileExtension(log_file_format);
 
-    simulation_configuration_.main_logger_ =
-        new Logger(log_file_name, log_path, initialize_base_file, save_ini_files, monte_carlo_simulator.GetSaveLogHistoryFlag());
+    simulation_configuration_.main_logger_ = new Logger(log_file_name, log_path, initialize_base_file, save_ini_files,
+                                                        monte_carlo_simulator.GetSaveLogHistoryFlag(), log_file_format);
+    InitLogAsyncMode(simulation_configuration_.main_logger_, initialize_base_file);
   }
   // Initialize Simulation Configuration
   InitializeSimulationConfiguration(initialize_base_file);
 }
 
-SimulationCase::~SimulationCase() { delete global_environment_; }
+SimulationCase::~SimulationCase() {
+  delete thread_pool_;
+  delete global_environment_;
+}
 
 void SimulationCase::Initialize() {
   // Target Objects Initialize
@@ -101,7 +107,31 @@ void SimulationCase::InitializeSimulationConfiguration(const std::string initial
   simulation_configuration_.inter_sc_communication_file_ = simulation_base_ini.ReadString(section, "inter_sat_comm_file");
   simulation_configuration_.gnss_file_ = simulation_base_ini.ReadString(section, "gnss_file");
 
+  // Parallelization
+  const int number_of_threads = simulation_base_ini.ReadInt(section, "number_of_threads");
+  simulation_configuration_.number_of_threads_ = number_of_threads > 0 ? (unsigned int)number_of_threads : 0;
+
   // Global Environment
   global_environment_ = new GlobalEnvironment(&simulation_configuration_);
   global_environment_->LogSetup(*(simulation_configuration_.main_logger_));
-}
\ No newline at end of file
+}
+
+void SimulationCase::UpdateSpacecraft(const std::vector<Spacecraft*>& spacecraft) {
+  const SimulationTime* simulation_time = &(global_environment_->GetSimulationTime());
+  if (simulation_configuration_.number_of_threads_ <= 1 || spacecraft.size() <= 1) {
+    for (auto sc : spacecraft) sc->Update(simulation_time);
+    return;
+  }
+  // The relative orbit refers to the orbit of the reference spacecraft during the propagation
+  for (auto sc : spacecraft) {
+    if (sc->GetDynamics().GetOrbit().GetPropagateMode() == OrbitPropagateMode::kRelativeOrbit) {
+      for (auto sc_serial : spacecraft) sc_serial->Update(simulation_time);
+      return;
+    }
+  }
+
+  if (thread_pool_ == nullptr) {
+    thread_pool_ = new ThreadPool(simulation_configuration_.number_of_threads_);
+  }
+  thread_pool_->ParallelFor(spacecraft.size(), [&spacecraft, simulation_time](size_t index) { spacecraft[index]->Update(simulation_time); });
+}
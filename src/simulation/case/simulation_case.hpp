@@ -8,10 +8,12 @@
 
 #include <environment/global/global_environment.hpp>
 #include <library/logger/loggable.hpp>
+#include <library/utilities/thread_pool.hpp>
 #include <simulation/monte_carlo_simulation/monte_carlo_simulation_executor.hpp>
 
 #include "../simulation_configuration.hpp"
 class Logger;
+class Spacecraft;
 
 /**
  * @class SimulationCase
@@ -77,6 +79,7 @@ class SimulationCase : public ILoggable {
  protected:
   SimulationConfiguration simulation_configuration_;  //!< Simulation setting
   GlobalEnvironment* global_environment_;             //!< Global Environment
+  ThreadPool* thread_pool_ = nullptr;                 //!< Thread pool for the parallel spacecraft update
 
   /**
    * @fn InitializeSimulationConfiguration
@@ -96,6 +99,16 @@ class SimulationCase : public ILoggable {
    * @brief Virtual function to update target objects(spacecraft and ground station)
    */
   virtual void UpdateTargetObjects() = 0;
+
+  /**
+   * @fn UpdateSpacecraft
+   * @brief Update the spacecraft in parallel when number_of_threads in the simulation base file is larger than 1
+   * @note The spacecraft must not depend on each other during the update. The function returns after all spacecraft are updated,
+   *       so the relative information and the inter-satellite communication should be updated after this function.
+   *       The spacecraft are updated serially when any of them uses the relative orbit, since it refers to the reference spacecraft.
+   * @param [in] spacecraft: Spacecraft to be updated
+   */
+  void UpdateSpacecraft(const std::vector<Spacecraft*>& spacecraft);
 };
 
 #endif  // S2E_SIMULATION_CASE_SIMULATION_CASE_HPP_
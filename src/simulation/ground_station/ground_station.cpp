@@ -90,3 +90,10 @@ std::string GroundStation::GetLogValue() const {
   str_tmp += WriteVector(position_i_m_);
   return str_tmp;
 }
+
+void GroundStation::AppendLogValue(std::vector<double>& values) const {
+  for (unsigned int i = 0; i < number_of_spacecraft_; i++) {
+    AppendScalar(values, is_visible_.at(i));
+  }
+  AppendVector(values, position_i_m_);
+}
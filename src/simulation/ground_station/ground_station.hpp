@@ -56,6 +56,11 @@ class GroundStation : public ILoggable {
    * @brief Override function of log value setting
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
   // Getters
   /**
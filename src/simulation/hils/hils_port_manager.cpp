@@ -13,6 +13,8 @@ HilsPortManager::HilsPortManager() {}
 
 HilsPortManager::~HilsPortManager() {}
 
+void HilsPortManager::SetPortName(const unsigned int port_id, const std::string port_name) { port_names_[port_id] = port_name; }
+
 // UART Communication port functions
 int HilsPortManager::UartConnectComPort(unsigned int port_id, unsigned int baud_rate, unsigned int tx_buffer_size, unsigned int rx_buffer_size) {
 #ifdef USE_HILS
@@ -24,7 +26,11 @@ int HilsPortManager::UartConnectComPort(unsigned int port_id, unsigned int baud_
     printf("Error: Illegal parameter\n");
     return -1;
   }
-  uart_ports_[port_id] = new HilsUartPort(port_id, baud_rate, tx_buffer_size, rx_buffer_size);
+  if (port_names_.count(port_id) > 0) {
+    uart_ports_[port_id] = new HilsUartPort(port_names_[port_id], baud_rate, tx_buffer_size, rx_buffer_size);
+  } else {
+    uart_ports_[port_id] = new HilsUartPort(port_id, baud_rate, tx_buffer_size, rx_buffer_size);
+  }
   return 0;
 #else
   UNUSED(port_id);
@@ -113,7 +119,11 @@ int HilsPortManager::I2cTargetConnectComPort(unsigned int port_id) {
     printf("Error: Port is already used\n");
     return -1;
   }
-  i2c_ports_[port_id] = new HilsI2cTargetPort(port_id);
+  if (port_names_.count(port_id) > 0) {
+    i2c_ports_[port_id] = new HilsI2cTargetPort(port_names_[port_id]);
+  } else {
+    i2c_ports_[port_id] = new HilsI2cTargetPort(port_id);
+  }
   i2c_ports_[port_id]->RegisterDevice();
   return 0;
 #else
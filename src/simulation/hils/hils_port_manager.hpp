@@ -7,10 +7,11 @@
 #define S2E_SIMULATION_HILS_HILS_PORT_MANAGER_HPP_
 
 #ifdef USE_HILS
-#include "ports/hils_i2c_target_port.hpp"
-#include "ports/hils_uart_port.hpp"
+#include <components/ports/hils_i2c_target_port.hpp>
+#include <components/ports/hils_uart_port.hpp>
 #endif
 #include <map>
+#include <string>
 
 /**
  * @class HilsPortManager
@@ -29,6 +30,16 @@ class HilsPortManager {
    */
   virtual ~HilsPortManager();
 
+  /**
+   * @fn SetPortName
+   * @brief Set the port name used when the port is connected
+   * @note Without this setting, the port name is "COM<port_id>" on Windows and "/dev/ttyS<port_id>" on Linux.
+   *       On Linux, a serial device like "/dev/ttyUSB0" or a pseudo terminal made by socat can be set here.
+   * @param [in] port_id: COM port ID
+   * @param [in] port_name: Port name like "COM4" or device path like "/dev/ttyUSB0"
+   */
+  void SetPortName(const unsigned int port_id, const std::string port_name);
+
   // UART Communication port functions
   /**
    * @fn UartConnectComPort
@@ -162,6 +173,7 @@ class HilsPortManager {
   virtual int I2cControllerSend(unsigned int port_id, const unsigned char* buffer, int offset, int length);
 
  private:
+  std::map<unsigned int, std::string> port_names_;  //!< Port names set by the user
 #ifdef USE_HILS
   std::map<int, HilsUartPort*> uart_ports_;      //!< UART ports
   std::map<int, HilsI2cTargetPort*> i2c_ports_;  //!< I2C ports
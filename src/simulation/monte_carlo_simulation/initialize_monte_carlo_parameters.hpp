@@ -45,6 +45,7 @@ class InitializedMonteCarloParameters {
   /**
    * @fn SetSeed
    * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
+   * @note The random number generator is prepared for each thread. The seed is applied to the generator of the calling thread.
    */
   static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
   /**
@@ -87,11 +88,11 @@ class InitializedMonteCarloParameters {
   std::vector<double> sigma_or_max_;  //!< standard deviation or maximum value. Refer comment in Generate[RandomizationType] function.
 
   // For randomization
-  RandomizationType randomization_type_;                           //!< Randomization type
-  static std::random_device randomizer_;                           //!< Non-deterministic random number generator with time information
-  static std::mt19937 mt_;                                         //!< Deterministic random number generator
-  static std::uniform_real_distribution<>* uniform_distribution_;  //!< Uniform random number generator
-  static std::normal_distribution<>* normal_distribution_;         //!< Normal random number generator
+  RandomizationType randomization_type_;                                       //!< Randomization type
+  static std::random_device randomizer_;                                       //!< Non-deterministic random number generator with time information
+  static thread_local std::mt19937 mt_;                                        //!< Deterministic random number generator
+  static thread_local std::uniform_real_distribution<> uniform_distribution_;  //!< Uniform random number generator
+  static thread_local std::normal_distribution<> normal_distribution_;         //!< Normal random number generator
 
   /**
    * @fn Generate1dUniform
@@ -5,6 +5,7 @@
 
 #include "initialize_monte_carlo_simulation.hpp"
 
+#include <cstdlib>
 #include <cstring>
 #include <library/initialize/initialize_file_access.hpp>
 
@@ -24,6 +25,15 @@ MonteCarloSimulationExecutor* InitMonteCarloSimulation(std::string file_name) {
   bool log_history = ini_file.ReadEnable(section, "log_enable");
   monte_carlo_simulator->SetSaveLogHistoryFlag(log_history);
 
+  MonteCarloParallelMode parallel_mode = ConvertMonteCarloParallelMode(ini_file.ReadString(section, "parallel_mode"));
+  unsigned int number_of_workers = ini_file.ReadInt(section, "number_of_parallel_workers");
+  monte_carlo_simulator->SetParallelMode(parallel_mode, number_of_workers);
+
+  bool is_deterministic_seed = ini_file.ReadEnable(section, "deterministic_seed_enable");
+  // The seed is read as a string since ReadInt cannot express the whole range of the 64 bit seed
+  unsigned long long seed = std::strtoull(ini_file.ReadString(section, "seed").c_str(), nullptr, 10);
+  monte_carlo_simulator->SetSeed(seed, is_deterministic_seed);
+
   section = "MONTE_CARLO_RANDOMIZATION";
   std::vector<std::string> so_dot_ip_str_vec = ini_file.ReadStrVector(section, "parameter");
   std::vector<std::string> so_str_vec, ip_str_vec;
@@ -5,6 +5,22 @@
 
 #include "monte_carlo_simulation_executor.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <library/randomization/global_randomization.hpp>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#ifndef WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 using std::string;
 
 MonteCarloSimulationExecutor::MonteCarloSimulationExecutor(unsigned long long total_num_of_executions)
@@ -12,6 +28,9 @@ MonteCarloSimulationExecutor::MonteCarloSimulationExecutor(unsigned long long to
   number_of_executions_done_ = 0;
   enabled_ = total_number_of_executions_ > 1 ? true : false;
   save_log_history_flag_ = !enabled_;
+  parallel_mode_ = MonteCarloParallelMode::kSequential;
+  number_of_workers_ = 0;
+  SetSeed();
 }
 
 bool MonteCarloSimulationExecutor::WillExecuteNextCase() {
@@ -41,7 +60,7 @@ void MonteCarloSimulationExecutor::GetInitializedMonteCarloParameterDouble(strin
       // Not registered in ip_list（Not defined in MCSim.ini）
       return;  // return without any update of destination
     } else {
-      init_parameter_list_.at(name)->GetRandomizedScalar(destination);  // cannot use operator[] since it is const map
+      init_parameter_list_.at(name).GetRandomizedScalar(destination);  // cannot use operator[] since it is const map
     }
   }
 }
@@ -55,17 +74,171 @@ void MonteCarloSimulationExecutor::GetInitializedMonteCarloParameterQuaternion(s
       // Not registered in ip_list（Not defined in MCSim.ini）
       return;  // return without any update of destination
     } else {
-      init_parameter_list_.at(name)->GetRandomizedQuaternion(destination);  // cannot use operator[] since it is const map
+      init_parameter_list_.at(name).GetRandomizedQuaternion(destination);  // cannot use operator[] since it is const map
     }
   }
 }
 
 void MonteCarloSimulationExecutor::RandomizeAllParameters() {
-  for (auto ip : init_parameter_list_) {
-    ip.second->Randomize();
+  // Reset the random number generators of this thread to make the results of the case independent from the execution order
+  const unsigned long case_seed = CalcCaseSeed(number_of_executions_done_);
+  InitializedMonteCarloParameters::SetSeed(case_seed, true);
+  global_randomization.SetSeed((long)(case_seed % (libra::MinimalStandardLcg::kM - 1)) + 1);  // The seed of the LCG must be in [1, kM-1]
+
+  for (auto& ip : init_parameter_list_) {
+    ip.second.Randomize();
+  }
+}
+
+void MonteCarloSimulationExecutor::SetSeed(unsigned long long seed, bool is_deterministic) {
+  if (is_deterministic) {
+    seed_ = seed;
+  } else {
+    std::random_device randomizer;
+    seed_ = randomizer();
+  }
+}
+
+unsigned long MonteCarloSimulationExecutor::CalcCaseSeed(const unsigned long long case_index) const {
+  // Mix the base seed and the case index to make independent streams for neighboring cases
+  std::seed_seq seed_sequence{(unsigned int)(seed_ & 0xffffffff), (unsigned int)(seed_ >> 32), (unsigned int)(case_index & 0xffffffff),
+                              (unsigned int)(case_index >> 32)};
+  unsigned int case_seed;
+  seed_sequence.generate(&case_seed, &case_seed + 1);
+  return case_seed;
+}
+
+void MonteCarloSimulationExecutor::Execute(const std::function<void(const MonteCarloSimulationExecutor&)>& run_case) {
+  if (!enabled_ || parallel_mode_ == MonteCarloParallelMode::kSequential || CalcNumberOfWorkers() <= 1) {
+    while (WillExecuteNextCase()) {
+      ExecuteCase(number_of_executions_done_, run_case);
+      AtTheEndOfEachCase();
+    }
+    return;
+  }
+
+  if (parallel_mode_ == MonteCarloParallelMode::kProcess) {
+#ifdef WIN32
+    std::cerr << "[WARNING] Monte-Carlo simulation: PROCESS mode is not supported on Windows. THREAD mode is used." << std::endl;
+    ExecuteWithThreads(run_case);
+#else
+    ExecuteWithProcesses(run_case);
+#endif
+  } else {
+    ExecuteWithThreads(run_case);
   }
+  number_of_executions_done_ = total_number_of_executions_;
 }
 
-void MonteCarloSimulationExecutor::SetSeed(unsigned long seed, bool is_deterministic) {
-  InitializedMonteCarloParameters::SetSeed(seed, is_deterministic);
+unsigned int MonteCarloSimulationExecutor::CalcNumberOfWorkers() const {
+  unsigned long long number_of_workers = number_of_workers_;
+  if (number_of_workers == 0) number_of_workers = std::thread::hardware_concurrency();
+  if (number_of_workers == 0) number_of_workers = 1;  // hardware_concurrency is not available
+  return (unsigned int)std::min(number_of_workers, total_number_of_executions_);
+}
+
+void MonteCarloSimulationExecutor::ExecuteCase(const unsigned long long case_index,
+                                               const std::function<void(const MonteCarloSimulationExecutor&)>& run_case) const {
+  // Each case has its own copy of the randomized parameters
+  MonteCarloSimulationExecutor case_executor = *this;
+  case_executor.number_of_executions_done_ = case_index;
+  case_executor.RandomizeAllParameters();
+  run_case(case_executor);
+}
+
+void MonteCarloSimulationExecutor::ExecuteWithThreads(const std::function<void(const MonteCarloSimulationExecutor&)>& run_case) {
+  std::atomic<unsigned long long> next_case_index(0);
+  std::exception_ptr first_exception = nullptr;
+  std::mutex exception_mutex;
+
+  auto worker = [&]() {
+    while (true) {
+      const unsigned long long case_index = next_case_index.fetch_add(1);
+      if (case_index >= total_number_of_executions_) break;
+      try {
+        ExecuteCase(case_index, run_case);
+      } catch (...) {
+        // Stop all workers and pass the exception to the calling thread
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (first_exception == nullptr) first_exception = std::current_exception();
+        next_case_index = total_number_of_executions_;
+        break;
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  const unsigned int number_of_workers = CalcNumberOfWorkers();
+  for (unsigned int i = 0; i < number_of_workers; i++) {
+    workers.push_back(std::thread(worker));
+  }
+  for (auto& thread : workers) {
+    thread.join();
+  }
+  if (first_exception != nullptr) std::rethrow_exception(first_exception);
+}
+
+#ifndef WIN32
+void MonteCarloSimulationExecutor::ExecuteWithProcesses(const std::function<void(const MonteCarloSimulationExecutor&)>& run_case) {
+  // Buffered outputs must be flushed before fork to avoid duplicated outputs from the workers
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+
+  const unsigned int number_of_workers = CalcNumberOfWorkers();
+  std::vector<pid_t> workers;
+  for (unsigned int worker_id = 0; worker_id < number_of_workers; worker_id++) {
+    pid_t pid = fork();
+    if (pid < 0) {
+      std::cerr << "[WARNING] Monte-Carlo simulation: fork failed. Remaining cases are executed with " << worker_id << " workers." << std::endl;
+      break;
+    }
+    if (pid == 0) {
+      // Worker process: execute cases assigned with the stride of the number of workers
+      int exit_status = 0;
+      try {
+        for (unsigned long long case_index = worker_id; case_index < total_number_of_executions_; case_index += number_of_workers) {
+          ExecuteCase(case_index, run_case);
+        }
+      } catch (...) {
+        std::cerr << "[ERROR] Monte-Carlo simulation: worker " << worker_id << " is terminated by an exception." << std::endl;
+        exit_status = 1;
+      }
+      std::cout.flush();
+      std::cerr.flush();
+      std::fflush(nullptr);
+      _exit(exit_status);  // Do not execute destructors of the objects copied from the calling process
+    }
+    workers.push_back(pid);
+  }
+
+  // Execute cases of the workers which could not be created in the calling process
+  for (unsigned int worker_id = (unsigned int)workers.size(); worker_id < number_of_workers; worker_id++) {
+    for (unsigned long long case_index = worker_id; case_index < total_number_of_executions_; case_index += number_of_workers) {
+      ExecuteCase(case_index, run_case);
+    }
+  }
+
+  bool is_all_succeeded = true;
+  for (auto pid : workers) {
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) is_all_succeeded = false;
+  }
+  if (!is_all_succeeded) throw std::runtime_error("Monte-Carlo simulation: some worker processes failed.");
+}
+#else
+void MonteCarloSimulationExecutor::ExecuteWithProcesses(const std::function<void(const MonteCarloSimulationExecutor&)>& run_case) {
+  ExecuteWithThreads(run_case);
+}
+#endif
+
+MonteCarloParallelMode ConvertMonteCarloParallelMode(const std::string mode) {
+  if (mode == "THREAD") {
+    return MonteCarloParallelMode::kThread;
+  } else if (mode == "PROCESS") {
+    return MonteCarloParallelMode::kProcess;
+  }
+  // if mode is unknown, set SEQUENTIAL
+  return MonteCarloParallelMode::kSequential;
 }
@@ -6,12 +6,31 @@
 #ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
 #define S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
 
+#include <functional>
 #include <library/math/vector.hpp>
 #include <map>
 #include <string>
 // #include "simulation_object.hpp"
 #include "initialize_monte_carlo_parameters.hpp"
 
+/**
+ * @enum MonteCarloParallelMode
+ * @brief Parallel execution mode of simulation cases
+ */
+enum class MonteCarloParallelMode {
+  kSequential,  //!< Execute cases one after another in the calling thread
+  kThread,      //!< Execute cases in worker threads of this process
+  kProcess,     //!< Execute cases in forked worker processes (POSIX only)
+};
+
+/**
+ * @fn ConvertMonteCarloParallelMode
+ * @brief Convert string to MonteCarloParallelMode
+ * @param [in] mode: Parallel mode name (SEQUENTIAL, THREAD, or PROCESS)
+ * @return Parallel mode. kSequential for unknown names.
+ */
+MonteCarloParallelMode ConvertMonteCarloParallelMode(const std::string mode);
+
 /**
  * @class MonteCarloSimulationExecutor
  * @brief Monte-Carlo Simulation Executor class
@@ -22,8 +41,34 @@ class MonteCarloSimulationExecutor {
   unsigned long long number_of_executions_done_;   //!< Number of executed case
   bool enabled_;                                   //!< Flag to execute Monte-Carlo Simulation or not
   bool save_log_history_flag_;                     //!< Flag to store the log for each case or not
+  unsigned long long seed_;                        //!< Base seed of randomization. The seed of each case is derived from this and the case index.
+  MonteCarloParallelMode parallel_mode_;           //!< Parallel execution mode
+  unsigned int number_of_workers_;                 //!< Number of worker threads or processes. 0 means the number of hardware threads.
 
-  std::map<std::string, InitializedMonteCarloParameters*> init_parameter_list_;  //!< List of InitializedMonteCarloParameters read from MCSim.ini
+  std::map<std::string, InitializedMonteCarloParameters> init_parameter_list_;  //!< List of InitializedMonteCarloParameters read from MCSim.ini
+
+  /**
+   * @fn CalcNumberOfWorkers
+   * @brief Return number of workers actually used for the parallel execution
+   */
+  unsigned int CalcNumberOfWorkers() const;
+  /**
+   * @fn ExecuteCase
+   * @brief Randomize parameters for the case and execute it with a copy of this executor
+   * @param [in] case_index: Index of the simulation case
+   * @param [in] run_case: Function to execute one simulation case
+   */
+  void ExecuteCase(const unsigned long long case_index, const std::function<void(const MonteCarloSimulationExecutor&)>& run_case) const;
+  /**
+   * @fn ExecuteWithThreads
+   * @brief Execute all cases with worker threads
+   */
+  void ExecuteWithThreads(const std::function<void(const MonteCarloSimulationExecutor&)>& run_case);
+  /**
+   * @fn ExecuteWithProcesses
+   * @brief Execute all cases with forked worker processes
+   */
+  void ExecuteWithProcesses(const std::function<void(const MonteCarloSimulationExecutor&)>& run_case);
 
  public:
   static const char separator_ = '.';  //!< Deliminator for name of SimulationObject and InitializedMonteCarloParameters in the initialization file
@@ -52,9 +97,19 @@ class MonteCarloSimulationExecutor {
   inline void SetSaveLogHistoryFlag(bool set) { save_log_history_flag_ = set; }
   /**
    * @fn SetSeed
-   * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
+   * @brief Set base seed of randomization. Use time infomation when is_deterministic = false.
    */
-  static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
+  void SetSeed(unsigned long long seed = 0, bool is_deterministic = false);
+  /**
+   * @fn SetParallelMode
+   * @brief Set parallel execution mode used in Execute
+   * @param [in] parallel_mode: Parallel execution mode
+   * @param [in] number_of_workers: Number of worker threads or processes. 0 means the number of hardware threads.
+   */
+  inline void SetParallelMode(const MonteCarloParallelMode parallel_mode, const unsigned int number_of_workers = 0) {
+    parallel_mode_ = parallel_mode;
+    number_of_workers_ = number_of_workers;
+  }
 
   // Getter
   /**
@@ -72,6 +127,17 @@ class MonteCarloSimulationExecutor {
    * @brief Return number of executed case
    */
   inline unsigned long long GetNumberOfExecutionsDone() const { return number_of_executions_done_; }
+  /**
+   * @fn GetParallelMode
+   * @brief Return parallel execution mode
+   */
+  inline MonteCarloParallelMode GetParallelMode() const { return parallel_mode_; }
+  /**
+   * @fn CalcCaseSeed
+   * @brief Return seed of the random number stream for the case
+   * @note The seed depends only on the base seed and the case index, so the randomized results do not depend on the execution order.
+   */
+  unsigned long CalcCaseSeed(const unsigned long long case_index) const;
   /**
    * @fn GetSaveLogHistoryFlag
    * @brief Return log history flag
@@ -132,8 +198,25 @@ class MonteCarloSimulationExecutor {
   /**
    * @fn RandomizeAllParameters
    * @brief Randomize all initialized parameter
+   * @note The random number generators of the calling thread are seeded with CalcCaseSeed(GetNumberOfExecutionsDone()) before the randomization.
    */
   void RandomizeAllParameters();
+
+  /**
+   * @fn Execute
+   * @brief Execute all simulation cases with the parallel mode
+   * @details Usage: create the executor with InitMonteCarloSimulation, and pass a function which constructs the user defined simulation case with
+   *          SimulationCase(initialize_base_file, executor, log_path) and calls Initialize and Main of it. This replaces the sequential loop of
+   *          WillExecuteNextCase, RandomizeAllParameters, and AtTheEndOfEachCase in the main function. The sample main function (s2e.cpp)
+   *          executes only one case since SampleCase does not have the constructor for the Monte-Carlo simulation.
+   * @param [in] run_case: Function to construct, initialize, and execute one simulation case.
+   *                       The argument is a copy of this executor which has randomized parameters of the case and the case index as the number of
+   *                       executed cases, so the case can be constructed in the same way as the sequential loop with WillExecuteNextCase.
+   * @note In the kThread mode, run_case is called concurrently from the worker threads. Objects shared between cases (e.g. the logger of the
+   *       Monte-Carlo results) must be protected by the caller. Each case must create its own SimulationCase and logger.
+   * @note In the kProcess mode, the worker processes do not share memory with the calling process. The results must be written to files in each case.
+   */
+  void Execute(const std::function<void(const MonteCarloSimulationExecutor&)>& run_case);
 };
 
 template <size_t NumElement>
@@ -145,7 +228,7 @@ void MonteCarloSimulationExecutor::GetInitializedMonteCarloParameterVector(std::
     // Not registered in ip_list（Not defined in MCSim.ini）
     return;  // return without update the destination
   } else {
-    init_parameter_list_.at(name)->GetRandomizedVector(destination);  // cannot use operator[] since it is const map
+    init_parameter_list_.at(name).GetRandomizedVector(destination);  // cannot use operator[] since it is const map
   }
 }
 
@@ -157,9 +240,7 @@ void MonteCarloSimulationExecutor::AddInitializedMonteCarloParameter(std::string
   std::string name = so_name + MonteCarloSimulationExecutor::separator_ + init_monte_carlo_parameter_name;
   if (init_parameter_list_.find(name) == init_parameter_list_.end()) {
     // Register the parameter in ip_list if it is not registered yet
-    auto newparam = new InitializedMonteCarloParameters();
-    newparam->SetRandomConfiguration(mean_or_min, sigma_or_max, random_type);
-    init_parameter_list_[name] = newparam;
+    init_parameter_list_[name].SetRandomConfiguration(mean_or_min, sigma_or_max, random_type);
   } else {
     // Throw error if the parameter is already registered
     throw "More than one definition of one InitializedMonteCarloParameters.";
@@ -0,0 +1,128 @@
+/**
+ * @file test_monte_carlo_simulation_executor.cpp
+ * @brief Test codes for MonteCarloSimulationExecutor class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "monte_carlo_simulation_executor.hpp"
+
+/**
+ * @fn MakeExecutor
+ * @brief Make an executor with a deterministic seed and a randomized parameter for the test
+ */
+MonteCarloSimulationExecutor MakeExecutor(const unsigned long long number_of_executions, const unsigned long long seed) {
+  MonteCarloSimulationExecutor executor(number_of_executions);
+  executor.SetSeed(seed, true);
+  libra::Vector<3> min{0.0};
+  libra::Vector<3> max{1.0};
+  executor.AddInitializedMonteCarloParameter("object", "parameter", min, max, InitializedMonteCarloParameters::kCartesianUniform);
+  return executor;
+}
+
+/**
+ * @fn ExecuteAndRecord
+ * @brief Execute all cases and return the randomized parameter of each case
+ */
+std::vector<libra::Vector<3>> ExecuteAndRecord(MonteCarloSimulationExecutor& executor, std::vector<size_t>& number_of_calls) {
+  const size_t number_of_executions = (size_t)executor.GetTotalNumberOfExecutions();
+  std::vector<libra::Vector<3>> parameters(number_of_executions, libra::Vector<3>(-1.0));
+  number_of_calls.assign(number_of_executions, 0);
+  std::mutex mutex;
+  executor.Execute([&](const MonteCarloSimulationExecutor& case_executor) {
+    libra::Vector<3> parameter(-1.0);
+    case_executor.GetInitializedMonteCarloParameterVector("object", "parameter", parameter);
+    std::lock_guard<std::mutex> lock(mutex);
+    const size_t case_index = (size_t)case_executor.GetNumberOfExecutionsDone();
+    parameters[case_index] = parameter;
+    number_of_calls[case_index]++;
+  });
+  return parameters;
+}
+
+/**
+ * @brief Test that the case seeds are deterministic and distinct
+ */
+TEST(MonteCarloSimulationExecutor, CalcCaseSeed) {
+  const unsigned long long kSeed = 0x123456789abcdefULL;  // Larger than 32 bit
+  MonteCarloSimulationExecutor executor = MakeExecutor(10, kSeed);
+  MonteCarloSimulationExecutor same_executor = MakeExecutor(10, kSeed);
+  MonteCarloSimulationExecutor other_executor = MakeExecutor(10, kSeed + (1ULL << 32));  // Differs only in the upper 32 bit
+
+  const unsigned long long kNumberOfCases = 10000;
+  std::set<unsigned long> case_seeds;
+  size_t number_of_same_seeds_with_other_base = 0;
+  for (unsigned long long case_index = 0; case_index < kNumberOfCases; case_index++) {
+    const unsigned long case_seed = executor.CalcCaseSeed(case_index);
+    EXPECT_EQ(case_seed, same_executor.CalcCaseSeed(case_index));
+    if (case_seed == other_executor.CalcCaseSeed(case_index)) number_of_same_seeds_with_other_base++;
+    case_seeds.insert(case_seed);
+  }
+  EXPECT_EQ(kNumberOfCases, case_seeds.size());
+  EXPECT_EQ(0, number_of_same_seeds_with_other_base);
+  // Upper bits of the case index are also used
+  EXPECT_NE(executor.CalcCaseSeed(0), executor.CalcCaseSeed(1ULL << 32));
+}
+
+/**
+ * @brief Test that the parallel execution gives the same randomized parameters as the sequential execution
+ */
+TEST(MonteCarloSimulationExecutor, ExecuteThread) {
+  const unsigned long long kNumberOfExecutions = 50;
+  MonteCarloSimulationExecutor sequential_executor = MakeExecutor(kNumberOfExecutions, 12345);
+  std::vector<size_t> sequential_calls;
+  const std::vector<libra::Vector<3>> sequential_parameters = ExecuteAndRecord(sequential_executor, sequential_calls);
+
+  MonteCarloSimulationExecutor thread_executor = MakeExecutor(kNumberOfExecutions, 12345);
+  thread_executor.SetParallelMode(MonteCarloParallelMode::kThread, 4);
+  std::vector<size_t> thread_calls;
+  const std::vector<libra::Vector<3>> thread_parameters = ExecuteAndRecord(thread_executor, thread_calls);
+
+  EXPECT_EQ(kNumberOfExecutions, sequential_executor.GetNumberOfExecutionsDone());
+  EXPECT_EQ(kNumberOfExecutions, thread_executor.GetNumberOfExecutionsDone());
+  for (size_t i = 0; i < kNumberOfExecutions; i++) {
+    EXPECT_EQ(1, sequential_calls[i]);
+    EXPECT_EQ(1, thread_calls[i]);
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_GE(sequential_parameters[i][j], 0.0);
+      EXPECT_LE(sequential_parameters[i][j], 1.0);
+      EXPECT_DOUBLE_EQ(sequential_parameters[i][j], thread_parameters[i][j]);
+    }
+  }
+  // Neighboring cases have different parameters
+  EXPECT_NE(sequential_parameters[0][0], sequential_parameters[1][0]);
+}
+
+/**
+ * @brief Test that an exception in a worker thread is passed to the caller
+ */
+TEST(MonteCarloSimulationExecutor, ExecuteThreadException) {
+  MonteCarloSimulationExecutor executor = MakeExecutor(20, 1);
+  executor.SetParallelMode(MonteCarloParallelMode::kThread, 4);
+  EXPECT_THROW(executor.Execute([](const MonteCarloSimulationExecutor& case_executor) {
+    if (case_executor.GetNumberOfExecutionsDone() == 7) throw std::runtime_error("test");
+  }),
+               std::runtime_error);
+}
+
+#ifndef WIN32
+/**
+ * @brief Test that a failure of a worker process is reported as std::runtime_error
+ */
+TEST(MonteCarloSimulationExecutor, ExecuteProcessFailure) {
+  MonteCarloSimulationExecutor executor = MakeExecutor(4, 1);
+  executor.SetParallelMode(MonteCarloParallelMode::kProcess, 2);
+  EXPECT_NO_THROW(executor.Execute([](const MonteCarloSimulationExecutor& case_executor) { static_cast<void>(case_executor); }));
+
+  MonteCarloSimulationExecutor failing_executor = MakeExecutor(4, 1);
+  failing_executor.SetParallelMode(MonteCarloParallelMode::kProcess, 2);
+  EXPECT_THROW(failing_executor.Execute([](const MonteCarloSimulationExecutor& case_executor) {
+    if (case_executor.GetNumberOfExecutionsDone() == 3) throw std::runtime_error("test");
+  }),
+               std::runtime_error);
+}
+#endif
@@ -10,30 +10,13 @@ RelativeInformation::RelativeInformation() {}
 RelativeInformation::~RelativeInformation() {}
 
 void RelativeInformation::Update() {
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < dynamics_database_.size(); reference_spacecraft_id++) {
-      // Position
-      libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-      libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-      relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id] = target_sat_pos_i - reference_sat_pos_i;
-      relative_position_list_rtn_m_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id);
-
-      // Distance
-      relative_distance_list_m_[target_spacecraft_id][reference_spacecraft_id] =
-          relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id].CalcNorm();
-
-      // Velocity
-      libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-      libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-      relative_velocity_list_i_m_s_[target_spacecraft_id][reference_spacecraft_id] = target_sat_vel_i - reference_sat_vel_i;
-      relative_velocity_list_rtn_m_s_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id);
-
-      // Attitude Quaternion
-      relative_attitude_quaternion_list_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativeAttitudeQuaternion(target_spacecraft_id, reference_spacecraft_id);
-    }
+  update_count_++;
+  for (size_t spacecraft_id = 0; spacecraft_id < dynamics_list_.size(); spacecraft_id++) {
+    const Dynamics* dynamics = dynamics_list_[spacecraft_id];
+    if (dynamics == nullptr) continue;
+    position_list_i_m_[spacecraft_id] = dynamics->GetOrbit().GetPosition_i_m();
+    velocity_list_i_m_s_[spacecraft_id] = dynamics->GetOrbit().GetVelocity_i_m_s();
+    quaternion_list_i2b_[spacecraft_id] = dynamics->GetAttitude().GetQuaternion_i2b();
   }
 }
 
@@ -81,6 +64,7 @@ std::string RelativeInformation::GetLogHeader() const {
 }
 
 std::string RelativeInformation::GetLogValue() const {
+  UpdateRtnFrames();
   std::string str_tmp = "";
   for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
     for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
@@ -96,70 +80,116 @@ std::string RelativeInformation::GetLogValue() const {
 
   for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
     for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(GetRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id));
+      str_tmp += WriteVector(CalcRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id));
     }
   }
 
   for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
     for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(GetRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id));
+      str_tmp += WriteVector(CalcRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id));
     }
   }
 
   return str_tmp;
 }
 
+void RelativeInformation::AppendLogValue(std::vector<double>& values) const {
+  UpdateRtnFrames();
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+      AppendVector(values, GetRelativePosition_i_m(target_spacecraft_id, reference_spacecraft_id));
+    }
+  }
+
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+      AppendVector(values, GetRelativeVelocity_i_m_s(target_spacecraft_id, reference_spacecraft_id));
+    }
+  }
+
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+      AppendVector(values, CalcRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id));
+    }
+  }
+
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+      AppendVector(values, CalcRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id));
+    }
+  }
+}
+
 void RelativeInformation::LogSetup(Logger& logger) { logger.AddLogList(this); }
 
-libra::Quaternion RelativeInformation::CalcRelativeAttitudeQuaternion(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) {
+libra::Quaternion RelativeInformation::GetRelativeAttitudeQuaternion(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
   // Observer SC Body frame(obs_sat) -> ECI frame(i)
-  libra::Quaternion q_reference_i2b = dynamics_database_.at(reference_spacecraft_id)->GetAttitude().GetQuaternion_i2b();
-  libra::Quaternion q_reference_b2i = q_reference_i2b.Conjugate();
+  libra::Quaternion q_reference_b2i = quaternion_list_i2b_[reference_spacecraft_id].Conjugate();
 
   // ECI frame(i) -> Target SC body frame(main_sat)
-  libra::Quaternion q_target_i2b = dynamics_database_.at(target_spacecraft_id)->GetAttitude().GetQuaternion_i2b();
+  return quaternion_list_i2b_[target_spacecraft_id] * q_reference_b2i;
+}
+
+libra::Vector<3> RelativeInformation::GetRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
+  UpdateRtnFrame(reference_spacecraft_id);
+  return CalcRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id);
+}
 
-  return q_target_i2b * q_reference_b2i;
+libra::Vector<3> RelativeInformation::GetRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
+  UpdateRtnFrame(reference_spacecraft_id);
+  return CalcRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id);
 }
 
-libra::Vector<3> RelativeInformation::CalcRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
+libra::Vector<3> RelativeInformation::CalcRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
+  return quaternion_list_i2rtn_[reference_spacecraft_id].FrameConversion(GetRelativePosition_i_m(target_spacecraft_id, reference_spacecraft_id));
+}
 
-  // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().CalcQuaternion_i2lvlh();
+libra::Vector<3> RelativeInformation::CalcRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
+  libra::Vector<3> relative_pos_i = GetRelativePosition_i_m(target_spacecraft_id, reference_spacecraft_id);
+  libra::Vector<3> relative_vel_i = GetRelativeVelocity_i_m_s(target_spacecraft_id, reference_spacecraft_id) -
+                                    cross(rtn_rotation_list_i_rad_s_[reference_spacecraft_id], relative_pos_i);
+  return quaternion_list_i2rtn_[reference_spacecraft_id].FrameConversion(relative_vel_i);
+}
 
-  libra::Vector<3> relative_pos_rtn = q_i2rtn.FrameConversion(relative_pos_i);
-  return relative_pos_rtn;
+void RelativeInformation::UpdateRtnFrame(const size_t spacecraft_id) const {
+  std::lock_guard<std::mutex> lock(rtn_frame_mutex_);
+  CalcRtnFrame(spacecraft_id);
 }
 
-libra::Vector<3> RelativeInformation::CalcRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
+void RelativeInformation::UpdateRtnFrames() const {
+  std::lock_guard<std::mutex> lock(rtn_frame_mutex_);
+  for (size_t spacecraft_id = 0; spacecraft_id < rtn_frame_update_counts_.size(); spacecraft_id++) {
+    CalcRtnFrame(spacecraft_id);
+  }
+}
 
+void RelativeInformation::CalcRtnFrame(const size_t spacecraft_id) const {
+  if (rtn_frame_update_counts_[spacecraft_id] == update_count_) return;
+  const libra::Vector<3>& reference_sat_pos_i = position_list_i_m_[spacecraft_id];
+  const libra::Vector<3>& reference_sat_vel_i = velocity_list_i_m_s_[spacecraft_id];
   // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().CalcQuaternion_i2lvlh();
+  quaternion_list_i2rtn_[spacecraft_id] = Orbit::CalcQuaternion_i2lvlh(reference_sat_pos_i, reference_sat_vel_i);
 
   // Rotation vector of RTN frame
-  libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-  libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
   libra::Vector<3> rot_vec_rtn_i = cross(reference_sat_pos_i, reference_sat_vel_i);
   double r2_ref = reference_sat_pos_i.CalcNorm() * reference_sat_pos_i.CalcNorm();
   rot_vec_rtn_i /= r2_ref;
-  libra::Vector<3> relative_vel_i = target_sat_vel_i - reference_sat_vel_i - cross(rot_vec_rtn_i, relative_pos_i);
-
-  libra::Vector<3> relative_vel_rtn = q_i2rtn.FrameConversion(relative_vel_i);
-  return relative_vel_rtn;
+  rtn_rotation_list_i_rad_s_[spacecraft_id] = rot_vec_rtn_i;
+  rtn_frame_update_counts_[spacecraft_id] = update_count_;
 }
 
 void RelativeInformation::ResizeLists() {
-  size_t size = dynamics_database_.size();
-  relative_position_list_i_m_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_velocity_list_i_m_s_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_distance_list_m_.assign(size, std::vector<double>(size, 0.0));
-  relative_position_list_rtn_m_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_velocity_list_rtn_m_s_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_attitude_quaternion_list_.assign(size, std::vector<libra::Quaternion>(size, libra::Quaternion(0, 0, 0, 1)));
+  size_t size = dynamics_database_.empty() ? 0 : dynamics_database_.rbegin()->first + 1;
+  dynamics_list_.assign(size, nullptr);
+  for (const auto& dynamics : dynamics_database_) {
+    dynamics_list_[dynamics.first] = dynamics.second;
+  }
+  position_list_i_m_.assign(size, libra::Vector<3>(0));
+  velocity_list_i_m_s_.assign(size, libra::Vector<3>(0));
+  quaternion_list_i2b_.assign(size, libra::Quaternion(0, 0, 0, 1));
+
+  std::lock_guard<std::mutex> lock(rtn_frame_mutex_);
+  rtn_frame_update_counts_.assign(size, update_count_);
+  quaternion_list_i2rtn_.assign(size, libra::Quaternion(0, 0, 0, 1));
+  rtn_rotation_list_i_rad_s_.assign(size, libra::Vector<3>(0));
 }
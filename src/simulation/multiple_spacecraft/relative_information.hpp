@@ -6,6 +6,7 @@
 #ifndef S2E_MULTIPLE_SPACECRAFT_RELATIVE_INFORMATION_HPP_
 #define S2E_MULTIPLE_SPACECRAFT_RELATIVE_INFORMATION_HPP_
 
+#include <mutex>
 #include <string>
 
 #include "../../dynamics/dynamics.hpp"
@@ -15,6 +16,9 @@
 /**
  * @class RelativeInformation
  * @brief Base class to manage relative information between spacecraft
+ * @note Update takes a snapshot of the states of all spacecraft, and the relative values are derived from the snapshot at the query.
+ *       The cost of Update is linear in the number of spacecraft, and only the queried or logged pairs are calculated.
+ *       The RTN frame of each spacecraft is calculated at the first query after Update and reused for all pairs.
  */
 class RelativeInformation : public ILoggable {
  public:
@@ -59,6 +63,11 @@ class RelativeInformation : public ILoggable {
    * @brief Override function of GetLogValue
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
   /**
    * @fn LogSetup
@@ -73,9 +82,7 @@ class RelativeInformation : public ILoggable {
    * @param [in] target_spacecraft_id: ID of target spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  inline libra::Quaternion GetRelativeAttitudeQuaternion(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_attitude_quaternion_list_[target_spacecraft_id][reference_spacecraft_id];
-  }
+  libra::Quaternion GetRelativeAttitudeQuaternion(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
   /**
    * @fn GetRelativePosition_i_m
    * @brief Return relative position of the target spacecraft with respect to the reference spacecraft in the inertial frame and unit [m]
@@ -83,7 +90,7 @@ class RelativeInformation : public ILoggable {
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
   inline libra::Vector<3> GetRelativePosition_i_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id];
+    return position_list_i_m_[target_spacecraft_id] - position_list_i_m_[reference_spacecraft_id];
   }
   /**
    * @fn GetRelativeVelocity_i_m
@@ -92,7 +99,7 @@ class RelativeInformation : public ILoggable {
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
   inline libra::Vector<3> GetRelativeVelocity_i_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_velocity_list_i_m_s_[target_spacecraft_id][reference_spacecraft_id];
+    return velocity_list_i_m_s_[target_spacecraft_id] - velocity_list_i_m_s_[reference_spacecraft_id];
   }
   /**
    * @fn GetRelativeDistance_m
@@ -101,7 +108,7 @@ class RelativeInformation : public ILoggable {
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
   inline double GetRelativeDistance_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_distance_list_m_[target_spacecraft_id][reference_spacecraft_id];
+    return GetRelativePosition_i_m(target_spacecraft_id, reference_spacecraft_id).CalcNorm();
   };
   /**
    * @fn GetRelativePosition_rtn_m
@@ -109,18 +116,14 @@ class RelativeInformation : public ILoggable {
    * @param [in] target_spacecraft_id: ID of target spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  inline libra::Vector<3> GetRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_position_list_rtn_m_[target_spacecraft_id][reference_spacecraft_id];
-  }
+  libra::Vector<3> GetRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
   /**
    * @fn GetRelativeVelocity_rtn_m_s
    * @brief Return relative velocity of the target spacecraft with respect to the reference spacecraft in the RTN frame of the reference spacecraft
    * @param [in] target_spacecraft_id: ID of target spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  inline libra::Vector<3> GetRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_velocity_list_rtn_m_s_[target_spacecraft_id][reference_spacecraft_id];
-  }
+  libra::Vector<3> GetRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
 
   /**
    * @fn GetReferenceSatDynamics
@@ -134,34 +137,51 @@ class RelativeInformation : public ILoggable {
  private:
   std::map<const size_t, const Dynamics*> dynamics_database_;  //!< Dynamics database of all spacecraft
 
-  std::vector<std::vector<libra::Vector<3>>> relative_position_list_i_m_;          //!< Relative position list in the inertial frame in unit [m]
-  std::vector<std::vector<libra::Vector<3>>> relative_velocity_list_i_m_s_;        //!< Relative velocity list in the inertial frame in unit [m/s]
-  std::vector<std::vector<libra::Vector<3>>> relative_position_list_rtn_m_;        //!< Relative position list in the RTN frame in unit [m]
-  std::vector<std::vector<libra::Vector<3>>> relative_velocity_list_rtn_m_s_;      //!< Relative velocity list in the RTN frame in unit [m/s]
-  std::vector<std::vector<double>> relative_distance_list_m_;                      //!< Relative distance list in unit [m]
-  std::vector<std::vector<libra::Quaternion>> relative_attitude_quaternion_list_;  //!< Relative attitude quaternion list
+  std::vector<const Dynamics*> dynamics_list_;  //!< Dynamics indexed by the spacecraft ID (nullptr for unregistered IDs)
+
+  // Snapshot of the states at Update indexed by the spacecraft ID
+  std::vector<libra::Vector<3>> position_list_i_m_;     //!< Position list in the inertial frame in unit [m]
+  std::vector<libra::Vector<3>> velocity_list_i_m_s_;   //!< Velocity list in the inertial frame in unit [m/s]
+  std::vector<libra::Quaternion> quaternion_list_i2b_;  //!< Attitude quaternion list from the inertial frame to the body frame
+  size_t update_count_ = 0;                             //!< Number of Update calls to validate the RTN frame cache
+
+  // RTN frames calculated at the first query after Update
+  mutable std::mutex rtn_frame_mutex_;                               //!< Mutex for the RTN frame cache
+  mutable std::vector<size_t> rtn_frame_update_counts_;              //!< update_count_ at the calculation of each RTN frame
+  mutable std::vector<libra::Quaternion> quaternion_list_i2rtn_;     //!< Quaternion list from the inertial frame to the RTN frame
+  mutable std::vector<libra::Vector<3>> rtn_rotation_list_i_rad_s_;  //!< Angular velocity list of the RTN frame in the inertial frame [rad/s]
 
   /**
-   * @fn CalcRelativeAttitudeQuaternion
-   * @brief Calculate and return the relative attitude quaternion
-   * @param [in] target_spacecraft_id: ID of the spacecraft
-   * @param [in] reference_spacecraft_id: ID of reference spacecraft
+   * @fn UpdateRtnFrame
+   * @brief Calculate the RTN frame of the spacecraft when it is not calculated after the last Update
+   * @param [in] spacecraft_id: ID of the spacecraft
+   */
+  void UpdateRtnFrame(const size_t spacecraft_id) const;
+  /**
+   * @fn UpdateRtnFrames
+   * @brief Calculate the RTN frames of all spacecraft which are not calculated after the last Update
+   */
+  void UpdateRtnFrames() const;
+  /**
+   * @fn CalcRtnFrame
+   * @brief Calculate the RTN frame of the spacecraft from the snapshot. rtn_frame_mutex_ must be locked.
+   * @param [in] spacecraft_id: ID of the spacecraft
    */
-  libra::Quaternion CalcRelativeAttitudeQuaternion(const size_t target_spacecraft_id, const size_t reference_spacecraft_id);
+  void CalcRtnFrame(const size_t spacecraft_id) const;
   /**
    * @fn CalcRelativePosition_rtn_m
-   * @brief Calculate and return the relative position in RTN frame
+   * @brief Calculate and return the relative position in RTN frame. The RTN frame of the reference must be updated.
    * @param [in] target_spacecraft_id: ID of the spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  libra::Vector<3> CalcRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id);
+  libra::Vector<3> CalcRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
   /**
    * @fn CalcRelativeVelocity_rtn_m_s
-   * @brief Calculate and return the relative velocity in RTN frame
+   * @brief Calculate and return the relative velocity in RTN frame. The RTN frame of the reference must be updated.
    * @param [in] target_spacecraft_id: ID of the spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  libra::Vector<3> CalcRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id);
+  libra::Vector<3> CalcRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
 
   /**
    * @fn ResizeLists
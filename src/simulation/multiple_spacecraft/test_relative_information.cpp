@@ -0,0 +1,228 @@
+/**
+ * @file test_relative_information.cpp
+ * @brief Test codes for RelativeInformation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <dynamics/attitude/attitude_rk4.hpp>
+#include <dynamics/orbit/rk4_orbit_propagation.hpp>
+#include <memory>
+#include <vector>
+
+#include "relative_information.hpp"
+
+namespace {
+const double kGravityConstant_m3_s2 = 3.986004418e14;  //!< Gravity constant of the Earth [m3/s2]
+const size_t kSpacecraftNumber = 4;                    //!< Number of the spacecraft
+const double kPositionTolerance_m = 1e-6;              //!< Tolerance of the position [m]
+const double kVelocityTolerance_m_s = 1e-9;            //!< Tolerance of the velocity [m/s]
+const double kQuaternionTolerance = 1e-12;             //!< Tolerance of the quaternion elements
+
+/**
+ * @brief Relative values of a pair calculated directly from the dynamics in the same way as the former RelativeInformation::Update
+ */
+struct RelativeValues {
+  libra::Vector<3> position_i_m{0.0};
+  libra::Vector<3> velocity_i_m_s{0.0};
+  double distance_m = 0.0;
+  libra::Vector<3> position_rtn_m{0.0};
+  libra::Vector<3> velocity_rtn_m_s{0.0};
+  libra::Quaternion quaternion{0.0, 0.0, 0.0, 1.0};
+};
+
+/**
+ * @brief Calculate the relative values of the target spacecraft with respect to the reference spacecraft from the current dynamics
+ */
+RelativeValues CalcReferenceValues(const Dynamics& target, const Dynamics& reference) {
+  RelativeValues values;
+  const libra::Vector<3> target_sat_pos_i = target.GetOrbit().GetPosition_i_m();
+  const libra::Vector<3> reference_sat_pos_i = reference.GetOrbit().GetPosition_i_m();
+  const libra::Vector<3> target_sat_vel_i = target.GetOrbit().GetVelocity_i_m_s();
+  const libra::Vector<3> reference_sat_vel_i = reference.GetOrbit().GetVelocity_i_m_s();
+  values.position_i_m = target_sat_pos_i - reference_sat_pos_i;
+  values.velocity_i_m_s = target_sat_vel_i - reference_sat_vel_i;
+  values.distance_m = values.position_i_m.CalcNorm();
+
+  // RTN frame for the reference satellite
+  const libra::Quaternion q_i2rtn = reference.GetOrbit().CalcQuaternion_i2lvlh();
+  values.position_rtn_m = q_i2rtn.FrameConversion(values.position_i_m);
+  libra::Vector<3> rot_vec_rtn_i = cross(reference_sat_pos_i, reference_sat_vel_i);
+  const double r2_ref = reference_sat_pos_i.CalcNorm() * reference_sat_pos_i.CalcNorm();
+  rot_vec_rtn_i /= r2_ref;
+  values.velocity_rtn_m_s = q_i2rtn.FrameConversion(values.velocity_i_m_s - cross(rot_vec_rtn_i, values.position_i_m));
+
+  values.quaternion = target.GetAttitude().GetQuaternion_i2b() * reference.GetAttitude().GetQuaternion_i2b().Conjugate();
+  return values;
+}
+
+/**
+ * @brief Spacecraft with the orbit and the attitude propagated in the test
+ */
+class RelativeInformationTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Only the center body is used, so the SPICE kernels are not needed.
+    // CelestialInformation takes the ownership of the array of the selected body IDs.
+    celestial_information_ = std::make_unique<CelestialInformation>("J2000", "NONE", "EARTH", 0, new int[0], std::vector<std::string>());
+
+    inertia_tensor_kgm2_[0][0] = 1.0;
+    inertia_tensor_kgm2_[1][1] = 2.0;
+    inertia_tensor_kgm2_[2][2] = 3.0;
+    for (size_t i = 0; i < kSpacecraftNumber; i++) {
+      // Slightly different orbits in a formation
+      libra::Vector<3> position_i_m(0.0);
+      position_i_m[0] = 6878137.0 + 100.0 * i;
+      position_i_m[2] = 50.0 * i * i;
+      libra::Vector<3> velocity_i_m_s(0.0);
+      velocity_i_m_s[1] = 7612.6 - 0.1 * i;
+      velocity_i_m_s[2] = 0.05 * i;
+      orbits_.push_back(new Rk4OrbitPropagation(celestial_information_.get(), kGravityConstant_m3_s2, 1.0, position_i_m, velocity_i_m_s));
+      orbits_[i]->SetIsCalcEnabled(true);
+
+      // Different tumbling attitudes
+      libra::Vector<3> angular_velocity_b_rad_s(0.0);
+      angular_velocity_b_rad_s[0] = 0.01 * (i + 1);
+      angular_velocity_b_rad_s[1] = -0.02;
+      angular_velocity_b_rad_s[2] = 0.005 * i;
+      libra::Quaternion quaternion_i2b(0.1 * i, -0.2, 0.3, 1.0);
+      quaternion_i2b = quaternion_i2b.Normalize();
+      attitudes_.push_back(new AttitudeRk4(angular_velocity_b_rad_s, quaternion_i2b, inertia_tensor_kgm2_, libra::Vector<3>(0.0), 0.1,
+                                           "attitude" + std::to_string(i)));
+
+      // The ownership of the attitude and the orbit is moved to the dynamics
+      dynamics_.push_back(std::make_unique<Dynamics>(attitudes_[i], orbits_[i]));
+      relative_information_.RegisterDynamicsInfo(i, dynamics_[i].get());
+    }
+  }
+
+  /**
+   * @brief Move all spacecraft to the time
+   */
+  void Propagate(const double end_time_s) {
+    for (size_t i = 0; i < kSpacecraftNumber; i++) {
+      orbits_[i]->Propagate(end_time_s, 0.0);
+      attitudes_[i]->Propagate(end_time_s);
+    }
+  }
+
+  /**
+   * @brief Return the reference values of all pairs indexed by [target][reference] from the current dynamics
+   */
+  std::vector<std::vector<RelativeValues>> CalcReferenceValueTable() const {
+    std::vector<std::vector<RelativeValues>> table(kSpacecraftNumber, std::vector<RelativeValues>(kSpacecraftNumber));
+    for (size_t target = 0; target < kSpacecraftNumber; target++) {
+      for (size_t reference = 0; reference < kSpacecraftNumber; reference++) {
+        table[target][reference] = CalcReferenceValues(*dynamics_[target], *dynamics_[reference]);
+      }
+    }
+    return table;
+  }
+
+  /**
+   * @brief Compare the queries of all pairs with the reference values
+   */
+  void ExpectQueriedValues(const std::vector<std::vector<RelativeValues>>& table) const {
+    for (size_t target = 0; target < kSpacecraftNumber; target++) {
+      for (size_t reference = 0; reference < kSpacecraftNumber; reference++) {
+        SCOPED_TRACE("target " + std::to_string(target) + ", reference " + std::to_string(reference));
+        const RelativeValues& expected = table[target][reference];
+        const libra::Vector<3> position_i_m = relative_information_.GetRelativePosition_i_m(target, reference);
+        const libra::Vector<3> velocity_i_m_s = relative_information_.GetRelativeVelocity_i_m_s(target, reference);
+        const libra::Vector<3> position_rtn_m = relative_information_.GetRelativePosition_rtn_m(target, reference);
+        const libra::Vector<3> velocity_rtn_m_s = relative_information_.GetRelativeVelocity_rtn_m_s(target, reference);
+        const libra::Quaternion quaternion = relative_information_.GetRelativeAttitudeQuaternion(target, reference);
+        EXPECT_NEAR(expected.distance_m, relative_information_.GetRelativeDistance_m(target, reference), kPositionTolerance_m);
+        for (size_t axis = 0; axis < 3; axis++) {
+          EXPECT_NEAR(expected.position_i_m[axis], position_i_m[axis], kPositionTolerance_m);
+          EXPECT_NEAR(expected.velocity_i_m_s[axis], velocity_i_m_s[axis], kVelocityTolerance_m_s);
+          EXPECT_NEAR(expected.position_rtn_m[axis], position_rtn_m[axis], kPositionTolerance_m);
+          EXPECT_NEAR(expected.velocity_rtn_m_s[axis], velocity_rtn_m_s[axis], kVelocityTolerance_m_s);
+        }
+        for (size_t element = 0; element < 4; element++) {
+          EXPECT_NEAR(expected.quaternion[element], quaternion[element], kQuaternionTolerance);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Compare the log values with the reference values
+   */
+  void ExpectLogValues(const std::vector<std::vector<RelativeValues>>& table) const {
+    // The order of the log is the same as GetLogHeader
+    std::vector<double> expected;
+    std::vector<double> tolerances;
+    auto append = [&](const libra::Vector<3>& vector, const double tolerance) {
+      for (size_t axis = 0; axis < 3; axis++) {
+        expected.push_back(vector[axis]);
+        tolerances.push_back(tolerance);
+      }
+    };
+    for (size_t target = 0; target < kSpacecraftNumber; target++) {
+      for (size_t reference = 0; reference < target; reference++) append(table[target][reference].position_i_m, kPositionTolerance_m);
+    }
+    for (size_t target = 0; target < kSpacecraftNumber; target++) {
+      for (size_t reference = 0; reference < target; reference++) append(table[target][reference].velocity_i_m_s, kVelocityTolerance_m_s);
+    }
+    for (size_t target = 0; target < kSpacecraftNumber; target++) {
+      for (size_t reference = 0; reference < target; reference++) append(table[target][reference].position_rtn_m, kPositionTolerance_m);
+    }
+    for (size_t target = 0; target < kSpacecraftNumber; target++) {
+      for (size_t reference = 0; reference < target; reference++) append(table[target][reference].velocity_rtn_m_s, kVelocityTolerance_m_s);
+    }
+
+    std::vector<double> values;
+    relative_information_.AppendLogValue(values);
+    ASSERT_EQ(expected.size(), values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+      EXPECT_NEAR(expected[i], values[i], tolerances[i]);
+    }
+  }
+
+  std::unique_ptr<CelestialInformation> celestial_information_;  //!< Celestial information with the Earth only
+  libra::Matrix<3, 3> inertia_tensor_kgm2_{0.0};                 //!< Inertia tensor referred by the attitudes [kg m^2]
+  std::vector<Rk4OrbitPropagation*> orbits_;                     //!< Orbits owned by the dynamics
+  std::vector<AttitudeRk4*> attitudes_;                          //!< Attitudes owned by the dynamics
+  std::vector<std::unique_ptr<Dynamics>> dynamics_;              //!< Dynamics of the spacecraft
+  RelativeInformation relative_information_;                     //!< Target of the test
+};
+}  // namespace
+
+/**
+ * @brief Test the queries of all pairs just after Update without logging
+ */
+TEST_F(RelativeInformationTest, QueryAfterUpdate) {
+  Propagate(10.0);
+  relative_information_.Update();
+  const std::vector<std::vector<RelativeValues>> table = CalcReferenceValueTable();
+  ExpectQueriedValues(table);
+  ExpectLogValues(table);
+}
+
+/**
+ * @brief Test the queries and the log after the spacecraft move again
+ */
+TEST_F(RelativeInformationTest, QueryAfterMove) {
+  Propagate(10.0);
+  relative_information_.Update();
+  const std::vector<std::vector<RelativeValues>> first_table = CalcReferenceValueTable();
+  ExpectQueriedValues(first_table);
+
+  // The values are kept until the next Update even when the spacecraft move
+  Propagate(600.0);
+  ExpectQueriedValues(first_table);
+
+  // The RTN frames calculated for the first Update must not be reused
+  relative_information_.Update();
+  const std::vector<std::vector<RelativeValues>> second_table = CalcReferenceValueTable();
+  EXPECT_GT(std::abs(second_table[1][0].position_rtn_m[0] - first_table[1][0].position_rtn_m[0]), 1.0);
+  ExpectLogValues(second_table);
+  ExpectQueriedValues(second_table);
+
+  // Query before logging for the next Update
+  Propagate(1200.0);
+  relative_information_.Update();
+  const std::vector<std::vector<RelativeValues>> third_table = CalcReferenceValueTable();
+  ExpectQueriedValues(third_table);
+  ExpectLogValues(third_table);
+}
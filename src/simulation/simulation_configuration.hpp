@@ -28,6 +28,8 @@ struct SimulationConfiguration {
   std::string inter_sc_communication_file_;  //!< File name for inter-satellite communication initialization
   std::string gnss_file_;                    //!< File name for GNSS initialization
 
+  unsigned int number_of_threads_ = 0;  //!< Number of threads to update spacecraft (0 or 1: serial update)
+
   /**
    * @fn ~SimulationConfiguration
    * @brief Destructor
@@ -27,7 +27,8 @@ void SampleCase::InitializeTargetObjects() {
 
 void SampleCase::UpdateTargetObjects() {
   // Spacecraft Update
-  sample_spacecraft_->Update(&(global_environment_->GetSimulationTime()));
+  // Add all spacecraft to the list to update them in parallel. Update RelativeInformation and inter-satellite communication after this.
+  UpdateSpacecraft({sample_spacecraft_});
   // Ground Station Update
   sample_ground_station_->Update(global_environment_->GetCelestialInformation().GetEarthRotation(), *sample_spacecraft_);
 }
@@ -47,3 +48,7 @@ std::string SampleCase::GetLogValue() const {
 
   return str_tmp;
 }
+
+void SampleCase::AppendLogValue(std::vector<double>& values) const {
+  AppendScalar(values, global_environment_->GetSimulationTime().GetElapsedTime_s());
+}
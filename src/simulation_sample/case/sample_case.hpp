@@ -39,6 +39,11 @@ class SampleCase : public SimulationCase {
    * @brief Override function of GetLogValue
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::vector<double>& values) const;
 
  private:
   SampleSpacecraft* sample_spacecraft_;         //!< Instance of spacecraft